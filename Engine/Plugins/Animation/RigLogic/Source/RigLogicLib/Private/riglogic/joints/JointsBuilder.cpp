@@ -3,11 +3,34 @@
 #include "riglogic/joints/JointsBuilder.h"
 
 #include "riglogic/TypeDefs.h"
+#include "riglogic/joints/JointsBuilderAVX.h"
 #include "riglogic/joints/bpcm/Builder.h"
 #include "riglogic/system/simd/Detect.h"
 
 namespace rl4 {
 
+#ifdef RL_JOINTS_AVX_DISPATCH
+// AVX is only used when the running CPU and OS support it (and F16C for half float storage), otherwise the request
+// falls back to SSE, so the same binary runs on SSE-only and AVX machines.
+//
+// Builds that don't require F16C still store the joint matrices as half floats, at half the memory and bandwidth,
+// when the running CPU can convert them. Every CPU with F16C also has AVX, so the AVX builder covers all of them; SSE
+// requests keep float storage, as their trimd types are compiled without F16C.
+JointsBuilderSelection selectJointsBuilder(CalculationType requested, const simd::CPUFeatures& features) {
+    #ifdef RL_USE_HALF_FLOATS
+        const bool avxSupported = features.avx && features.f16c;
+        const bool halfFloats = true;
+    #else
+        const bool avxSupported = features.avx;
+        const bool halfFloats = features.f16c;
+    #endif  // RL_USE_HALF_FLOATS
+    if ((requested == CalculationType::AVX) && !avxSupported) {
+        return {CalculationType::SSE, false};
+    }
+    return {requested, halfFloats};
+}
+#endif  // RL_JOINTS_AVX_DISPATCH
+
 JointsBuilder::~JointsBuilder() = default;
 
 JointsBuilder::Pointer JointsBuilder::create(Configuration config, MemoryResource* memRes) {
@@ -31,22 +54,32 @@ JointsBuilder::Pointer JointsBuilder::create(Configuration config, MemoryResourc
         #pragma clang diagnostic pop
     #endif
 
-    // Work around unused parameter warning when building without SSE and AVX
-    static_cast<void>(config);
+    #ifdef RL_JOINTS_AVX_DISPATCH
+        const JointsBuilderSelection selection = selectJointsBuilder(config.calculationType, simd::getCPUFeatures());
+        const CalculationType calculationType = selection.calculationType;
+    #else
+        const CalculationType calculationType = config.calculationType;
+    #endif  // RL_JOINTS_AVX_DISPATCH
+    // Work around unused variable warning when building without SSE and AVX
+    static_cast<void>(calculationType);
     #ifdef RL_BUILD_WITH_SSE
-        if (config.calculationType == CalculationType::SSE) {
+        if (calculationType == CalculationType::SSE) {
             using SSEJointsBuilder = bpcm::BPCMJointsBuilder<StorageType, trimd::sse::F128>;
             return UniqueInstance<SSEJointsBuilder, JointsBuilder>::with(memRes).create(memRes);
         }
     #endif  // RL_BUILD_WITH_SSE
-    #ifdef RL_BUILD_WITH_AVX
-        if (config.calculationType == CalculationType::AVX) {
+    #if defined(RL_BUILD_WITH_AVX)
+        if (calculationType == CalculationType::AVX) {
             using AVXJointsBuilder = bpcm::BPCMJointsBuilder<StorageType, trimd::avx::F256>;
             return UniqueInstance<AVXJointsBuilder, JointsBuilder>::with(memRes).create(memRes);
         }
+    #elif defined(RL_JOINTS_AVX_DISPATCH)
+        if (calculationType == CalculationType::AVX) {
+            return createAVXJointsBuilder(memRes, selection.halfFloats);
+        }
     #endif  // RL_BUILD_WITH_AVX
     #ifdef RL_BUILD_WITH_NEON
-        if (config.calculationType == CalculationType::NEON) {
+        if (calculationType == CalculationType::NEON) {
             using NEONJointsBuilder = bpcm::BPCMJointsBuilder<StorageType, trimd::neon::F128>;
             return UniqueInstance<NEONJointsBuilder, JointsBuilder>::with(memRes).create(memRes);
         }
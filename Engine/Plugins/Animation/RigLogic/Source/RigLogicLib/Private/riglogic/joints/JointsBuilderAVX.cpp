@@ -0,0 +1,79 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+// Everything defined between the target push and pop below is compiled for AVX and F16C, including any inline function
+// or template first defined there. So every header the BPCM builder needs that does not depend on the vector type is
+// included above the push: its functions and the instantiations shared with JointsBuilder.cpp (storage, extents, joint
+// groups, containers) are emitted without VEX code, and the linker cannot hand a VEX copy to a caller running on an
+// SSE-only machine. Only the headers templated on the trimd vector type are left inside the region.
+//
+// The same holds for trimd: the scalar and SSE types are included above the push with the build's own TRIMD_ENABLE_*
+// configuration, exactly as JointsBuilder.cpp sees them. Only trimd/AVX.h, which nothing else in an SSE build includes
+// with TRIMD_ENABLE_AVX set, is included inside. It has to be included directly: SIMD.h pulls in trimd/TRiMD.h, which
+// would mark trimd/AVX.h as already included while TRIMD_ENABLE_AVX is still undefined.
+#include "riglogic/joints/JointsBuilderAVX.h"
+
+#include "riglogic/TypeDefs.h"
+#include "riglogic/joints/JointsBuilder.h"
+#include "riglogic/joints/bpcm/Extent.h"
+#include "riglogic/joints/bpcm/JointGroup.h"
+#include "riglogic/joints/bpcm/Storage.h"
+#include "riglogic/system/simd/Detect.h"
+
+#ifdef RL_JOINTS_AVX_DISPATCH
+    #include "trimd/Scalar.h"
+    #include "trimd/SSE.h"
+#endif  // RL_JOINTS_AVX_DISPATCH
+
+#include <immintrin.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#ifdef RL_JOINTS_AVX_DISPATCH
+
+// trimd/AVX.h compiles to nothing without TRIMD_ENABLE_AVX, so with it still undefined here no AVX type can have been
+// compiled above the push. An earlier include that swallowed the one below (#pragma once) leaves trimd::avx::F256
+// undeclared, which fails to compile rather than falling back silently.
+#ifdef TRIMD_ENABLE_AVX
+    #error "TRIMD_ENABLE_AVX is already defined, trimd/AVX.h may have been compiled outside the AVX target region"
+#endif
+
+#if defined(__clang__)
+    #pragma clang attribute push (__attribute__((target("avx,f16c"))), apply_to = function)
+#elif defined(__GNUC__)
+    #pragma GCC push_options
+    #pragma GCC target("avx,f16c")
+#endif  // MSVC accepts AVX and F16C intrinsics without /arch:AVX
+
+#define TRIMD_ENABLE_AVX
+#ifndef TRIMD_ENABLE_F16C
+    #define TRIMD_ENABLE_F16C
+#endif
+#include "trimd/AVX.h"
+#include "riglogic/system/simd/SIMD.h"
+#include "riglogic/joints/bpcm/Builder.h"
+
+namespace rl4 {
+
+JointsBuilder::Pointer createAVXJointsBuilder(MemoryResource* memRes, bool halfFloats) {
+    #ifndef RL_USE_HALF_FLOATS
+        if (!halfFloats) {
+            using AVXJointsBuilder = bpcm::BPCMJointsBuilder<float, trimd::avx::F256>;
+            return UniqueInstance<AVXJointsBuilder, JointsBuilder>::with(memRes).create(memRes);
+        }
+    #endif  // RL_USE_HALF_FLOATS
+    static_cast<void>(halfFloats);
+    using AVXJointsBuilder = bpcm::BPCMJointsBuilder<std::uint16_t, trimd::avx::F256>;
+    return UniqueInstance<AVXJointsBuilder, JointsBuilder>::with(memRes).create(memRes);
+}
+
+}  // namespace rl4
+
+#if defined(__clang__)
+    #pragma clang attribute pop
+#elif defined(__GNUC__)
+    #pragma GCC pop_options
+#endif
+
+#endif  // RL_JOINTS_AVX_DISPATCH
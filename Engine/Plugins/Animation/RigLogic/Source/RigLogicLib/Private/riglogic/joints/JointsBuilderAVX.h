@@ -0,0 +1,31 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "riglogic/joints/JointsBuilder.h"
+#include "riglogic/system/simd/CPUFeatures.h"
+#include "riglogic/system/simd/Detect.h"
+
+// The AVX builder of an SSE-baseline build, defined in JointsBuilderAVX.cpp which is compiled for AVX and F16C. Builds
+// that already require AVX compile it in JointsBuilder.cpp instead.
+#if defined(RL_BUILD_WITH_AVX_DISPATCH) && !defined(RL_BUILD_WITH_AVX)
+    #define RL_JOINTS_AVX_DISPATCH
+#endif
+
+namespace rl4 {
+
+#ifdef RL_JOINTS_AVX_DISPATCH
+// Only call it when simd::getCPUFeatures() reports AVX, and F16C as well for half float storage.
+JointsBuilder::Pointer createAVXJointsBuilder(MemoryResource* memRes, bool halfFloats);
+
+struct JointsBuilderSelection {
+    CalculationType calculationType;
+    // Half float storage for the AVX builder, ignored by the others.
+    bool halfFloats;
+};
+
+// The builder JointsBuilder::create makes on a CPU with the given features, which passes simd::getCPUFeatures().
+JointsBuilderSelection selectJointsBuilder(CalculationType requested, const simd::CPUFeatures& features);
+#endif  // RL_JOINTS_AVX_DISPATCH
+
+}  // namespace rl4
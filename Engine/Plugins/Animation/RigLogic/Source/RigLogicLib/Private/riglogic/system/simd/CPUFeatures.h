@@ -0,0 +1,81 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#if defined(__x86_64__) || defined(__x86_64) || defined(__amd64__) || defined(__amd64) || defined(_M_X64) || defined(_M_AMD64) || \
+    defined(i386) || defined(__i386) || defined(__i386__) || defined(_M_IX86)
+    #define RL_CPU_X86 1
+#endif
+
+#ifdef RL_CPU_X86
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#endif  // RL_CPU_X86
+
+#include <cstdint>
+
+namespace rl4 {
+
+namespace simd {
+
+// Instruction sets of the running CPU that the compile time RL_BUILD_WITH_* switches can't promise.
+struct CPUFeatures {
+    bool f16c;
+    bool avx;
+};
+
+#ifdef RL_CPU_X86
+inline void cpuid(std::uint32_t leaf, std::uint32_t subleaf, std::uint32_t (&regs)[4]) {
+    #if defined(_MSC_VER) && !defined(__clang__)
+        int values[4];
+        __cpuidex(values, static_cast<int>(leaf), static_cast<int>(subleaf));
+        for (int i = 0; i < 4; ++i) {
+            regs[i] = static_cast<std::uint32_t>(values[i]);
+        }
+    #else
+        __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+    #endif
+}
+
+// XCR0, the register state the OS saves on context switches. Only valid when cpuid reports OSXSAVE.
+inline std::uint64_t xgetbv0() {
+    #if defined(_MSC_VER) && !defined(__clang__)
+        return _xgetbv(0);
+    #else
+        std::uint32_t lo;
+        std::uint32_t hi;
+        __asm__ __volatile__ ("xgetbv" : "=a" (lo), "=d" (hi) : "c" (0));
+        return (static_cast<std::uint64_t>(hi) << 32ull) | lo;
+    #endif
+}
+#endif  // RL_CPU_X86
+
+inline CPUFeatures detectCPUFeatures() {
+    CPUFeatures features{};
+    #ifdef RL_CPU_X86
+        std::uint32_t regs[4];
+        cpuid(0u, 0u, regs);
+        if (regs[0] >= 1u) {
+            cpuid(1u, 0u, regs);
+            const std::uint32_t ecx = regs[2];
+            // AVX also needs the OS to save the upper halves of the YMM registers (XCR0 bits 1 and 2).
+            const bool osSavesYMM = ((ecx & (1u << 27u)) != 0u) && ((xgetbv0() & 0x6ull) == 0x6ull);
+            features.avx = osSavesYMM && ((ecx & (1u << 28u)) != 0u);
+            features.f16c = features.avx && ((ecx & (1u << 29u)) != 0u);
+        }
+    #endif  // RL_CPU_X86
+    return features;
+}
+
+// Detected on first use, every flag is false on non-x86 targets.
+inline const CPUFeatures& getCPUFeatures() {
+    static const CPUFeatures features = detectCPUFeatures();
+    return features;
+}
+
+}  // namespace simd
+
+}  // namespace rl4
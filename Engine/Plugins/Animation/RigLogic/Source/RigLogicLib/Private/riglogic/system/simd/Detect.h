@@ -2,7 +2,11 @@
 
 #pragma once
 
-#if (defined(PLATFORM_ALWAYS_HAS_AVX) && (PLATFORM_ALWAYS_HAS_AVX > 0)) && !defined(RL_BUILD_WITH_AVX)
+#if (defined(PLATFORM_ALWAYS_HAS_AVX_512) && (PLATFORM_ALWAYS_HAS_AVX_512 > 0)) && !defined(RL_BUILD_WITH_AVX512)
+#define RL_BUILD_WITH_AVX512
+#endif  // RL_BUILD_WITH_AVX512
+
+#if ((defined(PLATFORM_ALWAYS_HAS_AVX) && (PLATFORM_ALWAYS_HAS_AVX > 0)) || defined(RL_BUILD_WITH_AVX512)) && !defined(RL_BUILD_WITH_AVX)
 #define RL_BUILD_WITH_AVX
 #endif  // RL_BUILD_WITH_AVX
 
@@ -4,6 +4,10 @@
 
 #include "riglogic/system/simd/Detect.h"
 
+#if defined(RL_BUILD_WITH_AVX512) && !defined(TRIMD_ENABLE_AVX512)
+    #define TRIMD_ENABLE_AVX512
+#endif  // RL_BUILD_WITH_AVX512
+
 #if defined(RL_BUILD_WITH_AVX)
     #if defined(RL_USE_HALF_FLOATS) && !defined(TRIMD_ENABLE_F16C)
         #define TRIMD_ENABLE_F16C
@@ -31,3 +35,4 @@
 #endif  // RL_BUILD_WITH_NEON
 
 #include "trimd/TRiMD.h"
+#include "trimd/AVX512.h"
@@ -0,0 +1,249 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#ifdef TRIMD_ENABLE_AVX512
+
+#include <immintrin.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace trimd {
+
+namespace avx512 {
+
+// Sixteen floats in one zmm register. Mirrors avx::F256, so evaluators templated on the vector type (block height
+// taken from size(), storage aligned to alignment()) take it unchanged.
+struct F512 {
+    using value_type = float;
+
+    __m512 data;
+
+    F512() : data{_mm512_setzero_ps()} {
+    }
+
+    explicit F512(__m512 value) : data{value} {
+    }
+
+    explicit F512(float value) : F512{_mm512_set1_ps(value)} {
+    }
+
+    F512(float v1, float v2, float v3, float v4, float v5, float v6, float v7, float v8,
+         float v9, float v10, float v11, float v12, float v13, float v14, float v15, float v16) :
+        F512{_mm512_setr_ps(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16)} {
+    }
+
+    static F512 fromAlignedSource(const float* source) {
+        return F512{_mm512_load_ps(source)};
+    }
+
+    static F512 fromUnalignedSource(const float* source) {
+        return F512{_mm512_loadu_ps(source)};
+    }
+
+    static F512 loadSingleValue(const float* source) {
+        return F512{_mm512_castps128_ps512(_mm_load_ss(source))};
+    }
+
+    #ifdef TRIMD_ENABLE_F16C
+        static F512 fromAlignedSource(const std::uint16_t* source) {
+            return F512{_mm512_cvtph_ps(_mm256_load_si256(reinterpret_cast<const __m256i*>(source)))};
+        }
+
+        static F512 fromUnalignedSource(const std::uint16_t* source) {
+            return F512{_mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(source)))};
+        }
+
+        static F512 loadSingleValue(const std::uint16_t* source) {
+            return F512{_mm512_castps128_ps512(_mm_cvtph_ps(_mm_cvtsi32_si128(static_cast<int>(*source))))};
+        }
+    #endif  // TRIMD_ENABLE_F16C
+
+    template<typename T>
+    static void prefetchT0(const T* source) {
+        _mm_prefetch(reinterpret_cast<const char*>(source), _MM_HINT_T0);
+    }
+
+    template<typename T>
+    static void prefetchT1(const T* source) {
+        _mm_prefetch(reinterpret_cast<const char*>(source), _MM_HINT_T1);
+    }
+
+    template<typename T>
+    static void prefetchT2(const T* source) {
+        _mm_prefetch(reinterpret_cast<const char*>(source), _MM_HINT_T2);
+    }
+
+    template<typename T>
+    static void prefetchNTA(const T* source) {
+        _mm_prefetch(reinterpret_cast<const char*>(source), _MM_HINT_NTA);
+    }
+
+    void alignedLoad(const float* source) {
+        data = _mm512_load_ps(source);
+    }
+
+    void unalignedLoad(const float* source) {
+        data = _mm512_loadu_ps(source);
+    }
+
+    void alignedStore(float* dest) const {
+        _mm512_store_ps(dest, data);
+    }
+
+    void unalignedStore(float* dest) const {
+        _mm512_storeu_ps(dest, data);
+    }
+
+    #ifdef TRIMD_ENABLE_F16C
+        void alignedLoad(const std::uint16_t* source) {
+            data = _mm512_cvtph_ps(_mm256_load_si256(reinterpret_cast<const __m256i*>(source)));
+        }
+
+        void unalignedLoad(const std::uint16_t* source) {
+            data = _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(source)));
+        }
+
+        void alignedStore(std::uint16_t* dest) const {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(dest), _mm512_cvtps_ph(data, _MM_FROUND_CUR_DIRECTION));
+        }
+
+        void unalignedStore(std::uint16_t* dest) const {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest), _mm512_cvtps_ph(data, _MM_FROUND_CUR_DIRECTION));
+        }
+    #endif  // TRIMD_ENABLE_F16C
+
+    float sum() const {
+        return _mm512_reduce_add_ps(data);
+    }
+
+    F512& operator+=(const F512& rhs) {
+        data = _mm512_add_ps(data, rhs.data);
+        return *this;
+    }
+
+    F512& operator-=(const F512& rhs) {
+        data = _mm512_sub_ps(data, rhs.data);
+        return *this;
+    }
+
+    F512& operator*=(const F512& rhs) {
+        data = _mm512_mul_ps(data, rhs.data);
+        return *this;
+    }
+
+    F512& operator/=(const F512& rhs) {
+        data = _mm512_div_ps(data, rhs.data);
+        return *this;
+    }
+
+    // Bitwise operations go through the integer domain, the float forms need AVX-512DQ.
+    F512& operator&=(const F512& rhs) {
+        data = _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(data), _mm512_castps_si512(rhs.data)));
+        return *this;
+    }
+
+    F512& operator|=(const F512& rhs) {
+        data = _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(data), _mm512_castps_si512(rhs.data)));
+        return *this;
+    }
+
+    F512& operator^=(const F512& rhs) {
+        data = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(data), _mm512_castps_si512(rhs.data)));
+        return *this;
+    }
+
+    static constexpr std::size_t size() {
+        return sizeof(decltype(data)) / sizeof(float);
+    }
+
+    static constexpr std::size_t alignment() {
+        return alignof(decltype(data));
+    }
+};
+
+namespace impl {
+
+// AVX-512 compares produce a lane mask, expanded here to the all-ones / all-zeros lanes the other backends return.
+inline F512 maskToVector(__mmask16 mask) {
+    return F512{_mm512_castsi512_ps(_mm512_maskz_set1_epi32(mask, -1))};
+}
+
+}  // namespace impl
+
+inline F512 operator==(const F512& lhs, const F512& rhs) {
+    return impl::maskToVector(_mm512_cmp_ps_mask(lhs.data, rhs.data, _CMP_EQ_OQ));
+}
+
+inline F512 operator!=(const F512& lhs, const F512& rhs) {
+    return impl::maskToVector(_mm512_cmp_ps_mask(lhs.data, rhs.data, _CMP_NEQ_UQ));
+}
+
+inline F512 operator<(const F512& lhs, const F512& rhs) {
+    return impl::maskToVector(_mm512_cmp_ps_mask(lhs.data, rhs.data, _CMP_LT_OQ));
+}
+
+inline F512 operator<=(const F512& lhs, const F512& rhs) {
+    return impl::maskToVector(_mm512_cmp_ps_mask(lhs.data, rhs.data, _CMP_LE_OQ));
+}
+
+inline F512 operator>(const F512& lhs, const F512& rhs) {
+    return impl::maskToVector(_mm512_cmp_ps_mask(lhs.data, rhs.data, _CMP_GT_OQ));
+}
+
+inline F512 operator>=(const F512& lhs, const F512& rhs) {
+    return impl::maskToVector(_mm512_cmp_ps_mask(lhs.data, rhs.data, _CMP_GE_OQ));
+}
+
+inline F512 operator+(const F512& lhs, const F512& rhs) {
+    return F512(lhs) += rhs;
+}
+
+inline F512 operator-(const F512& lhs, const F512& rhs) {
+    return F512(lhs) -= rhs;
+}
+
+inline F512 operator*(const F512& lhs, const F512& rhs) {
+    return F512(lhs) *= rhs;
+}
+
+inline F512 operator/(const F512& lhs, const F512& rhs) {
+    return F512(lhs) /= rhs;
+}
+
+inline F512 operator&(const F512& lhs, const F512& rhs) {
+    return F512(lhs) &= rhs;
+}
+
+inline F512 operator|(const F512& lhs, const F512& rhs) {
+    return F512(lhs) |= rhs;
+}
+
+inline F512 operator^(const F512& lhs, const F512& rhs) {
+    return F512(lhs) ^= rhs;
+}
+
+inline F512 operator~(const F512& rhs) {
+    return F512{_mm512_castsi512_ps(_mm512_ternarylogic_epi32(_mm512_castps_si512(rhs.data), _mm512_castps_si512(rhs.data),
+                                                              _mm512_castps_si512(rhs.data), 0x55))};
+}
+
+inline F512 abs(const F512& rhs) {
+    return F512{_mm512_abs_ps(rhs.data)};
+}
+
+inline F512 andnot(const F512& lhs, const F512& rhs) {
+    return F512{_mm512_castsi512_ps(_mm512_andnot_si512(_mm512_castps_si512(lhs.data), _mm512_castps_si512(rhs.data)))};
+}
+
+// 14 bit estimate, finer than the 12 bit _mm256_rsqrt_ps of the AVX backend.
+inline F512 rsqrt(const F512& rhs) {
+    return F512{_mm512_rsqrt14_ps(rhs.data)};
+}
+
+}  // namespace avx512
+
+}  // namespace trimd
+
+#endif  // TRIMD_ENABLE_AVX512
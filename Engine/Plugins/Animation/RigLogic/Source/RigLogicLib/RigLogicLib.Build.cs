@@ -23,6 +23,16 @@ namespace UnrealBuildTool.Rules
 							"TRIMD_ENABLE_F16C=1", // This on safe to use all AVX2 CPU's has support for F16C.
 						}
 					);
+					if (Target.MinCpuArchX64 >= MinimumCpuArchitectureX64.AVX512)
+					{
+						PublicDefinitions.AddRange(
+							new string[]
+							{
+								"RL_BUILD_WITH_AVX512=1",
+								"TRIMD_ENABLE_AVX512=1",
+							}
+						);
+					}
 				}
 				else
 				{
@@ -35,6 +45,9 @@ namespace UnrealBuildTool.Rules
 							//"TRIMD_ENABLE_F16C=1", // This on SSE revamps minimal DefaultCPU version to AMD(R) BobcatV2|+ or AMD(R) BulldozerV2|+, Intel(R) Ivybridge or Intel(R) Haswell|+.
 						}
 					);
+					// The AVX joints evaluator is still compiled in (JointsBuilderAVX.cpp, per-function target attributes) and
+					// picked when cpuid reports AVX on the running machine, with half float joint storage when it reports F16C.
+					PrivateDefinitions.Add("RL_BUILD_WITH_AVX_DISPATCH=1");
 				}
 			}
 
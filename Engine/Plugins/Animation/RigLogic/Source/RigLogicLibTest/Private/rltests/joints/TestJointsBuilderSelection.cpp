@@ -0,0 +1,51 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "rltests/Defs.h"
+
+#include "riglogic/joints/JointsBuilderAVX.h"
+
+#ifdef RL_JOINTS_AVX_DISPATCH
+
+namespace {
+
+rl4::simd::CPUFeatures makeFeatures(bool avx, bool f16c) {
+    rl4::simd::CPUFeatures features{};
+    features.avx = avx;
+    features.f16c = f16c;
+    return features;
+}
+
+}  // namespace
+
+TEST(JointsBuilderSelectionTest, AVXWithF16CSelectsHalfFloatAVXBuilder) {
+    const auto selection = rl4::selectJointsBuilder(rl4::CalculationType::AVX, makeFeatures(true, true));
+    ASSERT_EQ(selection.calculationType, rl4::CalculationType::AVX);
+    ASSERT_TRUE(selection.halfFloats);
+}
+
+TEST(JointsBuilderSelectionTest, AVXWithoutF16C) {
+    const auto selection = rl4::selectJointsBuilder(rl4::CalculationType::AVX, makeFeatures(true, false));
+    #ifdef RL_USE_HALF_FLOATS
+        // Half float storage can't be converted without F16C.
+        ASSERT_EQ(selection.calculationType, rl4::CalculationType::SSE);
+    #else
+        ASSERT_EQ(selection.calculationType, rl4::CalculationType::AVX);
+        ASSERT_FALSE(selection.halfFloats);
+    #endif  // RL_USE_HALF_FLOATS
+}
+
+TEST(JointsBuilderSelectionTest, NoAVXFallsBackToSSE) {
+    const auto selection = rl4::selectJointsBuilder(rl4::CalculationType::AVX, makeFeatures(false, false));
+    ASSERT_EQ(selection.calculationType, rl4::CalculationType::SSE);
+}
+
+TEST(JointsBuilderSelectionTest, OtherRequestsPassThrough) {
+    for (const bool supported : {false, true}) {
+        const auto features = makeFeatures(supported, supported);
+        ASSERT_EQ(rl4::selectJointsBuilder(rl4::CalculationType::SSE, features).calculationType, rl4::CalculationType::SSE);
+        ASSERT_EQ(rl4::selectJointsBuilder(rl4::CalculationType::Scalar, features).calculationType,
+                  rl4::CalculationType::Scalar);
+    }
+}
+
+#endif  // RL_JOINTS_AVX_DISPATCH
@@ -0,0 +1,209 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "rltests/Defs.h"
+
+#include "riglogic/system/simd/SIMD.h"
+
+#ifdef TRIMD_ENABLE_AVX512
+
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
+namespace {
+
+using trimd::avx512::F512;
+
+constexpr std::size_t laneCount = 16ul;
+
+struct alignas(64) AlignedFloats {
+    float values[laneCount];
+};
+
+#ifdef TRIMD_ENABLE_F16C
+    struct alignas(32) AlignedHalfs {
+        std::uint16_t values[laneCount];
+    };
+#endif  // TRIMD_ENABLE_F16C
+
+AlignedFloats iota(float start, float step) {
+    AlignedFloats result{};
+    for (std::size_t i = 0ul; i < laneCount; ++i) {
+        result.values[i] = start + step * static_cast<float>(i);
+    }
+    return result;
+}
+
+std::uint32_t bitsOf(float value) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+}  // namespace
+
+TEST(F512Test, SizeAndAlignment) {
+    ASSERT_EQ(F512::size(), laneCount);
+    ASSERT_EQ(F512::alignment(), 64ul);
+}
+
+TEST(F512Test, AlignedLoadStore) {
+    const AlignedFloats source = iota(-7.5f, 1.25f);
+    AlignedFloats dest{};
+    F512::fromAlignedSource(source.values).alignedStore(dest.values);
+    for (std::size_t i = 0ul; i < laneCount; ++i) {
+        ASSERT_EQ(dest.values[i], source.values[i]);
+    }
+}
+
+TEST(F512Test, UnalignedLoadStore) {
+    float source[laneCount + 1ul];
+    float dest[laneCount + 1ul] = {};
+    for (std::size_t i = 0ul; i < laneCount + 1ul; ++i) {
+        source[i] = static_cast<float>(i) * 0.5f;
+    }
+    F512 v;
+    v.unalignedLoad(source + 1);
+    v.unalignedStore(dest + 1);
+    ASSERT_EQ(dest[0], 0.0f);
+    for (std::size_t i = 1ul; i < laneCount + 1ul; ++i) {
+        ASSERT_EQ(dest[i], source[i]);
+    }
+}
+
+TEST(F512Test, LoadSingleValue) {
+    const float value = 3.0f;
+    AlignedFloats dest{};
+    F512::loadSingleValue(&value).alignedStore(dest.values);
+    ASSERT_EQ(dest.values[0], 3.0f);
+    for (std::size_t i = 1ul; i < laneCount; ++i) {
+        ASSERT_EQ(dest.values[i], 0.0f);
+    }
+}
+
+#ifdef TRIMD_ENABLE_F16C
+    TEST(F512Test, HalfFloatRoundTrip) {
+        // Every value is exactly representable as a half float, so the round trip is lossless.
+        const AlignedFloats source = iota(-4.0f, 0.5f);
+        AlignedHalfs halfs{};
+        F512::fromAlignedSource(source.values).alignedStore(halfs.values);
+        AlignedFloats dest{};
+        F512::fromAlignedSource(halfs.values).alignedStore(dest.values);
+        for (std::size_t i = 0ul; i < laneCount; ++i) {
+            ASSERT_EQ(dest.values[i], source.values[i]);
+        }
+
+        std::uint16_t unalignedHalfs[laneCount + 1ul] = {};
+        F512::fromAlignedSource(source.values).unalignedStore(unalignedHalfs + 1);
+        F512::fromUnalignedSource(unalignedHalfs + 1).alignedStore(dest.values);
+        for (std::size_t i = 0ul; i < laneCount; ++i) {
+            ASSERT_EQ(dest.values[i], source.values[i]);
+        }
+    }
+
+    TEST(F512Test, HalfFloatLoadSingleValue) {
+        const std::uint16_t one = 0x3C00u;
+        AlignedFloats dest{};
+        F512::loadSingleValue(&one).alignedStore(dest.values);
+        ASSERT_EQ(dest.values[0], 1.0f);
+        for (std::size_t i = 1ul; i < laneCount; ++i) {
+            ASSERT_EQ(dest.values[i], 0.0f);
+        }
+    }
+#endif  // TRIMD_ENABLE_F16C
+
+TEST(F512Test, Sum) {
+    const AlignedFloats source = iota(1.0f, 1.0f);
+    ASSERT_EQ(F512::fromAlignedSource(source.values).sum(), 136.0f);
+    ASSERT_EQ(F512{}.sum(), 0.0f);
+}
+
+TEST(F512Test, Arithmetic) {
+    const AlignedFloats lhsValues = iota(1.0f, 2.0f);
+    const AlignedFloats rhsValues = iota(0.5f, 0.25f);
+    const F512 lhs = F512::fromAlignedSource(lhsValues.values);
+    const F512 rhs = F512::fromAlignedSource(rhsValues.values);
+    AlignedFloats added{};
+    AlignedFloats subtracted{};
+    AlignedFloats multiplied{};
+    AlignedFloats divided{};
+    (lhs + rhs).alignedStore(added.values);
+    (lhs - rhs).alignedStore(subtracted.values);
+    (lhs * rhs).alignedStore(multiplied.values);
+    (lhs / rhs).alignedStore(divided.values);
+    for (std::size_t i = 0ul; i < laneCount; ++i) {
+        ASSERT_EQ(added.values[i], lhsValues.values[i] + rhsValues.values[i]);
+        ASSERT_EQ(subtracted.values[i], lhsValues.values[i] - rhsValues.values[i]);
+        ASSERT_EQ(multiplied.values[i], lhsValues.values[i] * rhsValues.values[i]);
+        ASSERT_EQ(divided.values[i], lhsValues.values[i] / rhsValues.values[i]);
+    }
+}
+
+TEST(F512Test, ComparesProduceAllOnesLanes) {
+    // Lanes 0-7 hold lhs < rhs, lane 8 lhs == rhs, lanes 9-15 lhs > rhs.
+    const AlignedFloats lhsValues = iota(0.0f, 1.0f);
+    const AlignedFloats rhsValues{{8.0f, 8.0f, 8.0f, 8.0f, 8.0f, 8.0f, 8.0f, 8.0f, 8.0f, 8.0f, 8.0f, 8.0f, 8.0f, 8.0f, 8.0f, 8.0f}};
+    const F512 lhs = F512::fromAlignedSource(lhsValues.values);
+    const F512 rhs = F512::fromAlignedSource(rhsValues.values);
+
+    const auto check = [&](const F512& result, bool (*expected)(float, float)) {
+        AlignedFloats lanes{};
+        result.alignedStore(lanes.values);
+        for (std::size_t i = 0ul; i < laneCount; ++i) {
+            const std::uint32_t expectedBits = expected(lhsValues.values[i], rhsValues.values[i]) ? 0xFFFFFFFFu : 0u;
+            ASSERT_EQ(bitsOf(lanes.values[i]), expectedBits);
+        }
+    };
+    check(lhs == rhs, [](float l, float r) { return l == r; });
+    check(lhs != rhs, [](float l, float r) { return l != r; });
+    check(lhs < rhs, [](float l, float r) { return l < r; });
+    check(lhs <= rhs, [](float l, float r) { return l <= r; });
+    check(lhs > rhs, [](float l, float r) { return l > r; });
+    check(lhs >= rhs, [](float l, float r) { return l >= r; });
+}
+
+TEST(F512Test, CompareMasksSelectWithBitwiseOps) {
+    const AlignedFloats values = iota(-8.0f, 1.0f);
+    const F512 v = F512::fromAlignedSource(values.values);
+    const F512 negative = v < F512{0.0f};
+    AlignedFloats selected{};
+    ((negative & F512{1.0f}) | andnot(negative, F512{2.0f})).alignedStore(selected.values);
+    for (std::size_t i = 0ul; i < laneCount; ++i) {
+        ASSERT_EQ(selected.values[i], values.values[i] < 0.0f ? 1.0f : 2.0f);
+    }
+
+    AlignedFloats inverted{};
+    (~negative ^ negative).alignedStore(inverted.values);
+    for (std::size_t i = 0ul; i < laneCount; ++i) {
+        ASSERT_EQ(bitsOf(inverted.values[i]), 0xFFFFFFFFu);
+    }
+}
+
+TEST(F512Test, Abs) {
+    const AlignedFloats values = iota(-8.0f, 1.0f);
+    AlignedFloats result{};
+    abs(F512::fromAlignedSource(values.values)).alignedStore(result.values);
+    for (std::size_t i = 0ul; i < laneCount; ++i) {
+        ASSERT_EQ(result.values[i], std::fabs(values.values[i]));
+    }
+}
+
+TEST(F512Test, ReciprocalSquareRoot) {
+    const AlignedFloats values = iota(0.25f, 3.5f);
+    AlignedFloats result{};
+    rsqrt(F512::fromAlignedSource(values.values)).alignedStore(result.values);
+    for (std::size_t i = 0ul; i < laneCount; ++i) {
+        const float expected = 1.0f / std::sqrt(values.values[i]);
+        // _mm512_rsqrt14_ps guarantees a relative error below 2^-14.
+        ASSERT_NEAR(result.values[i], expected, expected * 6.2e-5f);
+    }
+}
+
+#endif  // TRIMD_ENABLE_AVX512
@@ -27,6 +27,16 @@ namespace UnrealBuildTool.Rules
 							"TRIMD_ENABLE_F16C=1", // This on safe to use all AVX2 CPU's has support for F16C.
 						}
 					);
+					if (Target.MinCpuArchX64 >= MinimumCpuArchitectureX64.AVX512)
+					{
+						PublicDefinitions.AddRange(
+							new string[]
+							{
+								"RL_BUILD_WITH_AVX512=1",
+								"TRIMD_ENABLE_AVX512=1",
+							}
+						);
+					}
 				}
 				else
 				{
@@ -39,6 +49,8 @@ namespace UnrealBuildTool.Rules
 							//"TRIMD_ENABLE_F16C=1", // This on SSE revamps minimal DefaultCPU version to AMD(R) BobcatV2|+ or AMD(R) BulldozerV2|+, Intel(R) Ivybridge or Intel(R) Haswell|+.
 						}
 					);
+					// Same as RigLogicLib, so the runtime AVX joints builder selection is built and tested here as well.
+					PrivateDefinitions.Add("RL_BUILD_WITH_AVX_DISPATCH=1");
 				}
 			}
 
@@ -0,0 +1,1251 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "RequiredProgramMainCPPInclude.h"
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+
+IMPLEMENT_APPLICATION(VectorMathBenchmark, "VectorMathBenchmark");
+
+/**
+ * Micro benchmark of the VectorRegister primitives of the vector math backend this program was compiled with
+ * (UnrealMathSSE.h at the -MinCpuArchX64 level of the build, or UnrealMathNeon.h). The engine is never booted,
+ * only Core's timer and command line parsing are used.
+ *
+ * Every measurement is written to stdout as one JSON object per line, e.g.
+ *   {"primitive":"VectorPow","type":"double","isa":"AVX2","dispatch":"none","mode":"latency","ns":8.2500}
+ *
+ * mode "throughput"	ns per call, independent inputs
+ * mode "latency"		ns per call, each call consumes the previous result
+ * mode "bulk"			ns per element (vector, matrix, value, pixel or cache line) of an array routine
+ *
+ * In runtime dispatch builds the bulk routines are timed through the public function ("auto") and again pinned to each
+ * kernel tier the running CPU supports, see SetVectorBulkLevel.
+ *
+ * -accuracy replaces the timings with a sweep of the double transcendental kernels against the C library, one line
+ * per primitive and input range, e.g.
+ *   {"primitive":"VectorLog","type":"double","isa":"AVX2","range":"full","samples":1000000,"maxulp":1,"worst":[0.5],"specials":"pass"}
+ *
+ * "full" draws random bit patterns over every finite exponent, "core" is uniform over the range the kernel is built
+ * for. Both start with zero, subnormal, boundary, infinite and NaN inputs. maxulp is the largest distance to the libm
+ * result, specials is "fail" when one of those inputs returns NaN or infinity where libm does not, or the reverse.
+ *
+ * Usage: VectorMathBenchmark [-filter=Substring] [-type=float|double] [-mintime=Seconds] [-accuracy] [-samples=Count]
+ */
+namespace VectorMathBenchmark
+{
+	constexpr int32 NumInputs = 64;
+	constexpr int32 ChainLength = 64;
+	constexpr int32 NumBulkElements = 1024;
+	constexpr int32 NumMatrices = 16;
+
+	struct FOptions
+	{
+		FString Filter;
+		FString Type;
+		double MinTime = 0.05;
+		int32 NumSamples = 1000000;
+	};
+
+	template<typename T>
+	struct TVectorTraits;
+
+	template<>
+	struct TVectorTraits<float>
+	{
+		typedef VectorRegister4Float VectorType;
+		typedef FMatrix44f MatrixType;
+		typedef FQuat4f QuatType;
+		typedef FVector3f Vector3Type;
+		static const char* Name() { return "float"; }
+	};
+
+	template<>
+	struct TVectorTraits<double>
+	{
+		typedef VectorRegister4Double VectorType;
+		typedef FMatrix44d MatrixType;
+		typedef FQuat4d QuatType;
+		typedef FVector3d Vector3Type;
+		static const char* Name() { return "double"; }
+	};
+
+	/** Returns Ptr through a volatile so the optimizer can neither hoist work across repetitions nor drop the stores. */
+	template<typename T>
+	FORCEINLINE T* Opaque(T* Ptr)
+	{
+		T* volatile Result = Ptr;
+		return Result;
+	}
+
+	const char* GetCompiledIsaName()
+	{
+#if PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+		return "Neon";
+#elif !PLATFORM_ENABLE_VECTORINTRINSICS
+		return "FPU";
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return "AVX512";
+#elif UE_PLATFORM_MATH_USE_AVX_2
+		return "AVX2";
+#elif UE_PLATFORM_MATH_USE_AVX
+		return "AVX";
+#else
+		return "SSE";
+#endif
+	}
+
+	/**
+	 * Runs Body until MinTime has passed (at least three samples) and returns the best sample in ns per item.
+	 *
+	 * @param ItemsPerCall	Number of primitive calls or array elements done by one call of Body
+	 */
+	template<typename BodyType>
+	double MeasureNanoseconds(const FOptions& Options, int64 ItemsPerCall, BodyType&& Body)
+	{
+		// Grow the repetition count until one sample takes about a tenth of the time budget.
+		int64 Reps = 1;
+		for (;;)
+		{
+			const double Start = FPlatformTime::Seconds();
+			for (int64 Rep = 0; Rep < Reps; ++Rep)
+			{
+				Body();
+			}
+			if (FPlatformTime::Seconds() - Start >= Options.MinTime * 0.1 || Reps >= (int64(1) << 32))
+			{
+				break;
+			}
+			Reps *= 2;
+		}
+
+		double Best = 0.0;
+		int32 NumSamples = 0;
+		const double EndTime = FPlatformTime::Seconds() + Options.MinTime;
+		do
+		{
+			const double Start = FPlatformTime::Seconds();
+			for (int64 Rep = 0; Rep < Reps; ++Rep)
+			{
+				Body();
+			}
+			const double Elapsed = FPlatformTime::Seconds() - Start;
+			Best = (NumSamples == 0 || Elapsed < Best) ? Elapsed : Best;
+			++NumSamples;
+		}
+		while (NumSamples < 3 || FPlatformTime::Seconds() < EndTime);
+
+		return Best * 1e9 / double(Reps * ItemsPerCall);
+	}
+
+	template<typename T>
+	class TBenchmark
+	{
+	public:
+		typedef typename TVectorTraits<T>::VectorType VectorType;
+		typedef typename TVectorTraits<T>::MatrixType MatrixType;
+
+		explicit TBenchmark(const FOptions& InOptions)
+			: Options(InOptions)
+			, FilterUtf8(*InOptions.Filter)
+		{
+			// The latency chain is X = (Op(X) & 0) | Seed: every call waits for the previous one, the input stays
+			// in the primitive's domain and NaN/Inf results can't leak into the next call. The and/or pair is
+			// measured here and subtracted from every latency result.
+			ChainOverhead = MeasureChain(Make(0.5, 0.5), Make(0.5, 0.5), [](const VectorType& A, const VectorType&) { return A; });
+		}
+
+		bool Matches(const char* Name) const
+		{
+			return Options.Filter.IsEmpty() || FCStringAnsi::Strstr(Name, FilterUtf8.Get()) != nullptr;
+		}
+
+		void Print(const char* Name, const char* Dispatch, const char* Mode, double Nanoseconds) const
+		{
+			printf("{\"primitive\":\"%s\",\"type\":\"%s\",\"isa\":\"%s\",\"dispatch\":\"%s\",\"mode\":\"%s\",\"ns\":%.4f}\n",
+				Name, TVectorTraits<T>::Name(), GetCompiledIsaName(), Dispatch, Mode, Nanoseconds);
+			fflush(stdout);
+		}
+
+		/** Uniform value in [Lo, Hi], deterministic across runs. */
+		T Random(T Lo, T Hi)
+		{
+			RandomState = RandomState * 1664525u + 1013904223u;
+			return Lo + (Hi - Lo) * T(RandomState >> 8) * T(1.0 / 16777216.0);
+		}
+
+		VectorType Make(T Lo, T Hi)
+		{
+			const T Values[4] = { Random(Lo, Hi), Random(Lo, Hi), Random(Lo, Hi), Random(Lo, Hi) };
+			return VectorLoad(Values);
+		}
+
+		/** Well conditioned, diagonally dominant matrix. */
+		void MakeMatrix(MatrixType& Matrix)
+		{
+			for (int32 Row = 0; Row < 4; ++Row)
+			{
+				for (int32 Col = 0; Col < 4; ++Col)
+				{
+					Matrix.M[Row][Col] = Random(T(-1), T(1)) + (Row == Col ? T(4) : T(0));
+				}
+			}
+		}
+
+		/** Cyclic permutation, products with it are exact so chains never drift. */
+		static void MakePermutation(MatrixType& Matrix)
+		{
+			for (int32 Row = 0; Row < 4; ++Row)
+			{
+				for (int32 Col = 0; Col < 4; ++Col)
+				{
+					Matrix.M[Row][Col] = (Col == ((Row + 1) & 3)) ? T(1) : T(0);
+				}
+			}
+		}
+
+		/**
+		 * Measures throughput and latency of Op(A, B); unary primitives ignore B.
+		 * Both operands are drawn from [Lo, Hi].
+		 */
+		template<typename OpType>
+		void Primitive(const char* Name, T Lo, T Hi, OpType Op)
+		{
+			if (!Matches(Name))
+			{
+				return;
+			}
+
+			VectorType In[NumInputs];
+			for (int32 Index = 0; Index < NumInputs; ++Index)
+			{
+				In[Index] = Make(Lo, Hi);
+			}
+
+			const double Throughput = MeasureNanoseconds(Options, NumInputs, [&In, &Op, this]()
+			{
+				const VectorType* Src = Opaque(In);
+				VectorType* Dst = Opaque(Sink);
+				for (int32 Index = 0; Index < NumInputs; ++Index)
+				{
+					Dst[Index] = Op(Src[Index], Src[(Index + 1) % NumInputs]);
+				}
+			});
+			Print(Name, "none", "throughput", Throughput);
+
+			const double Latency = MeasureChain(In[0], In[1], Op) - ChainOverhead;
+			Print(Name, "none", "latency", Latency > 0.0 ? Latency : 0.0);
+		}
+
+		/** Measures an array routine, Body processes NumElements elements per call. */
+		template<typename BodyType>
+		void Bulk(const char* Name, const char* Dispatch, int32 NumElements, BodyType&& Body)
+		{
+			if (Matches(Name))
+			{
+				Print(Name, Dispatch, "bulk", MeasureNanoseconds(Options, NumElements, Body));
+			}
+		}
+
+		/** Measures a primitive that doesn't fit Op(A, B), ThroughputBody makes Count independent calls. */
+		template<typename ThroughputBodyType, typename LatencyBodyType>
+		void Custom(const char* Name, int32 Count, ThroughputBodyType&& ThroughputBody, LatencyBodyType&& LatencyBody)
+		{
+			if (Matches(Name))
+			{
+				Print(Name, "none", "throughput", MeasureNanoseconds(Options, Count, ThroughputBody));
+				Print(Name, "none", "latency", MeasureNanoseconds(Options, ChainLength, [&LatencyBody]()
+				{
+					for (int32 Index = 0; Index < ChainLength; ++Index)
+					{
+						LatencyBody();
+					}
+				}));
+			}
+		}
+
+	private:
+		template<typename OpType>
+		double MeasureChain(const VectorType& Seed, const VectorType& B, OpType Op)
+		{
+			const T Zeros[4] = {};
+			const VectorType ZeroMask = VectorLoad(Opaque(Zeros));
+			return MeasureNanoseconds(Options, ChainLength, [&Seed, &B, &ZeroMask, &Op, this]()
+			{
+				VectorType X = Seed;
+				for (int32 Index = 0; Index < ChainLength; ++Index)
+				{
+					X = VectorBitwiseOr(VectorBitwiseAnd(Op(X, B), ZeroMask), Seed);
+				}
+				*Opaque(Sink) = X;
+			});
+		}
+
+		const FOptions& Options;
+		FTCHARToUTF8 FilterUtf8;
+		double ChainOverhead = 0.0;
+		uint32 RandomState = 0x2545F491u;
+		VectorType Sink[NumInputs];
+	};
+
+	/** The integer bitwise ops are timed on the bits of float registers, there is no double form. */
+	void RunIntegerMask(TBenchmark<float>& Bench, const VectorRegister4Float& SelectMask)
+	{
+		const VectorRegister4Int IntMask = VectorCastFloatToInt(SelectMask);
+		Bench.Primitive("VectorIntSelect", -2.0f, 2.0f, [IntMask](const VectorRegister4Float& A, const VectorRegister4Float& B)
+		{
+			return VectorCastIntToFloat(VectorIntSelect(IntMask, VectorCastFloatToInt(A), VectorCastFloatToInt(B)));
+		});
+		Bench.Primitive("VectorIntNot", -2.0f, 2.0f, [](const VectorRegister4Float& A, const VectorRegister4Float&)
+		{
+			return VectorCastIntToFloat(VectorIntNot(VectorCastFloatToInt(A)));
+		});
+	}
+
+	void RunIntegerMask(TBenchmark<double>&, const VectorRegister4Double&)
+	{
+	}
+
+	template<typename T>
+	void RunArithmetic(TBenchmark<T>& Bench)
+	{
+		typedef typename TVectorTraits<T>::VectorType VectorType;
+
+		Bench.Primitive("VectorAdd", T(-2), T(2), [](const VectorType& A, const VectorType& B) { return VectorAdd(A, B); });
+		Bench.Primitive("VectorSubtract", T(-2), T(2), [](const VectorType& A, const VectorType& B) { return VectorSubtract(A, B); });
+		Bench.Primitive("VectorMultiply", T(-2), T(2), [](const VectorType& A, const VectorType& B) { return VectorMultiply(A, B); });
+		Bench.Primitive("VectorDivide", T(0.5), T(2), [](const VectorType& A, const VectorType& B) { return VectorDivide(A, B); });
+		Bench.Primitive("VectorMultiplyAdd", T(-2), T(2), [](const VectorType& A, const VectorType& B) { return VectorMultiplyAdd(A, B, A); });
+		Bench.Primitive("VectorNegateMultiplyAdd", T(-2), T(2), [](const VectorType& A, const VectorType& B) { return VectorNegateMultiplyAdd(A, B, A); });
+		Bench.Primitive("VectorMin", T(-2), T(2), [](const VectorType& A, const VectorType& B) { return VectorMin(A, B); });
+		Bench.Primitive("VectorMax", T(-2), T(2), [](const VectorType& A, const VectorType& B) { return VectorMax(A, B); });
+		Bench.Primitive("VectorAbs", T(-2), T(2), [](const VectorType& A, const VectorType&) { return VectorAbs(A); });
+		Bench.Primitive("VectorNegate", T(-2), T(2), [](const VectorType& A, const VectorType&) { return VectorNegate(A); });
+
+		Bench.Primitive("VectorSqrt", T(0.5), T(2), [](const VectorType& A, const VectorType&) { return VectorSqrt(A); });
+		Bench.Primitive("VectorReciprocalSqrt", T(0.5), T(2), [](const VectorType& A, const VectorType&) { return VectorReciprocalSqrt(A); });
+		Bench.Primitive("VectorReciprocalSqrtEstimate", T(0.5), T(2), [](const VectorType& A, const VectorType&) { return VectorReciprocalSqrtEstimate(A); });
+		Bench.Primitive("VectorReciprocal", T(0.5), T(2), [](const VectorType& A, const VectorType&) { return VectorReciprocal(A); });
+		Bench.Primitive("VectorReciprocalEstimate", T(0.5), T(2), [](const VectorType& A, const VectorType&) { return VectorReciprocalEstimate(A); });
+		Bench.Primitive("VectorReciprocalLen", T(0.5), T(2), [](const VectorType& A, const VectorType&) { return VectorReciprocalLen(A); });
+
+		Bench.Primitive("VectorDot3", T(-2), T(2), [](const VectorType& A, const VectorType& B) { return VectorDot3(A, B); });
+		Bench.Primitive("VectorDot4", T(-2), T(2), [](const VectorType& A, const VectorType& B) { return VectorDot4(A, B); });
+		Bench.Primitive("VectorCross", T(-2), T(2), [](const VectorType& A, const VectorType& B) { return VectorCross(A, B); });
+
+		Bench.Primitive("VectorSwizzle", T(-2), T(2), [](const VectorType& A, const VectorType&) { return VectorSwizzle(A, 2, 0, 3, 1); });
+		Bench.Primitive("VectorReplicate", T(-2), T(2), [](const VectorType& A, const VectorType&) { return VectorReplicate(A, 1); });
+		Bench.Primitive("VectorShuffle", T(-2), T(2), [](const VectorType& A, const VectorType& B) { return VectorShuffle(A, B, 1, 0, 3, 2); });
+		Bench.Primitive("VectorCompareGT", T(-2), T(2), [](const VectorType& A, const VectorType& B) { return VectorCompareGT(A, B); });
+		const VectorType SelectMask = VectorCompareGT(Bench.Make(T(-1), T(1)), Bench.Make(T(-1), T(1)));
+		Bench.Primitive("VectorSelect", T(-2), T(2), [SelectMask](const VectorType& A, const VectorType& B) { return VectorSelect(SelectMask, A, B); });
+		Bench.Primitive("VectorContainsNaNOrInfinite", T(-2), T(2), [](const VectorType& A, const VectorType& B) { return VectorContainsNaNOrInfinite(A) ? B : A; });
+		RunIntegerMask(Bench, SelectMask);
+
+		Bench.Primitive("VectorFloor", T(-100), T(100), [](const VectorType& A, const VectorType&) { return VectorFloor(A); });
+		Bench.Primitive("VectorCeil", T(-100), T(100), [](const VectorType& A, const VectorType&) { return VectorCeil(A); });
+		Bench.Primitive("VectorTruncate", T(-100), T(100), [](const VectorType& A, const VectorType&) { return VectorTruncate(A); });
+		Bench.Primitive("VectorMod", T(0.5), T(8), [](const VectorType& A, const VectorType& B) { return VectorMod(A, B); });
+		Bench.Primitive("VectorSign", T(-2), T(2), [](const VectorType& A, const VectorType&) { return VectorSign(A); });
+		Bench.Primitive("VectorStep", T(-2), T(2), [](const VectorType& A, const VectorType&) { return VectorStep(A); });
+	}
+
+	template<typename T>
+	void RunTranscendental(TBenchmark<T>& Bench)
+	{
+		typedef typename TVectorTraits<T>::VectorType VectorType;
+		const T Pi = T(3.14159265358979323846);
+
+		Bench.Primitive("VectorExp", T(-10), T(10), [](const VectorType& A, const VectorType&) { return VectorExp(A); });
+		Bench.Primitive("VectorExp2", T(-10), T(10), [](const VectorType& A, const VectorType&) { return VectorExp2(A); });
+		Bench.Primitive("VectorLog", T(0.01), T(100), [](const VectorType& A, const VectorType&) { return VectorLog(A); });
+		Bench.Primitive("VectorLog2", T(0.01), T(100), [](const VectorType& A, const VectorType&) { return VectorLog2(A); });
+		// Inputs near the ends of the range, where the AVX-512 builds scale with vscalef and split with vgetexp/vgetmant.
+		const T ExpLimit = T(sizeof(T) == sizeof(double) ? 700 : 85);
+		Bench.Primitive("VectorExp (wide)", -ExpLimit, ExpLimit, [](const VectorType& A, const VectorType&) { return VectorExp(A); });
+		Bench.Primitive("VectorExp2 (wide)", -ExpLimit, ExpLimit, [](const VectorType& A, const VectorType&) { return VectorExp2(A); });
+		Bench.Primitive("VectorLog (subnormal)", TNumericLimits<T>::Min() / T(1024), TNumericLimits<T>::Min(), [](const VectorType& A, const VectorType&) { return VectorLog(A); });
+		Bench.Primitive("VectorLog2 (subnormal)", TNumericLimits<T>::Min() / T(1024), TNumericLimits<T>::Min(), [](const VectorType& A, const VectorType&) { return VectorLog2(A); });
+		Bench.Primitive("VectorPow", T(0.5), T(2), [](const VectorType& A, const VectorType& B) { return VectorPow(A, B); });
+		Bench.Primitive("VectorSin", -Pi, Pi, [](const VectorType& A, const VectorType&) { return VectorSin(A); });
+		Bench.Primitive("VectorCos", -Pi, Pi, [](const VectorType& A, const VectorType&) { return VectorCos(A); });
+		Bench.Primitive("VectorTan", -Pi, Pi, [](const VectorType& A, const VectorType&) { return VectorTan(A); });
+		Bench.Primitive("VectorSinCos", -Pi, Pi, [](const VectorType& A, const VectorType&)
+		{
+			VectorType S, C;
+			VectorSinCos(&S, &C, &A);
+			return VectorAdd(S, C);
+		});
+		Bench.Primitive("VectorASin", T(-1), T(1), [](const VectorType& A, const VectorType&) { return VectorASin(A); });
+		Bench.Primitive("VectorACos", T(-1), T(1), [](const VectorType& A, const VectorType&) { return VectorACos(A); });
+		Bench.Primitive("VectorATan", T(-100), T(100), [](const VectorType& A, const VectorType&) { return VectorATan(A); });
+		Bench.Primitive("VectorATan2", T(-2), T(2), [](const VectorType& A, const VectorType& B) { return VectorATan2(A, B); });
+	}
+
+	template<typename T>
+	void RunMatrix(TBenchmark<T>& Bench)
+	{
+		typedef typename TVectorTraits<T>::VectorType VectorType;
+		typedef typename TVectorTraits<T>::MatrixType MatrixType;
+
+		MatrixType Permutation;
+		TBenchmark<T>::MakePermutation(Permutation);
+		MatrixType Matrices[NumMatrices];
+		MatrixType Results[NumMatrices];
+		for (MatrixType& Matrix : Matrices)
+		{
+			Bench.MakeMatrix(Matrix);
+		}
+
+		Bench.Primitive("VectorTransformVector", T(-2), T(2), [&Matrices](const VectorType& A, const VectorType&) { return VectorTransformVector(A, &Matrices[0]); });
+		Bench.Primitive("VectorQuaternionMultiply2", T(-1), T(1), [](const VectorType& A, const VectorType& B) { return VectorQuaternionMultiply2(A, B); });
+
+		MatrixType Chain = Matrices[0];
+		Bench.Custom("VectorMatrixMultiply", NumMatrices,
+			[&]()
+			{
+				const MatrixType* Src = Opaque(Matrices);
+				MatrixType* Dst = Opaque(Results);
+				for (int32 Index = 0; Index < NumMatrices; ++Index)
+				{
+					VectorMatrixMultiply(&Dst[Index], &Src[Index], &Permutation);
+				}
+			},
+			[&]()
+			{
+				VectorMatrixMultiply(Opaque(&Chain), Opaque(&Chain), &Permutation);
+			});
+
+		Chain = Matrices[0];
+		Bench.Custom("VectorMatrixInverse", NumMatrices,
+			[&]()
+			{
+				const MatrixType* Src = Opaque(Matrices);
+				MatrixType* Dst = Opaque(Results);
+				for (int32 Index = 0; Index < NumMatrices; ++Index)
+				{
+					VectorMatrixInverse(&Dst[Index], &Src[Index]);
+				}
+			},
+			[&]()
+			{
+				VectorMatrixInverse(Opaque(&Chain), Opaque(&Chain));
+			});
+	}
+
+	void RunHalf(TBenchmark<float>& Bench)
+	{
+		VectorRegister4Float Vectors[NumInputs];
+		uint16 Halves[NumInputs * 4];
+		for (int32 Index = 0; Index < NumInputs; ++Index)
+		{
+			Vectors[Index] = Bench.Make(-100.0f, 100.0f);
+			VectorStoreHalf4<false>(Vectors[Index], &Halves[Index * 4]);
+		}
+
+		VectorRegister4Float Loaded[NumInputs];
+		uint16 Stored[NumInputs * 4];
+		uint16 ChainHalves[4];
+		VectorStoreHalf4<false>(Vectors[0], ChainHalves);
+
+		Bench.Custom("VectorLoadHalf4", NumInputs,
+			[&]()
+			{
+				const uint16* Src = Opaque(Halves);
+				VectorRegister4Float* Dst = Opaque(Loaded);
+				for (int32 Index = 0; Index < NumInputs; ++Index)
+				{
+					Dst[Index] = VectorLoadHalf4(&Src[Index * 4]);
+				}
+			},
+			// Load and store can only be chained through memory, so latency covers the round trip.
+			[&]()
+			{
+				VectorStoreHalf4<false>(VectorLoadHalf4(Opaque(ChainHalves)), Opaque(ChainHalves));
+			});
+
+		Bench.Custom("VectorStoreHalf4", NumInputs,
+			[&]()
+			{
+				const VectorRegister4Float* Src = Opaque(Vectors);
+				uint16* Dst = Opaque(Stored);
+				for (int32 Index = 0; Index < NumInputs; ++Index)
+				{
+					VectorStoreHalf4<false>(Src[Index], &Dst[Index * 4]);
+				}
+			},
+			[&]()
+			{
+				VectorStoreHalf4<false>(VectorLoadHalf4(Opaque(ChainHalves)), Opaque(ChainHalves));
+			});
+	}
+
+	void RunHalf(TBenchmark<double>& Bench)
+	{
+	}
+
+	template<typename T>
+	struct TBulkData
+	{
+		typedef typename TVectorTraits<T>::VectorType VectorType;
+		typedef typename TVectorTraits<T>::MatrixType MatrixType;
+
+		explicit TBulkData(TBenchmark<T>& Bench)
+		{
+			Bench.MakeMatrix(Matrix);
+			for (int32 Index = 0; Index < NumBulkElements; ++Index)
+			{
+				Src[Index] = Bench.Make(T(-2), T(2));
+				InX[Index] = Bench.Random(T(-2), T(2));
+				InY[Index] = Bench.Random(T(-2), T(2));
+				InZ[Index] = Bench.Random(T(-2), T(2));
+			}
+			for (int32 Index = 0; Index < NumBulkElements / 4; ++Index)
+			{
+				Bench.MakeMatrix(Matrices1[Index]);
+				Bench.MakeMatrix(Matrices2[Index]);
+			}
+		}
+
+		MatrixType Matrix;
+		VectorType Src[NumBulkElements];
+		VectorType Dst[NumBulkElements];
+		T InX[NumBulkElements], InY[NumBulkElements], InZ[NumBulkElements];
+		T OutX[NumBulkElements], OutY[NumBulkElements], OutZ[NumBulkElements], OutW[NumBulkElements];
+		MatrixType Matrices1[NumBulkElements / 4];
+		MatrixType Matrices2[NumBulkElements / 4];
+		MatrixType MatrixResults[NumBulkElements / 4];
+	};
+
+	template<typename T>
+	void RunBulk(TBenchmark<T>& Bench, const char* Dispatch)
+	{
+		TBulkData<T>* Data = new TBulkData<T>(Bench);
+		const int32 NumBulkMatrices = NumBulkElements / 4;
+
+		Bench.Bulk("VectorTransformVectorArray", Dispatch, NumBulkElements, [Data]()
+		{
+			VectorTransformVectorArray(Opaque(Data->Dst), Data->Src, NumBulkElements, &Data->Matrix);
+		});
+		Bench.Bulk("VectorTransformVectorSoA", Dispatch, NumBulkElements, [Data]()
+		{
+			VectorTransformVectorSoA(&Data->Matrix, Opaque(Data->OutX), Data->OutY, Data->OutZ, Data->OutW, Data->InX, Data->InY, Data->InZ, T(1), NumBulkElements);
+		});
+		Bench.Bulk("VectorMatrixMultiplyArray", Dispatch, NumBulkMatrices, [Data, NumBulkMatrices]()
+		{
+			VectorMatrixMultiplyArray(Opaque(Data->MatrixResults), Data->Matrices1, Data->Matrices2, NumBulkMatrices);
+		});
+
+		T* const Components[4] = { Data->OutX, Data->OutY, Data->OutZ, Data->OutW };
+		const T* const ConstComponents[4] = { Data->OutX, Data->OutY, Data->OutZ, Data->OutW };
+		Bench.Bulk("VectorAoSToSoA", Dispatch, NumBulkElements, [Data, &Components]()
+		{
+			VectorAoSToSoA(Opaque(Components), (const T*)Data->Src, NumBulkElements);
+		});
+		Bench.Bulk("AoSToSoALoop", "none", NumBulkElements, [Data]()
+		{
+			const T* Src = (const T*)Data->Src;
+			T* OutX = Opaque(Data->OutX);
+			for (int32 Index = 0; Index < NumBulkElements; ++Index)
+			{
+				OutX[Index] = Src[Index * 4 + 0];
+				Data->OutY[Index] = Src[Index * 4 + 1];
+				Data->OutZ[Index] = Src[Index * 4 + 2];
+				Data->OutW[Index] = Src[Index * 4 + 3];
+			}
+		});
+		Bench.Bulk("VectorSoAToAoS", Dispatch, NumBulkElements, [Data, &ConstComponents]()
+		{
+			VectorSoAToAoS((T*)Opaque(Data->Dst), ConstComponents, NumBulkElements);
+		});
+
+		// The XYZW source reinterpreted as packed XYZ points, as in an FVector3f / FVector3d array.
+		const T* Points = (const T*)Data->Src;
+		const int32 NumPoints = NumBulkElements * 4 / 3;
+		const T* const InComponents[3] = { Data->InX, Data->InY, Data->InZ };
+		T Bounds[2][3];
+		Bench.Bulk("VectorComputeBounds", Dispatch, NumPoints, [Points, NumPoints, &Bounds]()
+		{
+			VectorComputeBounds(Opaque(Bounds[0]), Bounds[1], Points, 3 * sizeof(T), NumPoints);
+		});
+		Bench.Bulk("BoundsLoop", "none", NumPoints, [Points, NumPoints, &Bounds]()
+		{
+			T* Min = Opaque(Bounds[0]);
+			T* Max = Bounds[1];
+			for (int32 Component = 0; Component < 3; ++Component)
+			{
+				Min[Component] = Max[Component] = Points[Component];
+			}
+			for (int32 Index = 1; Index < NumPoints; ++Index)
+			{
+				for (int32 Component = 0; Component < 3; ++Component)
+				{
+					Min[Component] = FMath::Min(Min[Component], Points[Index * 3 + Component]);
+					Max[Component] = FMath::Max(Max[Component], Points[Index * 3 + Component]);
+				}
+			}
+		});
+		Bench.Bulk("VectorComputeBounds (stride 4)", Dispatch, NumBulkElements, [Points, &Bounds]()
+		{
+			VectorComputeBounds(Opaque(Bounds[0]), Bounds[1], Points, 4 * sizeof(T), NumBulkElements);
+		});
+		Bench.Bulk("VectorComputeBoundsSoA", Dispatch, NumBulkElements, [&InComponents, &Bounds]()
+		{
+			VectorComputeBoundsSoA(Opaque(Bounds[0]), Bounds[1], InComponents, NumBulkElements);
+		});
+		const T Center[3] = { T(0), T(0), T(0) };
+		T Radius;
+		Bench.Bulk("VectorComputeBoundingRadius", Dispatch, NumPoints, [Points, NumPoints, &Center, &Radius]()
+		{
+			*Opaque(&Radius) = VectorComputeBoundingRadius(Center, Points, 3 * sizeof(T), NumPoints);
+		});
+		Bench.Bulk("VectorComputeBoundingRadiusSoA", Dispatch, NumBulkElements, [&InComponents, &Center, &Radius]()
+		{
+			*Opaque(&Radius) = VectorComputeBoundingRadiusSoA(Center, InComponents, NumBulkElements);
+		});
+
+		// Six planes around the unit cube, the -2..2 centers leave about half of the objects visible.
+		T* Radii = new T[NumBulkElements];
+		for (int32 Index = 0; Index < NumBulkElements; ++Index)
+		{
+			Radii[Index] = Bench.Random(T(0), T(0.5));
+		}
+		const T Planes[6][4] = { { 1, 0, 0, 1 }, { -1, 0, 0, 1 }, { 0, 1, 0, 1 }, { 0, -1, 0, 1 }, { 0, 0, 1, 1 }, { 0, 0, -1, 1 } };
+		const T* const Spheres[4] = { Data->InX, Data->InY, Data->InZ, Radii };
+		const T* const Boxes[6] = { Data->InX, Data->InY, Data->InZ, Radii, Radii, Radii };
+		uint32 Visible[NumBulkElements / 32];
+		Bench.Bulk("VectorCullSpheresSoA", Dispatch, NumBulkElements, [&Spheres, &Planes, &Visible]()
+		{
+			VectorCullSpheresSoA(Opaque(Visible), Spheres, &Planes[0][0], 6, NumBulkElements);
+		});
+		Bench.Bulk("CullSpheresLoop", "none", NumBulkElements, [&Spheres, &Planes, &Visible]()
+		{
+			uint32* Dst = Opaque(Visible);
+			for (int32 Index = 0; Index < NumBulkElements; ++Index)
+			{
+				bool bVisible = true;
+				for (int32 Plane = 0; Plane < 6 && bVisible; ++Plane)
+				{
+					const T Distance = Planes[Plane][0] * Spheres[0][Index] + Planes[Plane][1] * Spheres[1][Index] + Planes[Plane][2] * Spheres[2][Index] - Planes[Plane][3];
+					bVisible = Distance <= Spheres[3][Index];
+				}
+				if (Index % 32 == 0)
+				{
+					Dst[Index / 32] = 0;
+				}
+				Dst[Index / 32] |= uint32(bVisible) << (Index % 32);
+			}
+		});
+		Bench.Bulk("VectorCullBoxesSoA", Dispatch, NumBulkElements, [&Boxes, &Planes, &Visible]()
+		{
+			VectorCullBoxesSoA(Opaque(Visible), Boxes, &Planes[0][0], 6, NumBulkElements);
+		});
+		delete[] Radii;
+
+		delete Data;
+	}
+
+	/** Quaternions stored both as SoA component arrays for the batch kernels and as FQuat / VectorRegister arrays for the per-element loops. */
+	template<typename T>
+	struct TBulkQuaternionData
+	{
+		typedef typename TVectorTraits<T>::VectorType VectorType;
+		typedef typename TVectorTraits<T>::QuatType QuatType;
+		typedef typename TVectorTraits<T>::Vector3Type Vector3Type;
+
+		// Components are NumBulkElements + 16 apart so the arrays don't all share the same 4KB page offset.
+		static constexpr int32 Stride = NumBulkElements + 16;
+
+		explicit TBulkQuaternionData(TBenchmark<T>& Bench)
+		{
+			for (int32 Component = 0; Component < 4; ++Component)
+			{
+				Quat1[Component] = Storage + (Component + 0) * Stride;
+				Quat2[Component] = Storage + (Component + 4) * Stride;
+				Result[Component] = Storage + (Component + 8) * Stride;
+				Vector[Component] = Storage + (Component + 12) * Stride;
+			}
+			for (int32 Index = 0; Index < NumBulkElements; ++Index)
+			{
+				Quats1[Index] = QuatType(Bench.Random(T(-1), T(1)), Bench.Random(T(-1), T(1)), Bench.Random(T(-1), T(1)), Bench.Random(T(-1), T(1))).GetNormalized();
+				Quats2[Index] = QuatType(Bench.Random(T(-1), T(1)), Bench.Random(T(-1), T(1)), Bench.Random(T(-1), T(1)), Bench.Random(T(-1), T(1))).GetNormalized();
+				Vectors[Index] = Vector3Type(Bench.Random(T(-100), T(100)), Bench.Random(T(-100), T(100)), Bench.Random(T(-100), T(100)));
+				Alpha[Index] = Bench.Random(T(0), T(1));
+				RegisterQuats1[Index] = VectorLoad(&Quats1[Index].X);
+				RegisterQuats2[Index] = VectorLoad(&Quats2[Index].X);
+				for (int32 Component = 0; Component < 4; ++Component)
+				{
+					Quat1[Component][Index] = (&Quats1[Index].X)[Component];
+					Quat2[Component][Index] = (&Quats2[Index].X)[Component];
+					Vector[Component][Index] = Component < 3 ? Vectors[Index][Component] : T(0);
+				}
+			}
+		}
+
+		T Storage[16 * Stride];
+		T* Quat1[4];
+		T* Quat2[4];
+		T* Result[4];
+		T* Vector[4];
+		T Alpha[NumBulkElements];
+		QuatType Quats1[NumBulkElements];
+		QuatType Quats2[NumBulkElements];
+		QuatType QuatResults[NumBulkElements];
+		Vector3Type Vectors[NumBulkElements];
+		Vector3Type VectorResults[NumBulkElements];
+		VectorType RegisterQuats1[NumBulkElements];
+		VectorType RegisterQuats2[NumBulkElements];
+		VectorType RegisterResults[NumBulkElements];
+	};
+
+	/** Times the SoA quaternion kernels against per-element loops over the existing single quaternion functions. */
+	template<typename T>
+	void RunBulkQuaternion(TBenchmark<T>& Bench, const char* Dispatch)
+	{
+		typedef typename TVectorTraits<T>::QuatType QuatType;
+		TBulkQuaternionData<T>* Data = new TBulkQuaternionData<T>(Bench);
+
+		Bench.Bulk("VectorQuaternionMultiplySoA", Dispatch, NumBulkElements, [Data]()
+		{
+			VectorQuaternionMultiplySoA(Opaque(Data->Result), Data->Quat1, Data->Quat2, NumBulkElements);
+		});
+		Bench.Bulk("VectorQuaternionMultiply2Loop", "none", NumBulkElements, [Data]()
+		{
+			for (int32 Index = 0; Index < NumBulkElements; ++Index)
+			{
+				Opaque(Data->RegisterResults)[Index] = VectorQuaternionMultiply2(Data->RegisterQuats1[Index], Data->RegisterQuats2[Index]);
+			}
+		});
+		Bench.Bulk("VectorQuaternionNormalizeSoA", Dispatch, NumBulkElements, [Data]()
+		{
+			VectorQuaternionNormalizeSoA(Opaque(Data->Result), Data->Quat1, NumBulkElements);
+		});
+		Bench.Bulk("FQuatGetNormalizedLoop", "none", NumBulkElements, [Data]()
+		{
+			for (int32 Index = 0; Index < NumBulkElements; ++Index)
+			{
+				Opaque(Data->QuatResults)[Index] = Data->Quats1[Index].GetNormalized();
+			}
+		});
+		Bench.Bulk("VectorQuaternionNLerpSoA", Dispatch, NumBulkElements, [Data]()
+		{
+			VectorQuaternionNLerpSoA(Opaque(Data->Result), Data->Quat1, Data->Quat2, Data->Alpha, NumBulkElements);
+		});
+		Bench.Bulk("FQuatFastLerpLoop", "none", NumBulkElements, [Data]()
+		{
+			for (int32 Index = 0; Index < NumBulkElements; ++Index)
+			{
+				Opaque(Data->QuatResults)[Index] = QuatType::FastLerp(Data->Quats1[Index], Data->Quats2[Index], Data->Alpha[Index]).GetNormalized();
+			}
+		});
+		Bench.Bulk("VectorQuaternionSlerpSoA", Dispatch, NumBulkElements, [Data]()
+		{
+			VectorQuaternionSlerpSoA(Opaque(Data->Result), Data->Quat1, Data->Quat2, Data->Alpha, NumBulkElements);
+		});
+		Bench.Bulk("FQuatSlerpLoop", "none", NumBulkElements, [Data]()
+		{
+			for (int32 Index = 0; Index < NumBulkElements; ++Index)
+			{
+				Opaque(Data->QuatResults)[Index] = QuatType::Slerp(Data->Quats1[Index], Data->Quats2[Index], Data->Alpha[Index]);
+			}
+		});
+		Bench.Bulk("VectorQuaternionRotateVectorSoA", Dispatch, NumBulkElements, [Data]()
+		{
+			VectorQuaternionRotateVectorSoA(Opaque(Data->Result), Data->Quat1, Data->Vector, NumBulkElements);
+		});
+		Bench.Bulk("FQuatRotateVectorLoop", "none", NumBulkElements, [Data]()
+		{
+			for (int32 Index = 0; Index < NumBulkElements; ++Index)
+			{
+				Opaque(Data->VectorResults)[Index] = Data->Quats1[Index].RotateVector(Data->Vectors[Index]);
+			}
+		});
+
+		delete Data;
+	}
+
+	void RunBulkHalf(TBenchmark<float>& Bench, const char* Dispatch)
+	{
+		const int32 NumValues = NumBulkElements * 4;
+		float* Floats = new float[NumValues];
+		uint16* Halves = new uint16[NumValues];
+		for (int32 Index = 0; Index < NumValues; ++Index)
+		{
+			Floats[Index] = Bench.Random(-100.0f, 100.0f);
+		}
+		VectorFloatToHalfArray(Halves, Floats, NumValues);
+
+		Bench.Bulk("VectorFloatToHalfArray", Dispatch, NumValues, [Floats, Halves, NumValues]()
+		{
+			VectorFloatToHalfArray(Opaque(Halves), Floats, NumValues);
+		});
+		Bench.Bulk("VectorHalfToFloatArray", Dispatch, NumValues, [Floats, Halves, NumValues]()
+		{
+			VectorHalfToFloatArray(Opaque(Floats), Halves, NumValues);
+		});
+
+		// Clean buffers, the common case when validating render output.
+		FVectorScanResult ScanResult;
+		Bench.Bulk("VectorScanNonFiniteArray", Dispatch, NumValues, [Floats, NumValues, &ScanResult]()
+		{
+			*Opaque(&ScanResult) = VectorScanNonFiniteArray(Floats, NumValues);
+		});
+		Bench.Bulk("NonFiniteScanLoop", "none", NumValues, [Floats, NumValues, &ScanResult]()
+		{
+			FVectorScanResult Result;
+			for (int32 Index = 0; Index < NumValues; ++Index)
+			{
+				if (!FMath::IsFinite(Floats[Index]))
+				{
+					Result.FirstIndex = Result.FirstIndex < 0 ? Index : Result.FirstIndex;
+					++Result.NumFound;
+				}
+			}
+			*Opaque(&ScanResult) = Result;
+		});
+		Bench.Bulk("VectorScanNonFiniteHalfArray", Dispatch, NumValues, [Halves, NumValues, &ScanResult]()
+		{
+			*Opaque(&ScanResult) = VectorScanNonFiniteHalfArray(Halves, NumValues);
+		});
+		Bench.Bulk("VectorScanOutOfRangeArray", Dispatch, NumValues, [Floats, NumValues, &ScanResult]()
+		{
+			*Opaque(&ScanResult) = VectorScanOutOfRangeArray(Floats, NumValues, -1000.0f, 1000.0f);
+		});
+
+		delete[] Floats;
+		delete[] Halves;
+	}
+
+	void RunBulkHalf(TBenchmark<double>& Bench, const char* Dispatch)
+	{
+	}
+
+	/** bfloat16 weights for the GEMV cases, large enough to leave L1 so the halved weight traffic shows. */
+	struct FBulkBFloat16Data
+	{
+		static constexpr int32 NumRows = 256;
+		static constexpr int32 NumColumns = NumBulkElements;
+
+		explicit FBulkBFloat16Data(TBenchmark<float>& Bench)
+		{
+			for (int32 Index = 0; Index < NumRows * NumColumns; ++Index)
+			{
+				Weights[Index] = Bench.Random(-1.0f, 1.0f);
+			}
+			for (int32 Index = 0; Index < NumColumns; ++Index)
+			{
+				Vector[Index] = Bench.Random(-1.0f, 1.0f);
+			}
+			VectorFloatToBFloat16Array(PackedWeights, Weights, NumRows * NumColumns);
+			VectorFloatToBFloat16Array(PackedVector, Vector, NumColumns);
+		}
+
+		float Weights[NumRows * NumColumns];
+		float Vector[NumColumns];
+		float Result[NumRows];
+		uint16 PackedWeights[NumRows * NumColumns];
+		uint16 PackedVector[NumColumns];
+	};
+
+	void RunBulkBFloat16(TBenchmark<float>& Bench, const char* Dispatch)
+	{
+		typedef FBulkBFloat16Data FData;
+		FData* Data = new FData(Bench);
+
+		Bench.Bulk("VectorFloatToBFloat16Array", Dispatch, NumBulkElements, [Data]()
+		{
+			VectorFloatToBFloat16Array(Opaque(Data->PackedWeights), Data->Weights, NumBulkElements);
+		});
+		Bench.Bulk("VectorBFloat16ToFloatArray", Dispatch, NumBulkElements, [Data]()
+		{
+			VectorBFloat16ToFloatArray(Opaque(Data->Weights), Data->PackedWeights, NumBulkElements);
+		});
+		Bench.Bulk("VectorMatrixVectorMultiplyBFloat16", Dispatch, FData::NumRows * FData::NumColumns, [Data]()
+		{
+			VectorMatrixVectorMultiplyBFloat16(Opaque(Data->Result), Data->PackedWeights, Data->PackedVector, FData::NumRows, FData::NumColumns);
+		});
+		Bench.Bulk("MatrixVectorMultiplyFloatLoop", "none", FData::NumRows * FData::NumColumns, [Data]()
+		{
+			for (int32 Row = 0; Row < FData::NumRows; ++Row)
+			{
+				const float* Weights = Data->Weights + Row * FData::NumColumns;
+				VectorRegister4Float Sum = VectorZeroFloat();
+				for (int32 Column = 0; Column < FData::NumColumns; Column += 4)
+				{
+					Sum = VectorMultiplyAdd(VectorLoad(Weights + Column), VectorLoad(Data->Vector + Column), Sum);
+				}
+				Opaque(Data->Result)[Row] = VectorGetComponent(VectorDot4(Sum, VectorOneFloat()), 0);
+			}
+		});
+
+		delete Data;
+	}
+
+	void RunBulkBFloat16(TBenchmark<double>& Bench, const char* Dispatch)
+	{
+	}
+
+	void RunBulkPacked(TBenchmark<float>& Bench, const char* Dispatch)
+	{
+		const int32 NumPixels = NumBulkElements;
+		float* Floats = new float[NumPixels * 4];
+		uint16* Packed = new uint16[NumPixels * 4];
+		for (int32 Index = 0; Index < NumPixels * 4; ++Index)
+		{
+			Floats[Index] = Bench.Random(-0.1f, 1.1f);
+			Packed[Index] = uint16(Bench.Random(0.0f, 65535.0f));
+		}
+
+		Bench.Bulk("VectorLoadByte4Array", Dispatch, NumPixels, [Floats, Packed, NumPixels]() { VectorLoadByte4Array(Opaque(Floats), Packed, NumPixels); });
+		Bench.Bulk("VectorStoreByte4Array", Dispatch, NumPixels, [Floats, Packed, NumPixels]() { VectorStoreByte4Array(Opaque(Packed), Floats, NumPixels); });
+		Bench.Bulk("VectorLoadURGB10A2NArray", Dispatch, NumPixels, [Floats, Packed, NumPixels]() { VectorLoadURGB10A2NArray(Opaque(Floats), Packed, NumPixels); });
+		Bench.Bulk("VectorStoreURGB10A2NArray", Dispatch, NumPixels, [Floats, Packed, NumPixels]() { VectorStoreURGB10A2NArray(Opaque(Packed), Floats, NumPixels); });
+		Bench.Bulk("VectorLoadURGBA16NArray", Dispatch, NumPixels, [Floats, Packed, NumPixels]() { VectorLoadURGBA16NArray(Opaque(Floats), Packed, NumPixels); });
+		Bench.Bulk("VectorLoadSRGBA16NArray", Dispatch, NumPixels, [Floats, Packed, NumPixels]() { VectorLoadSRGBA16NArray(Opaque(Floats), Packed, NumPixels); });
+		Bench.Bulk("VectorStoreURGBA16NArray", Dispatch, NumPixels, [Floats, Packed, NumPixels]() { VectorStoreURGBA16NArray(Opaque(Packed), Floats, NumPixels); });
+
+		delete[] Floats;
+		delete[] Packed;
+	}
+
+	void RunBulkPacked(TBenchmark<double>& Bench, const char* Dispatch)
+	{
+	}
+
+	/**
+	 * 64 MB copies and fills, in ns per 64-byte line. The buffers are far past the LLC of most machines, so the plain
+	 * and streamed routines are compared once at the default threshold and once with streaming forced on.
+	 */
+	void RunBulkStreaming(TBenchmark<float>& Bench)
+	{
+		const SIZE_T Size = SIZE_T(64) << 20;
+		const int32 NumLines = int32(Size / 64);
+		uint8* Src = new uint8[Size];
+		uint8* Dst = new uint8[Size];
+		memset(Src, 0x5A, Size);
+		memset(Dst, 0, Size);
+
+		const SIZE_T DefaultThreshold = VectorGetStreamingThreshold();
+		Bench.Bulk("Memcpy", "none", NumLines, [Src, Dst, Size]() { memcpy(Opaque(Dst), Src, Size); });
+		Bench.Bulk("VectorMemcpyStreamed", "none", NumLines, [Src, Dst, Size]() { VectorMemcpyStreamed(Opaque(Dst), Src, Size); });
+		Bench.Bulk("Memset", "none", NumLines, [Dst, Size]() { memset(Opaque(Dst), 0x5A, Size); });
+		Bench.Bulk("VectorMemsetStreamed", "none", NumLines, [Dst, Size]() { VectorMemsetStreamed(Opaque(Dst), 0x5A, Size); });
+
+		VectorSetStreamingThreshold(0);
+		Bench.Bulk("VectorMemcpyStreamed (always)", "none", NumLines, [Src, Dst, Size]() { VectorMemcpyStreamed(Opaque(Dst), Src, Size); });
+		Bench.Bulk("VectorMemsetStreamed (always)", "none", NumLines, [Dst, Size]() { VectorMemsetStreamed(Opaque(Dst), 0x5A, Size); });
+		VectorSetStreamingThreshold(DefaultThreshold);
+
+		delete[] Src;
+		delete[] Dst;
+	}
+
+	void RunBulkStreaming(TBenchmark<double>& Bench)
+	{
+	}
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS && !PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+	const char* GetBulkLevelName(EVectorBulkLevel Level)
+	{
+		switch (Level)
+		{
+		case EVectorBulkLevel::AVX512BF16:	return "AVX512BF16";
+		case EVectorBulkLevel::AVX512:	return "AVX512";
+		case EVectorBulkLevel::AVX2:	return "AVX2";
+		default:						return "SSE";
+		}
+	}
+
+	/** Pins the bulk routines to each tier the CPU supports in turn, then restores the detected tier. */
+	template<typename T>
+	void RunDispatchTiers(TBenchmark<T>& Bench)
+	{
+		const EVectorBulkLevel Supported = GetSupportedVectorBulkLevel();
+		for (EVectorBulkLevel Level : { EVectorBulkLevel::SSE, EVectorBulkLevel::AVX2, EVectorBulkLevel::AVX512, EVectorBulkLevel::AVX512BF16 })
+		{
+			if (Level <= Supported)
+			{
+				SetVectorBulkLevel(Level);
+				const char* Dispatch = GetBulkLevelName(Level);
+				RunBulk(Bench, Dispatch);
+				RunBulkQuaternion(Bench, Dispatch);
+				RunBulkHalf(Bench, Dispatch);
+				RunBulkBFloat16(Bench, Dispatch);
+				RunBulkPacked(Bench, Dispatch);
+			}
+		}
+		SetVectorBulkLevel(Supported);
+	}
+#endif // UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+#endif
+
+	/** Sweeps the double transcendental primitives against the C library, see -accuracy above. */
+	class FAccuracySweep
+	{
+	public:
+		explicit FAccuracySweep(const FOptions& InOptions)
+			: Options(InOptions)
+			, FilterUtf8(*InOptions.Filter)
+		{
+		}
+
+		bool Matches(const char* Name) const
+		{
+			return Options.Filter.IsEmpty() || FCStringAnsi::Strstr(Name, FilterUtf8.Get()) != nullptr;
+		}
+
+		uint64 RandomBits()
+		{
+			RandomState = RandomState * 6364136223846793005ull + 1442695040888963407ull;
+			return RandomState ^ (RandomState >> 29);
+		}
+
+		/** Random finite double of any exponent and sign. */
+		double RandomFinite()
+		{
+			for (;;)
+			{
+				const uint64 Bits = RandomBits();
+				double Value;
+				FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+				if (FMath::IsFinite(Value))
+				{
+					return Value;
+				}
+			}
+		}
+
+		double RandomUniform(double Lo, double Hi)
+		{
+			return Lo + (Hi - Lo) * double(RandomBits() >> 11) * (1.0 / 9007199254740992.0);
+		}
+
+		/** Distance in units in the last place, counted across zero; both arguments finite. */
+		static uint64 UlpDistance(double A, double B)
+		{
+			int64 BitsA, BitsB;
+			FMemory::Memcpy(&BitsA, &A, sizeof(A));
+			FMemory::Memcpy(&BitsB, &B, sizeof(B));
+			const uint64 OrderedA = BitsA < 0 ? uint64(0x8000000000000000ull) - uint64(BitsA & 0x7fffffffffffffffll) : uint64(0x8000000000000000ull) + uint64(BitsA);
+			const uint64 OrderedB = BitsB < 0 ? uint64(0x8000000000000000ull) - uint64(BitsB & 0x7fffffffffffffffll) : uint64(0x8000000000000000ull) + uint64(BitsB);
+			return OrderedA > OrderedB ? OrderedA - OrderedB : OrderedB - OrderedA;
+		}
+
+		/** True if Result and Expected are both NaN, equal infinities, or both finite. */
+		static bool SameClass(double Result, double Expected)
+		{
+			if (FMath::IsNaN(Expected) || FMath::IsNaN(Result))
+			{
+				return FMath::IsNaN(Expected) && FMath::IsNaN(Result);
+			}
+			if (!FMath::IsFinite(Expected) || !FMath::IsFinite(Result))
+			{
+				return Result == Expected;
+			}
+			return true;
+		}
+
+		/**
+		 * Evaluates Op four lanes at a time on Count inputs from Generate and prints the largest ulp distance to Ref.
+		 * Generate fills the NumArgs arguments of one sample, Specials are evaluated first and checked for their class.
+		 */
+		template<int32 NumArgs, typename GenerateType, typename OpType, typename RefType>
+		void Sweep(const char* Name, const char* Range, const double (*Specials)[NumArgs], int32 NumSpecials, int32 Count, GenerateType&& Generate, OpType&& Op, RefType&& Ref)
+		{
+			uint64 MaxUlp = 0;
+			double Worst[NumArgs] = {};
+			bool bSpecialsPass = true;
+
+			const int32 Total = NumSpecials + Count;
+			for (int32 Base = 0; Base < Total; Base += 4)
+			{
+				alignas(32) double Args[NumArgs][4];
+				for (int32 Lane = 0; Lane < 4; ++Lane)
+				{
+					const int32 Index = FMath::Min(Base + Lane, Total - 1);
+					double Sample[NumArgs];
+					if (Index < NumSpecials)
+					{
+						FMemory::Memcpy(Sample, Specials[Index], sizeof(Sample));
+					}
+					else
+					{
+						Generate(Sample);
+					}
+					for (int32 Arg = 0; Arg < NumArgs; ++Arg)
+					{
+						Args[Arg][Lane] = Sample[Arg];
+					}
+				}
+
+				alignas(32) double Results[4];
+				VectorStoreAligned(Op(VectorLoadAligned(Args[0]), VectorLoadAligned(Args[NumArgs - 1])), Results);
+
+				for (int32 Lane = 0; Lane < 4 && Base + Lane < Total; ++Lane)
+				{
+					const double Expected = Ref(Args[0][Lane], Args[NumArgs - 1][Lane]);
+					const bool bSameClass = SameClass(Results[Lane], Expected);
+					const uint64 Ulp = !bSameClass ? ~uint64(0) : FMath::IsFinite(Expected) ? UlpDistance(Results[Lane], Expected) : 0;
+					bSpecialsPass &= bSameClass || Base + Lane >= NumSpecials;
+					if (Ulp > MaxUlp)
+					{
+						MaxUlp = Ulp;
+						for (int32 Arg = 0; Arg < NumArgs; ++Arg)
+						{
+							Worst[Arg] = Args[Arg][Lane];
+						}
+					}
+				}
+			}
+
+			printf("{\"primitive\":\"%s\",\"type\":\"double\",\"isa\":\"%s\",\"range\":\"%s\",\"samples\":%d,\"maxulp\":",
+				Name, GetCompiledIsaName(), Range, Total);
+			if (MaxUlp == ~uint64(0))
+			{
+				printf("\"class mismatch\"");
+			}
+			else
+			{
+				printf("%llu", (unsigned long long)MaxUlp);
+			}
+			for (int32 Arg = 0; Arg < NumArgs; ++Arg)
+			{
+				printf("%s%.17g", Arg == 0 ? ",\"worst\":[" : ",", Worst[Arg]);
+			}
+			printf("],\"specials\":\"%s\"}\n", bSpecialsPass ? "pass" : "fail");
+			fflush(stdout);
+		}
+
+		/** Sweeps a unary primitive over the full finite range and uniformly over [Lo, Hi]. */
+		template<typename OpType, typename RefType>
+		void Unary(const char* Name, double Lo, double Hi, OpType&& Op, RefType&& Ref)
+		{
+			if (!Matches(Name))
+			{
+				return;
+			}
+			Sweep<1>(Name, "full", UnarySpecials, UE_ARRAY_COUNT(UnarySpecials), Options.NumSamples,
+				[this](double* Sample) { Sample[0] = RandomFinite(); }, Op, Ref);
+			Sweep<1>(Name, "core", UnarySpecials, 0, Options.NumSamples,
+				[this, Lo, Hi](double* Sample) { Sample[0] = RandomUniform(Lo, Hi); }, Op, Ref);
+		}
+
+		template<typename OpType, typename RefType>
+		void Binary(const char* Name, double Lo, double Hi, OpType&& Op, RefType&& Ref)
+		{
+			if (!Matches(Name))
+			{
+				return;
+			}
+			Sweep<2>(Name, "full", BinarySpecials, UE_ARRAY_COUNT(BinarySpecials), Options.NumSamples,
+				[this](double* Sample) { Sample[0] = RandomFinite(); Sample[1] = RandomFinite(); }, Op, Ref);
+			Sweep<2>(Name, "core", BinarySpecials, 0, Options.NumSamples,
+				[this, Lo, Hi](double* Sample) { Sample[0] = RandomUniform(Lo, Hi); Sample[1] = RandomUniform(Lo, Hi); }, Op, Ref);
+		}
+
+		void Run()
+		{
+			typedef VectorRegister4Double VectorType;
+
+			static constexpr double Specials[] =
+			{
+				0.0, -0.0, 4.9406564584124654e-324, -4.9406564584124654e-324, 2.2250738585072014e-308, -2.2250738585072014e-308,
+				0.5, -0.5, 1.0, -1.0, 2.0, -2.0, 1.5707963267948966, -1.5707963267948966, 67108864.0, -67108864.0,
+				709.782712893384, -708.39641853226408, -745.13321910194110, 1023.0, 1024.0, -1022.0, -1074.0, -1075.0,
+				DBL_MAX, -DBL_MAX, INFINITY, -INFINITY, NAN,
+			};
+			static_assert(UE_ARRAY_COUNT(Specials) == NumSpecialValues, "Resize UnarySpecials and BinarySpecials");
+			for (int32 Index = 0; Index < UE_ARRAY_COUNT(Specials); ++Index)
+			{
+				UnarySpecials[Index][0] = Specials[Index];
+				for (int32 Other = 0; Other < UE_ARRAY_COUNT(Specials); ++Other)
+				{
+					BinarySpecials[Index * UE_ARRAY_COUNT(Specials) + Other][0] = Specials[Index];
+					BinarySpecials[Index * UE_ARRAY_COUNT(Specials) + Other][1] = Specials[Other];
+				}
+			}
+
+			Unary("VectorExp", -746.0, 710.0, [](const VectorType& A, const VectorType&) { return VectorExp(A); }, [](double A, double) { return exp(A); });
+			Unary("VectorExp2", -1076.0, 1025.0, [](const VectorType& A, const VectorType&) { return VectorExp2(A); }, [](double A, double) { return exp2(A); });
+			Unary("VectorLog", 0.0, 4.0, [](const VectorType& A, const VectorType&) { return VectorLog(A); }, [](double A, double) { return log(A); });
+			Unary("VectorLog2", 0.0, 4.0, [](const VectorType& A, const VectorType&) { return VectorLog2(A); }, [](double A, double) { return log2(A); });
+			Unary("VectorTan", -67108864.0, 67108864.0, [](const VectorType& A, const VectorType&) { return VectorTan(A); }, [](double A, double) { return tan(A); });
+			Unary("VectorASin", -1.0, 1.0, [](const VectorType& A, const VectorType&) { return VectorASin(A); }, [](double A, double) { return asin(A); });
+			Unary("VectorACos", -1.0, 1.0, [](const VectorType& A, const VectorType&) { return VectorACos(A); }, [](double A, double) { return acos(A); });
+			Unary("VectorATan", -16.0, 16.0, [](const VectorType& A, const VectorType&) { return VectorATan(A); }, [](double A, double) { return atan(A); });
+			Binary("VectorATan2", -2.0, 2.0, [](const VectorType& A, const VectorType& B) { return VectorATan2(A, B); }, [](double A, double B) { return atan2(A, B); });
+		}
+
+	private:
+		static constexpr int32 NumSpecialValues = 29;
+
+		const FOptions& Options;
+		FTCHARToUTF8 FilterUtf8;
+		uint64 RandomState = 0x853c49e6748fea9bull;
+		double UnarySpecials[NumSpecialValues][1];
+		double BinarySpecials[NumSpecialValues * NumSpecialValues][2];
+	};
+
+	template<typename T>
+	void Run(const FOptions& Options)
+	{
+		TBenchmark<T> Bench(Options);
+		RunArithmetic(Bench);
+		RunTranscendental(Bench);
+		RunMatrix(Bench);
+		RunHalf(Bench);
+
+		const char* BulkDispatch = "none";
+#if PLATFORM_ENABLE_VECTORINTRINSICS && !PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		BulkDispatch = "auto";
+#endif
+#endif
+		RunBulk(Bench, BulkDispatch);
+		RunBulkQuaternion(Bench, BulkDispatch);
+		RunBulkHalf(Bench, BulkDispatch);
+		RunBulkBFloat16(Bench, BulkDispatch);
+		RunBulkPacked(Bench, BulkDispatch);
+		RunBulkStreaming(Bench);
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS && !PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		RunDispatchTiers(Bench);
+#endif
+#endif
+	}
+}
+
+INT32_MAIN_INT32_ARGC_TCHAR_ARGV()
+{
+	using namespace VectorMathBenchmark;
+
+	FPlatformTime::InitTiming();
+
+	const FString CommandLine = FCommandLine::BuildFromArgV(nullptr, ArgC, ArgV, nullptr);
+	FOptions Options;
+	FParse::Value(*CommandLine, TEXT("-filter="), Options.Filter);
+	FParse::Value(*CommandLine, TEXT("-type="), Options.Type);
+	FParse::Value(*CommandLine, TEXT("-mintime="), Options.MinTime);
+	FParse::Value(*CommandLine, TEXT("-samples="), Options.NumSamples);
+
+	if (FParse::Param(*CommandLine, TEXT("accuracy")))
+	{
+		FAccuracySweep(Options).Run();
+		return 0;
+	}
+
+	if (Options.Type.IsEmpty() || Options.Type == TEXT("float"))
+	{
+		Run<float>(Options);
+	}
+	if (Options.Type.IsEmpty() || Options.Type == TEXT("double"))
+	{
+		Run<double>(Options);
+	}
+
+	return 0;
+}
@@ -0,0 +1,27 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+using UnrealBuildTool;
+using System.Collections.Generic;
+
+[SupportedPlatforms(UnrealPlatformClass.Desktop)]
+public class VectorMathBenchmarkTarget : TargetRules
+{
+	public VectorMathBenchmarkTarget(TargetInfo Target) : base(Target)
+	{
+		Type = TargetType.Program;
+		IncludeOrderVersion = EngineIncludeOrderVersion.Latest;
+		LinkType = TargetLinkType.Monolithic;
+		LaunchModuleName = "VectorMathBenchmark";
+
+		// Only Core is needed, the benchmark never boots the engine loop.
+		bBuildDeveloperTools = false;
+		bBuildWithEditorOnlyData = false;
+		bCompileAgainstEngine = false;
+		bCompileAgainstCoreUObject = false;
+		bCompileAgainstApplicationCore = false;
+		bCompileICU = false;
+
+		// Results go to stdout so they can be piped into other tools.
+		bIsBuildingConsoleApplication = true;
+	}
+}
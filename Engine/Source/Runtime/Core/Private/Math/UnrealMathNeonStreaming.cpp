@@ -0,0 +1,35 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Math/VectorRegister.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+
+#include <atomic>
+#include <string.h>
+
+// Streaming copy and fill, see UnrealMathNeon.h.
+
+static std::atomic<SIZE_T> GVectorStreamingThreshold(SIZE_T(4) << 20);
+
+SIZE_T VectorGetStreamingThreshold()
+{
+	return GVectorStreamingThreshold.load(std::memory_order_relaxed);
+}
+
+void VectorSetStreamingThreshold(SIZE_T Threshold)
+{
+	GVectorStreamingThreshold.store(Threshold, std::memory_order_relaxed);
+}
+
+void VectorMemcpyStreamed(void* RESTRICT Dst, const void* RESTRICT Src, SIZE_T Size)
+{
+	memcpy(Dst, Src, Size);
+}
+
+void VectorMemsetStreamed(void* Dst, uint8 Value, SIZE_T Size)
+{
+	memset(Dst, Value, Size);
+}
+
+#endif // PLATFORM_ENABLE_VECTORINTRINSICS_NEON
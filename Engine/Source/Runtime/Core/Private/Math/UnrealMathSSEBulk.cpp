@@ -0,0 +1,3252 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Math/VectorRegister.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS && !PLATFORM_ENABLE_VECTORINTRINSICS_NEON && !WITH_DIRECTXMATH
+
+#include <atomic>
+#include <string.h>
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+namespace SSEVectorHelperFuncs
+{
+	FORCEINLINE void InternalCpuId(uint32 Leaf, uint32 SubLeaf, uint32 (&OutRegs)[4])
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		__cpuidex((int*)OutRegs, (int)Leaf, (int)SubLeaf);
+#else
+		__cpuid_count(Leaf, SubLeaf, OutRegs[0], OutRegs[1], OutRegs[2], OutRegs[3]);
+#endif
+	}
+} // namespace SSEVectorHelperFuncs
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+
+// Runtime dispatched kernels are compiled for a wider target than the rest of Core. MSVC accepts any intrinsic without this.
+// On AVX builds the kernels that only need AVX keep the baseline target, so AVX-only CPUs can run them from the SSE level.
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH && (defined(__clang__) || defined(__GNUC__))
+#if UE_PLATFORM_MATH_USE_AVX
+#define UE_SSE_TARGET_AVX
+#else
+#define UE_SSE_TARGET_AVX		__attribute__((target("avx,avx2,fma,f16c")))
+#endif
+#define UE_SSE_TARGET_AVX_2		__attribute__((target("avx,avx2,fma,f16c")))
+#define UE_SSE_TARGET_AVX_512	__attribute__((target("avx,avx2,fma,f16c,avx512f,avx512vl,avx512dq,avx512bw")))
+#define UE_SSE_TARGET_AVX_512_BF16	__attribute__((target("avx,avx2,fma,f16c,avx512f,avx512vl,avx512dq,avx512bw,avx512bf16")))
+#else
+#define UE_SSE_TARGET_AVX
+#define UE_SSE_TARGET_AVX_2
+#define UE_SSE_TARGET_AVX_512
+#define UE_SSE_TARGET_AVX_512_BF16
+#endif
+
+// The AVX kernels may only fuse multiply-adds when nothing but the AVX2 level (AVX2 + FMA3 + F16C) runs them.
+#define UE_SSE_AVX_KERNELS_USE_FMA3		(UE_PLATFORM_MATH_USE_FMA3 || (UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH && !UE_PLATFORM_MATH_USE_AVX))
+
+namespace SSEVectorHelperFuncs
+{
+#if UE_PLATFORM_MATH_USE_AVX || UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+	UE_SSE_TARGET_AVX FORCEINLINE __m256 InternalMultiplyAdd256(const __m256& A, const __m256& B, const __m256& C)
+	{
+#if UE_SSE_AVX_KERNELS_USE_FMA3
+		return _mm256_fmadd_ps(A, B, C);
+#else
+		return _mm256_add_ps(_mm256_mul_ps(A, B), C);
+#endif
+	}
+
+	UE_SSE_TARGET_AVX FORCEINLINE __m256d InternalMultiplyAdd256(const __m256d& A, const __m256d& B, const __m256d& C)
+	{
+#if UE_SSE_AVX_KERNELS_USE_FMA3
+		return _mm256_fmadd_pd(A, B, C);
+#else
+		return _mm256_add_pd(_mm256_mul_pd(A, B), C);
+#endif
+	}
+
+	// AVX kernels for the bulk routines below. Each one starts at Index, processes as many elements as its width allows and returns where it stopped.
+	UE_SSE_TARGET_AVX inline int32 InternalVectorTransformVectorArrayAVX(VectorRegister4Float* Dst, const VectorRegister4Float* Src, int32 Index, int32 Count, const float* MRows)
+	{
+		// Two vectors per iteration, each 128-bit lane holds one vector.
+		const __m256 Row0 = _mm256_broadcast_ps((const __m128*)(MRows + 0));
+		const __m256 Row1 = _mm256_broadcast_ps((const __m128*)(MRows + 4));
+		const __m256 Row2 = _mm256_broadcast_ps((const __m128*)(MRows + 8));
+		const __m256 Row3 = _mm256_broadcast_ps((const __m128*)(MRows + 12));
+		for (; Index + 2 <= Count; Index += 2)
+		{
+			const __m256 V = _mm256_loadu_ps((const float*)(Src + Index));
+			__m256 Result = _mm256_mul_ps(_mm256_permute_ps(V, _MM_SHUFFLE(0, 0, 0, 0)), Row0);
+			Result = InternalMultiplyAdd256(_mm256_permute_ps(V, _MM_SHUFFLE(1, 1, 1, 1)), Row1, Result);
+			Result = InternalMultiplyAdd256(_mm256_permute_ps(V, _MM_SHUFFLE(2, 2, 2, 2)), Row2, Result);
+			Result = InternalMultiplyAdd256(_mm256_permute_ps(V, _MM_SHUFFLE(3, 3, 3, 3)), Row3, Result);
+			_mm256_storeu_ps((float*)(Dst + Index), Result);
+		}
+		return Index;
+	}
+
+	UE_SSE_TARGET_AVX inline int32 InternalVectorTransformVectorArrayAVX(VectorRegister4Double* Dst, const VectorRegister4Double* Src, int32 Index, int32 Count, const double* MRows)
+	{
+		const __m256d Row0 = _mm256_loadu_pd(MRows + 0);
+		const __m256d Row1 = _mm256_loadu_pd(MRows + 4);
+		const __m256d Row2 = _mm256_loadu_pd(MRows + 8);
+		const __m256d Row3 = _mm256_loadu_pd(MRows + 12);
+		for (; Index < Count; ++Index)
+		{
+			// Splat each component with AVX1 lane ops only (no vpermpd), so this also runs on AVX-only builds.
+			const __m256d V = _mm256_loadu_pd((const double*)(Src + Index));
+			const __m256d XY = _mm256_permute2f128_pd(V, V, 0x00);
+			const __m256d ZW = _mm256_permute2f128_pd(V, V, 0x11);
+			__m256d Result = _mm256_mul_pd(_mm256_permute_pd(XY, 0x0), Row0);
+			Result = InternalMultiplyAdd256(_mm256_permute_pd(XY, 0xF), Row1, Result);
+			Result = InternalMultiplyAdd256(_mm256_permute_pd(ZW, 0x0), Row2, Result);
+			Result = InternalMultiplyAdd256(_mm256_permute_pd(ZW, 0xF), Row3, Result);
+			_mm256_storeu_pd((double*)(Dst + Index), Result);
+		}
+		return Index;
+	}
+
+	UE_SSE_TARGET_AVX inline int32 InternalVectorTransformVectorSoAAVX(const float (&M)[4][4], float* OutX, float* OutY, float* OutZ, float* OutW, const float* InX, const float* InY, const float* InZ, float InW, int32 Index, int32 Count)
+	{
+		__m256 Rows[3][4];
+		__m256 Offset[4];
+		for (int32 Column = 0; Column < 4; ++Column)
+		{
+			Rows[0][Column] = _mm256_set1_ps(M[0][Column]);
+			Rows[1][Column] = _mm256_set1_ps(M[1][Column]);
+			Rows[2][Column] = _mm256_set1_ps(M[2][Column]);
+			Offset[Column] = _mm256_set1_ps(InW * M[3][Column]);
+		}
+		for (; Index + 8 <= Count; Index += 8)
+		{
+			const __m256 X = _mm256_loadu_ps(InX + Index);
+			const __m256 Y = _mm256_loadu_ps(InY + Index);
+			const __m256 Z = _mm256_loadu_ps(InZ + Index);
+			_mm256_storeu_ps(OutX + Index, InternalMultiplyAdd256(Z, Rows[2][0], InternalMultiplyAdd256(Y, Rows[1][0], InternalMultiplyAdd256(X, Rows[0][0], Offset[0]))));
+			_mm256_storeu_ps(OutY + Index, InternalMultiplyAdd256(Z, Rows[2][1], InternalMultiplyAdd256(Y, Rows[1][1], InternalMultiplyAdd256(X, Rows[0][1], Offset[1]))));
+			_mm256_storeu_ps(OutZ + Index, InternalMultiplyAdd256(Z, Rows[2][2], InternalMultiplyAdd256(Y, Rows[1][2], InternalMultiplyAdd256(X, Rows[0][2], Offset[2]))));
+			if (OutW)
+			{
+				_mm256_storeu_ps(OutW + Index, InternalMultiplyAdd256(Z, Rows[2][3], InternalMultiplyAdd256(Y, Rows[1][3], InternalMultiplyAdd256(X, Rows[0][3], Offset[3]))));
+			}
+		}
+		return Index;
+	}
+
+	UE_SSE_TARGET_AVX inline int32 InternalVectorTransformVectorSoAAVX(const double (&M)[4][4], double* OutX, double* OutY, double* OutZ, double* OutW, const double* InX, const double* InY, const double* InZ, double InW, int32 Index, int32 Count)
+	{
+		__m256d Rows[3][4];
+		__m256d Offset[4];
+		for (int32 Column = 0; Column < 4; ++Column)
+		{
+			Rows[0][Column] = _mm256_set1_pd(M[0][Column]);
+			Rows[1][Column] = _mm256_set1_pd(M[1][Column]);
+			Rows[2][Column] = _mm256_set1_pd(M[2][Column]);
+			Offset[Column] = _mm256_set1_pd(InW * M[3][Column]);
+		}
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			const __m256d X = _mm256_loadu_pd(InX + Index);
+			const __m256d Y = _mm256_loadu_pd(InY + Index);
+			const __m256d Z = _mm256_loadu_pd(InZ + Index);
+			_mm256_storeu_pd(OutX + Index, InternalMultiplyAdd256(Z, Rows[2][0], InternalMultiplyAdd256(Y, Rows[1][0], InternalMultiplyAdd256(X, Rows[0][0], Offset[0]))));
+			_mm256_storeu_pd(OutY + Index, InternalMultiplyAdd256(Z, Rows[2][1], InternalMultiplyAdd256(Y, Rows[1][1], InternalMultiplyAdd256(X, Rows[0][1], Offset[1]))));
+			_mm256_storeu_pd(OutZ + Index, InternalMultiplyAdd256(Z, Rows[2][2], InternalMultiplyAdd256(Y, Rows[1][2], InternalMultiplyAdd256(X, Rows[0][2], Offset[2]))));
+			if (OutW)
+			{
+				_mm256_storeu_pd(OutW + Index, InternalMultiplyAdd256(Z, Rows[2][3], InternalMultiplyAdd256(Y, Rows[1][3], InternalMultiplyAdd256(X, Rows[0][3], Offset[3]))));
+			}
+		}
+		return Index;
+	}
+
+	// Result, Matrix1 and Matrix2 point to arrays of row major 4x4 matrices (16 scalars each). A result may alias either of its inputs,
+	// so every matrix is fully loaded before its result is stored.
+	UE_SSE_TARGET_AVX inline int32 InternalVectorMatrixMultiplyArrayAVX(float* Result, const float* Matrix1, const float* Matrix2, int32 Index, int32 Count)
+	{
+		// Rows 0-1 and 2-3 of each matrix share a register, the rows of Matrix2 are broadcast to both lanes.
+		for (; Index < Count; ++Index)
+		{
+			const float* A = Matrix1 + Index * 16;
+			const float* B = Matrix2 + Index * 16;
+			const __m256 A01 = _mm256_loadu_ps(A + 0);
+			const __m256 A23 = _mm256_loadu_ps(A + 8);
+			const __m256 B0 = _mm256_broadcast_ps((const __m128*)(B + 0));
+			const __m256 B1 = _mm256_broadcast_ps((const __m128*)(B + 4));
+			const __m256 B2 = _mm256_broadcast_ps((const __m128*)(B + 8));
+			const __m256 B3 = _mm256_broadcast_ps((const __m128*)(B + 12));
+
+			__m256 R01 = _mm256_mul_ps(_mm256_permute_ps(A01, _MM_SHUFFLE(0, 0, 0, 0)), B0);
+			__m256 R23 = _mm256_mul_ps(_mm256_permute_ps(A23, _MM_SHUFFLE(0, 0, 0, 0)), B0);
+			R01 = InternalMultiplyAdd256(_mm256_permute_ps(A01, _MM_SHUFFLE(1, 1, 1, 1)), B1, R01);
+			R23 = InternalMultiplyAdd256(_mm256_permute_ps(A23, _MM_SHUFFLE(1, 1, 1, 1)), B1, R23);
+			R01 = InternalMultiplyAdd256(_mm256_permute_ps(A01, _MM_SHUFFLE(2, 2, 2, 2)), B2, R01);
+			R23 = InternalMultiplyAdd256(_mm256_permute_ps(A23, _MM_SHUFFLE(2, 2, 2, 2)), B2, R23);
+			R01 = InternalMultiplyAdd256(_mm256_permute_ps(A01, _MM_SHUFFLE(3, 3, 3, 3)), B3, R01);
+			R23 = InternalMultiplyAdd256(_mm256_permute_ps(A23, _MM_SHUFFLE(3, 3, 3, 3)), B3, R23);
+
+			_mm256_storeu_ps(Result + Index * 16 + 0, R01);
+			_mm256_storeu_ps(Result + Index * 16 + 8, R23);
+		}
+		return Index;
+	}
+
+	UE_SSE_TARGET_AVX inline int32 InternalVectorMatrixMultiplyArrayAVX(double* Result, const double* Matrix1, const double* Matrix2, int32 Index, int32 Count)
+	{
+		// One row per register instead of XY/ZW halves, the Matrix1 elements are broadcast straight from memory.
+		for (; Index < Count; ++Index)
+		{
+			const double* A = Matrix1 + Index * 16;
+			const double* B = Matrix2 + Index * 16;
+			const __m256d B0 = _mm256_loadu_pd(B + 0);
+			const __m256d B1 = _mm256_loadu_pd(B + 4);
+			const __m256d B2 = _mm256_loadu_pd(B + 8);
+			const __m256d B3 = _mm256_loadu_pd(B + 12);
+
+			__m256d R[4];
+			for (int32 Row = 0; Row < 4; ++Row)
+			{
+				R[Row] = _mm256_mul_pd(_mm256_broadcast_sd(A + Row * 4 + 0), B0);
+				R[Row] = InternalMultiplyAdd256(_mm256_broadcast_sd(A + Row * 4 + 1), B1, R[Row]);
+				R[Row] = InternalMultiplyAdd256(_mm256_broadcast_sd(A + Row * 4 + 2), B2, R[Row]);
+				R[Row] = InternalMultiplyAdd256(_mm256_broadcast_sd(A + Row * 4 + 3), B3, R[Row]);
+			}
+
+			double* Out = Result + Index * 16;
+			_mm256_storeu_pd(Out + 0, R[0]);
+			_mm256_storeu_pd(Out + 4, R[1]);
+			_mm256_storeu_pd(Out + 8, R[2]);
+			_mm256_storeu_pd(Out + 12, R[3]);
+		}
+		return Index;
+	}
+
+	// Overloads the SoA quaternion kernels use, so each kernel is written once for float and double.
+	UE_SSE_TARGET_AVX FORCEINLINE __m256 InternalLoad256(const float* Src)
+	{
+		return _mm256_loadu_ps(Src);
+	}
+
+	UE_SSE_TARGET_AVX FORCEINLINE __m256d InternalLoad256(const double* Src)
+	{
+		return _mm256_loadu_pd(Src);
+	}
+
+	UE_SSE_TARGET_AVX FORCEINLINE void InternalStore256(float* Dst, const __m256& Vec)
+	{
+		_mm256_storeu_ps(Dst, Vec);
+	}
+
+	UE_SSE_TARGET_AVX FORCEINLINE void InternalStore256(double* Dst, const __m256d& Vec)
+	{
+		_mm256_storeu_pd(Dst, Vec);
+	}
+
+	UE_SSE_TARGET_AVX FORCEINLINE __m256 InternalSet256(float Value)
+	{
+		return _mm256_set1_ps(Value);
+	}
+
+	UE_SSE_TARGET_AVX FORCEINLINE __m256d InternalSet256(double Value)
+	{
+		return _mm256_set1_pd(Value);
+	}
+
+	UE_SSE_TARGET_AVX FORCEINLINE __m256 InternalAdd256(const __m256& A, const __m256& B)
+	{
+		return _mm256_add_ps(A, B);
+	}
+
+	UE_SSE_TARGET_AVX FORCEINLINE __m256d InternalAdd256(const __m256d& A, const __m256d& B)
+	{
+		return _mm256_add_pd(A, B);
+	}
+
+	UE_SSE_TARGET_AVX FORCEINLINE __m256 InternalSubtract256(const __m256& A, const __m256& B)
+	{
+		return _mm256_sub_ps(A, B);
+	}
+
+	UE_SSE_TARGET_AVX FORCEINLINE __m256d InternalSubtract256(const __m256d& A, const __m256d& B)
+	{
+		return _mm256_sub_pd(A, B);
+	}
+
+	UE_SSE_TARGET_AVX FORCEINLINE __m256 InternalMultiply256(const __m256& A, const __m256& B)
+	{
+		return _mm256_mul_ps(A, B);
+	}
+
+	UE_SSE_TARGET_AVX FORCEINLINE __m256d InternalMultiply256(const __m256d& A, const __m256d& B)
+	{
+		return _mm256_mul_pd(A, B);
+	}
+
+	// C - A * B
+	UE_SSE_TARGET_AVX FORCEINLINE __m256 InternalNegateMultiplyAdd256(const __m256& A, const __m256& B, const __m256& C)
+	{
+#if UE_SSE_AVX_KERNELS_USE_FMA3
+		return _mm256_fnmadd_ps(A, B, C);
+#else
+		return _mm256_sub_ps(C, _mm256_mul_ps(A, B));
+#endif
+	}
+
+	UE_SSE_TARGET_AVX FORCEINLINE __m256d InternalNegateMultiplyAdd256(const __m256d& A, const __m256d& B, const __m256d& C)
+	{
+#if UE_SSE_AVX_KERNELS_USE_FMA3
+		return _mm256_fnmadd_pd(A, B, C);
+#else
+		return _mm256_sub_pd(C, _mm256_mul_pd(A, B));
+#endif
+	}
+
+	// 1 / sqrt(A), with a real divide so the result matches the 4-wide path.
+	UE_SSE_TARGET_AVX FORCEINLINE __m256 InternalReciprocalSqrt256(const __m256& A)
+	{
+		return _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(A));
+	}
+
+	UE_SSE_TARGET_AVX FORCEINLINE __m256d InternalReciprocalSqrt256(const __m256d& A)
+	{
+		return _mm256_div_pd(_mm256_set1_pd(1.0), _mm256_sqrt_pd(A));
+	}
+
+	// Value >= Threshold ? IfGreaterEqual : IfLess, per lane.
+	UE_SSE_TARGET_AVX FORCEINLINE __m256 InternalSelectGreaterEqual256(const __m256& Value, const __m256& Threshold, const __m256& IfGreaterEqual, const __m256& IfLess)
+	{
+		return _mm256_blendv_ps(IfLess, IfGreaterEqual, _mm256_cmp_ps(Value, Threshold, _CMP_GE_OQ));
+	}
+
+	UE_SSE_TARGET_AVX FORCEINLINE __m256d InternalSelectGreaterEqual256(const __m256d& Value, const __m256d& Threshold, const __m256d& IfGreaterEqual, const __m256d& IfLess)
+	{
+		return _mm256_blendv_pd(IfLess, IfGreaterEqual, _mm256_cmp_pd(Value, Threshold, _CMP_GE_OQ));
+	}
+
+	template<typename RegisterType, typename ScalarType>
+	UE_SSE_TARGET_AVX FORCEINLINE void InternalLoadQuaternion256(RegisterType (&Out)[4], const ScalarType* const* Quat, int32 Index)
+	{
+		Out[0] = InternalLoad256(Quat[0] + Index);
+		Out[1] = InternalLoad256(Quat[1] + Index);
+		Out[2] = InternalLoad256(Quat[2] + Index);
+		Out[3] = InternalLoad256(Quat[3] + Index);
+	}
+
+	template<typename RegisterType, typename ScalarType>
+	UE_SSE_TARGET_AVX FORCEINLINE void InternalStoreQuaternion256(ScalarType* const* Quat, const RegisterType (&In)[4], int32 Index)
+	{
+		InternalStore256(Quat[0] + Index, In[0]);
+		InternalStore256(Quat[1] + Index, In[1]);
+		InternalStore256(Quat[2] + Index, In[2]);
+		InternalStore256(Quat[3] + Index, In[3]);
+	}
+
+	// Normalizes Q in place, quaternions with a squared length below 1e-8 (FQuat::Normalize's default tolerance) become the identity.
+	template<typename ScalarType, typename RegisterType>
+	UE_SSE_TARGET_AVX FORCEINLINE void InternalQuaternionNormalize256(RegisterType (&Q)[4])
+	{
+		RegisterType SquareSum = InternalMultiply256(Q[0], Q[0]);
+		SquareSum = InternalMultiplyAdd256(Q[1], Q[1], SquareSum);
+		SquareSum = InternalMultiplyAdd256(Q[2], Q[2], SquareSum);
+		SquareSum = InternalMultiplyAdd256(Q[3], Q[3], SquareSum);
+		const RegisterType Scale = InternalReciprocalSqrt256(SquareSum);
+		const RegisterType Tolerance = InternalSet256(ScalarType(1.e-8));
+		const RegisterType Zero = InternalSet256(ScalarType(0));
+		Q[0] = InternalSelectGreaterEqual256(SquareSum, Tolerance, InternalMultiply256(Q[0], Scale), Zero);
+		Q[1] = InternalSelectGreaterEqual256(SquareSum, Tolerance, InternalMultiply256(Q[1], Scale), Zero);
+		Q[2] = InternalSelectGreaterEqual256(SquareSum, Tolerance, InternalMultiply256(Q[2], Scale), Zero);
+		Q[3] = InternalSelectGreaterEqual256(SquareSum, Tolerance, InternalMultiply256(Q[3], Scale), InternalSet256(ScalarType(1)));
+	}
+
+	// SoA quaternion kernels. Every pointer array holds the X, Y, Z and W component arrays (X, Y and Z for vectors).
+	template<typename ScalarType>
+	UE_SSE_TARGET_AVX inline int32 InternalVectorQuaternionMultiplySoAAVX(ScalarType* const* Result, const ScalarType* const* Quat1, const ScalarType* const* Quat2, int32 Index, int32 Count)
+	{
+		typedef decltype(InternalSet256(ScalarType(0))) RegisterType;
+		constexpr int32 Width = int32(sizeof(RegisterType) / sizeof(ScalarType));
+		for (; Index + Width <= Count; Index += Width)
+		{
+			RegisterType A[4], B[4], Out[4];
+			InternalLoadQuaternion256(A, Quat1, Index);
+			InternalLoadQuaternion256(B, Quat2, Index);
+			Out[0] = InternalMultiplyAdd256(A[3], B[0], InternalMultiplyAdd256(A[0], B[3], InternalNegateMultiplyAdd256(A[2], B[1], InternalMultiply256(A[1], B[2]))));
+			Out[1] = InternalMultiplyAdd256(A[3], B[1], InternalMultiplyAdd256(A[1], B[3], InternalNegateMultiplyAdd256(A[0], B[2], InternalMultiply256(A[2], B[0]))));
+			Out[2] = InternalMultiplyAdd256(A[3], B[2], InternalMultiplyAdd256(A[2], B[3], InternalNegateMultiplyAdd256(A[1], B[0], InternalMultiply256(A[0], B[1]))));
+			Out[3] = InternalNegateMultiplyAdd256(A[2], B[2], InternalNegateMultiplyAdd256(A[1], B[1], InternalNegateMultiplyAdd256(A[0], B[0], InternalMultiply256(A[3], B[3]))));
+			InternalStoreQuaternion256(Result, Out, Index);
+		}
+		return Index;
+	}
+
+	template<typename ScalarType>
+	UE_SSE_TARGET_AVX inline int32 InternalVectorQuaternionNormalizeSoAAVX(ScalarType* const* Result, const ScalarType* const* Quat, int32 Index, int32 Count)
+	{
+		typedef decltype(InternalSet256(ScalarType(0))) RegisterType;
+		constexpr int32 Width = int32(sizeof(RegisterType) / sizeof(ScalarType));
+		for (; Index + Width <= Count; Index += Width)
+		{
+			RegisterType Q[4];
+			InternalLoadQuaternion256(Q, Quat, Index);
+			InternalQuaternionNormalize256<ScalarType>(Q);
+			InternalStoreQuaternion256(Result, Q, Index);
+		}
+		return Index;
+	}
+
+	template<typename ScalarType>
+	UE_SSE_TARGET_AVX inline int32 InternalVectorQuaternionNLerpSoAAVX(ScalarType* const* Result, const ScalarType* const* Quat1, const ScalarType* const* Quat2, const ScalarType* Alpha, int32 Index, int32 Count)
+	{
+		typedef decltype(InternalSet256(ScalarType(0))) RegisterType;
+		constexpr int32 Width = int32(sizeof(RegisterType) / sizeof(ScalarType));
+		const RegisterType Zero = InternalSet256(ScalarType(0));
+		const RegisterType One = InternalSet256(ScalarType(1));
+		const RegisterType MinusOne = InternalSet256(ScalarType(-1));
+		for (; Index + Width <= Count; Index += Width)
+		{
+			RegisterType A[4], B[4];
+			InternalLoadQuaternion256(A, Quat1, Index);
+			InternalLoadQuaternion256(B, Quat2, Index);
+			RegisterType Dot = InternalMultiply256(A[0], B[0]);
+			Dot = InternalMultiplyAdd256(A[1], B[1], Dot);
+			Dot = InternalMultiplyAdd256(A[2], B[2], Dot);
+			Dot = InternalMultiplyAdd256(A[3], B[3], Dot);
+
+			// FQuat::FastLerp, Quat1 is flipped onto Quat2's hemisphere to take the shortest path.
+			const RegisterType WeightB = InternalLoad256(Alpha + Index);
+			const RegisterType WeightA = InternalMultiply256(InternalSelectGreaterEqual256(Dot, Zero, One, MinusOne), InternalSubtract256(One, WeightB));
+			RegisterType Q[4];
+			Q[0] = InternalMultiplyAdd256(A[0], WeightA, InternalMultiply256(B[0], WeightB));
+			Q[1] = InternalMultiplyAdd256(A[1], WeightA, InternalMultiply256(B[1], WeightB));
+			Q[2] = InternalMultiplyAdd256(A[2], WeightA, InternalMultiply256(B[2], WeightB));
+			Q[3] = InternalMultiplyAdd256(A[3], WeightA, InternalMultiply256(B[3], WeightB));
+			InternalQuaternionNormalize256<ScalarType>(Q);
+			InternalStoreQuaternion256(Result, Q, Index);
+		}
+		return Index;
+	}
+
+	template<typename ScalarType>
+	UE_SSE_TARGET_AVX inline int32 InternalVectorQuaternionRotateVectorSoAAVX(ScalarType* const* Result, const ScalarType* const* Quat, const ScalarType* const* Vector, int32 Index, int32 Count)
+	{
+		typedef decltype(InternalSet256(ScalarType(0))) RegisterType;
+		constexpr int32 Width = int32(sizeof(RegisterType) / sizeof(ScalarType));
+		const RegisterType Two = InternalSet256(ScalarType(2));
+		for (; Index + Width <= Count; Index += Width)
+		{
+			RegisterType Q[4];
+			InternalLoadQuaternion256(Q, Quat, Index);
+			const RegisterType V[3] = { InternalLoad256(Vector[0] + Index), InternalLoad256(Vector[1] + Index), InternalLoad256(Vector[2] + Index) };
+
+			// FQuat::RotateVector: T = 2 * (Q x V), Result = V + W * T + Q x T
+			const RegisterType TX = InternalMultiply256(InternalNegateMultiplyAdd256(Q[2], V[1], InternalMultiply256(Q[1], V[2])), Two);
+			const RegisterType TY = InternalMultiply256(InternalNegateMultiplyAdd256(Q[0], V[2], InternalMultiply256(Q[2], V[0])), Two);
+			const RegisterType TZ = InternalMultiply256(InternalNegateMultiplyAdd256(Q[1], V[0], InternalMultiply256(Q[0], V[1])), Two);
+			InternalStore256(Result[0] + Index, InternalAdd256(InternalMultiplyAdd256(Q[3], TX, V[0]), InternalNegateMultiplyAdd256(Q[2], TY, InternalMultiply256(Q[1], TZ))));
+			InternalStore256(Result[1] + Index, InternalAdd256(InternalMultiplyAdd256(Q[3], TY, V[1]), InternalNegateMultiplyAdd256(Q[0], TZ, InternalMultiply256(Q[2], TX))));
+			InternalStore256(Result[2] + Index, InternalAdd256(InternalMultiplyAdd256(Q[3], TZ, V[2]), InternalNegateMultiplyAdd256(Q[1], TX, InternalMultiply256(Q[0], TY))));
+		}
+		return Index;
+	}
+
+	// AoS <-> SoA kernels. Index and Count are in 4-component vectors; a null W array drops W on the way in and reads as
+	// zero on the way out. Loads and stores do the lane crossing so the shuffles in between stay within 128-bit lanes.
+	UE_SSE_TARGET_AVX FORCEINLINE void InternalTranspose4x4x2(__m256& Row0, __m256& Row1, __m256& Row2, __m256& Row3)
+	{
+		const __m256 T0 = _mm256_unpacklo_ps(Row0, Row1);
+		const __m256 T1 = _mm256_unpacklo_ps(Row2, Row3);
+		const __m256 T2 = _mm256_unpackhi_ps(Row0, Row1);
+		const __m256 T3 = _mm256_unpackhi_ps(Row2, Row3);
+		Row0 = _mm256_shuffle_ps(T0, T1, _MM_SHUFFLE(1, 0, 1, 0));
+		Row1 = _mm256_shuffle_ps(T0, T1, _MM_SHUFFLE(3, 2, 3, 2));
+		Row2 = _mm256_shuffle_ps(T2, T3, _MM_SHUFFLE(1, 0, 1, 0));
+		Row3 = _mm256_shuffle_ps(T2, T3, _MM_SHUFFLE(3, 2, 3, 2));
+	}
+
+	UE_SSE_TARGET_AVX inline int32 InternalVectorAoSToSoAAVX(float* const* Dst, const float* Src, int32 Index, int32 Count)
+	{
+		for (; Index + 8 <= Count; Index += 8)
+		{
+			// Row N holds vectors N and N + 4.
+			const float* In = Src + Index * 4;
+			__m256 Row0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(In + 0)), _mm_loadu_ps(In + 16), 1);
+			__m256 Row1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(In + 4)), _mm_loadu_ps(In + 20), 1);
+			__m256 Row2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(In + 8)), _mm_loadu_ps(In + 24), 1);
+			__m256 Row3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(In + 12)), _mm_loadu_ps(In + 28), 1);
+			InternalTranspose4x4x2(Row0, Row1, Row2, Row3);
+			_mm256_storeu_ps(Dst[0] + Index, Row0);
+			_mm256_storeu_ps(Dst[1] + Index, Row1);
+			_mm256_storeu_ps(Dst[2] + Index, Row2);
+			if (Dst[3])
+			{
+				_mm256_storeu_ps(Dst[3] + Index, Row3);
+			}
+		}
+		return Index;
+	}
+
+	UE_SSE_TARGET_AVX inline int32 InternalVectorAoSToSoAAVX(double* const* Dst, const double* Src, int32 Index, int32 Count)
+	{
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			// Pair the XY and ZW halves of vectors 0/2 and 1/3, then one unpack per component.
+			const double* In = Src + Index * 4;
+			const __m256d XY02 = _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_loadu_pd(In + 0)), _mm_loadu_pd(In + 8), 1);
+			const __m256d XY13 = _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_loadu_pd(In + 4)), _mm_loadu_pd(In + 12), 1);
+			const __m256d ZW02 = _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_loadu_pd(In + 2)), _mm_loadu_pd(In + 10), 1);
+			const __m256d ZW13 = _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_loadu_pd(In + 6)), _mm_loadu_pd(In + 14), 1);
+			_mm256_storeu_pd(Dst[0] + Index, _mm256_unpacklo_pd(XY02, XY13));
+			_mm256_storeu_pd(Dst[1] + Index, _mm256_unpackhi_pd(XY02, XY13));
+			_mm256_storeu_pd(Dst[2] + Index, _mm256_unpacklo_pd(ZW02, ZW13));
+			if (Dst[3])
+			{
+				_mm256_storeu_pd(Dst[3] + Index, _mm256_unpackhi_pd(ZW02, ZW13));
+			}
+		}
+		return Index;
+	}
+
+	UE_SSE_TARGET_AVX inline int32 InternalVectorSoAToAoSAVX(float* Dst, const float* const* Src, int32 Index, int32 Count)
+	{
+		for (; Index + 8 <= Count; Index += 8)
+		{
+			__m256 Row0 = _mm256_loadu_ps(Src[0] + Index);
+			__m256 Row1 = _mm256_loadu_ps(Src[1] + Index);
+			__m256 Row2 = _mm256_loadu_ps(Src[2] + Index);
+			__m256 Row3 = Src[3] ? _mm256_loadu_ps(Src[3] + Index) : _mm256_setzero_ps();
+			InternalTranspose4x4x2(Row0, Row1, Row2, Row3);
+			float* Out = Dst + Index * 4;
+			_mm256_storeu_ps(Out + 0, _mm256_permute2f128_ps(Row0, Row1, 0x20));
+			_mm256_storeu_ps(Out + 8, _mm256_permute2f128_ps(Row2, Row3, 0x20));
+			_mm256_storeu_ps(Out + 16, _mm256_permute2f128_ps(Row0, Row1, 0x31));
+			_mm256_storeu_ps(Out + 24, _mm256_permute2f128_ps(Row2, Row3, 0x31));
+		}
+		return Index;
+	}
+
+	UE_SSE_TARGET_AVX inline int32 InternalVectorSoAToAoSAVX(double* Dst, const double* const* Src, int32 Index, int32 Count)
+	{
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			const __m256d X = _mm256_loadu_pd(Src[0] + Index);
+			const __m256d Y = _mm256_loadu_pd(Src[1] + Index);
+			const __m256d Z = _mm256_loadu_pd(Src[2] + Index);
+			const __m256d W = Src[3] ? _mm256_loadu_pd(Src[3] + Index) : _mm256_setzero_pd();
+			const __m256d XY02 = _mm256_unpacklo_pd(X, Y);
+			const __m256d XY13 = _mm256_unpackhi_pd(X, Y);
+			const __m256d ZW02 = _mm256_unpacklo_pd(Z, W);
+			const __m256d ZW13 = _mm256_unpackhi_pd(Z, W);
+			double* Out = Dst + Index * 4;
+			_mm256_storeu_pd(Out + 0, _mm256_permute2f128_pd(XY02, ZW02, 0x20));
+			_mm256_storeu_pd(Out + 4, _mm256_permute2f128_pd(XY13, ZW13, 0x20));
+			_mm256_storeu_pd(Out + 8, _mm256_permute2f128_pd(XY02, ZW02, 0x31));
+			_mm256_storeu_pd(Out + 12, _mm256_permute2f128_pd(XY13, ZW13, 0x31));
+		}
+		return Index;
+	}
+
+#if UE_PLATFORM_MATH_USE_F16C || UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+	UE_SSE_TARGET_AVX_2 inline int32 InternalVectorFloatToHalfArrayAVX(uint16* RESTRICT Dst, const float* RESTRICT Src, int32 Index, int32 Count)
+	{
+		for (; Index + 8 <= Count; Index += 8)
+		{
+			_mm_storeu_si128((__m128i*)(Dst + Index), _mm256_cvtps_ph(_mm256_loadu_ps(Src + Index), _MM_FROUND_TO_NEAREST_INT));
+		}
+		return Index;
+	}
+
+	UE_SSE_TARGET_AVX_2 inline int32 InternalVectorHalfToFloatArrayAVX(float* RESTRICT Dst, const uint16* RESTRICT Src, int32 Index, int32 Count)
+	{
+		for (; Index + 8 <= Count; Index += 8)
+		{
+			_mm256_storeu_ps(Dst + Index, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(Src + Index))));
+		}
+		return Index;
+	}
+#endif
+
+	// Buffer scan kernels. A value is flagged when it is not within [MinValue, MaxValue]; the unordered compares flag NaNs
+	// as well. Clean blocks cost one test and branch, the count and first index are only worked out for blocks with hits.
+	UE_SSE_TARGET_AVX FORCEINLINE __m256 InternalLoadScan256(const float* Src)
+	{
+		return _mm256_loadu_ps(Src);
+	}
+
+#if UE_PLATFORM_MATH_USE_F16C || UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+	UE_SSE_TARGET_AVX_2 FORCEINLINE __m256 InternalLoadScan256(const uint16* Src)
+	{
+		return _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)Src));
+	}
+#endif
+
+	UE_SSE_TARGET_AVX FORCEINLINE __m256 InternalOutOfRangeMask256(const __m256& Value, const __m256& MinValue, const __m256& MaxValue)
+	{
+		return _mm256_or_ps(_mm256_cmp_ps(Value, MinValue, _CMP_NGE_UQ), _mm256_cmp_ps(Value, MaxValue, _CMP_NLE_UQ));
+	}
+
+	template<typename ScalarType>
+	UE_SSE_TARGET_AVX_2 inline int32 InternalVectorScanOutOfRangeArrayAVX(const ScalarType* Src, int32 Index, int32 Count, float MinValue, float MaxValue, FVectorScanResult& Result)
+	{
+		const __m256 Min = _mm256_set1_ps(MinValue);
+		const __m256 Max = _mm256_set1_ps(MaxValue);
+		for (; Index + 32 <= Count; Index += 32)
+		{
+			const __m256 Mask0 = InternalOutOfRangeMask256(InternalLoadScan256(Src + Index + 0), Min, Max);
+			const __m256 Mask1 = InternalOutOfRangeMask256(InternalLoadScan256(Src + Index + 8), Min, Max);
+			const __m256 Mask2 = InternalOutOfRangeMask256(InternalLoadScan256(Src + Index + 16), Min, Max);
+			const __m256 Mask3 = InternalOutOfRangeMask256(InternalLoadScan256(Src + Index + 24), Min, Max);
+			const __m256 Any = _mm256_or_ps(_mm256_or_ps(Mask0, Mask1), _mm256_or_ps(Mask2, Mask3));
+			if (!_mm256_testz_ps(Any, Any))
+			{
+				InternalAddScanHits(Result, Index, uint64(_mm256_movemask_ps(Mask0)) | (uint64(_mm256_movemask_ps(Mask1)) << 8) | (uint64(_mm256_movemask_ps(Mask2)) << 16) | (uint64(_mm256_movemask_ps(Mask3)) << 24));
+			}
+		}
+		return Index;
+	}
+
+	// Point bounds kernels. Index and Count are in points, the running bounds and squared radius are read from and folded
+	// back into the InOut arguments.
+	UE_SSE_TARGET_AVX FORCEINLINE __m256 InternalMin256(const __m256& A, const __m256& B)
+	{
+		return _mm256_min_ps(A, B);
+	}
+
+	UE_SSE_TARGET_AVX FORCEINLINE __m256d InternalMin256(const __m256d& A, const __m256d& B)
+	{
+		return _mm256_min_pd(A, B);
+	}
+
+	UE_SSE_TARGET_AVX FORCEINLINE __m256 InternalMax256(const __m256& A, const __m256& B)
+	{
+		return _mm256_max_ps(A, B);
+	}
+
+	UE_SSE_TARGET_AVX FORCEINLINE __m256d InternalMax256(const __m256d& A, const __m256d& B)
+	{
+		return _mm256_max_pd(A, B);
+	}
+
+	template<typename RegisterType>
+	UE_SSE_TARGET_AVX FORCEINLINE void InternalAddBounds256(RegisterType& Min, RegisterType& Max, const RegisterType& Value)
+	{
+		Min = InternalMin256(Min, Value);
+		Max = InternalMax256(Max, Value);
+	}
+
+	// Loads 8 XYZ points Stride bytes apart as X, Y and Z registers. Each point is read as four floats.
+	UE_SSE_TARGET_AVX FORCEINLINE void InternalLoadPoints256(const uint8* Points, SIZE_T Stride, __m256 (&XYZ)[3])
+	{
+		// Row N holds points N and N + 4.
+		__m256 Row0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps((const float*)(Points + 0 * Stride))), _mm_loadu_ps((const float*)(Points + 4 * Stride)), 1);
+		__m256 Row1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps((const float*)(Points + 1 * Stride))), _mm_loadu_ps((const float*)(Points + 5 * Stride)), 1);
+		__m256 Row2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps((const float*)(Points + 2 * Stride))), _mm_loadu_ps((const float*)(Points + 6 * Stride)), 1);
+		__m256 Row3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps((const float*)(Points + 3 * Stride))), _mm_loadu_ps((const float*)(Points + 7 * Stride)), 1);
+		InternalTranspose4x4x2(Row0, Row1, Row2, Row3);
+		XYZ[0] = Row0;
+		XYZ[1] = Row1;
+		XYZ[2] = Row2;
+	}
+
+	// Loads 4 XYZ points Stride bytes apart as X, Y and Z registers. Each point is read as four doubles.
+	UE_SSE_TARGET_AVX FORCEINLINE void InternalLoadPoints256(const uint8* Points, SIZE_T Stride, __m256d (&XYZ)[3])
+	{
+		const __m256d P0 = _mm256_loadu_pd((const double*)(Points + 0 * Stride));
+		const __m256d P1 = _mm256_loadu_pd((const double*)(Points + 1 * Stride));
+		const __m256d P2 = _mm256_loadu_pd((const double*)(Points + 2 * Stride));
+		const __m256d P3 = _mm256_loadu_pd((const double*)(Points + 3 * Stride));
+		const __m256d XZ01 = _mm256_unpacklo_pd(P0, P1);
+		const __m256d XZ23 = _mm256_unpacklo_pd(P2, P3);
+		const __m256d YW01 = _mm256_unpackhi_pd(P0, P1);
+		const __m256d YW23 = _mm256_unpackhi_pd(P2, P3);
+		XYZ[0] = _mm256_permute2f128_pd(XZ01, XZ23, 0x20);
+		XYZ[1] = _mm256_permute2f128_pd(YW01, YW23, 0x20);
+		XYZ[2] = _mm256_permute2f128_pd(XZ01, XZ23, 0x31);
+	}
+
+	// Packed points are read straight through, three registers per block of Width points. Lane L of register R then always
+	// holds component (R * Width + L) % 3, so the accumulators keep that rotating order and only the final fold sorts it out.
+	template<typename ScalarType>
+	UE_SSE_TARGET_AVX inline int32 InternalVectorComputeBoundsPackedAVX(const ScalarType* Points, int32 Index, int32 Count, ScalarType* InOutMin, ScalarType* InOutMax)
+	{
+		typedef decltype(InternalLoad256(Points)) RegisterType;
+		constexpr int32 Width = int32(sizeof(RegisterType) / sizeof(ScalarType));
+		if (Index + 2 * Width > Count)
+		{
+			return Index;
+		}
+
+		ScalarType MinLanes[3 * Width];
+		ScalarType MaxLanes[3 * Width];
+		for (int32 Lane = 0; Lane < 3 * Width; ++Lane)
+		{
+			MinLanes[Lane] = InOutMin[Lane % 3];
+			MaxLanes[Lane] = InOutMax[Lane % 3];
+		}
+
+		// Two blocks per iteration with their own accumulators, 0-2 and 3-5.
+		RegisterType Min0 = InternalLoad256(MinLanes + 0 * Width);
+		RegisterType Min1 = InternalLoad256(MinLanes + 1 * Width);
+		RegisterType Min2 = InternalLoad256(MinLanes + 2 * Width);
+		RegisterType Max0 = InternalLoad256(MaxLanes + 0 * Width);
+		RegisterType Max1 = InternalLoad256(MaxLanes + 1 * Width);
+		RegisterType Max2 = InternalLoad256(MaxLanes + 2 * Width);
+		RegisterType Min3 = Min0, Min4 = Min1, Min5 = Min2;
+		RegisterType Max3 = Max0, Max4 = Max1, Max5 = Max2;
+		for (; Index + 2 * Width <= Count; Index += 2 * Width)
+		{
+			const ScalarType* In = Points + SIZE_T(Index) * 3;
+			InternalAddBounds256(Min0, Max0, InternalLoad256(In + 0 * Width));
+			InternalAddBounds256(Min1, Max1, InternalLoad256(In + 1 * Width));
+			InternalAddBounds256(Min2, Max2, InternalLoad256(In + 2 * Width));
+			InternalAddBounds256(Min3, Max3, InternalLoad256(In + 3 * Width));
+			InternalAddBounds256(Min4, Max4, InternalLoad256(In + 4 * Width));
+			InternalAddBounds256(Min5, Max5, InternalLoad256(In + 5 * Width));
+		}
+		InternalStore256(MinLanes + 0 * Width, InternalMin256(Min0, Min3));
+		InternalStore256(MinLanes + 1 * Width, InternalMin256(Min1, Min4));
+		InternalStore256(MinLanes + 2 * Width, InternalMin256(Min2, Min5));
+		InternalStore256(MaxLanes + 0 * Width, InternalMax256(Max0, Max3));
+		InternalStore256(MaxLanes + 1 * Width, InternalMax256(Max1, Max4));
+		InternalStore256(MaxLanes + 2 * Width, InternalMax256(Max2, Max5));
+		InternalFoldBoundsLanes(MinLanes, MaxLanes, 3 * Width, 1, InOutMin, InOutMax);
+		return Index;
+	}
+
+	// Points are read as four scalars, so the kernel stops before the last point to stay inside the buffer.
+	template<typename ScalarType>
+	UE_SSE_TARGET_AVX inline int32 InternalVectorComputeBoundsStridedAVX(const ScalarType* Points, int32 Stride, int32 Index, int32 Count, ScalarType* InOutMin, ScalarType* InOutMax)
+	{
+		typedef decltype(InternalLoad256(Points)) RegisterType;
+		constexpr int32 Width = int32(sizeof(RegisterType) / sizeof(ScalarType));
+		RegisterType MinX = InternalSet256(InOutMin[0]), MinY = InternalSet256(InOutMin[1]), MinZ = InternalSet256(InOutMin[2]);
+		RegisterType MaxX = InternalSet256(InOutMax[0]), MaxY = InternalSet256(InOutMax[1]), MaxZ = InternalSet256(InOutMax[2]);
+		for (; Index + Width < Count; Index += Width)
+		{
+			RegisterType XYZ[3];
+			InternalLoadPoints256((const uint8*)Points + SIZE_T(Index) * Stride, SIZE_T(Stride), XYZ);
+			InternalAddBounds256(MinX, MaxX, XYZ[0]);
+			InternalAddBounds256(MinY, MaxY, XYZ[1]);
+			InternalAddBounds256(MinZ, MaxZ, XYZ[2]);
+		}
+
+		ScalarType MinLanes[3 * Width];
+		ScalarType MaxLanes[3 * Width];
+		InternalStore256(MinLanes + 0 * Width, MinX);
+		InternalStore256(MinLanes + 1 * Width, MinY);
+		InternalStore256(MinLanes + 2 * Width, MinZ);
+		InternalStore256(MaxLanes + 0 * Width, MaxX);
+		InternalStore256(MaxLanes + 1 * Width, MaxY);
+		InternalStore256(MaxLanes + 2 * Width, MaxZ);
+		InternalFoldBoundsLanes(MinLanes, MaxLanes, 3 * Width, Width, InOutMin, InOutMax);
+		return Index;
+	}
+
+	template<typename ScalarType>
+	UE_SSE_TARGET_AVX inline int32 InternalVectorComputeBoundsSoAAVX(const ScalarType* const* Components, int32 Index, int32 Count, ScalarType* InOutMin, ScalarType* InOutMax)
+	{
+		typedef decltype(InternalLoad256(Components[0])) RegisterType;
+		constexpr int32 Width = int32(sizeof(RegisterType) / sizeof(ScalarType));
+
+		const ScalarType* X = Components[0];
+		const ScalarType* Y = Components[1];
+		const ScalarType* Z = Components[2];
+
+		// Two blocks per iteration with their own accumulators, 0 and 1.
+		RegisterType MinX0 = InternalSet256(InOutMin[0]), MinY0 = InternalSet256(InOutMin[1]), MinZ0 = InternalSet256(InOutMin[2]);
+		RegisterType MaxX0 = InternalSet256(InOutMax[0]), MaxY0 = InternalSet256(InOutMax[1]), MaxZ0 = InternalSet256(InOutMax[2]);
+		RegisterType MinX1 = MinX0, MinY1 = MinY0, MinZ1 = MinZ0;
+		RegisterType MaxX1 = MaxX0, MaxY1 = MaxY0, MaxZ1 = MaxZ0;
+		for (; Index + 2 * Width <= Count; Index += 2 * Width)
+		{
+			InternalAddBounds256(MinX0, MaxX0, InternalLoad256(X + Index));
+			InternalAddBounds256(MinY0, MaxY0, InternalLoad256(Y + Index));
+			InternalAddBounds256(MinZ0, MaxZ0, InternalLoad256(Z + Index));
+			InternalAddBounds256(MinX1, MaxX1, InternalLoad256(X + Index + Width));
+			InternalAddBounds256(MinY1, MaxY1, InternalLoad256(Y + Index + Width));
+			InternalAddBounds256(MinZ1, MaxZ1, InternalLoad256(Z + Index + Width));
+		}
+
+		ScalarType MinLanes[3 * Width];
+		ScalarType MaxLanes[3 * Width];
+		InternalStore256(MinLanes + 0 * Width, InternalMin256(MinX0, MinX1));
+		InternalStore256(MinLanes + 1 * Width, InternalMin256(MinY0, MinY1));
+		InternalStore256(MinLanes + 2 * Width, InternalMin256(MinZ0, MinZ1));
+		InternalStore256(MaxLanes + 0 * Width, InternalMax256(MaxX0, MaxX1));
+		InternalStore256(MaxLanes + 1 * Width, InternalMax256(MaxY0, MaxY1));
+		InternalStore256(MaxLanes + 2 * Width, InternalMax256(MaxZ0, MaxZ1));
+		InternalFoldBoundsLanes(MinLanes, MaxLanes, 3 * Width, Width, InOutMin, InOutMax);
+		return Index;
+	}
+
+	template<typename RegisterType>
+	UE_SSE_TARGET_AVX FORCEINLINE RegisterType InternalDistanceSquared256(const RegisterType (&XYZ)[3], const RegisterType (&Center)[3])
+	{
+		const RegisterType DX = InternalSubtract256(XYZ[0], Center[0]);
+		const RegisterType DY = InternalSubtract256(XYZ[1], Center[1]);
+		const RegisterType DZ = InternalSubtract256(XYZ[2], Center[2]);
+		return InternalMultiplyAdd256(DZ, DZ, InternalMultiplyAdd256(DY, DY, InternalMultiply256(DX, DX)));
+	}
+
+	template<typename ScalarType>
+	UE_SSE_TARGET_AVX inline int32 InternalVectorComputeBoundingRadiusStridedAVX(const ScalarType* Points, int32 Stride, int32 Index, int32 Count, const ScalarType* Center, ScalarType& InOutRadiusSquared)
+	{
+		typedef decltype(InternalLoad256(Points)) RegisterType;
+		constexpr int32 Width = int32(sizeof(RegisterType) / sizeof(ScalarType));
+		const RegisterType CenterXYZ[3] = { InternalSet256(Center[0]), InternalSet256(Center[1]), InternalSet256(Center[2]) };
+		RegisterType MaxDistance = InternalSet256(InOutRadiusSquared);
+		for (; Index + Width < Count; Index += Width)
+		{
+			RegisterType XYZ[3];
+			InternalLoadPoints256((const uint8*)Points + SIZE_T(Index) * Stride, SIZE_T(Stride), XYZ);
+			MaxDistance = InternalMax256(MaxDistance, InternalDistanceSquared256(XYZ, CenterXYZ));
+		}
+
+		ScalarType Lanes[Width];
+		InternalStore256(Lanes, MaxDistance);
+		for (int32 Lane = 0; Lane < Width; ++Lane)
+		{
+			InOutRadiusSquared = FMath::Max(InOutRadiusSquared, Lanes[Lane]);
+		}
+		return Index;
+	}
+
+	template<typename ScalarType>
+	UE_SSE_TARGET_AVX inline int32 InternalVectorComputeBoundingRadiusSoAAVX(const ScalarType* const* Components, int32 Index, int32 Count, const ScalarType* Center, ScalarType& InOutRadiusSquared)
+	{
+		typedef decltype(InternalLoad256(Components[0])) RegisterType;
+		constexpr int32 Width = int32(sizeof(RegisterType) / sizeof(ScalarType));
+		const RegisterType CenterXYZ[3] = { InternalSet256(Center[0]), InternalSet256(Center[1]), InternalSet256(Center[2]) };
+		RegisterType MaxDistance0 = InternalSet256(InOutRadiusSquared);
+		RegisterType MaxDistance1 = MaxDistance0;
+		for (; Index + 2 * Width <= Count; Index += 2 * Width)
+		{
+			const RegisterType XYZ0[3] = { InternalLoad256(Components[0] + Index), InternalLoad256(Components[1] + Index), InternalLoad256(Components[2] + Index) };
+			const RegisterType XYZ1[3] = { InternalLoad256(Components[0] + Index + Width), InternalLoad256(Components[1] + Index + Width), InternalLoad256(Components[2] + Index + Width) };
+			MaxDistance0 = InternalMax256(MaxDistance0, InternalDistanceSquared256(XYZ0, CenterXYZ));
+			MaxDistance1 = InternalMax256(MaxDistance1, InternalDistanceSquared256(XYZ1, CenterXYZ));
+		}
+
+		ScalarType Lanes[Width];
+		InternalStore256(Lanes, InternalMax256(MaxDistance0, MaxDistance1));
+		for (int32 Lane = 0; Lane < Width; ++Lane)
+		{
+			InOutRadiusSquared = FMath::Max(InOutRadiusSquared, Lanes[Lane]);
+		}
+		return Index;
+	}
+
+	// Frustum culling kernels. Index is a multiple of 32 and every full group of 32 objects becomes one visibility word.
+	UE_SSE_TARGET_AVX FORCEINLINE __m256 InternalCompareGreater256(const __m256& A, const __m256& B)
+	{
+		return _mm256_cmp_ps(A, B, _CMP_GT_OQ);
+	}
+
+	UE_SSE_TARGET_AVX FORCEINLINE __m256d InternalCompareGreater256(const __m256d& A, const __m256d& B)
+	{
+		return _mm256_cmp_pd(A, B, _CMP_GT_OQ);
+	}
+
+	UE_SSE_TARGET_AVX FORCEINLINE __m256 InternalBitwiseOr256(const __m256& A, const __m256& B)
+	{
+		return _mm256_or_ps(A, B);
+	}
+
+	UE_SSE_TARGET_AVX FORCEINLINE __m256d InternalBitwiseOr256(const __m256d& A, const __m256d& B)
+	{
+		return _mm256_or_pd(A, B);
+	}
+
+	UE_SSE_TARGET_AVX FORCEINLINE uint32 InternalMaskBits256(const __m256& Mask)
+	{
+		return uint32(_mm256_movemask_ps(Mask));
+	}
+
+	UE_SSE_TARGET_AVX FORCEINLINE uint32 InternalMaskBits256(const __m256d& Mask)
+	{
+		return uint32(_mm256_movemask_pd(Mask));
+	}
+
+	// N dot P - W for one plane, in the same operation order as the 4-wide path. NegW holds -W.
+	template<typename RegisterType>
+	UE_SSE_TARGET_AVX FORCEINLINE RegisterType InternalPlaneDistance256(const RegisterType& NX, const RegisterType& NY, const RegisterType& NZ, const RegisterType& NegW, const RegisterType& X, const RegisterType& Y, const RegisterType& Z)
+	{
+		return InternalMultiplyAdd256(NZ, Z, InternalMultiplyAdd256(NY, Y, InternalMultiplyAdd256(NX, X, NegW)));
+	}
+
+	UE_SSE_TARGET_AVX FORCEINLINE __m256 InternalAbs256(const __m256& Value)
+	{
+		return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), Value);
+	}
+
+	UE_SSE_TARGET_AVX FORCEINLINE __m256d InternalAbs256(const __m256d& Value)
+	{
+		return _mm256_andnot_pd(_mm256_set1_pd(-0.0), Value);
+	}
+
+	// Largest N dot P - W over the box for one plane, minus the distance of its center.
+	template<typename RegisterType>
+	UE_SSE_TARGET_AVX FORCEINLINE RegisterType InternalPlanePushOut256(const RegisterType& NX, const RegisterType& NY, const RegisterType& NZ, const RegisterType& ExtentX, const RegisterType& ExtentY, const RegisterType& ExtentZ)
+	{
+		const RegisterType PushOut = InternalMultiply256(InternalAbs256(NX), ExtentX);
+		return InternalMultiplyAdd256(InternalAbs256(NZ), ExtentZ, InternalMultiplyAdd256(InternalAbs256(NY), ExtentY, PushOut));
+	}
+
+	// Two blocks of Width objects go through each plane, sharing its broadcasts.
+	template<typename ScalarType>
+	UE_SSE_TARGET_AVX inline int32 InternalVectorCullSpheresSoAAVX(uint32* OutVisible, const ScalarType* const* Spheres, const ScalarType* Planes, int32 NumPlanes, int32 Index, int32 Count)
+	{
+		typedef decltype(InternalLoad256(Planes)) RegisterType;
+		constexpr int32 Width = int32(sizeof(RegisterType) / sizeof(ScalarType));
+		for (; Index + 32 <= Count; Index += 32)
+		{
+			uint32 Outside = 0;
+			for (int32 Block = Index; Block < Index + 32; Block += 2 * Width)
+			{
+				const RegisterType X0 = InternalLoad256(Spheres[0] + Block), X1 = InternalLoad256(Spheres[0] + Block + Width);
+				const RegisterType Y0 = InternalLoad256(Spheres[1] + Block), Y1 = InternalLoad256(Spheres[1] + Block + Width);
+				const RegisterType Z0 = InternalLoad256(Spheres[2] + Block), Z1 = InternalLoad256(Spheres[2] + Block + Width);
+				const RegisterType Radius0 = InternalLoad256(Spheres[3] + Block), Radius1 = InternalLoad256(Spheres[3] + Block + Width);
+				RegisterType Mask0 = InternalSet256(ScalarType(0));
+				RegisterType Mask1 = Mask0;
+				for (int32 Plane = 0; Plane < NumPlanes; ++Plane)
+				{
+					const RegisterType NX = InternalSet256(Planes[4 * Plane + 0]);
+					const RegisterType NY = InternalSet256(Planes[4 * Plane + 1]);
+					const RegisterType NZ = InternalSet256(Planes[4 * Plane + 2]);
+					const RegisterType NegW = InternalSet256(-Planes[4 * Plane + 3]);
+					Mask0 = InternalBitwiseOr256(Mask0, InternalCompareGreater256(InternalPlaneDistance256(NX, NY, NZ, NegW, X0, Y0, Z0), Radius0));
+					Mask1 = InternalBitwiseOr256(Mask1, InternalCompareGreater256(InternalPlaneDistance256(NX, NY, NZ, NegW, X1, Y1, Z1), Radius1));
+				}
+				Outside |= (InternalMaskBits256(Mask0) | (InternalMaskBits256(Mask1) << Width)) << (Block - Index);
+			}
+			OutVisible[Index / 32] = ~Outside;
+		}
+		return Index;
+	}
+
+	template<typename ScalarType>
+	UE_SSE_TARGET_AVX inline int32 InternalVectorCullBoxesSoAAVX(uint32* OutVisible, const ScalarType* const* Boxes, const ScalarType* Planes, int32 NumPlanes, int32 Index, int32 Count)
+	{
+		typedef decltype(InternalLoad256(Planes)) RegisterType;
+		constexpr int32 Width = int32(sizeof(RegisterType) / sizeof(ScalarType));
+		for (; Index + 32 <= Count; Index += 32)
+		{
+			uint32 Outside = 0;
+			for (int32 Block = Index; Block < Index + 32; Block += 2 * Width)
+			{
+				const RegisterType X0 = InternalLoad256(Boxes[0] + Block), X1 = InternalLoad256(Boxes[0] + Block + Width);
+				const RegisterType Y0 = InternalLoad256(Boxes[1] + Block), Y1 = InternalLoad256(Boxes[1] + Block + Width);
+				const RegisterType Z0 = InternalLoad256(Boxes[2] + Block), Z1 = InternalLoad256(Boxes[2] + Block + Width);
+				const RegisterType ExtentX0 = InternalLoad256(Boxes[3] + Block), ExtentX1 = InternalLoad256(Boxes[3] + Block + Width);
+				const RegisterType ExtentY0 = InternalLoad256(Boxes[4] + Block), ExtentY1 = InternalLoad256(Boxes[4] + Block + Width);
+				const RegisterType ExtentZ0 = InternalLoad256(Boxes[5] + Block), ExtentZ1 = InternalLoad256(Boxes[5] + Block + Width);
+				RegisterType Mask0 = InternalSet256(ScalarType(0));
+				RegisterType Mask1 = Mask0;
+				for (int32 Plane = 0; Plane < NumPlanes; ++Plane)
+				{
+					const RegisterType NX = InternalSet256(Planes[4 * Plane + 0]);
+					const RegisterType NY = InternalSet256(Planes[4 * Plane + 1]);
+					const RegisterType NZ = InternalSet256(Planes[4 * Plane + 2]);
+					const RegisterType NegW = InternalSet256(-Planes[4 * Plane + 3]);
+					Mask0 = InternalBitwiseOr256(Mask0, InternalCompareGreater256(InternalPlaneDistance256(NX, NY, NZ, NegW, X0, Y0, Z0), InternalPlanePushOut256(NX, NY, NZ, ExtentX0, ExtentY0, ExtentZ0)));
+					Mask1 = InternalBitwiseOr256(Mask1, InternalCompareGreater256(InternalPlaneDistance256(NX, NY, NZ, NegW, X1, Y1, Z1), InternalPlanePushOut256(NX, NY, NZ, ExtentX1, ExtentY1, ExtentZ1)));
+				}
+				Outside |= (InternalMaskBits256(Mask0) | (InternalMaskBits256(Mask1) << Width)) << (Block - Index);
+			}
+			OutVisible[Index / 32] = ~Outside;
+		}
+		return Index;
+	}
+#endif // UE_PLATFORM_MATH_USE_AVX || UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+
+#if UE_PLATFORM_MATH_USE_AVX_2 || UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+	// Packed pixel kernels. Each 128-bit lane holds one RGBA pixel and goes through the same instructions as the per-pixel
+	// VectorLoad*/VectorStore* functions, so the results are bit-identical to them. Index and Count are in pixels.
+	UE_SSE_TARGET_AVX_2 inline int32 InternalVectorLoadByte4ArrayAVX2(float* RESTRICT Dst, const uint8* RESTRICT Src, int32 Index, int32 Count)
+	{
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			const __m128i Bytes = _mm_loadu_si128((const __m128i*)(Src + Index * 4));
+			_mm256_storeu_ps(Dst + Index * 4 + 0, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(Bytes)));
+			_mm256_storeu_ps(Dst + Index * 4 + 8, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(Bytes, 8))));
+		}
+		return Index;
+	}
+
+	UE_SSE_TARGET_AVX_2 inline int32 InternalVectorStoreByte4ArrayAVX2(uint8* RESTRICT Dst, const float* RESTRICT Src, int32 Index, int32 Count)
+	{
+		// The saturating packs work within 128-bit lanes and leave the pixels in 0 2 4 6 1 3 5 7 order.
+		const __m256i PixelOrder = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+		for (; Index + 8 <= Count; Index += 8)
+		{
+			const float* In = Src + Index * 4;
+			const __m256i Words0123 = _mm256_packs_epi32(_mm256_cvttps_epi32(_mm256_loadu_ps(In + 0)), _mm256_cvttps_epi32(_mm256_loadu_ps(In + 8)));
+			const __m256i Words4567 = _mm256_packs_epi32(_mm256_cvttps_epi32(_mm256_loadu_ps(In + 16)), _mm256_cvttps_epi32(_mm256_loadu_ps(In + 24)));
+			_mm256_storeu_si256((__m256i*)(Dst + Index * 4), _mm256_permutevar8x32_epi32(_mm256_packus_epi16(Words0123, Words4567), PixelOrder));
+		}
+		return Index;
+	}
+
+	UE_SSE_TARGET_AVX_2 FORCEINLINE __m256 InternalURGB10A2NToFloat256(const __m256i& Pixels)
+	{
+		// Pixels holds one packed pixel replicated across each 128-bit lane.
+		const __m256i Mask = _mm256_setr_epi32(0x3FF, 0x3FF << 10, 0x3FF << 20, 0x3u << 30, 0x3FF, 0x3FF << 10, 0x3FF << 20, 0x3u << 30);
+		const __m256i AlphaSign = _mm256_setr_epi32(0, 0, 0, 0x80000000, 0, 0, 0, 0x80000000);
+		const __m256 AlphaBias = _mm256_setr_ps(0, 0, 0, 32768.0f*65536.0f, 0, 0, 0, 32768.0f*65536.0f);
+		const __m256 Scale = _mm256_setr_ps(
+			1.0f / 1023.0f, 1.0f / (1023.0f*1024.0f), 1.0f / (1023.0f*1024.0f*1024.0f), 1.0f / (3.0f*1024.0f*1024.0f*1024.0f),
+			1.0f / 1023.0f, 1.0f / (1023.0f*1024.0f), 1.0f / (1023.0f*1024.0f*1024.0f), 1.0f / (3.0f*1024.0f*1024.0f*1024.0f));
+
+		const __m256i Fields = _mm256_xor_si256(_mm256_and_si256(Pixels, Mask), AlphaSign);
+		return _mm256_mul_ps(_mm256_add_ps(_mm256_cvtepi32_ps(Fields), AlphaBias), Scale);
+	}
+
+	UE_SSE_TARGET_AVX_2 inline int32 InternalVectorLoadURGB10A2NArrayAVX2(float* RESTRICT Dst, const uint32* RESTRICT Src, int32 Index, int32 Count)
+	{
+		const __m256i Broadcast01 = _mm256_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1);
+		const __m256i Broadcast23 = _mm256_setr_epi32(2, 2, 2, 2, 3, 3, 3, 3);
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			const __m256i Pixels = _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(Src + Index)));
+			_mm256_storeu_ps(Dst + Index * 4 + 0, InternalURGB10A2NToFloat256(_mm256_permutevar8x32_epi32(Pixels, Broadcast01)));
+			_mm256_storeu_ps(Dst + Index * 4 + 8, InternalURGB10A2NToFloat256(_mm256_permutevar8x32_epi32(Pixels, Broadcast23)));
+		}
+		return Index;
+	}
+
+	UE_SSE_TARGET_AVX_2 FORCEINLINE __m256i InternalFloatToURGB10A2N256(const __m256& Vec)
+	{
+		// Two pixels in, the packed value of each ends up in element 0 of its 128-bit lane.
+		const __m256 Scale = _mm256_setr_ps(
+			1023.0f, 1023.0f*1024.0f*0.5f, 1023.0f*1024.0f*1024.0f, 3.0f*1024.0f*1024.0f*1024.0f*0.5f,
+			1023.0f, 1023.0f*1024.0f*0.5f, 1023.0f*1024.0f*1024.0f, 3.0f*1024.0f*1024.0f*1024.0f*0.5f);
+		const __m256i Mask = _mm256_setr_epi32(0x3FF, 0x3FF << (10 - 1), 0x3FF << 20, 0x3u << (30 - 1), 0x3FF, 0x3FF << (10 - 1), 0x3FF << 20, 0x3u << (30 - 1));
+
+		const __m256 Clamped = _mm256_min_ps(_mm256_max_ps(Vec, _mm256_setzero_ps()), _mm256_set1_ps(1.0f));
+		__m256i Fields = _mm256_and_si256(_mm256_cvttps_epi32(_mm256_mul_ps(Clamped, Scale)), Mask);
+		Fields = _mm256_or_si256(Fields, _mm256_shuffle_epi32(Fields, _MM_SHUFFLE(3, 2, 3, 2)));
+		const __m256i GreenAlpha = _mm256_shuffle_epi32(Fields, _MM_SHUFFLE(1, 1, 1, 1));
+		return _mm256_or_si256(Fields, _mm256_add_epi32(GreenAlpha, GreenAlpha));
+	}
+
+	UE_SSE_TARGET_AVX_2 inline int32 InternalVectorStoreURGB10A2NArrayAVX2(uint32* RESTRICT Dst, const float* RESTRICT Src, int32 Index, int32 Count)
+	{
+		const __m256i PixelOrder = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+		for (; Index + 8 <= Count; Index += 8)
+		{
+			const float* In = Src + Index * 4;
+			const __m256i Packed01 = InternalFloatToURGB10A2N256(_mm256_loadu_ps(In + 0));
+			const __m256i Packed23 = InternalFloatToURGB10A2N256(_mm256_loadu_ps(In + 8));
+			const __m256i Packed45 = InternalFloatToURGB10A2N256(_mm256_loadu_ps(In + 16));
+			const __m256i Packed67 = InternalFloatToURGB10A2N256(_mm256_loadu_ps(In + 24));
+			// Gather element 0 of every lane, which gives pixels 0 2 4 6 | 1 3 5 7.
+			const __m256i Packed = _mm256_unpacklo_epi64(_mm256_unpacklo_epi32(Packed01, Packed23), _mm256_unpacklo_epi32(Packed45, Packed67));
+			_mm256_storeu_si256((__m256i*)(Dst + Index), _mm256_permutevar8x32_epi32(Packed, PixelOrder));
+		}
+		return Index;
+	}
+
+	UE_SSE_TARGET_AVX_2 inline int32 InternalVectorLoadURGBA16NArrayAVX2(float* RESTRICT Dst, const uint16* RESTRICT Src, int32 Index, int32 Count)
+	{
+		// 8 pixels per iteration as 4 independent chains. Each 16-byte read folds into the widening move, so the loop issues
+		// one load, one convert and one store per 2 pixels.
+		for (; Index + 8 <= Count; Index += 8)
+		{
+			const uint16* In = Src + Index * 4;
+			float* Out = Dst + Index * 4;
+			const __m256 Pixels01 = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(In + 0))));
+			const __m256 Pixels23 = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(In + 8))));
+			const __m256 Pixels45 = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(In + 16))));
+			const __m256 Pixels67 = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(In + 24))));
+			_mm256_storeu_ps(Out + 0, Pixels01);
+			_mm256_storeu_ps(Out + 8, Pixels23);
+			_mm256_storeu_ps(Out + 16, Pixels45);
+			_mm256_storeu_ps(Out + 24, Pixels67);
+		}
+		for (; Index + 2 <= Count; Index += 2)
+		{
+			_mm256_storeu_ps(Dst + Index * 4, _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(Src + Index * 4)))));
+		}
+		return Index;
+	}
+
+	UE_SSE_TARGET_AVX_2 inline int32 InternalVectorLoadSRGBA16NArrayAVX2(float* RESTRICT Dst, const int16* RESTRICT Src, int32 Index, int32 Count)
+	{
+		for (; Index + 8 <= Count; Index += 8)
+		{
+			const int16* In = Src + Index * 4;
+			float* Out = Dst + Index * 4;
+			const __m256 Pixels01 = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(In + 0))));
+			const __m256 Pixels23 = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(In + 8))));
+			const __m256 Pixels45 = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(In + 16))));
+			const __m256 Pixels67 = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(In + 24))));
+			_mm256_storeu_ps(Out + 0, Pixels01);
+			_mm256_storeu_ps(Out + 8, Pixels23);
+			_mm256_storeu_ps(Out + 16, Pixels45);
+			_mm256_storeu_ps(Out + 24, Pixels67);
+		}
+		for (; Index + 2 <= Count; Index += 2)
+		{
+			_mm256_storeu_ps(Dst + Index * 4, _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(Src + Index * 4)))));
+		}
+		return Index;
+	}
+
+	UE_SSE_TARGET_AVX_2 inline int32 InternalVectorStoreURGBA16NArrayAVX2(uint16* RESTRICT Dst, const float* RESTRICT Src, int32 Index, int32 Count)
+	{
+		// After clamping every value is in [0, 65535], so the unsigned saturating pack keeps the same low 16 bits the per-pixel store extracts.
+		const __m256 Scale = _mm256_set1_ps(65535.0f);
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			const float* In = Src + Index * 4;
+			const __m256 Clamped01 = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(In + 0), _mm256_setzero_ps()), _mm256_set1_ps(1.0f));
+			const __m256 Clamped23 = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(In + 8), _mm256_setzero_ps()), _mm256_set1_ps(1.0f));
+			const __m256i Words = _mm256_packus_epi32(_mm256_cvtps_epi32(_mm256_mul_ps(Clamped01, Scale)), _mm256_cvtps_epi32(_mm256_mul_ps(Clamped23, Scale)));
+			_mm256_storeu_si256((__m256i*)(Dst + Index * 4), _mm256_permute4x64_epi64(Words, _MM_SHUFFLE(3, 1, 2, 0)));
+		}
+		return Index;
+	}
+
+	// bfloat16 kernels. Denormals are flushed to zero before rounding to nearest even, which is what vcvtneps2bf16 does,
+	// so every path narrows to the same bits. One result per 32-bit lane, zero extended.
+	UE_SSE_TARGET_AVX_2 FORCEINLINE __m256i InternalFloatToBFloat16256(const __m256& Vec)
+	{
+		const __m256i AbsMask = _mm256_set1_epi32(0x7FFFFFFF);
+		const __m256i IsDenormal = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_castps_si256(Vec), _mm256_set1_epi32(0x7F800000)), _mm256_setzero_si256());
+		const __m256i Bits = _mm256_andnot_si256(_mm256_and_si256(IsDenormal, AbsMask), _mm256_castps_si256(Vec));
+		const __m256i Odd = _mm256_and_si256(_mm256_srli_epi32(Bits, 16), _mm256_set1_epi32(1));
+		const __m256i Rounded = _mm256_add_epi32(Bits, _mm256_add_epi32(Odd, _mm256_set1_epi32(0x7FFF)));
+		const __m256i IsNaN = _mm256_cmpgt_epi32(_mm256_and_si256(Bits, AbsMask), _mm256_set1_epi32(0x7F800000));
+		const __m256i Quiet = _mm256_or_si256(Bits, _mm256_set1_epi32(0x00400000));
+		return _mm256_srli_epi32(_mm256_blendv_epi8(Rounded, Quiet, IsNaN), 16);
+	}
+
+	UE_SSE_TARGET_AVX_2 FORCEINLINE __m256 InternalLoadBFloat16256(const uint16* Src)
+	{
+		return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)Src)), 16));
+	}
+
+	UE_SSE_TARGET_AVX_2 FORCEINLINE float InternalReduceAdd256(const __m256& Vec)
+	{
+		const __m128 Sum4 = _mm_add_ps(_mm256_castps256_ps128(Vec), _mm256_extractf128_ps(Vec, 1));
+		const __m128 Sum2 = _mm_add_ps(Sum4, _mm_movehl_ps(Sum4, Sum4));
+		return _mm_cvtss_f32(_mm_add_ss(Sum2, _mm_shuffle_ps(Sum2, Sum2, _MM_SHUFFLE(1, 1, 1, 1))));
+	}
+
+	UE_SSE_TARGET_AVX_2 inline int32 InternalVectorFloatToBFloat16ArrayAVX2(uint16* RESTRICT Dst, const float* RESTRICT Src, int32 Index, int32 Count)
+	{
+		for (; Index + 16 <= Count; Index += 16)
+		{
+			const __m256i Words = _mm256_packus_epi32(InternalFloatToBFloat16256(_mm256_loadu_ps(Src + Index)), InternalFloatToBFloat16256(_mm256_loadu_ps(Src + Index + 8)));
+			_mm256_storeu_si256((__m256i*)(Dst + Index), _mm256_permute4x64_epi64(Words, _MM_SHUFFLE(3, 1, 2, 0)));
+		}
+		return Index;
+	}
+
+	UE_SSE_TARGET_AVX_2 inline int32 InternalVectorBFloat16ToFloatArrayAVX2(float* RESTRICT Dst, const uint16* RESTRICT Src, int32 Index, int32 Count)
+	{
+		for (; Index + 8 <= Count; Index += 8)
+		{
+			_mm256_storeu_ps(Dst + Index, InternalLoadBFloat16256(Src + Index));
+		}
+		return Index;
+	}
+
+	// Result[Row] = Matrix[Row] . Vector for the rows [Row, NumRows) of a row-major NumColumns wide matrix. Four rows share
+	// each widened chunk of Vector. The last partial chunk of every row goes through a zero padded copy. Returns NumRows.
+	UE_SSE_TARGET_AVX_2 inline int32 InternalVectorMatrixVectorMultiplyBFloat16AVX2(float* RESTRICT Result, const uint16* RESTRICT Matrix, const uint16* RESTRICT Vector, int32 NumColumns, int32 Row, int32 NumRows)
+	{
+		const int32 NumBodyColumns = NumColumns & ~7;
+		uint16 Tail[5][8] = {};
+		for (int32 Column = NumBodyColumns; Column < NumColumns; ++Column)
+		{
+			Tail[4][Column - NumBodyColumns] = Vector[Column];
+		}
+		const __m256 VectorTail = InternalLoadBFloat16256(Tail[4]);
+
+		for (; Row + 4 <= NumRows; Row += 4)
+		{
+			const uint16* Row0 = Matrix + (SIZE_T)Row * NumColumns;
+			const uint16* Row1 = Row0 + NumColumns;
+			const uint16* Row2 = Row1 + NumColumns;
+			const uint16* Row3 = Row2 + NumColumns;
+			__m256 Sum0 = _mm256_setzero_ps();
+			__m256 Sum1 = _mm256_setzero_ps();
+			__m256 Sum2 = _mm256_setzero_ps();
+			__m256 Sum3 = _mm256_setzero_ps();
+			for (int32 Column = 0; Column < NumBodyColumns; Column += 8)
+			{
+				const __m256 V = InternalLoadBFloat16256(Vector + Column);
+				Sum0 = InternalMultiplyAdd256(InternalLoadBFloat16256(Row0 + Column), V, Sum0);
+				Sum1 = InternalMultiplyAdd256(InternalLoadBFloat16256(Row1 + Column), V, Sum1);
+				Sum2 = InternalMultiplyAdd256(InternalLoadBFloat16256(Row2 + Column), V, Sum2);
+				Sum3 = InternalMultiplyAdd256(InternalLoadBFloat16256(Row3 + Column), V, Sum3);
+			}
+			if (NumBodyColumns < NumColumns)
+			{
+				for (int32 TailColumn = NumBodyColumns; TailColumn < NumColumns; ++TailColumn)
+				{
+					Tail[0][TailColumn - NumBodyColumns] = Row0[TailColumn];
+					Tail[1][TailColumn - NumBodyColumns] = Row1[TailColumn];
+					Tail[2][TailColumn - NumBodyColumns] = Row2[TailColumn];
+					Tail[3][TailColumn - NumBodyColumns] = Row3[TailColumn];
+				}
+				Sum0 = InternalMultiplyAdd256(InternalLoadBFloat16256(Tail[0]), VectorTail, Sum0);
+				Sum1 = InternalMultiplyAdd256(InternalLoadBFloat16256(Tail[1]), VectorTail, Sum1);
+				Sum2 = InternalMultiplyAdd256(InternalLoadBFloat16256(Tail[2]), VectorTail, Sum2);
+				Sum3 = InternalMultiplyAdd256(InternalLoadBFloat16256(Tail[3]), VectorTail, Sum3);
+			}
+			Result[Row + 0] = InternalReduceAdd256(Sum0);
+			Result[Row + 1] = InternalReduceAdd256(Sum1);
+			Result[Row + 2] = InternalReduceAdd256(Sum2);
+			Result[Row + 3] = InternalReduceAdd256(Sum3);
+		}
+		for (; Row < NumRows; ++Row)
+		{
+			const uint16* Row0 = Matrix + (SIZE_T)Row * NumColumns;
+			__m256 Sum0 = _mm256_setzero_ps();
+			__m256 Sum1 = _mm256_setzero_ps();
+			int32 Column = 0;
+			for (; Column + 16 <= NumBodyColumns; Column += 16)
+			{
+				Sum0 = InternalMultiplyAdd256(InternalLoadBFloat16256(Row0 + Column), InternalLoadBFloat16256(Vector + Column), Sum0);
+				Sum1 = InternalMultiplyAdd256(InternalLoadBFloat16256(Row0 + Column + 8), InternalLoadBFloat16256(Vector + Column + 8), Sum1);
+			}
+			if (Column < NumBodyColumns)
+			{
+				Sum0 = InternalMultiplyAdd256(InternalLoadBFloat16256(Row0 + Column), InternalLoadBFloat16256(Vector + Column), Sum0);
+			}
+			if (NumBodyColumns < NumColumns)
+			{
+				for (int32 TailColumn = NumBodyColumns; TailColumn < NumColumns; ++TailColumn)
+				{
+					Tail[0][TailColumn - NumBodyColumns] = Row0[TailColumn];
+				}
+				Sum1 = InternalMultiplyAdd256(InternalLoadBFloat16256(Tail[0]), VectorTail, Sum1);
+			}
+			Result[Row] = InternalReduceAdd256(_mm256_add_ps(Sum0, Sum1));
+		}
+		return Row;
+	}
+#endif // UE_PLATFORM_MATH_USE_AVX_2 || UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+
+#if UE_PLATFORM_MATH_USE_AVX_512 || UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+	// AVX-512 kernels, same contract as the AVX ones which they fall through to for the remainder.
+	UE_SSE_TARGET_AVX_512 inline int32 InternalVectorTransformVectorArrayAVX512(VectorRegister4Float* Dst, const VectorRegister4Float* Src, int32 Index, int32 Count, const float* MRows)
+	{
+		// Four vectors per iteration, each 128-bit lane holds one vector.
+		const __m512 Row0 = _mm512_broadcast_f32x4(_mm_loadu_ps(MRows + 0));
+		const __m512 Row1 = _mm512_broadcast_f32x4(_mm_loadu_ps(MRows + 4));
+		const __m512 Row2 = _mm512_broadcast_f32x4(_mm_loadu_ps(MRows + 8));
+		const __m512 Row3 = _mm512_broadcast_f32x4(_mm_loadu_ps(MRows + 12));
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			const __m512 V = _mm512_loadu_ps((const float*)(Src + Index));
+			__m512 Result = _mm512_mul_ps(_mm512_permute_ps(V, _MM_SHUFFLE(0, 0, 0, 0)), Row0);
+			Result = _mm512_fmadd_ps(_mm512_permute_ps(V, _MM_SHUFFLE(1, 1, 1, 1)), Row1, Result);
+			Result = _mm512_fmadd_ps(_mm512_permute_ps(V, _MM_SHUFFLE(2, 2, 2, 2)), Row2, Result);
+			Result = _mm512_fmadd_ps(_mm512_permute_ps(V, _MM_SHUFFLE(3, 3, 3, 3)), Row3, Result);
+			_mm512_storeu_ps((float*)(Dst + Index), Result);
+		}
+		return InternalVectorTransformVectorArrayAVX(Dst, Src, Index, Count, MRows);
+	}
+
+	UE_SSE_TARGET_AVX_512 inline int32 InternalVectorTransformVectorArrayAVX512(VectorRegister4Double* Dst, const VectorRegister4Double* Src, int32 Index, int32 Count, const double* MRows)
+	{
+		// Two vectors per iteration, each 256-bit lane holds one vector.
+		const __m512d Row0 = _mm512_broadcast_f64x4(_mm256_loadu_pd(MRows + 0));
+		const __m512d Row1 = _mm512_broadcast_f64x4(_mm256_loadu_pd(MRows + 4));
+		const __m512d Row2 = _mm512_broadcast_f64x4(_mm256_loadu_pd(MRows + 8));
+		const __m512d Row3 = _mm512_broadcast_f64x4(_mm256_loadu_pd(MRows + 12));
+		for (; Index + 2 <= Count; Index += 2)
+		{
+			const __m512d V = _mm512_loadu_pd((const double*)(Src + Index));
+			__m512d Result = _mm512_mul_pd(_mm512_permutex_pd(V, _MM_SHUFFLE(0, 0, 0, 0)), Row0);
+			Result = _mm512_fmadd_pd(_mm512_permutex_pd(V, _MM_SHUFFLE(1, 1, 1, 1)), Row1, Result);
+			Result = _mm512_fmadd_pd(_mm512_permutex_pd(V, _MM_SHUFFLE(2, 2, 2, 2)), Row2, Result);
+			Result = _mm512_fmadd_pd(_mm512_permutex_pd(V, _MM_SHUFFLE(3, 3, 3, 3)), Row3, Result);
+			_mm512_storeu_pd((double*)(Dst + Index), Result);
+		}
+		return InternalVectorTransformVectorArrayAVX(Dst, Src, Index, Count, MRows);
+	}
+
+	UE_SSE_TARGET_AVX_512 inline int32 InternalVectorTransformVectorSoAAVX512(const float (&M)[4][4], float* OutX, float* OutY, float* OutZ, float* OutW, const float* InX, const float* InY, const float* InZ, float InW, int32 Index, int32 Count)
+	{
+		__m512 Rows[3][4];
+		__m512 Offset[4];
+		for (int32 Column = 0; Column < 4; ++Column)
+		{
+			Rows[0][Column] = _mm512_set1_ps(M[0][Column]);
+			Rows[1][Column] = _mm512_set1_ps(M[1][Column]);
+			Rows[2][Column] = _mm512_set1_ps(M[2][Column]);
+			Offset[Column] = _mm512_set1_ps(InW * M[3][Column]);
+		}
+		for (; Index + 16 <= Count; Index += 16)
+		{
+			const __m512 X = _mm512_loadu_ps(InX + Index);
+			const __m512 Y = _mm512_loadu_ps(InY + Index);
+			const __m512 Z = _mm512_loadu_ps(InZ + Index);
+			_mm512_storeu_ps(OutX + Index, _mm512_fmadd_ps(Z, Rows[2][0], _mm512_fmadd_ps(Y, Rows[1][0], _mm512_fmadd_ps(X, Rows[0][0], Offset[0]))));
+			_mm512_storeu_ps(OutY + Index, _mm512_fmadd_ps(Z, Rows[2][1], _mm512_fmadd_ps(Y, Rows[1][1], _mm512_fmadd_ps(X, Rows[0][1], Offset[1]))));
+			_mm512_storeu_ps(OutZ + Index, _mm512_fmadd_ps(Z, Rows[2][2], _mm512_fmadd_ps(Y, Rows[1][2], _mm512_fmadd_ps(X, Rows[0][2], Offset[2]))));
+			if (OutW)
+			{
+				_mm512_storeu_ps(OutW + Index, _mm512_fmadd_ps(Z, Rows[2][3], _mm512_fmadd_ps(Y, Rows[1][3], _mm512_fmadd_ps(X, Rows[0][3], Offset[3]))));
+			}
+		}
+		return InternalVectorTransformVectorSoAAVX(M, OutX, OutY, OutZ, OutW, InX, InY, InZ, InW, Index, Count);
+	}
+
+	UE_SSE_TARGET_AVX_512 inline int32 InternalVectorTransformVectorSoAAVX512(const double (&M)[4][4], double* OutX, double* OutY, double* OutZ, double* OutW, const double* InX, const double* InY, const double* InZ, double InW, int32 Index, int32 Count)
+	{
+		__m512d Rows[3][4];
+		__m512d Offset[4];
+		for (int32 Column = 0; Column < 4; ++Column)
+		{
+			Rows[0][Column] = _mm512_set1_pd(M[0][Column]);
+			Rows[1][Column] = _mm512_set1_pd(M[1][Column]);
+			Rows[2][Column] = _mm512_set1_pd(M[2][Column]);
+			Offset[Column] = _mm512_set1_pd(InW * M[3][Column]);
+		}
+		for (; Index + 8 <= Count; Index += 8)
+		{
+			const __m512d X = _mm512_loadu_pd(InX + Index);
+			const __m512d Y = _mm512_loadu_pd(InY + Index);
+			const __m512d Z = _mm512_loadu_pd(InZ + Index);
+			_mm512_storeu_pd(OutX + Index, _mm512_fmadd_pd(Z, Rows[2][0], _mm512_fmadd_pd(Y, Rows[1][0], _mm512_fmadd_pd(X, Rows[0][0], Offset[0]))));
+			_mm512_storeu_pd(OutY + Index, _mm512_fmadd_pd(Z, Rows[2][1], _mm512_fmadd_pd(Y, Rows[1][1], _mm512_fmadd_pd(X, Rows[0][1], Offset[1]))));
+			_mm512_storeu_pd(OutZ + Index, _mm512_fmadd_pd(Z, Rows[2][2], _mm512_fmadd_pd(Y, Rows[1][2], _mm512_fmadd_pd(X, Rows[0][2], Offset[2]))));
+			if (OutW)
+			{
+				_mm512_storeu_pd(OutW + Index, _mm512_fmadd_pd(Z, Rows[2][3], _mm512_fmadd_pd(Y, Rows[1][3], _mm512_fmadd_pd(X, Rows[0][3], Offset[3]))));
+			}
+		}
+		return InternalVectorTransformVectorSoAAVX(M, OutX, OutY, OutZ, OutW, InX, InY, InZ, InW, Index, Count);
+	}
+
+	UE_SSE_TARGET_AVX_512 inline int32 InternalVectorMatrixMultiplyArrayAVX512(float* Result, const float* Matrix1, const float* Matrix2, int32 Index, int32 Count)
+	{
+		// A whole matrix fits one register, the rows of Matrix2 are broadcast to all four lanes.
+		for (; Index < Count; ++Index)
+		{
+			const __m512 A = _mm512_loadu_ps(Matrix1 + Index * 16);
+			const float* B = Matrix2 + Index * 16;
+			const __m512 B0 = _mm512_broadcast_f32x4(_mm_loadu_ps(B + 0));
+			const __m512 B1 = _mm512_broadcast_f32x4(_mm_loadu_ps(B + 4));
+			const __m512 B2 = _mm512_broadcast_f32x4(_mm_loadu_ps(B + 8));
+			const __m512 B3 = _mm512_broadcast_f32x4(_mm_loadu_ps(B + 12));
+
+			__m512 R = _mm512_mul_ps(_mm512_permute_ps(A, _MM_SHUFFLE(0, 0, 0, 0)), B0);
+			R = _mm512_fmadd_ps(_mm512_permute_ps(A, _MM_SHUFFLE(1, 1, 1, 1)), B1, R);
+			R = _mm512_fmadd_ps(_mm512_permute_ps(A, _MM_SHUFFLE(2, 2, 2, 2)), B2, R);
+			R = _mm512_fmadd_ps(_mm512_permute_ps(A, _MM_SHUFFLE(3, 3, 3, 3)), B3, R);
+			_mm512_storeu_ps(Result + Index * 16, R);
+		}
+		return Index;
+	}
+
+	UE_SSE_TARGET_AVX_512 inline int32 InternalVectorMatrixMultiplyArrayAVX512(double* Result, const double* Matrix1, const double* Matrix2, int32 Index, int32 Count)
+	{
+		// Rows 0-1 and 2-3 of each matrix share a register, the rows of Matrix2 are broadcast to both halves.
+		for (; Index < Count; ++Index)
+		{
+			const __m512d A01 = _mm512_loadu_pd(Matrix1 + Index * 16 + 0);
+			const __m512d A23 = _mm512_loadu_pd(Matrix1 + Index * 16 + 8);
+			const double* B = Matrix2 + Index * 16;
+			const __m512d B0 = _mm512_broadcast_f64x4(_mm256_loadu_pd(B + 0));
+			const __m512d B1 = _mm512_broadcast_f64x4(_mm256_loadu_pd(B + 4));
+			const __m512d B2 = _mm512_broadcast_f64x4(_mm256_loadu_pd(B + 8));
+			const __m512d B3 = _mm512_broadcast_f64x4(_mm256_loadu_pd(B + 12));
+
+			__m512d R01 = _mm512_mul_pd(_mm512_permutex_pd(A01, _MM_SHUFFLE(0, 0, 0, 0)), B0);
+			__m512d R23 = _mm512_mul_pd(_mm512_permutex_pd(A23, _MM_SHUFFLE(0, 0, 0, 0)), B0);
+			R01 = _mm512_fmadd_pd(_mm512_permutex_pd(A01, _MM_SHUFFLE(1, 1, 1, 1)), B1, R01);
+			R23 = _mm512_fmadd_pd(_mm512_permutex_pd(A23, _MM_SHUFFLE(1, 1, 1, 1)), B1, R23);
+			R01 = _mm512_fmadd_pd(_mm512_permutex_pd(A01, _MM_SHUFFLE(2, 2, 2, 2)), B2, R01);
+			R23 = _mm512_fmadd_pd(_mm512_permutex_pd(A23, _MM_SHUFFLE(2, 2, 2, 2)), B2, R23);
+			R01 = _mm512_fmadd_pd(_mm512_permutex_pd(A01, _MM_SHUFFLE(3, 3, 3, 3)), B3, R01);
+			R23 = _mm512_fmadd_pd(_mm512_permutex_pd(A23, _MM_SHUFFLE(3, 3, 3, 3)), B3, R23);
+
+			_mm512_storeu_pd(Result + Index * 16 + 0, R01);
+			_mm512_storeu_pd(Result + Index * 16 + 8, R23);
+		}
+		return Index;
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512 InternalLoad512(const float* Src)
+	{
+		return _mm512_loadu_ps(Src);
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512d InternalLoad512(const double* Src)
+	{
+		return _mm512_loadu_pd(Src);
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE void InternalStore512(float* Dst, const __m512& Vec)
+	{
+		_mm512_storeu_ps(Dst, Vec);
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE void InternalStore512(double* Dst, const __m512d& Vec)
+	{
+		_mm512_storeu_pd(Dst, Vec);
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512 InternalSet512(float Value)
+	{
+		return _mm512_set1_ps(Value);
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512d InternalSet512(double Value)
+	{
+		return _mm512_set1_pd(Value);
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512 InternalAdd512(const __m512& A, const __m512& B)
+	{
+		return _mm512_add_ps(A, B);
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512d InternalAdd512(const __m512d& A, const __m512d& B)
+	{
+		return _mm512_add_pd(A, B);
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512 InternalSubtract512(const __m512& A, const __m512& B)
+	{
+		return _mm512_sub_ps(A, B);
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512d InternalSubtract512(const __m512d& A, const __m512d& B)
+	{
+		return _mm512_sub_pd(A, B);
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512 InternalMultiply512(const __m512& A, const __m512& B)
+	{
+		return _mm512_mul_ps(A, B);
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512d InternalMultiply512(const __m512d& A, const __m512d& B)
+	{
+		return _mm512_mul_pd(A, B);
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512 InternalMultiplyAdd512(const __m512& A, const __m512& B, const __m512& C)
+	{
+		return _mm512_fmadd_ps(A, B, C);
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512d InternalMultiplyAdd512(const __m512d& A, const __m512d& B, const __m512d& C)
+	{
+		return _mm512_fmadd_pd(A, B, C);
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512 InternalNegateMultiplyAdd512(const __m512& A, const __m512& B, const __m512& C)
+	{
+		return _mm512_fnmadd_ps(A, B, C);
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512d InternalNegateMultiplyAdd512(const __m512d& A, const __m512d& B, const __m512d& C)
+	{
+		return _mm512_fnmadd_pd(A, B, C);
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512 InternalReciprocalSqrt512(const __m512& A)
+	{
+		return _mm512_div_ps(_mm512_set1_ps(1.0f), _mm512_sqrt_ps(A));
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512d InternalReciprocalSqrt512(const __m512d& A)
+	{
+		return _mm512_div_pd(_mm512_set1_pd(1.0), _mm512_sqrt_pd(A));
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512 InternalSelectGreaterEqual512(const __m512& Value, const __m512& Threshold, const __m512& IfGreaterEqual, const __m512& IfLess)
+	{
+		return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(Value, Threshold, _CMP_GE_OQ), IfLess, IfGreaterEqual);
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512d InternalSelectGreaterEqual512(const __m512d& Value, const __m512d& Threshold, const __m512d& IfGreaterEqual, const __m512d& IfLess)
+	{
+		return _mm512_mask_blend_pd(_mm512_cmp_pd_mask(Value, Threshold, _CMP_GE_OQ), IfLess, IfGreaterEqual);
+	}
+
+	template<typename RegisterType, typename ScalarType>
+	UE_SSE_TARGET_AVX_512 FORCEINLINE void InternalLoadQuaternion512(RegisterType (&Out)[4], const ScalarType* const* Quat, int32 Index)
+	{
+		Out[0] = InternalLoad512(Quat[0] + Index);
+		Out[1] = InternalLoad512(Quat[1] + Index);
+		Out[2] = InternalLoad512(Quat[2] + Index);
+		Out[3] = InternalLoad512(Quat[3] + Index);
+	}
+
+	template<typename RegisterType, typename ScalarType>
+	UE_SSE_TARGET_AVX_512 FORCEINLINE void InternalStoreQuaternion512(ScalarType* const* Quat, const RegisterType (&In)[4], int32 Index)
+	{
+		InternalStore512(Quat[0] + Index, In[0]);
+		InternalStore512(Quat[1] + Index, In[1]);
+		InternalStore512(Quat[2] + Index, In[2]);
+		InternalStore512(Quat[3] + Index, In[3]);
+	}
+
+	template<typename ScalarType, typename RegisterType>
+	UE_SSE_TARGET_AVX_512 FORCEINLINE void InternalQuaternionNormalize512(RegisterType (&Q)[4])
+	{
+		RegisterType SquareSum = InternalMultiply512(Q[0], Q[0]);
+		SquareSum = InternalMultiplyAdd512(Q[1], Q[1], SquareSum);
+		SquareSum = InternalMultiplyAdd512(Q[2], Q[2], SquareSum);
+		SquareSum = InternalMultiplyAdd512(Q[3], Q[3], SquareSum);
+		const RegisterType Scale = InternalReciprocalSqrt512(SquareSum);
+		const RegisterType Tolerance = InternalSet512(ScalarType(1.e-8));
+		const RegisterType Zero = InternalSet512(ScalarType(0));
+		Q[0] = InternalSelectGreaterEqual512(SquareSum, Tolerance, InternalMultiply512(Q[0], Scale), Zero);
+		Q[1] = InternalSelectGreaterEqual512(SquareSum, Tolerance, InternalMultiply512(Q[1], Scale), Zero);
+		Q[2] = InternalSelectGreaterEqual512(SquareSum, Tolerance, InternalMultiply512(Q[2], Scale), Zero);
+		Q[3] = InternalSelectGreaterEqual512(SquareSum, Tolerance, InternalMultiply512(Q[3], Scale), InternalSet512(ScalarType(1)));
+	}
+
+	template<typename ScalarType>
+	UE_SSE_TARGET_AVX_512 inline int32 InternalVectorQuaternionMultiplySoAAVX512(ScalarType* const* Result, const ScalarType* const* Quat1, const ScalarType* const* Quat2, int32 Index, int32 Count)
+	{
+		typedef decltype(InternalSet512(ScalarType(0))) RegisterType;
+		constexpr int32 Width = int32(sizeof(RegisterType) / sizeof(ScalarType));
+		for (; Index + Width <= Count; Index += Width)
+		{
+			RegisterType A[4], B[4], Out[4];
+			InternalLoadQuaternion512(A, Quat1, Index);
+			InternalLoadQuaternion512(B, Quat2, Index);
+			Out[0] = InternalMultiplyAdd512(A[3], B[0], InternalMultiplyAdd512(A[0], B[3], InternalNegateMultiplyAdd512(A[2], B[1], InternalMultiply512(A[1], B[2]))));
+			Out[1] = InternalMultiplyAdd512(A[3], B[1], InternalMultiplyAdd512(A[1], B[3], InternalNegateMultiplyAdd512(A[0], B[2], InternalMultiply512(A[2], B[0]))));
+			Out[2] = InternalMultiplyAdd512(A[3], B[2], InternalMultiplyAdd512(A[2], B[3], InternalNegateMultiplyAdd512(A[1], B[0], InternalMultiply512(A[0], B[1]))));
+			Out[3] = InternalNegateMultiplyAdd512(A[2], B[2], InternalNegateMultiplyAdd512(A[1], B[1], InternalNegateMultiplyAdd512(A[0], B[0], InternalMultiply512(A[3], B[3]))));
+			InternalStoreQuaternion512(Result, Out, Index);
+		}
+		return InternalVectorQuaternionMultiplySoAAVX(Result, Quat1, Quat2, Index, Count);
+	}
+
+	template<typename ScalarType>
+	UE_SSE_TARGET_AVX_512 inline int32 InternalVectorQuaternionNormalizeSoAAVX512(ScalarType* const* Result, const ScalarType* const* Quat, int32 Index, int32 Count)
+	{
+		typedef decltype(InternalSet512(ScalarType(0))) RegisterType;
+		constexpr int32 Width = int32(sizeof(RegisterType) / sizeof(ScalarType));
+		for (; Index + Width <= Count; Index += Width)
+		{
+			RegisterType Q[4];
+			InternalLoadQuaternion512(Q, Quat, Index);
+			InternalQuaternionNormalize512<ScalarType>(Q);
+			InternalStoreQuaternion512(Result, Q, Index);
+		}
+		return InternalVectorQuaternionNormalizeSoAAVX(Result, Quat, Index, Count);
+	}
+
+	template<typename ScalarType>
+	UE_SSE_TARGET_AVX_512 inline int32 InternalVectorQuaternionNLerpSoAAVX512(ScalarType* const* Result, const ScalarType* const* Quat1, const ScalarType* const* Quat2, const ScalarType* Alpha, int32 Index, int32 Count)
+	{
+		typedef decltype(InternalSet512(ScalarType(0))) RegisterType;
+		constexpr int32 Width = int32(sizeof(RegisterType) / sizeof(ScalarType));
+		const RegisterType Zero = InternalSet512(ScalarType(0));
+		const RegisterType One = InternalSet512(ScalarType(1));
+		const RegisterType MinusOne = InternalSet512(ScalarType(-1));
+		for (; Index + Width <= Count; Index += Width)
+		{
+			RegisterType A[4], B[4];
+			InternalLoadQuaternion512(A, Quat1, Index);
+			InternalLoadQuaternion512(B, Quat2, Index);
+			RegisterType Dot = InternalMultiply512(A[0], B[0]);
+			Dot = InternalMultiplyAdd512(A[1], B[1], Dot);
+			Dot = InternalMultiplyAdd512(A[2], B[2], Dot);
+			Dot = InternalMultiplyAdd512(A[3], B[3], Dot);
+
+			const RegisterType WeightB = InternalLoad512(Alpha + Index);
+			const RegisterType WeightA = InternalMultiply512(InternalSelectGreaterEqual512(Dot, Zero, One, MinusOne), InternalSubtract512(One, WeightB));
+			RegisterType Q[4];
+			Q[0] = InternalMultiplyAdd512(A[0], WeightA, InternalMultiply512(B[0], WeightB));
+			Q[1] = InternalMultiplyAdd512(A[1], WeightA, InternalMultiply512(B[1], WeightB));
+			Q[2] = InternalMultiplyAdd512(A[2], WeightA, InternalMultiply512(B[2], WeightB));
+			Q[3] = InternalMultiplyAdd512(A[3], WeightA, InternalMultiply512(B[3], WeightB));
+			InternalQuaternionNormalize512<ScalarType>(Q);
+			InternalStoreQuaternion512(Result, Q, Index);
+		}
+		return InternalVectorQuaternionNLerpSoAAVX(Result, Quat1, Quat2, Alpha, Index, Count);
+	}
+
+	template<typename ScalarType>
+	UE_SSE_TARGET_AVX_512 inline int32 InternalVectorQuaternionRotateVectorSoAAVX512(ScalarType* const* Result, const ScalarType* const* Quat, const ScalarType* const* Vector, int32 Index, int32 Count)
+	{
+		typedef decltype(InternalSet512(ScalarType(0))) RegisterType;
+		constexpr int32 Width = int32(sizeof(RegisterType) / sizeof(ScalarType));
+		const RegisterType Two = InternalSet512(ScalarType(2));
+		for (; Index + Width <= Count; Index += Width)
+		{
+			RegisterType Q[4];
+			InternalLoadQuaternion512(Q, Quat, Index);
+			const RegisterType V[3] = { InternalLoad512(Vector[0] + Index), InternalLoad512(Vector[1] + Index), InternalLoad512(Vector[2] + Index) };
+
+			const RegisterType TX = InternalMultiply512(InternalNegateMultiplyAdd512(Q[2], V[1], InternalMultiply512(Q[1], V[2])), Two);
+			const RegisterType TY = InternalMultiply512(InternalNegateMultiplyAdd512(Q[0], V[2], InternalMultiply512(Q[2], V[0])), Two);
+			const RegisterType TZ = InternalMultiply512(InternalNegateMultiplyAdd512(Q[1], V[0], InternalMultiply512(Q[0], V[1])), Two);
+			InternalStore512(Result[0] + Index, InternalAdd512(InternalMultiplyAdd512(Q[3], TX, V[0]), InternalNegateMultiplyAdd512(Q[2], TY, InternalMultiply512(Q[1], TZ))));
+			InternalStore512(Result[1] + Index, InternalAdd512(InternalMultiplyAdd512(Q[3], TY, V[1]), InternalNegateMultiplyAdd512(Q[0], TZ, InternalMultiply512(Q[2], TX))));
+			InternalStore512(Result[2] + Index, InternalAdd512(InternalMultiplyAdd512(Q[3], TZ, V[2]), InternalNegateMultiplyAdd512(Q[1], TX, InternalMultiply512(Q[0], TY))));
+		}
+		return InternalVectorQuaternionRotateVectorSoAAVX(Result, Quat, Vector, Index, Count);
+	}
+
+	// 16 float or 8 double vectors per iteration: one two-source permute gathers two components of half the vectors,
+	// a 128-bit lane shuffle then joins the halves. The SoA to AoS direction runs the same steps backwards.
+	UE_SSE_TARGET_AVX_512 inline int32 InternalVectorAoSToSoAAVX512(float* const* Dst, const float* Src, int32 Index, int32 Count)
+	{
+		const __m512i IndicesXY = _mm512_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28, 1, 5, 9, 13, 17, 21, 25, 29);
+		const __m512i IndicesZW = _mm512_setr_epi32(2, 6, 10, 14, 18, 22, 26, 30, 3, 7, 11, 15, 19, 23, 27, 31);
+		for (; Index + 16 <= Count; Index += 16)
+		{
+			const float* In = Src + Index * 4;
+			const __m512 V0 = _mm512_loadu_ps(In + 0);
+			const __m512 V1 = _mm512_loadu_ps(In + 16);
+			const __m512 V2 = _mm512_loadu_ps(In + 32);
+			const __m512 V3 = _mm512_loadu_ps(In + 48);
+			const __m512 XYLo = _mm512_permutex2var_ps(V0, IndicesXY, V1);
+			const __m512 ZWLo = _mm512_permutex2var_ps(V0, IndicesZW, V1);
+			const __m512 XYHi = _mm512_permutex2var_ps(V2, IndicesXY, V3);
+			const __m512 ZWHi = _mm512_permutex2var_ps(V2, IndicesZW, V3);
+			_mm512_storeu_ps(Dst[0] + Index, _mm512_shuffle_f32x4(XYLo, XYHi, _MM_SHUFFLE(1, 0, 1, 0)));
+			_mm512_storeu_ps(Dst[1] + Index, _mm512_shuffle_f32x4(XYLo, XYHi, _MM_SHUFFLE(3, 2, 3, 2)));
+			_mm512_storeu_ps(Dst[2] + Index, _mm512_shuffle_f32x4(ZWLo, ZWHi, _MM_SHUFFLE(1, 0, 1, 0)));
+			if (Dst[3])
+			{
+				_mm512_storeu_ps(Dst[3] + Index, _mm512_shuffle_f32x4(ZWLo, ZWHi, _MM_SHUFFLE(3, 2, 3, 2)));
+			}
+		}
+		return InternalVectorAoSToSoAAVX(Dst, Src, Index, Count);
+	}
+
+	UE_SSE_TARGET_AVX_512 inline int32 InternalVectorAoSToSoAAVX512(double* const* Dst, const double* Src, int32 Index, int32 Count)
+	{
+		const __m512i IndicesXY = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+		const __m512i IndicesZW = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+		for (; Index + 8 <= Count; Index += 8)
+		{
+			const double* In = Src + Index * 4;
+			const __m512d V0 = _mm512_loadu_pd(In + 0);
+			const __m512d V1 = _mm512_loadu_pd(In + 8);
+			const __m512d V2 = _mm512_loadu_pd(In + 16);
+			const __m512d V3 = _mm512_loadu_pd(In + 24);
+			const __m512d XYLo = _mm512_permutex2var_pd(V0, IndicesXY, V1);
+			const __m512d ZWLo = _mm512_permutex2var_pd(V0, IndicesZW, V1);
+			const __m512d XYHi = _mm512_permutex2var_pd(V2, IndicesXY, V3);
+			const __m512d ZWHi = _mm512_permutex2var_pd(V2, IndicesZW, V3);
+			_mm512_storeu_pd(Dst[0] + Index, _mm512_shuffle_f64x2(XYLo, XYHi, _MM_SHUFFLE(1, 0, 1, 0)));
+			_mm512_storeu_pd(Dst[1] + Index, _mm512_shuffle_f64x2(XYLo, XYHi, _MM_SHUFFLE(3, 2, 3, 2)));
+			_mm512_storeu_pd(Dst[2] + Index, _mm512_shuffle_f64x2(ZWLo, ZWHi, _MM_SHUFFLE(1, 0, 1, 0)));
+			if (Dst[3])
+			{
+				_mm512_storeu_pd(Dst[3] + Index, _mm512_shuffle_f64x2(ZWLo, ZWHi, _MM_SHUFFLE(3, 2, 3, 2)));
+			}
+		}
+		return InternalVectorAoSToSoAAVX(Dst, Src, Index, Count);
+	}
+
+	UE_SSE_TARGET_AVX_512 inline int32 InternalVectorSoAToAoSAVX512(float* Dst, const float* const* Src, int32 Index, int32 Count)
+	{
+		const __m512i Indices01 = _mm512_setr_epi32(0, 8, 16, 24, 1, 9, 17, 25, 2, 10, 18, 26, 3, 11, 19, 27);
+		const __m512i Indices23 = _mm512_setr_epi32(4, 12, 20, 28, 5, 13, 21, 29, 6, 14, 22, 30, 7, 15, 23, 31);
+		for (; Index + 16 <= Count; Index += 16)
+		{
+			const __m512 X = _mm512_loadu_ps(Src[0] + Index);
+			const __m512 Y = _mm512_loadu_ps(Src[1] + Index);
+			const __m512 Z = _mm512_loadu_ps(Src[2] + Index);
+			const __m512 W = Src[3] ? _mm512_loadu_ps(Src[3] + Index) : _mm512_setzero_ps();
+			const __m512 XYLo = _mm512_shuffle_f32x4(X, Y, _MM_SHUFFLE(1, 0, 1, 0));
+			const __m512 XYHi = _mm512_shuffle_f32x4(X, Y, _MM_SHUFFLE(3, 2, 3, 2));
+			const __m512 ZWLo = _mm512_shuffle_f32x4(Z, W, _MM_SHUFFLE(1, 0, 1, 0));
+			const __m512 ZWHi = _mm512_shuffle_f32x4(Z, W, _MM_SHUFFLE(3, 2, 3, 2));
+			float* Out = Dst + Index * 4;
+			_mm512_storeu_ps(Out + 0, _mm512_permutex2var_ps(XYLo, Indices01, ZWLo));
+			_mm512_storeu_ps(Out + 16, _mm512_permutex2var_ps(XYLo, Indices23, ZWLo));
+			_mm512_storeu_ps(Out + 32, _mm512_permutex2var_ps(XYHi, Indices01, ZWHi));
+			_mm512_storeu_ps(Out + 48, _mm512_permutex2var_ps(XYHi, Indices23, ZWHi));
+		}
+		return InternalVectorSoAToAoSAVX(Dst, Src, Index, Count);
+	}
+
+	UE_SSE_TARGET_AVX_512 inline int32 InternalVectorSoAToAoSAVX512(double* Dst, const double* const* Src, int32 Index, int32 Count)
+	{
+		const __m512i Indices01 = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+		const __m512i Indices23 = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+		for (; Index + 8 <= Count; Index += 8)
+		{
+			const __m512d X = _mm512_loadu_pd(Src[0] + Index);
+			const __m512d Y = _mm512_loadu_pd(Src[1] + Index);
+			const __m512d Z = _mm512_loadu_pd(Src[2] + Index);
+			const __m512d W = Src[3] ? _mm512_loadu_pd(Src[3] + Index) : _mm512_setzero_pd();
+			const __m512d XYLo = _mm512_shuffle_f64x2(X, Y, _MM_SHUFFLE(1, 0, 1, 0));
+			const __m512d XYHi = _mm512_shuffle_f64x2(X, Y, _MM_SHUFFLE(3, 2, 3, 2));
+			const __m512d ZWLo = _mm512_shuffle_f64x2(Z, W, _MM_SHUFFLE(1, 0, 1, 0));
+			const __m512d ZWHi = _mm512_shuffle_f64x2(Z, W, _MM_SHUFFLE(3, 2, 3, 2));
+			double* Out = Dst + Index * 4;
+			_mm512_storeu_pd(Out + 0, _mm512_permutex2var_pd(XYLo, Indices01, ZWLo));
+			_mm512_storeu_pd(Out + 8, _mm512_permutex2var_pd(XYLo, Indices23, ZWLo));
+			_mm512_storeu_pd(Out + 16, _mm512_permutex2var_pd(XYHi, Indices01, ZWHi));
+			_mm512_storeu_pd(Out + 24, _mm512_permutex2var_pd(XYHi, Indices23, ZWHi));
+		}
+		return InternalVectorSoAToAoSAVX(Dst, Src, Index, Count);
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512 InternalLoadScan512(const float* Src)
+	{
+		return _mm512_loadu_ps(Src);
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512 InternalLoadScan512(const uint16* Src)
+	{
+		return _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)Src));
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE uint64 InternalOutOfRangeMask512(const __m512& Value, const __m512& MinValue, const __m512& MaxValue)
+	{
+		return uint64(_mm512_cmp_ps_mask(Value, MinValue, _CMP_NGE_UQ) | _mm512_cmp_ps_mask(Value, MaxValue, _CMP_NLE_UQ));
+	}
+
+	template<typename ScalarType>
+	UE_SSE_TARGET_AVX_512 inline int32 InternalVectorScanOutOfRangeArrayAVX512(const ScalarType* Src, int32 Index, int32 Count, float MinValue, float MaxValue, FVectorScanResult& Result)
+	{
+		const __m512 Min = _mm512_set1_ps(MinValue);
+		const __m512 Max = _mm512_set1_ps(MaxValue);
+		for (; Index + 64 <= Count; Index += 64)
+		{
+			const uint64 Mask0 = InternalOutOfRangeMask512(InternalLoadScan512(Src + Index + 0), Min, Max);
+			const uint64 Mask1 = InternalOutOfRangeMask512(InternalLoadScan512(Src + Index + 16), Min, Max);
+			const uint64 Mask2 = InternalOutOfRangeMask512(InternalLoadScan512(Src + Index + 32), Min, Max);
+			const uint64 Mask3 = InternalOutOfRangeMask512(InternalLoadScan512(Src + Index + 48), Min, Max);
+			const uint64 Bits = Mask0 | (Mask1 << 16) | (Mask2 << 32) | (Mask3 << 48);
+			if (Bits)
+			{
+				InternalAddScanHits(Result, Index, Bits);
+			}
+		}
+		return InternalVectorScanOutOfRangeArrayAVX(Src, Index, Count, MinValue, MaxValue, Result);
+	}
+
+	// Point bounds kernels, see the AVX versions. Strided points have no AVX-512 kernel; eight-point transposes already
+	// keep the AVX one load bound.
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512 InternalMin512(const __m512& A, const __m512& B)
+	{
+		return _mm512_min_ps(A, B);
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512d InternalMin512(const __m512d& A, const __m512d& B)
+	{
+		return _mm512_min_pd(A, B);
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512 InternalMax512(const __m512& A, const __m512& B)
+	{
+		return _mm512_max_ps(A, B);
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512d InternalMax512(const __m512d& A, const __m512d& B)
+	{
+		return _mm512_max_pd(A, B);
+	}
+
+	template<typename RegisterType>
+	UE_SSE_TARGET_AVX_512 FORCEINLINE void InternalAddBounds512(RegisterType& Min, RegisterType& Max, const RegisterType& Value)
+	{
+		Min = InternalMin512(Min, Value);
+		Max = InternalMax512(Max, Value);
+	}
+
+	template<typename ScalarType>
+	UE_SSE_TARGET_AVX_512 inline int32 InternalVectorComputeBoundsPackedAVX512(const ScalarType* Points, int32 Index, int32 Count, ScalarType* InOutMin, ScalarType* InOutMax)
+	{
+		typedef decltype(InternalLoad512(Points)) RegisterType;
+		constexpr int32 Width = int32(sizeof(RegisterType) / sizeof(ScalarType));
+		if (Index + 2 * Width <= Count)
+		{
+			ScalarType MinLanes[3 * Width];
+			ScalarType MaxLanes[3 * Width];
+			for (int32 Lane = 0; Lane < 3 * Width; ++Lane)
+			{
+				MinLanes[Lane] = InOutMin[Lane % 3];
+				MaxLanes[Lane] = InOutMax[Lane % 3];
+			}
+
+			RegisterType Min0 = InternalLoad512(MinLanes + 0 * Width);
+			RegisterType Min1 = InternalLoad512(MinLanes + 1 * Width);
+			RegisterType Min2 = InternalLoad512(MinLanes + 2 * Width);
+			RegisterType Max0 = InternalLoad512(MaxLanes + 0 * Width);
+			RegisterType Max1 = InternalLoad512(MaxLanes + 1 * Width);
+			RegisterType Max2 = InternalLoad512(MaxLanes + 2 * Width);
+			RegisterType Min3 = Min0, Min4 = Min1, Min5 = Min2;
+			RegisterType Max3 = Max0, Max4 = Max1, Max5 = Max2;
+			for (; Index + 2 * Width <= Count; Index += 2 * Width)
+			{
+				const ScalarType* In = Points + SIZE_T(Index) * 3;
+				InternalAddBounds512(Min0, Max0, InternalLoad512(In + 0 * Width));
+				InternalAddBounds512(Min1, Max1, InternalLoad512(In + 1 * Width));
+				InternalAddBounds512(Min2, Max2, InternalLoad512(In + 2 * Width));
+				InternalAddBounds512(Min3, Max3, InternalLoad512(In + 3 * Width));
+				InternalAddBounds512(Min4, Max4, InternalLoad512(In + 4 * Width));
+				InternalAddBounds512(Min5, Max5, InternalLoad512(In + 5 * Width));
+			}
+			InternalStore512(MinLanes + 0 * Width, InternalMin512(Min0, Min3));
+			InternalStore512(MinLanes + 1 * Width, InternalMin512(Min1, Min4));
+			InternalStore512(MinLanes + 2 * Width, InternalMin512(Min2, Min5));
+			InternalStore512(MaxLanes + 0 * Width, InternalMax512(Max0, Max3));
+			InternalStore512(MaxLanes + 1 * Width, InternalMax512(Max1, Max4));
+			InternalStore512(MaxLanes + 2 * Width, InternalMax512(Max2, Max5));
+			InternalFoldBoundsLanes(MinLanes, MaxLanes, 3 * Width, 1, InOutMin, InOutMax);
+		}
+		return InternalVectorComputeBoundsPackedAVX(Points, Index, Count, InOutMin, InOutMax);
+	}
+
+	template<typename ScalarType>
+	UE_SSE_TARGET_AVX_512 inline int32 InternalVectorComputeBoundsSoAAVX512(const ScalarType* const* Components, int32 Index, int32 Count, ScalarType* InOutMin, ScalarType* InOutMax)
+	{
+		typedef decltype(InternalLoad512(Components[0])) RegisterType;
+		constexpr int32 Width = int32(sizeof(RegisterType) / sizeof(ScalarType));
+		if (Index + 2 * Width <= Count)
+		{
+			const ScalarType* X = Components[0];
+			const ScalarType* Y = Components[1];
+			const ScalarType* Z = Components[2];
+			RegisterType MinX0 = InternalSet512(InOutMin[0]), MinY0 = InternalSet512(InOutMin[1]), MinZ0 = InternalSet512(InOutMin[2]);
+			RegisterType MaxX0 = InternalSet512(InOutMax[0]), MaxY0 = InternalSet512(InOutMax[1]), MaxZ0 = InternalSet512(InOutMax[2]);
+			RegisterType MinX1 = MinX0, MinY1 = MinY0, MinZ1 = MinZ0;
+			RegisterType MaxX1 = MaxX0, MaxY1 = MaxY0, MaxZ1 = MaxZ0;
+			for (; Index + 2 * Width <= Count; Index += 2 * Width)
+			{
+				InternalAddBounds512(MinX0, MaxX0, InternalLoad512(X + Index));
+				InternalAddBounds512(MinY0, MaxY0, InternalLoad512(Y + Index));
+				InternalAddBounds512(MinZ0, MaxZ0, InternalLoad512(Z + Index));
+				InternalAddBounds512(MinX1, MaxX1, InternalLoad512(X + Index + Width));
+				InternalAddBounds512(MinY1, MaxY1, InternalLoad512(Y + Index + Width));
+				InternalAddBounds512(MinZ1, MaxZ1, InternalLoad512(Z + Index + Width));
+			}
+
+			ScalarType MinLanes[3 * Width];
+			ScalarType MaxLanes[3 * Width];
+			InternalStore512(MinLanes + 0 * Width, InternalMin512(MinX0, MinX1));
+			InternalStore512(MinLanes + 1 * Width, InternalMin512(MinY0, MinY1));
+			InternalStore512(MinLanes + 2 * Width, InternalMin512(MinZ0, MinZ1));
+			InternalStore512(MaxLanes + 0 * Width, InternalMax512(MaxX0, MaxX1));
+			InternalStore512(MaxLanes + 1 * Width, InternalMax512(MaxY0, MaxY1));
+			InternalStore512(MaxLanes + 2 * Width, InternalMax512(MaxZ0, MaxZ1));
+			InternalFoldBoundsLanes(MinLanes, MaxLanes, 3 * Width, Width, InOutMin, InOutMax);
+		}
+		return InternalVectorComputeBoundsSoAAVX(Components, Index, Count, InOutMin, InOutMax);
+	}
+
+	template<typename ScalarType>
+	UE_SSE_TARGET_AVX_512 inline int32 InternalVectorComputeBoundingRadiusSoAAVX512(const ScalarType* const* Components, int32 Index, int32 Count, const ScalarType* Center, ScalarType& InOutRadiusSquared)
+	{
+		typedef decltype(InternalLoad512(Components[0])) RegisterType;
+		constexpr int32 Width = int32(sizeof(RegisterType) / sizeof(ScalarType));
+		const RegisterType CenterX = InternalSet512(Center[0]);
+		const RegisterType CenterY = InternalSet512(Center[1]);
+		const RegisterType CenterZ = InternalSet512(Center[2]);
+		RegisterType MaxDistance0 = InternalSet512(InOutRadiusSquared);
+		RegisterType MaxDistance1 = MaxDistance0;
+		for (; Index + 2 * Width <= Count; Index += 2 * Width)
+		{
+			const RegisterType DX0 = InternalSubtract512(InternalLoad512(Components[0] + Index), CenterX);
+			const RegisterType DY0 = InternalSubtract512(InternalLoad512(Components[1] + Index), CenterY);
+			const RegisterType DZ0 = InternalSubtract512(InternalLoad512(Components[2] + Index), CenterZ);
+			const RegisterType DX1 = InternalSubtract512(InternalLoad512(Components[0] + Index + Width), CenterX);
+			const RegisterType DY1 = InternalSubtract512(InternalLoad512(Components[1] + Index + Width), CenterY);
+			const RegisterType DZ1 = InternalSubtract512(InternalLoad512(Components[2] + Index + Width), CenterZ);
+			MaxDistance0 = InternalMax512(MaxDistance0, InternalMultiplyAdd512(DZ0, DZ0, InternalMultiplyAdd512(DY0, DY0, InternalMultiply512(DX0, DX0))));
+			MaxDistance1 = InternalMax512(MaxDistance1, InternalMultiplyAdd512(DZ1, DZ1, InternalMultiplyAdd512(DY1, DY1, InternalMultiply512(DX1, DX1))));
+		}
+
+		ScalarType Lanes[Width];
+		InternalStore512(Lanes, InternalMax512(MaxDistance0, MaxDistance1));
+		for (int32 Lane = 0; Lane < Width; ++Lane)
+		{
+			InOutRadiusSquared = FMath::Max(InOutRadiusSquared, Lanes[Lane]);
+		}
+		return InternalVectorComputeBoundingRadiusSoAAVX(Components, Index, Count, Center, InOutRadiusSquared);
+	}
+
+	// Frustum culling kernels, see the AVX versions. Compares go straight to mask registers.
+	UE_SSE_TARGET_AVX_512 FORCEINLINE uint32 InternalCompareGreaterMask512(const __m512& A, const __m512& B)
+	{
+		return uint32(_mm512_cmp_ps_mask(A, B, _CMP_GT_OQ));
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE uint32 InternalCompareGreaterMask512(const __m512d& A, const __m512d& B)
+	{
+		return uint32(_mm512_cmp_pd_mask(A, B, _CMP_GT_OQ));
+	}
+
+	template<typename RegisterType>
+	UE_SSE_TARGET_AVX_512 FORCEINLINE RegisterType InternalPlaneDistance512(const RegisterType& NX, const RegisterType& NY, const RegisterType& NZ, const RegisterType& NegW, const RegisterType& X, const RegisterType& Y, const RegisterType& Z)
+	{
+		return InternalMultiplyAdd512(NZ, Z, InternalMultiplyAdd512(NY, Y, InternalMultiplyAdd512(NX, X, NegW)));
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512 InternalAbs512(const __m512& Value)
+	{
+		return _mm512_abs_ps(Value);
+	}
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512d InternalAbs512(const __m512d& Value)
+	{
+		return _mm512_abs_pd(Value);
+	}
+
+	template<typename RegisterType>
+	UE_SSE_TARGET_AVX_512 FORCEINLINE RegisterType InternalPlanePushOut512(const RegisterType& NX, const RegisterType& NY, const RegisterType& NZ, const RegisterType& ExtentX, const RegisterType& ExtentY, const RegisterType& ExtentZ)
+	{
+		const RegisterType PushOut = InternalMultiply512(InternalAbs512(NX), ExtentX);
+		return InternalMultiplyAdd512(InternalAbs512(NZ), ExtentZ, InternalMultiplyAdd512(InternalAbs512(NY), ExtentY, PushOut));
+	}
+
+	template<typename ScalarType>
+	UE_SSE_TARGET_AVX_512 inline int32 InternalVectorCullSpheresSoAAVX512(uint32* OutVisible, const ScalarType* const* Spheres, const ScalarType* Planes, int32 NumPlanes, int32 Index, int32 Count)
+	{
+		typedef decltype(InternalLoad512(Planes)) RegisterType;
+		constexpr int32 Width = int32(sizeof(RegisterType) / sizeof(ScalarType));
+		for (; Index + 32 <= Count; Index += 32)
+		{
+			uint32 Outside = 0;
+			for (int32 Block = Index; Block < Index + 32; Block += 2 * Width)
+			{
+				const RegisterType X0 = InternalLoad512(Spheres[0] + Block), X1 = InternalLoad512(Spheres[0] + Block + Width);
+				const RegisterType Y0 = InternalLoad512(Spheres[1] + Block), Y1 = InternalLoad512(Spheres[1] + Block + Width);
+				const RegisterType Z0 = InternalLoad512(Spheres[2] + Block), Z1 = InternalLoad512(Spheres[2] + Block + Width);
+				const RegisterType Radius0 = InternalLoad512(Spheres[3] + Block), Radius1 = InternalLoad512(Spheres[3] + Block + Width);
+				uint32 Mask0 = 0;
+				uint32 Mask1 = 0;
+				for (int32 Plane = 0; Plane < NumPlanes; ++Plane)
+				{
+					const RegisterType NX = InternalSet512(Planes[4 * Plane + 0]);
+					const RegisterType NY = InternalSet512(Planes[4 * Plane + 1]);
+					const RegisterType NZ = InternalSet512(Planes[4 * Plane + 2]);
+					const RegisterType NegW = InternalSet512(-Planes[4 * Plane + 3]);
+					Mask0 |= InternalCompareGreaterMask512(InternalPlaneDistance512(NX, NY, NZ, NegW, X0, Y0, Z0), Radius0);
+					Mask1 |= InternalCompareGreaterMask512(InternalPlaneDistance512(NX, NY, NZ, NegW, X1, Y1, Z1), Radius1);
+				}
+				Outside |= (Mask0 | (Mask1 << Width)) << (Block - Index);
+			}
+			OutVisible[Index / 32] = ~Outside;
+		}
+		return Index;
+	}
+
+	template<typename ScalarType>
+	UE_SSE_TARGET_AVX_512 inline int32 InternalVectorCullBoxesSoAAVX512(uint32* OutVisible, const ScalarType* const* Boxes, const ScalarType* Planes, int32 NumPlanes, int32 Index, int32 Count)
+	{
+		typedef decltype(InternalLoad512(Planes)) RegisterType;
+		constexpr int32 Width = int32(sizeof(RegisterType) / sizeof(ScalarType));
+		for (; Index + 32 <= Count; Index += 32)
+		{
+			uint32 Outside = 0;
+			for (int32 Block = Index; Block < Index + 32; Block += 2 * Width)
+			{
+				const RegisterType X0 = InternalLoad512(Boxes[0] + Block), X1 = InternalLoad512(Boxes[0] + Block + Width);
+				const RegisterType Y0 = InternalLoad512(Boxes[1] + Block), Y1 = InternalLoad512(Boxes[1] + Block + Width);
+				const RegisterType Z0 = InternalLoad512(Boxes[2] + Block), Z1 = InternalLoad512(Boxes[2] + Block + Width);
+				const RegisterType ExtentX0 = InternalLoad512(Boxes[3] + Block), ExtentX1 = InternalLoad512(Boxes[3] + Block + Width);
+				const RegisterType ExtentY0 = InternalLoad512(Boxes[4] + Block), ExtentY1 = InternalLoad512(Boxes[4] + Block + Width);
+				const RegisterType ExtentZ0 = InternalLoad512(Boxes[5] + Block), ExtentZ1 = InternalLoad512(Boxes[5] + Block + Width);
+				uint32 Mask0 = 0;
+				uint32 Mask1 = 0;
+				for (int32 Plane = 0; Plane < NumPlanes; ++Plane)
+				{
+					const RegisterType NX = InternalSet512(Planes[4 * Plane + 0]);
+					const RegisterType NY = InternalSet512(Planes[4 * Plane + 1]);
+					const RegisterType NZ = InternalSet512(Planes[4 * Plane + 2]);
+					const RegisterType NegW = InternalSet512(-Planes[4 * Plane + 3]);
+					Mask0 |= InternalCompareGreaterMask512(InternalPlaneDistance512(NX, NY, NZ, NegW, X0, Y0, Z0), InternalPlanePushOut512(NX, NY, NZ, ExtentX0, ExtentY0, ExtentZ0));
+					Mask1 |= InternalCompareGreaterMask512(InternalPlaneDistance512(NX, NY, NZ, NegW, X1, Y1, Z1), InternalPlanePushOut512(NX, NY, NZ, ExtentX1, ExtentY1, ExtentZ1));
+				}
+				Outside |= (Mask0 | (Mask1 << Width)) << (Block - Index);
+			}
+			OutVisible[Index / 32] = ~Outside;
+		}
+		return Index;
+	}
+
+#if UE_PLATFORM_MATH_USE_F16C || UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+	UE_SSE_TARGET_AVX_512 inline int32 InternalVectorFloatToHalfArrayAVX512(uint16* RESTRICT Dst, const float* RESTRICT Src, int32 Index, int32 Count)
+	{
+		for (; Index + 16 <= Count; Index += 16)
+		{
+			_mm256_storeu_si256((__m256i*)(Dst + Index), _mm512_cvtps_ph(_mm512_loadu_ps(Src + Index), _MM_FROUND_TO_NEAREST_INT));
+		}
+		return InternalVectorFloatToHalfArrayAVX(Dst, Src, Index, Count);
+	}
+
+	UE_SSE_TARGET_AVX_512 inline int32 InternalVectorHalfToFloatArrayAVX512(float* RESTRICT Dst, const uint16* RESTRICT Src, int32 Index, int32 Count)
+	{
+		for (; Index + 16 <= Count; Index += 16)
+		{
+			_mm512_storeu_ps(Dst + Index, _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)(Src + Index))));
+		}
+		return InternalVectorHalfToFloatArrayAVX(Dst, Src, Index, Count);
+	}
+#endif
+
+	UE_SSE_TARGET_AVX_512 FORCEINLINE __m512 InternalLoadBFloat16512(const uint16* Src, __mmask16 Mask = 0xFFFF)
+	{
+		return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_maskz_loadu_epi16(Mask, Src)), 16));
+	}
+
+	UE_SSE_TARGET_AVX_512 inline int32 InternalVectorFloatToBFloat16ArrayAVX512(uint16* RESTRICT Dst, const float* RESTRICT Src, int32 Index, int32 Count)
+	{
+		const __m512i AbsMask = _mm512_set1_epi32(0x7FFFFFFF);
+		const __m512i ExponentMask = _mm512_set1_epi32(0x7F800000);
+		for (; Index + 16 <= Count; Index += 16)
+		{
+			const __m512i In = _mm512_castps_si512(_mm512_loadu_ps(Src + Index));
+			const __m512i Bits = _mm512_mask_and_epi32(In, _mm512_testn_epi32_mask(In, ExponentMask), In, _mm512_set1_epi32(0x80000000));
+			const __m512i Odd = _mm512_and_si512(_mm512_srli_epi32(Bits, 16), _mm512_set1_epi32(1));
+			const __m512i Rounded = _mm512_add_epi32(Bits, _mm512_add_epi32(Odd, _mm512_set1_epi32(0x7FFF)));
+			const __mmask16 IsNaN = _mm512_cmpgt_epi32_mask(_mm512_and_si512(Bits, AbsMask), ExponentMask);
+			const __m512i Words = _mm512_srli_epi32(_mm512_mask_or_epi32(Rounded, IsNaN, Bits, _mm512_set1_epi32(0x00400000)), 16);
+			_mm256_storeu_si256((__m256i*)(Dst + Index), _mm512_cvtepi32_epi16(Words));
+		}
+		return InternalVectorFloatToBFloat16ArrayAVX2(Dst, Src, Index, Count);
+	}
+
+	UE_SSE_TARGET_AVX_512 inline int32 InternalVectorBFloat16ToFloatArrayAVX512(float* RESTRICT Dst, const uint16* RESTRICT Src, int32 Index, int32 Count)
+	{
+		for (; Index + 16 <= Count; Index += 16)
+		{
+			_mm512_storeu_ps(Dst + Index, InternalLoadBFloat16512(Src + Index));
+		}
+		return InternalVectorBFloat16ToFloatArrayAVX2(Dst, Src, Index, Count);
+	}
+
+	// Same blocking as the AVX2 version, the partial chunk at the end of each row is a masked load.
+	UE_SSE_TARGET_AVX_512 inline int32 InternalVectorMatrixVectorMultiplyBFloat16AVX512(float* RESTRICT Result, const uint16* RESTRICT Matrix, const uint16* RESTRICT Vector, int32 NumColumns, int32 Row, int32 NumRows)
+	{
+		const int32 NumBodyColumns = NumColumns & ~15;
+		const __mmask16 TailMask = (__mmask16)((1u << (NumColumns - NumBodyColumns)) - 1);
+		const __m512 VectorTail = InternalLoadBFloat16512(Vector + NumBodyColumns, TailMask);
+
+		for (; Row + 4 <= NumRows; Row += 4)
+		{
+			const uint16* Row0 = Matrix + (SIZE_T)Row * NumColumns;
+			const uint16* Row1 = Row0 + NumColumns;
+			const uint16* Row2 = Row1 + NumColumns;
+			const uint16* Row3 = Row2 + NumColumns;
+			__m512 Sum0 = _mm512_setzero_ps();
+			__m512 Sum1 = _mm512_setzero_ps();
+			__m512 Sum2 = _mm512_setzero_ps();
+			__m512 Sum3 = _mm512_setzero_ps();
+			for (int32 Column = 0; Column < NumBodyColumns; Column += 16)
+			{
+				const __m512 V = InternalLoadBFloat16512(Vector + Column);
+				Sum0 = _mm512_fmadd_ps(InternalLoadBFloat16512(Row0 + Column), V, Sum0);
+				Sum1 = _mm512_fmadd_ps(InternalLoadBFloat16512(Row1 + Column), V, Sum1);
+				Sum2 = _mm512_fmadd_ps(InternalLoadBFloat16512(Row2 + Column), V, Sum2);
+				Sum3 = _mm512_fmadd_ps(InternalLoadBFloat16512(Row3 + Column), V, Sum3);
+			}
+			if (TailMask)
+			{
+				Sum0 = _mm512_fmadd_ps(InternalLoadBFloat16512(Row0 + NumBodyColumns, TailMask), VectorTail, Sum0);
+				Sum1 = _mm512_fmadd_ps(InternalLoadBFloat16512(Row1 + NumBodyColumns, TailMask), VectorTail, Sum1);
+				Sum2 = _mm512_fmadd_ps(InternalLoadBFloat16512(Row2 + NumBodyColumns, TailMask), VectorTail, Sum2);
+				Sum3 = _mm512_fmadd_ps(InternalLoadBFloat16512(Row3 + NumBodyColumns, TailMask), VectorTail, Sum3);
+			}
+			Result[Row + 0] = _mm512_reduce_add_ps(Sum0);
+			Result[Row + 1] = _mm512_reduce_add_ps(Sum1);
+			Result[Row + 2] = _mm512_reduce_add_ps(Sum2);
+			Result[Row + 3] = _mm512_reduce_add_ps(Sum3);
+		}
+		for (; Row < NumRows; ++Row)
+		{
+			const uint16* Row0 = Matrix + (SIZE_T)Row * NumColumns;
+			__m512 Sum0 = _mm512_setzero_ps();
+			__m512 Sum1 = _mm512_setzero_ps();
+			int32 Column = 0;
+			for (; Column + 32 <= NumBodyColumns; Column += 32)
+			{
+				Sum0 = _mm512_fmadd_ps(InternalLoadBFloat16512(Row0 + Column), InternalLoadBFloat16512(Vector + Column), Sum0);
+				Sum1 = _mm512_fmadd_ps(InternalLoadBFloat16512(Row0 + Column + 16), InternalLoadBFloat16512(Vector + Column + 16), Sum1);
+			}
+			if (Column < NumBodyColumns)
+			{
+				Sum0 = _mm512_fmadd_ps(InternalLoadBFloat16512(Row0 + Column), InternalLoadBFloat16512(Vector + Column), Sum0);
+			}
+			if (TailMask)
+			{
+				Sum1 = _mm512_fmadd_ps(InternalLoadBFloat16512(Row0 + NumBodyColumns, TailMask), VectorTail, Sum1);
+			}
+			Result[Row] = _mm512_reduce_add_ps(_mm512_add_ps(Sum0, Sum1));
+		}
+		return Row;
+	}
+#endif // UE_PLATFORM_MATH_USE_AVX_512 || UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+
+#if UE_PLATFORM_MATH_USE_AVX_512_BF16 || UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+	// AVX-512 BF16 kernels. vcvtne2ps2bf16 produces the same bits as the integer rounding above; vdpbf16ps adds the products
+	// of each bfloat16 pair straight into float lanes, treating denormal inputs as zero.
+	UE_SSE_TARGET_AVX_512_BF16 FORCEINLINE __m512bh InternalLoadBFloat16x32(const uint16* Src, __mmask32 Mask = 0xFFFFFFFF)
+	{
+		return (__m512bh)_mm512_maskz_loadu_epi16(Mask, Src);
+	}
+
+	UE_SSE_TARGET_AVX_512_BF16 inline int32 InternalVectorFloatToBFloat16ArrayAVX512BF16(uint16* RESTRICT Dst, const float* RESTRICT Src, int32 Index, int32 Count)
+	{
+		for (; Index + 32 <= Count; Index += 32)
+		{
+			_mm512_storeu_si512(Dst + Index, (__m512i)_mm512_cvtne2ps_pbh(_mm512_loadu_ps(Src + Index + 16), _mm512_loadu_ps(Src + Index)));
+		}
+		return InternalVectorFloatToBFloat16ArrayAVX512(Dst, Src, Index, Count);
+	}
+
+	UE_SSE_TARGET_AVX_512_BF16 inline int32 InternalVectorMatrixVectorMultiplyBFloat16AVX512BF16(float* RESTRICT Result, const uint16* RESTRICT Matrix, const uint16* RESTRICT Vector, int32 NumColumns, int32 Row, int32 NumRows)
+	{
+		const int32 NumBodyColumns = NumColumns & ~31;
+		const __mmask32 TailMask = (__mmask32)((1ull << (NumColumns - NumBodyColumns)) - 1);
+		const __m512bh VectorTail = InternalLoadBFloat16x32(Vector + NumBodyColumns, TailMask);
+
+		for (; Row + 4 <= NumRows; Row += 4)
+		{
+			const uint16* Row0 = Matrix + (SIZE_T)Row * NumColumns;
+			const uint16* Row1 = Row0 + NumColumns;
+			const uint16* Row2 = Row1 + NumColumns;
+			const uint16* Row3 = Row2 + NumColumns;
+			__m512 Sum0 = _mm512_setzero_ps();
+			__m512 Sum1 = _mm512_setzero_ps();
+			__m512 Sum2 = _mm512_setzero_ps();
+			__m512 Sum3 = _mm512_setzero_ps();
+			for (int32 Column = 0; Column < NumBodyColumns; Column += 32)
+			{
+				const __m512bh V = InternalLoadBFloat16x32(Vector + Column);
+				Sum0 = _mm512_dpbf16_ps(Sum0, InternalLoadBFloat16x32(Row0 + Column), V);
+				Sum1 = _mm512_dpbf16_ps(Sum1, InternalLoadBFloat16x32(Row1 + Column), V);
+				Sum2 = _mm512_dpbf16_ps(Sum2, InternalLoadBFloat16x32(Row2 + Column), V);
+				Sum3 = _mm512_dpbf16_ps(Sum3, InternalLoadBFloat16x32(Row3 + Column), V);
+			}
+			if (TailMask)
+			{
+				Sum0 = _mm512_dpbf16_ps(Sum0, InternalLoadBFloat16x32(Row0 + NumBodyColumns, TailMask), VectorTail);
+				Sum1 = _mm512_dpbf16_ps(Sum1, InternalLoadBFloat16x32(Row1 + NumBodyColumns, TailMask), VectorTail);
+				Sum2 = _mm512_dpbf16_ps(Sum2, InternalLoadBFloat16x32(Row2 + NumBodyColumns, TailMask), VectorTail);
+				Sum3 = _mm512_dpbf16_ps(Sum3, InternalLoadBFloat16x32(Row3 + NumBodyColumns, TailMask), VectorTail);
+			}
+			Result[Row + 0] = _mm512_reduce_add_ps(Sum0);
+			Result[Row + 1] = _mm512_reduce_add_ps(Sum1);
+			Result[Row + 2] = _mm512_reduce_add_ps(Sum2);
+			Result[Row + 3] = _mm512_reduce_add_ps(Sum3);
+		}
+		for (; Row < NumRows; ++Row)
+		{
+			const uint16* Row0 = Matrix + (SIZE_T)Row * NumColumns;
+			__m512 Sum0 = _mm512_setzero_ps();
+			__m512 Sum1 = _mm512_setzero_ps();
+			int32 Column = 0;
+			for (; Column + 64 <= NumBodyColumns; Column += 64)
+			{
+				Sum0 = _mm512_dpbf16_ps(Sum0, InternalLoadBFloat16x32(Row0 + Column), InternalLoadBFloat16x32(Vector + Column));
+				Sum1 = _mm512_dpbf16_ps(Sum1, InternalLoadBFloat16x32(Row0 + Column + 32), InternalLoadBFloat16x32(Vector + Column + 32));
+			}
+			if (Column < NumBodyColumns)
+			{
+				Sum0 = _mm512_dpbf16_ps(Sum0, InternalLoadBFloat16x32(Row0 + Column), InternalLoadBFloat16x32(Vector + Column));
+			}
+			if (TailMask)
+			{
+				Sum1 = _mm512_dpbf16_ps(Sum1, InternalLoadBFloat16x32(Row0 + NumBodyColumns, TailMask), VectorTail);
+			}
+			Result[Row] = _mm512_reduce_add_ps(_mm512_add_ps(Sum0, Sum1));
+		}
+		return Row;
+	}
+#endif
+
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+	// Returns XCR0, the register state the OS saves on context switch. Only valid if cpuid reports OSXSAVE.
+	FORCEINLINE uint64 InternalXGetBV0()
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		return _xgetbv(0);
+#else
+		uint32 Lo, Hi;
+		__asm__ __volatile__("xgetbv" : "=a"(Lo), "=d"(Hi) : "c"(0));
+		return ((uint64)Hi << 32) | Lo;
+#endif
+	}
+
+	EVectorBulkLevel InternalDetectVectorBulkLevel()
+	{
+		uint32 Regs[4];
+		InternalCpuId(0, 0, Regs);
+		if (Regs[0] < 7)
+		{
+			return EVectorBulkLevel::SSE;
+		}
+
+		InternalCpuId(1, 0, Regs);
+		const uint32 Leaf1Bits = (1u << 12) /* FMA */ | (1u << 27) /* OSXSAVE */ | (1u << 28) /* AVX */ | (1u << 29) /* F16C */;
+		if ((Regs[2] & Leaf1Bits) != Leaf1Bits)
+		{
+			return EVectorBulkLevel::SSE;
+		}
+
+		// The OS has to save the XMM/YMM (and for AVX-512 the opmask/ZMM) state, otherwise the instructions fault.
+		const uint64 XCR0 = InternalXGetBV0();
+		InternalCpuId(7, 0, Regs);
+		const uint32 MaxLeaf7SubLeaf = Regs[0];
+		if ((XCR0 & 0x6) != 0x6 || (Regs[1] & (1u << 5)) == 0 /* AVX2 */)
+		{
+			return EVectorBulkLevel::SSE;
+		}
+
+#if UE_PLATFORM_MATH_REQUIRES_AVX_512_CHECKS || UE_PLATFORM_MATH_SUPPORTS_AVX_512
+		const uint32 AVX512Bits = (1u << 16) /* F */ | (1u << 17) /* DQ */ | (1u << 30) /* BW */ | (1u << 31) /* VL */;
+		if ((Regs[1] & AVX512Bits) == AVX512Bits && (XCR0 & 0xE6) == 0xE6)
+		{
+			if (MaxLeaf7SubLeaf >= 1)
+			{
+				InternalCpuId(7, 1, Regs);
+				if ((Regs[0] & (1u << 5)) != 0 /* AVX512_BF16 */)
+				{
+					return EVectorBulkLevel::AVX512BF16;
+				}
+			}
+			return EVectorBulkLevel::AVX512;
+		}
+#endif
+		return EVectorBulkLevel::AVX2;
+	}
+
+	// Wide kernels picked for the running CPU. A nullptr entry means the caller's SSE code handles all elements.
+	struct FVectorBulkDispatch
+	{
+		int32 (*TransformVectorArrayFloat)(VectorRegister4Float* Dst, const VectorRegister4Float* Src, int32 Index, int32 Count, const float* MRows);
+		int32 (*TransformVectorArrayDouble)(VectorRegister4Double* Dst, const VectorRegister4Double* Src, int32 Index, int32 Count, const double* MRows);
+		int32 (*TransformVectorSoAFloat)(const float (&M)[4][4], float* OutX, float* OutY, float* OutZ, float* OutW, const float* InX, const float* InY, const float* InZ, float InW, int32 Index, int32 Count);
+		int32 (*TransformVectorSoADouble)(const double (&M)[4][4], double* OutX, double* OutY, double* OutZ, double* OutW, const double* InX, const double* InY, const double* InZ, double InW, int32 Index, int32 Count);
+		int32 (*FloatToHalfArray)(uint16* RESTRICT Dst, const float* RESTRICT Src, int32 Index, int32 Count);
+		int32 (*HalfToFloatArray)(float* RESTRICT Dst, const uint16* RESTRICT Src, int32 Index, int32 Count);
+		int32 (*MatrixMultiplyArrayFloat)(float* Result, const float* Matrix1, const float* Matrix2, int32 Index, int32 Count);
+		int32 (*MatrixMultiplyArrayDouble)(double* Result, const double* Matrix1, const double* Matrix2, int32 Index, int32 Count);
+		int32 (*LoadByte4Array)(float* RESTRICT Dst, const uint8* RESTRICT Src, int32 Index, int32 Count);
+		int32 (*StoreByte4Array)(uint8* RESTRICT Dst, const float* RESTRICT Src, int32 Index, int32 Count);
+		int32 (*LoadURGB10A2NArray)(float* RESTRICT Dst, const uint32* RESTRICT Src, int32 Index, int32 Count);
+		int32 (*StoreURGB10A2NArray)(uint32* RESTRICT Dst, const float* RESTRICT Src, int32 Index, int32 Count);
+		int32 (*LoadURGBA16NArray)(float* RESTRICT Dst, const uint16* RESTRICT Src, int32 Index, int32 Count);
+		int32 (*LoadSRGBA16NArray)(float* RESTRICT Dst, const int16* RESTRICT Src, int32 Index, int32 Count);
+		int32 (*StoreURGBA16NArray)(uint16* RESTRICT Dst, const float* RESTRICT Src, int32 Index, int32 Count);
+		int32 (*QuaternionMultiplySoAFloat)(float* const* Result, const float* const* Quat1, const float* const* Quat2, int32 Index, int32 Count);
+		int32 (*QuaternionMultiplySoADouble)(double* const* Result, const double* const* Quat1, const double* const* Quat2, int32 Index, int32 Count);
+		int32 (*QuaternionNormalizeSoAFloat)(float* const* Result, const float* const* Quat, int32 Index, int32 Count);
+		int32 (*QuaternionNormalizeSoADouble)(double* const* Result, const double* const* Quat, int32 Index, int32 Count);
+		int32 (*QuaternionNLerpSoAFloat)(float* const* Result, const float* const* Quat1, const float* const* Quat2, const float* Alpha, int32 Index, int32 Count);
+		int32 (*QuaternionNLerpSoADouble)(double* const* Result, const double* const* Quat1, const double* const* Quat2, const double* Alpha, int32 Index, int32 Count);
+		int32 (*QuaternionRotateVectorSoAFloat)(float* const* Result, const float* const* Quat, const float* const* Vector, int32 Index, int32 Count);
+		int32 (*QuaternionRotateVectorSoADouble)(double* const* Result, const double* const* Quat, const double* const* Vector, int32 Index, int32 Count);
+		int32 (*FloatToBFloat16Array)(uint16* RESTRICT Dst, const float* RESTRICT Src, int32 Index, int32 Count);
+		int32 (*BFloat16ToFloatArray)(float* RESTRICT Dst, const uint16* RESTRICT Src, int32 Index, int32 Count);
+		int32 (*MatrixVectorMultiplyBFloat16)(float* RESTRICT Result, const uint16* RESTRICT Matrix, const uint16* RESTRICT Vector, int32 NumColumns, int32 Row, int32 NumRows);
+		int32 (*AoSToSoAFloat)(float* const* Dst, const float* Src, int32 Index, int32 Count);
+		int32 (*AoSToSoADouble)(double* const* Dst, const double* Src, int32 Index, int32 Count);
+		int32 (*SoAToAoSFloat)(float* Dst, const float* const* Src, int32 Index, int32 Count);
+		int32 (*SoAToAoSDouble)(double* Dst, const double* const* Src, int32 Index, int32 Count);
+		int32 (*ScanOutOfRangeArray)(const float* Src, int32 Index, int32 Count, float MinValue, float MaxValue, FVectorScanResult& Result);
+		int32 (*ScanOutOfRangeHalfArray)(const uint16* Src, int32 Index, int32 Count, float MinValue, float MaxValue, FVectorScanResult& Result);
+		int32 (*ComputeBoundsPackedFloat)(const float* Points, int32 Index, int32 Count, float* InOutMin, float* InOutMax);
+		int32 (*ComputeBoundsPackedDouble)(const double* Points, int32 Index, int32 Count, double* InOutMin, double* InOutMax);
+		int32 (*ComputeBoundsStridedFloat)(const float* Points, int32 Stride, int32 Index, int32 Count, float* InOutMin, float* InOutMax);
+		int32 (*ComputeBoundsStridedDouble)(const double* Points, int32 Stride, int32 Index, int32 Count, double* InOutMin, double* InOutMax);
+		int32 (*ComputeBoundsSoAFloat)(const float* const* Components, int32 Index, int32 Count, float* InOutMin, float* InOutMax);
+		int32 (*ComputeBoundsSoADouble)(const double* const* Components, int32 Index, int32 Count, double* InOutMin, double* InOutMax);
+		int32 (*ComputeBoundingRadiusStridedFloat)(const float* Points, int32 Stride, int32 Index, int32 Count, const float* Center, float& InOutRadiusSquared);
+		int32 (*ComputeBoundingRadiusStridedDouble)(const double* Points, int32 Stride, int32 Index, int32 Count, const double* Center, double& InOutRadiusSquared);
+		int32 (*ComputeBoundingRadiusSoAFloat)(const float* const* Components, int32 Index, int32 Count, const float* Center, float& InOutRadiusSquared);
+		int32 (*ComputeBoundingRadiusSoADouble)(const double* const* Components, int32 Index, int32 Count, const double* Center, double& InOutRadiusSquared);
+		int32 (*CullSpheresSoAFloat)(uint32* OutVisible, const float* const* Spheres, const float* Planes, int32 NumPlanes, int32 Index, int32 Count);
+		int32 (*CullSpheresSoADouble)(uint32* OutVisible, const double* const* Spheres, const double* Planes, int32 NumPlanes, int32 Index, int32 Count);
+		int32 (*CullBoxesSoAFloat)(uint32* OutVisible, const float* const* Boxes, const float* Planes, int32 NumPlanes, int32 Index, int32 Count);
+		int32 (*CullBoxesSoADouble)(uint32* OutVisible, const double* const* Boxes, const double* Planes, int32 NumPlanes, int32 Index, int32 Count);
+	};
+
+	FVectorBulkDispatch MakeVectorBulkDispatch(EVectorBulkLevel Level)
+	{
+		FVectorBulkDispatch Dispatch = {};
+		if (Level >= EVectorBulkLevel::AVX512)
+		{
+			Dispatch.TransformVectorArrayFloat = &InternalVectorTransformVectorArrayAVX512;
+			Dispatch.TransformVectorArrayDouble = &InternalVectorTransformVectorArrayAVX512;
+			Dispatch.TransformVectorSoAFloat = &InternalVectorTransformVectorSoAAVX512;
+			Dispatch.TransformVectorSoADouble = &InternalVectorTransformVectorSoAAVX512;
+			Dispatch.FloatToHalfArray = &InternalVectorFloatToHalfArrayAVX512;
+			Dispatch.HalfToFloatArray = &InternalVectorHalfToFloatArrayAVX512;
+			Dispatch.MatrixMultiplyArrayFloat = &InternalVectorMatrixMultiplyArrayAVX512;
+			Dispatch.MatrixMultiplyArrayDouble = &InternalVectorMatrixMultiplyArrayAVX512;
+			Dispatch.QuaternionMultiplySoAFloat = &InternalVectorQuaternionMultiplySoAAVX512<float>;
+			Dispatch.QuaternionMultiplySoADouble = &InternalVectorQuaternionMultiplySoAAVX512<double>;
+			Dispatch.QuaternionNormalizeSoAFloat = &InternalVectorQuaternionNormalizeSoAAVX512<float>;
+			Dispatch.QuaternionNormalizeSoADouble = &InternalVectorQuaternionNormalizeSoAAVX512<double>;
+			Dispatch.QuaternionNLerpSoAFloat = &InternalVectorQuaternionNLerpSoAAVX512<float>;
+			Dispatch.QuaternionNLerpSoADouble = &InternalVectorQuaternionNLerpSoAAVX512<double>;
+			Dispatch.QuaternionRotateVectorSoAFloat = &InternalVectorQuaternionRotateVectorSoAAVX512<float>;
+			Dispatch.QuaternionRotateVectorSoADouble = &InternalVectorQuaternionRotateVectorSoAAVX512<double>;
+			Dispatch.FloatToBFloat16Array = &InternalVectorFloatToBFloat16ArrayAVX512;
+			Dispatch.BFloat16ToFloatArray = &InternalVectorBFloat16ToFloatArrayAVX512;
+			Dispatch.MatrixVectorMultiplyBFloat16 = &InternalVectorMatrixVectorMultiplyBFloat16AVX512;
+			Dispatch.AoSToSoAFloat = &InternalVectorAoSToSoAAVX512;
+			Dispatch.AoSToSoADouble = &InternalVectorAoSToSoAAVX512;
+			Dispatch.SoAToAoSFloat = &InternalVectorSoAToAoSAVX512;
+			Dispatch.SoAToAoSDouble = &InternalVectorSoAToAoSAVX512;
+			Dispatch.ScanOutOfRangeArray = &InternalVectorScanOutOfRangeArrayAVX512<float>;
+			Dispatch.ScanOutOfRangeHalfArray = &InternalVectorScanOutOfRangeArrayAVX512<uint16>;
+			Dispatch.ComputeBoundsPackedFloat = &InternalVectorComputeBoundsPackedAVX512<float>;
+			Dispatch.ComputeBoundsPackedDouble = &InternalVectorComputeBoundsPackedAVX512<double>;
+			Dispatch.ComputeBoundsSoAFloat = &InternalVectorComputeBoundsSoAAVX512<float>;
+			Dispatch.ComputeBoundsSoADouble = &InternalVectorComputeBoundsSoAAVX512<double>;
+			Dispatch.ComputeBoundingRadiusSoAFloat = &InternalVectorComputeBoundingRadiusSoAAVX512<float>;
+			Dispatch.ComputeBoundingRadiusSoADouble = &InternalVectorComputeBoundingRadiusSoAAVX512<double>;
+			Dispatch.CullSpheresSoAFloat = &InternalVectorCullSpheresSoAAVX512<float>;
+			Dispatch.CullSpheresSoADouble = &InternalVectorCullSpheresSoAAVX512<double>;
+			Dispatch.CullBoxesSoAFloat = &InternalVectorCullBoxesSoAAVX512<float>;
+			Dispatch.CullBoxesSoADouble = &InternalVectorCullBoxesSoAAVX512<double>;
+			if (Level == EVectorBulkLevel::AVX512BF16)
+			{
+				Dispatch.FloatToBFloat16Array = &InternalVectorFloatToBFloat16ArrayAVX512BF16;
+				Dispatch.MatrixVectorMultiplyBFloat16 = &InternalVectorMatrixVectorMultiplyBFloat16AVX512BF16;
+			}
+		}
+		else if (Level == EVectorBulkLevel::AVX2 || UE_PLATFORM_MATH_USE_AVX)
+		{
+			// AVX-only CPUs (Sandy Bridge, Ivy Bridge) detect as the SSE level. AVX builds compile these kernels for the
+			// baseline, so that level gets them too rather than leaving every call to the caller's SSE code.
+			Dispatch.TransformVectorArrayFloat = &InternalVectorTransformVectorArrayAVX;
+			Dispatch.TransformVectorArrayDouble = &InternalVectorTransformVectorArrayAVX;
+			Dispatch.TransformVectorSoAFloat = &InternalVectorTransformVectorSoAAVX;
+			Dispatch.TransformVectorSoADouble = &InternalVectorTransformVectorSoAAVX;
+			Dispatch.MatrixMultiplyArrayFloat = &InternalVectorMatrixMultiplyArrayAVX;
+			Dispatch.MatrixMultiplyArrayDouble = &InternalVectorMatrixMultiplyArrayAVX;
+			Dispatch.QuaternionMultiplySoAFloat = &InternalVectorQuaternionMultiplySoAAVX<float>;
+			Dispatch.QuaternionMultiplySoADouble = &InternalVectorQuaternionMultiplySoAAVX<double>;
+			Dispatch.QuaternionNormalizeSoAFloat = &InternalVectorQuaternionNormalizeSoAAVX<float>;
+			Dispatch.QuaternionNormalizeSoADouble = &InternalVectorQuaternionNormalizeSoAAVX<double>;
+			Dispatch.QuaternionNLerpSoAFloat = &InternalVectorQuaternionNLerpSoAAVX<float>;
+			Dispatch.QuaternionNLerpSoADouble = &InternalVectorQuaternionNLerpSoAAVX<double>;
+			Dispatch.QuaternionRotateVectorSoAFloat = &InternalVectorQuaternionRotateVectorSoAAVX<float>;
+			Dispatch.QuaternionRotateVectorSoADouble = &InternalVectorQuaternionRotateVectorSoAAVX<double>;
+			Dispatch.AoSToSoAFloat = &InternalVectorAoSToSoAAVX;
+			Dispatch.AoSToSoADouble = &InternalVectorAoSToSoAAVX;
+			Dispatch.SoAToAoSFloat = &InternalVectorSoAToAoSAVX;
+			Dispatch.SoAToAoSDouble = &InternalVectorSoAToAoSAVX;
+			Dispatch.ComputeBoundsPackedFloat = &InternalVectorComputeBoundsPackedAVX<float>;
+			Dispatch.ComputeBoundsPackedDouble = &InternalVectorComputeBoundsPackedAVX<double>;
+			Dispatch.ComputeBoundsSoAFloat = &InternalVectorComputeBoundsSoAAVX<float>;
+			Dispatch.ComputeBoundsSoADouble = &InternalVectorComputeBoundsSoAAVX<double>;
+			Dispatch.ComputeBoundingRadiusSoAFloat = &InternalVectorComputeBoundingRadiusSoAAVX<float>;
+			Dispatch.ComputeBoundingRadiusSoADouble = &InternalVectorComputeBoundingRadiusSoAAVX<double>;
+			Dispatch.CullSpheresSoAFloat = &InternalVectorCullSpheresSoAAVX<float>;
+			Dispatch.CullSpheresSoADouble = &InternalVectorCullSpheresSoAAVX<double>;
+			Dispatch.CullBoxesSoAFloat = &InternalVectorCullBoxesSoAAVX<float>;
+			Dispatch.CullBoxesSoADouble = &InternalVectorCullBoxesSoAAVX<double>;
+		}
+		if (Level == EVectorBulkLevel::AVX2)
+		{
+			// These need F16C or AVX2 integer instructions, an AVX-only CPU keeps the SSE code for them.
+			Dispatch.FloatToHalfArray = &InternalVectorFloatToHalfArrayAVX;
+			Dispatch.HalfToFloatArray = &InternalVectorHalfToFloatArrayAVX;
+			Dispatch.FloatToBFloat16Array = &InternalVectorFloatToBFloat16ArrayAVX2;
+			Dispatch.BFloat16ToFloatArray = &InternalVectorBFloat16ToFloatArrayAVX2;
+			Dispatch.MatrixVectorMultiplyBFloat16 = &InternalVectorMatrixVectorMultiplyBFloat16AVX2;
+			Dispatch.ScanOutOfRangeArray = &InternalVectorScanOutOfRangeArrayAVX<float>;
+			Dispatch.ScanOutOfRangeHalfArray = &InternalVectorScanOutOfRangeArrayAVX<uint16>;
+		}
+		if (Level != EVectorBulkLevel::SSE)
+		{
+			// The packed pixel kernels have no AVX-512 version, the AVX2 ones are used on both levels.
+			Dispatch.LoadByte4Array = &InternalVectorLoadByte4ArrayAVX2;
+			Dispatch.StoreByte4Array = &InternalVectorStoreByte4ArrayAVX2;
+			Dispatch.LoadURGB10A2NArray = &InternalVectorLoadURGB10A2NArrayAVX2;
+			Dispatch.StoreURGB10A2NArray = &InternalVectorStoreURGB10A2NArrayAVX2;
+			Dispatch.LoadURGBA16NArray = &InternalVectorLoadURGBA16NArrayAVX2;
+			Dispatch.LoadSRGBA16NArray = &InternalVectorLoadSRGBA16NArrayAVX2;
+			Dispatch.StoreURGBA16NArray = &InternalVectorStoreURGBA16NArrayAVX2;
+		}
+		if (Level != EVectorBulkLevel::SSE || UE_PLATFORM_MATH_USE_AVX)
+		{
+			// The strided point kernels have no AVX-512 version, the AVX ones are used on every level that has AVX.
+			Dispatch.ComputeBoundsStridedFloat = &InternalVectorComputeBoundsStridedAVX<float>;
+			Dispatch.ComputeBoundsStridedDouble = &InternalVectorComputeBoundsStridedAVX<double>;
+			Dispatch.ComputeBoundingRadiusStridedFloat = &InternalVectorComputeBoundingRadiusStridedAVX<float>;
+			Dispatch.ComputeBoundingRadiusStridedDouble = &InternalVectorComputeBoundingRadiusStridedAVX<double>;
+		}
+		return Dispatch;
+	}
+
+	// All tables are built on first use, cpuid is probed once. Active points at the table of the current level.
+	struct FVectorBulkDispatchState
+	{
+		EVectorBulkLevel SupportedLevel;
+		FVectorBulkDispatch Tables[(uint8)EVectorBulkLevel::AVX512BF16 + 1];
+		std::atomic<EVectorBulkLevel> Level;
+
+		FVectorBulkDispatchState()
+			: SupportedLevel(InternalDetectVectorBulkLevel())
+			, Level(SupportedLevel)
+		{
+			for (uint8 Index = 0; Index <= (uint8)EVectorBulkLevel::AVX512BF16; ++Index)
+			{
+				Tables[Index] = MakeVectorBulkDispatch(EVectorBulkLevel(Index));
+			}
+		}
+	};
+
+	FVectorBulkDispatchState& GetVectorBulkDispatchState()
+	{
+		static FVectorBulkDispatchState State;
+		return State;
+	}
+
+	FORCEINLINE const FVectorBulkDispatch& GetVectorBulkDispatch()
+	{
+		FVectorBulkDispatchState& State = GetVectorBulkDispatchState();
+		return State.Tables[(uint8)State.Level.load(std::memory_order_relaxed)];
+	}
+#endif // UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+
+	int32 InternalVectorTransformVectorArrayWide(VectorRegister4Float* Dst, const VectorRegister4Float* Src, int32 Index, int32 Count, const float* MRows)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().TransformVectorArrayFloat;
+		return Kernel ? Kernel(Dst, Src, Index, Count, MRows) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorTransformVectorArrayAVX512(Dst, Src, Index, Count, MRows);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorTransformVectorArrayAVX(Dst, Src, Index, Count, MRows);
+#else
+		(void)Dst; (void)Src; (void)Count; (void)MRows;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorTransformVectorArrayWide(VectorRegister4Double* Dst, const VectorRegister4Double* Src, int32 Index, int32 Count, const double* MRows)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().TransformVectorArrayDouble;
+		return Kernel ? Kernel(Dst, Src, Index, Count, MRows) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorTransformVectorArrayAVX512(Dst, Src, Index, Count, MRows);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorTransformVectorArrayAVX(Dst, Src, Index, Count, MRows);
+#else
+		(void)Dst; (void)Src; (void)Count; (void)MRows;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorTransformVectorSoAWide(const float (&M)[4][4], float* OutX, float* OutY, float* OutZ, float* OutW, const float* InX, const float* InY, const float* InZ, float InW, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().TransformVectorSoAFloat;
+		return Kernel ? Kernel(M, OutX, OutY, OutZ, OutW, InX, InY, InZ, InW, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorTransformVectorSoAAVX512(M, OutX, OutY, OutZ, OutW, InX, InY, InZ, InW, Index, Count);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorTransformVectorSoAAVX(M, OutX, OutY, OutZ, OutW, InX, InY, InZ, InW, Index, Count);
+#else
+		(void)M; (void)OutX; (void)OutY; (void)OutZ; (void)OutW; (void)InX; (void)InY; (void)InZ; (void)InW; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorTransformVectorSoAWide(const double (&M)[4][4], double* OutX, double* OutY, double* OutZ, double* OutW, const double* InX, const double* InY, const double* InZ, double InW, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().TransformVectorSoADouble;
+		return Kernel ? Kernel(M, OutX, OutY, OutZ, OutW, InX, InY, InZ, InW, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorTransformVectorSoAAVX512(M, OutX, OutY, OutZ, OutW, InX, InY, InZ, InW, Index, Count);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorTransformVectorSoAAVX(M, OutX, OutY, OutZ, OutW, InX, InY, InZ, InW, Index, Count);
+#else
+		(void)M; (void)OutX; (void)OutY; (void)OutZ; (void)OutW; (void)InX; (void)InY; (void)InZ; (void)InW; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorFloatToHalfArrayWide(uint16* RESTRICT Dst, const float* RESTRICT Src, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().FloatToHalfArray;
+		return Kernel ? Kernel(Dst, Src, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512 && UE_PLATFORM_MATH_USE_F16C
+		return InternalVectorFloatToHalfArrayAVX512(Dst, Src, Index, Count);
+#elif UE_PLATFORM_MATH_USE_AVX && UE_PLATFORM_MATH_USE_F16C
+		return InternalVectorFloatToHalfArrayAVX(Dst, Src, Index, Count);
+#else
+		(void)Dst; (void)Src; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorHalfToFloatArrayWide(float* RESTRICT Dst, const uint16* RESTRICT Src, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().HalfToFloatArray;
+		return Kernel ? Kernel(Dst, Src, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512 && UE_PLATFORM_MATH_USE_F16C
+		return InternalVectorHalfToFloatArrayAVX512(Dst, Src, Index, Count);
+#elif UE_PLATFORM_MATH_USE_AVX && UE_PLATFORM_MATH_USE_F16C
+		return InternalVectorHalfToFloatArrayAVX(Dst, Src, Index, Count);
+#else
+		(void)Dst; (void)Src; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorMatrixMultiplyArrayWide(float* Result, const float* Matrix1, const float* Matrix2, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().MatrixMultiplyArrayFloat;
+		return Kernel ? Kernel(Result, Matrix1, Matrix2, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorMatrixMultiplyArrayAVX512(Result, Matrix1, Matrix2, Index, Count);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorMatrixMultiplyArrayAVX(Result, Matrix1, Matrix2, Index, Count);
+#else
+		(void)Result; (void)Matrix1; (void)Matrix2; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorMatrixMultiplyArrayWide(double* Result, const double* Matrix1, const double* Matrix2, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().MatrixMultiplyArrayDouble;
+		return Kernel ? Kernel(Result, Matrix1, Matrix2, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorMatrixMultiplyArrayAVX512(Result, Matrix1, Matrix2, Index, Count);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorMatrixMultiplyArrayAVX(Result, Matrix1, Matrix2, Index, Count);
+#else
+		(void)Result; (void)Matrix1; (void)Matrix2; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorLoadByte4ArrayWide(float* RESTRICT Dst, const uint8* RESTRICT Src, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().LoadByte4Array;
+		return Kernel ? Kernel(Dst, Src, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_2
+		return InternalVectorLoadByte4ArrayAVX2(Dst, Src, Index, Count);
+#else
+		(void)Dst; (void)Src; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorStoreByte4ArrayWide(uint8* RESTRICT Dst, const float* RESTRICT Src, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().StoreByte4Array;
+		return Kernel ? Kernel(Dst, Src, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_2
+		return InternalVectorStoreByte4ArrayAVX2(Dst, Src, Index, Count);
+#else
+		(void)Dst; (void)Src; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorLoadURGB10A2NArrayWide(float* RESTRICT Dst, const uint32* RESTRICT Src, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().LoadURGB10A2NArray;
+		return Kernel ? Kernel(Dst, Src, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_2
+		return InternalVectorLoadURGB10A2NArrayAVX2(Dst, Src, Index, Count);
+#else
+		(void)Dst; (void)Src; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorStoreURGB10A2NArrayWide(uint32* RESTRICT Dst, const float* RESTRICT Src, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().StoreURGB10A2NArray;
+		return Kernel ? Kernel(Dst, Src, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_2
+		return InternalVectorStoreURGB10A2NArrayAVX2(Dst, Src, Index, Count);
+#else
+		(void)Dst; (void)Src; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorLoadURGBA16NArrayWide(float* RESTRICT Dst, const uint16* RESTRICT Src, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().LoadURGBA16NArray;
+		return Kernel ? Kernel(Dst, Src, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_2
+		return InternalVectorLoadURGBA16NArrayAVX2(Dst, Src, Index, Count);
+#else
+		(void)Dst; (void)Src; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorLoadSRGBA16NArrayWide(float* RESTRICT Dst, const int16* RESTRICT Src, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().LoadSRGBA16NArray;
+		return Kernel ? Kernel(Dst, Src, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_2
+		return InternalVectorLoadSRGBA16NArrayAVX2(Dst, Src, Index, Count);
+#else
+		(void)Dst; (void)Src; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorStoreURGBA16NArrayWide(uint16* RESTRICT Dst, const float* RESTRICT Src, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().StoreURGBA16NArray;
+		return Kernel ? Kernel(Dst, Src, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_2
+		return InternalVectorStoreURGBA16NArrayAVX2(Dst, Src, Index, Count);
+#else
+		(void)Dst; (void)Src; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorQuaternionMultiplySoAWide(float* const* Result, const float* const* Quat1, const float* const* Quat2, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().QuaternionMultiplySoAFloat;
+		return Kernel ? Kernel(Result, Quat1, Quat2, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorQuaternionMultiplySoAAVX512(Result, Quat1, Quat2, Index, Count);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorQuaternionMultiplySoAAVX(Result, Quat1, Quat2, Index, Count);
+#else
+		(void)Result; (void)Quat1; (void)Quat2; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorQuaternionMultiplySoAWide(double* const* Result, const double* const* Quat1, const double* const* Quat2, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().QuaternionMultiplySoADouble;
+		return Kernel ? Kernel(Result, Quat1, Quat2, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorQuaternionMultiplySoAAVX512(Result, Quat1, Quat2, Index, Count);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorQuaternionMultiplySoAAVX(Result, Quat1, Quat2, Index, Count);
+#else
+		(void)Result; (void)Quat1; (void)Quat2; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorQuaternionNormalizeSoAWide(float* const* Result, const float* const* Quat, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().QuaternionNormalizeSoAFloat;
+		return Kernel ? Kernel(Result, Quat, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorQuaternionNormalizeSoAAVX512(Result, Quat, Index, Count);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorQuaternionNormalizeSoAAVX(Result, Quat, Index, Count);
+#else
+		(void)Result; (void)Quat; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorQuaternionNormalizeSoAWide(double* const* Result, const double* const* Quat, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().QuaternionNormalizeSoADouble;
+		return Kernel ? Kernel(Result, Quat, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorQuaternionNormalizeSoAAVX512(Result, Quat, Index, Count);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorQuaternionNormalizeSoAAVX(Result, Quat, Index, Count);
+#else
+		(void)Result; (void)Quat; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorQuaternionNLerpSoAWide(float* const* Result, const float* const* Quat1, const float* const* Quat2, const float* Alpha, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().QuaternionNLerpSoAFloat;
+		return Kernel ? Kernel(Result, Quat1, Quat2, Alpha, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorQuaternionNLerpSoAAVX512(Result, Quat1, Quat2, Alpha, Index, Count);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorQuaternionNLerpSoAAVX(Result, Quat1, Quat2, Alpha, Index, Count);
+#else
+		(void)Result; (void)Quat1; (void)Quat2; (void)Alpha; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorQuaternionNLerpSoAWide(double* const* Result, const double* const* Quat1, const double* const* Quat2, const double* Alpha, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().QuaternionNLerpSoADouble;
+		return Kernel ? Kernel(Result, Quat1, Quat2, Alpha, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorQuaternionNLerpSoAAVX512(Result, Quat1, Quat2, Alpha, Index, Count);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorQuaternionNLerpSoAAVX(Result, Quat1, Quat2, Alpha, Index, Count);
+#else
+		(void)Result; (void)Quat1; (void)Quat2; (void)Alpha; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorQuaternionRotateVectorSoAWide(float* const* Result, const float* const* Quat, const float* const* Vector, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().QuaternionRotateVectorSoAFloat;
+		return Kernel ? Kernel(Result, Quat, Vector, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorQuaternionRotateVectorSoAAVX512(Result, Quat, Vector, Index, Count);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorQuaternionRotateVectorSoAAVX(Result, Quat, Vector, Index, Count);
+#else
+		(void)Result; (void)Quat; (void)Vector; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorQuaternionRotateVectorSoAWide(double* const* Result, const double* const* Quat, const double* const* Vector, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().QuaternionRotateVectorSoADouble;
+		return Kernel ? Kernel(Result, Quat, Vector, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorQuaternionRotateVectorSoAAVX512(Result, Quat, Vector, Index, Count);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorQuaternionRotateVectorSoAAVX(Result, Quat, Vector, Index, Count);
+#else
+		(void)Result; (void)Quat; (void)Vector; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorFloatToBFloat16ArrayWide(uint16* RESTRICT Dst, const float* RESTRICT Src, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().FloatToBFloat16Array;
+		return Kernel ? Kernel(Dst, Src, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512_BF16
+		return InternalVectorFloatToBFloat16ArrayAVX512BF16(Dst, Src, Index, Count);
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorFloatToBFloat16ArrayAVX512(Dst, Src, Index, Count);
+#elif UE_PLATFORM_MATH_USE_AVX_2
+		return InternalVectorFloatToBFloat16ArrayAVX2(Dst, Src, Index, Count);
+#else
+		(void)Dst; (void)Src; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorBFloat16ToFloatArrayWide(float* RESTRICT Dst, const uint16* RESTRICT Src, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().BFloat16ToFloatArray;
+		return Kernel ? Kernel(Dst, Src, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorBFloat16ToFloatArrayAVX512(Dst, Src, Index, Count);
+#elif UE_PLATFORM_MATH_USE_AVX_2
+		return InternalVectorBFloat16ToFloatArrayAVX2(Dst, Src, Index, Count);
+#else
+		(void)Dst; (void)Src; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorMatrixVectorMultiplyBFloat16Wide(float* RESTRICT Result, const uint16* RESTRICT Matrix, const uint16* RESTRICT Vector, int32 NumColumns, int32 Row, int32 NumRows)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().MatrixVectorMultiplyBFloat16;
+		return Kernel ? Kernel(Result, Matrix, Vector, NumColumns, Row, NumRows) : Row;
+#elif UE_PLATFORM_MATH_USE_AVX_512_BF16
+		return InternalVectorMatrixVectorMultiplyBFloat16AVX512BF16(Result, Matrix, Vector, NumColumns, Row, NumRows);
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorMatrixVectorMultiplyBFloat16AVX512(Result, Matrix, Vector, NumColumns, Row, NumRows);
+#elif UE_PLATFORM_MATH_USE_AVX_2
+		return InternalVectorMatrixVectorMultiplyBFloat16AVX2(Result, Matrix, Vector, NumColumns, Row, NumRows);
+#else
+		(void)Result; (void)Matrix; (void)Vector; (void)NumColumns; (void)NumRows;
+		return Row;
+#endif
+	}
+
+	int32 InternalVectorAoSToSoAWide(float* const* Dst, const float* Src, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().AoSToSoAFloat;
+		return Kernel ? Kernel(Dst, Src, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorAoSToSoAAVX512(Dst, Src, Index, Count);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorAoSToSoAAVX(Dst, Src, Index, Count);
+#else
+		(void)Dst; (void)Src; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorAoSToSoAWide(double* const* Dst, const double* Src, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().AoSToSoADouble;
+		return Kernel ? Kernel(Dst, Src, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorAoSToSoAAVX512(Dst, Src, Index, Count);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorAoSToSoAAVX(Dst, Src, Index, Count);
+#else
+		(void)Dst; (void)Src; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorSoAToAoSWide(float* Dst, const float* const* Src, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().SoAToAoSFloat;
+		return Kernel ? Kernel(Dst, Src, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorSoAToAoSAVX512(Dst, Src, Index, Count);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorSoAToAoSAVX(Dst, Src, Index, Count);
+#else
+		(void)Dst; (void)Src; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorSoAToAoSWide(double* Dst, const double* const* Src, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().SoAToAoSDouble;
+		return Kernel ? Kernel(Dst, Src, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorSoAToAoSAVX512(Dst, Src, Index, Count);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorSoAToAoSAVX(Dst, Src, Index, Count);
+#else
+		(void)Dst; (void)Src; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorScanOutOfRangeArrayWide(const float* Src, int32 Index, int32 Count, float MinValue, float MaxValue, FVectorScanResult& Result)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().ScanOutOfRangeArray;
+		return Kernel ? Kernel(Src, Index, Count, MinValue, MaxValue, Result) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorScanOutOfRangeArrayAVX512(Src, Index, Count, MinValue, MaxValue, Result);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorScanOutOfRangeArrayAVX(Src, Index, Count, MinValue, MaxValue, Result);
+#else
+		(void)Src; (void)Count; (void)MinValue; (void)MaxValue; (void)Result;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorScanOutOfRangeArrayWide(const uint16* Src, int32 Index, int32 Count, float MinValue, float MaxValue, FVectorScanResult& Result)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().ScanOutOfRangeHalfArray;
+		return Kernel ? Kernel(Src, Index, Count, MinValue, MaxValue, Result) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512 && UE_PLATFORM_MATH_USE_F16C
+		return InternalVectorScanOutOfRangeArrayAVX512(Src, Index, Count, MinValue, MaxValue, Result);
+#elif UE_PLATFORM_MATH_USE_AVX && UE_PLATFORM_MATH_USE_F16C
+		return InternalVectorScanOutOfRangeArrayAVX(Src, Index, Count, MinValue, MaxValue, Result);
+#else
+		(void)Src; (void)Count; (void)MinValue; (void)MaxValue; (void)Result;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorComputeBoundsPackedWide(const float* Points, int32 Index, int32 Count, float* InOutMin, float* InOutMax)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().ComputeBoundsPackedFloat;
+		return Kernel ? Kernel(Points, Index, Count, InOutMin, InOutMax) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorComputeBoundsPackedAVX512(Points, Index, Count, InOutMin, InOutMax);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorComputeBoundsPackedAVX(Points, Index, Count, InOutMin, InOutMax);
+#else
+		(void)Points; (void)Count; (void)InOutMin; (void)InOutMax;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorComputeBoundsPackedWide(const double* Points, int32 Index, int32 Count, double* InOutMin, double* InOutMax)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().ComputeBoundsPackedDouble;
+		return Kernel ? Kernel(Points, Index, Count, InOutMin, InOutMax) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorComputeBoundsPackedAVX512(Points, Index, Count, InOutMin, InOutMax);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorComputeBoundsPackedAVX(Points, Index, Count, InOutMin, InOutMax);
+#else
+		(void)Points; (void)Count; (void)InOutMin; (void)InOutMax;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorComputeBoundsStridedWide(const float* Points, int32 Stride, int32 Index, int32 Count, float* InOutMin, float* InOutMax)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().ComputeBoundsStridedFloat;
+		return Kernel ? Kernel(Points, Stride, Index, Count, InOutMin, InOutMax) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorComputeBoundsStridedAVX(Points, Stride, Index, Count, InOutMin, InOutMax);
+#else
+		(void)Points; (void)Stride; (void)Count; (void)InOutMin; (void)InOutMax;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorComputeBoundsStridedWide(const double* Points, int32 Stride, int32 Index, int32 Count, double* InOutMin, double* InOutMax)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().ComputeBoundsStridedDouble;
+		return Kernel ? Kernel(Points, Stride, Index, Count, InOutMin, InOutMax) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorComputeBoundsStridedAVX(Points, Stride, Index, Count, InOutMin, InOutMax);
+#else
+		(void)Points; (void)Stride; (void)Count; (void)InOutMin; (void)InOutMax;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorComputeBoundsSoAWide(const float* const* Components, int32 Index, int32 Count, float* InOutMin, float* InOutMax)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().ComputeBoundsSoAFloat;
+		return Kernel ? Kernel(Components, Index, Count, InOutMin, InOutMax) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorComputeBoundsSoAAVX512(Components, Index, Count, InOutMin, InOutMax);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorComputeBoundsSoAAVX(Components, Index, Count, InOutMin, InOutMax);
+#else
+		(void)Components; (void)Count; (void)InOutMin; (void)InOutMax;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorComputeBoundsSoAWide(const double* const* Components, int32 Index, int32 Count, double* InOutMin, double* InOutMax)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().ComputeBoundsSoADouble;
+		return Kernel ? Kernel(Components, Index, Count, InOutMin, InOutMax) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorComputeBoundsSoAAVX512(Components, Index, Count, InOutMin, InOutMax);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorComputeBoundsSoAAVX(Components, Index, Count, InOutMin, InOutMax);
+#else
+		(void)Components; (void)Count; (void)InOutMin; (void)InOutMax;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorComputeBoundingRadiusStridedWide(const float* Points, int32 Stride, int32 Index, int32 Count, const float* Center, float& InOutRadiusSquared)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().ComputeBoundingRadiusStridedFloat;
+		return Kernel ? Kernel(Points, Stride, Index, Count, Center, InOutRadiusSquared) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorComputeBoundingRadiusStridedAVX(Points, Stride, Index, Count, Center, InOutRadiusSquared);
+#else
+		(void)Points; (void)Stride; (void)Count; (void)Center; (void)InOutRadiusSquared;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorComputeBoundingRadiusStridedWide(const double* Points, int32 Stride, int32 Index, int32 Count, const double* Center, double& InOutRadiusSquared)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().ComputeBoundingRadiusStridedDouble;
+		return Kernel ? Kernel(Points, Stride, Index, Count, Center, InOutRadiusSquared) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorComputeBoundingRadiusStridedAVX(Points, Stride, Index, Count, Center, InOutRadiusSquared);
+#else
+		(void)Points; (void)Stride; (void)Count; (void)Center; (void)InOutRadiusSquared;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorComputeBoundingRadiusSoAWide(const float* const* Components, int32 Index, int32 Count, const float* Center, float& InOutRadiusSquared)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().ComputeBoundingRadiusSoAFloat;
+		return Kernel ? Kernel(Components, Index, Count, Center, InOutRadiusSquared) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorComputeBoundingRadiusSoAAVX512(Components, Index, Count, Center, InOutRadiusSquared);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorComputeBoundingRadiusSoAAVX(Components, Index, Count, Center, InOutRadiusSquared);
+#else
+		(void)Components; (void)Count; (void)Center; (void)InOutRadiusSquared;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorComputeBoundingRadiusSoAWide(const double* const* Components, int32 Index, int32 Count, const double* Center, double& InOutRadiusSquared)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().ComputeBoundingRadiusSoADouble;
+		return Kernel ? Kernel(Components, Index, Count, Center, InOutRadiusSquared) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorComputeBoundingRadiusSoAAVX512(Components, Index, Count, Center, InOutRadiusSquared);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorComputeBoundingRadiusSoAAVX(Components, Index, Count, Center, InOutRadiusSquared);
+#else
+		(void)Components; (void)Count; (void)Center; (void)InOutRadiusSquared;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorCullSpheresSoAWide(uint32* OutVisible, const float* const* Spheres, const float* Planes, int32 NumPlanes, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().CullSpheresSoAFloat;
+		return Kernel ? Kernel(OutVisible, Spheres, Planes, NumPlanes, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorCullSpheresSoAAVX512(OutVisible, Spheres, Planes, NumPlanes, Index, Count);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorCullSpheresSoAAVX(OutVisible, Spheres, Planes, NumPlanes, Index, Count);
+#else
+		(void)OutVisible; (void)Spheres; (void)Planes; (void)NumPlanes; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorCullSpheresSoAWide(uint32* OutVisible, const double* const* Spheres, const double* Planes, int32 NumPlanes, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().CullSpheresSoADouble;
+		return Kernel ? Kernel(OutVisible, Spheres, Planes, NumPlanes, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorCullSpheresSoAAVX512(OutVisible, Spheres, Planes, NumPlanes, Index, Count);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorCullSpheresSoAAVX(OutVisible, Spheres, Planes, NumPlanes, Index, Count);
+#else
+		(void)OutVisible; (void)Spheres; (void)Planes; (void)NumPlanes; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorCullBoxesSoAWide(uint32* OutVisible, const float* const* Boxes, const float* Planes, int32 NumPlanes, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().CullBoxesSoAFloat;
+		return Kernel ? Kernel(OutVisible, Boxes, Planes, NumPlanes, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorCullBoxesSoAAVX512(OutVisible, Boxes, Planes, NumPlanes, Index, Count);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorCullBoxesSoAAVX(OutVisible, Boxes, Planes, NumPlanes, Index, Count);
+#else
+		(void)OutVisible; (void)Boxes; (void)Planes; (void)NumPlanes; (void)Count;
+		return Index;
+#endif
+	}
+
+	int32 InternalVectorCullBoxesSoAWide(uint32* OutVisible, const double* const* Boxes, const double* Planes, int32 NumPlanes, int32 Index, int32 Count)
+	{
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+		const auto Kernel = GetVectorBulkDispatch().CullBoxesSoADouble;
+		return Kernel ? Kernel(OutVisible, Boxes, Planes, NumPlanes, Index, Count) : Index;
+#elif UE_PLATFORM_MATH_USE_AVX_512
+		return InternalVectorCullBoxesSoAAVX512(OutVisible, Boxes, Planes, NumPlanes, Index, Count);
+#elif UE_PLATFORM_MATH_USE_AVX
+		return InternalVectorCullBoxesSoAAVX(OutVisible, Boxes, Planes, NumPlanes, Index, Count);
+#else
+		(void)OutVisible; (void)Boxes; (void)Planes; (void)NumPlanes; (void)Count;
+		return Index;
+#endif
+	}
+} // namespace SSEVectorHelperFuncs
+
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+EVectorBulkLevel GetSupportedVectorBulkLevel()
+{
+	return SSEVectorHelperFuncs::GetVectorBulkDispatchState().SupportedLevel;
+}
+
+EVectorBulkLevel GetVectorBulkLevel()
+{
+	return SSEVectorHelperFuncs::GetVectorBulkDispatchState().Level.load(std::memory_order_relaxed);
+}
+
+void SetVectorBulkLevel(EVectorBulkLevel Level)
+{
+	SSEVectorHelperFuncs::FVectorBulkDispatchState& State = SSEVectorHelperFuncs::GetVectorBulkDispatchState();
+	State.Level.store(Level < State.SupportedLevel ? Level : State.SupportedLevel, std::memory_order_relaxed);
+}
+#endif // UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+
+#endif // UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+
+// Streaming copy and fill, see UnrealMathSSE.h.
+
+namespace SSEVectorHelperFuncs
+{
+	// Size of the largest data or unified cache in bytes, zero if cpuid does not report it. Intel describes its caches in
+	// leaf 4, AMD in leaf 0x8000001D with the same layout, or only in leaf 0x80000006 on older parts.
+	SIZE_T InternalDetectLastLevelCacheSize()
+	{
+		uint32 Regs[4];
+		InternalCpuId(0, 0, Regs);
+		const uint32 MaxLeaf = Regs[0];
+		InternalCpuId(0x80000000, 0, Regs);
+		const uint32 MaxExtendedLeaf = Regs[0];
+		bool bHasTopologyExtensions = false;
+		if (MaxExtendedLeaf >= 0x80000001)
+		{
+			InternalCpuId(0x80000001, 0, Regs);
+			bHasTopologyExtensions = (Regs[2] & (1u << 22)) != 0;
+		}
+
+		SIZE_T LargestSize = 0;
+		const uint32 CacheLeaves[2] = { MaxLeaf >= 4 ? 4u : 0u, MaxExtendedLeaf >= 0x8000001D && bHasTopologyExtensions ? 0x8000001Du : 0u };
+		for (const uint32 Leaf : CacheLeaves)
+		{
+			for (uint32 SubLeaf = 0; Leaf != 0 && SubLeaf < 16; ++SubLeaf)
+			{
+				InternalCpuId(Leaf, SubLeaf, Regs);
+				const uint32 Type = Regs[0] & 0x1F;
+				if (Type == 0)
+				{
+					break;
+				}
+				if (Type != 2 /* instruction cache */)
+				{
+					const SIZE_T Ways = SIZE_T(Regs[1] >> 22) + 1;
+					const SIZE_T Partitions = SIZE_T((Regs[1] >> 12) & 0x3FF) + 1;
+					const SIZE_T LineSize = SIZE_T(Regs[1] & 0xFFF) + 1;
+					const SIZE_T Sets = SIZE_T(Regs[2]) + 1;
+					LargestSize = FMath::Max(LargestSize, Ways * Partitions * LineSize * Sets);
+				}
+			}
+			if (LargestSize != 0)
+			{
+				break;
+			}
+		}
+		if (LargestSize == 0 && MaxExtendedLeaf >= 0x80000006)
+		{
+			// L2 size in KB in ECX[31:16], L3 size in 512 KB units in EDX[31:18].
+			InternalCpuId(0x80000006, 0, Regs);
+			LargestSize = FMath::Max(SIZE_T(Regs[2] >> 16) * 1024, SIZE_T(Regs[3] >> 18) * 512 * 1024);
+		}
+		return LargestSize;
+	}
+
+	// Half the LLC: anything smaller leaves room for the working set and is likely still cached when it is read. cpuid is
+	// probed once, on first use; 4 MB when it reports no cache. Relaxed, the threshold only picks between two correct paths.
+	std::atomic<SIZE_T>& GetVectorStreamingThresholdState()
+	{
+		static std::atomic<SIZE_T> Threshold([] { const SIZE_T CacheSize = InternalDetectLastLevelCacheSize(); return CacheSize ? CacheSize / 2 : SIZE_T(4) << 20; }());
+		return Threshold;
+	}
+
+	// Whole 64-byte lines, Dst aligned to a line so no line is shared with ordinary stores.
+	FORCEINLINE void InternalVectorCopyLinesStreamed(uint8* RESTRICT Dst, const uint8* RESTRICT Src, SIZE_T NumLines)
+	{
+		for (; NumLines > 0; --NumLines, Dst += 64, Src += 64)
+		{
+			const VectorRegister4Float Value0 = VectorLoad((const float*)Src + 0);
+			const VectorRegister4Float Value1 = VectorLoad((const float*)Src + 4);
+			const VectorRegister4Float Value2 = VectorLoad((const float*)Src + 8);
+			const VectorRegister4Float Value3 = VectorLoad((const float*)Src + 12);
+			VectorStoreAlignedStreamed(Value0, (float*)Dst + 0);
+			VectorStoreAlignedStreamed(Value1, (float*)Dst + 4);
+			VectorStoreAlignedStreamed(Value2, (float*)Dst + 8);
+			VectorStoreAlignedStreamed(Value3, (float*)Dst + 12);
+		}
+	}
+
+	FORCEINLINE void InternalVectorFillLinesStreamed(uint8* Dst, const VectorRegister4Float& Value, SIZE_T NumLines)
+	{
+		for (; NumLines > 0; --NumLines, Dst += 64)
+		{
+			VectorStoreAlignedStreamed(Value, (float*)Dst + 0);
+			VectorStoreAlignedStreamed(Value, (float*)Dst + 4);
+			VectorStoreAlignedStreamed(Value, (float*)Dst + 8);
+			VectorStoreAlignedStreamed(Value, (float*)Dst + 12);
+		}
+	}
+
+	// Bytes before the first 64-byte boundary of Dst, at most Size.
+	FORCEINLINE SIZE_T InternalStreamingHeadSize(const void* Dst, SIZE_T Size)
+	{
+		return FMath::Min(SIZE_T((64 - (UPTRINT(Dst) & 63)) & 63), Size);
+	}
+} // namespace SSEVectorHelperFuncs
+
+SIZE_T VectorGetStreamingThreshold()
+{
+	return SSEVectorHelperFuncs::GetVectorStreamingThresholdState().load(std::memory_order_relaxed);
+}
+
+void VectorSetStreamingThreshold(SIZE_T Threshold)
+{
+	SSEVectorHelperFuncs::GetVectorStreamingThresholdState().store(Threshold, std::memory_order_relaxed);
+}
+
+void VectorMemcpyStreamed(void* RESTRICT Dst, const void* RESTRICT Src, SIZE_T Size)
+{
+	if (Size < VectorGetStreamingThreshold())
+	{
+		memcpy(Dst, Src, Size);
+		return;
+	}
+
+	const SIZE_T HeadSize = SSEVectorHelperFuncs::InternalStreamingHeadSize(Dst, Size);
+	const SIZE_T NumLines = (Size - HeadSize) / 64;
+	const SIZE_T TailOffset = HeadSize + NumLines * 64;
+	memcpy(Dst, Src, HeadSize);
+	SSEVectorHelperFuncs::InternalVectorCopyLinesStreamed((uint8*)Dst + HeadSize, (const uint8*)Src + HeadSize, NumLines);
+	memcpy((uint8*)Dst + TailOffset, (const uint8*)Src + TailOffset, Size - TailOffset);
+	_mm_sfence();
+}
+
+void VectorMemsetStreamed(void* Dst, uint8 Value, SIZE_T Size)
+{
+	if (Size < VectorGetStreamingThreshold())
+	{
+		memset(Dst, Value, Size);
+		return;
+	}
+
+	const SIZE_T HeadSize = SSEVectorHelperFuncs::InternalStreamingHeadSize(Dst, Size);
+	const SIZE_T NumLines = (Size - HeadSize) / 64;
+	const SIZE_T TailOffset = HeadSize + NumLines * 64;
+	memset(Dst, Value, HeadSize);
+	SSEVectorHelperFuncs::InternalVectorFillLinesStreamed((uint8*)Dst + HeadSize, _mm_castsi128_ps(_mm_set1_epi8(char(Value))), NumLines);
+	memset((uint8*)Dst + TailOffset, Value, Size - TailOffset);
+	_mm_sfence();
+}
+
+#endif // PLATFORM_ENABLE_VECTORINTRINSICS && !PLATFORM_ENABLE_VECTORINTRINSICS_NEON && !WITH_DIRECTXMATH
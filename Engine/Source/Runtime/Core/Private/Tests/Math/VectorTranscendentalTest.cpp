@@ -0,0 +1,310 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Math/RandomStream.h"
+#include "Math/UnrealMathUtility.h"
+#include "Math/VectorRegister.h"
+#include "Misc/AutomationTest.h"
+
+#include <cfloat>
+#include <cmath>
+#include <limits>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Checks the vector Exp, Exp2, Log, Log2, Tan, ASin, ACos, ATan and ATan2 kernels against libm evaluated in double
+ * precision, over random samples of their core ranges and of all finite inputs, and over their special values.
+ * The ulp bounds are the ones documented with the kernels in the platform math headers.
+ */
+namespace UE::Math::VectorTranscendentalTest
+{
+	constexpr int32 NumSamples = 1 << 16;
+
+	template<typename T>
+	struct TFloatBits;
+
+	template<>
+	struct TFloatBits<float>
+	{
+		using Type = uint32;
+		static constexpr uint64 SignMask = 0x80000000ull;
+	};
+
+	template<>
+	struct TFloatBits<double>
+	{
+		using Type = uint64;
+		static constexpr uint64 SignMask = 0x8000000000000000ull;
+	};
+
+	template<typename T>
+	uint64 GetBits(T Value)
+	{
+		typename TFloatBits<T>::Type Bits;
+		FMemory::Memcpy(&Bits, &Value, sizeof(T));
+		return Bits;
+	}
+
+	// Number of representable values between A and B, or MAX_uint64 when only one of them is NaN or infinite, or they
+	// are different infinities.
+	template<typename T>
+	uint64 UlpDistance(T A, T B)
+	{
+		if (FMath::IsNaN(A) || FMath::IsNaN(B))
+		{
+			return (FMath::IsNaN(A) && FMath::IsNaN(B)) ? 0 : MAX_uint64;
+		}
+		if (!FMath::IsFinite(A) || !FMath::IsFinite(B))
+		{
+			return (A == B) ? 0 : MAX_uint64;
+		}
+
+		const uint64 SignMask = TFloatBits<T>::SignMask;
+		const uint64 BitsA = GetBits(A);
+		const uint64 BitsB = GetBits(B);
+		const uint64 MagnitudeA = BitsA & ~SignMask;
+		const uint64 MagnitudeB = BitsB & ~SignMask;
+		if ((BitsA & SignMask) != (BitsB & SignMask))
+		{
+			return MagnitudeA + MagnitudeB;
+		}
+		return (MagnitudeA > MagnitudeB) ? MagnitudeA - MagnitudeB : MagnitudeB - MagnitudeA;
+	}
+
+	// Uniformly distributed samples in [Min, Max].
+	template<typename T>
+	TArray<T> UniformSamples(FRandomStream& Random, T Min, T Max)
+	{
+		TArray<T> Samples;
+		Samples.Reserve(NumSamples);
+		while (Samples.Num() < NumSamples)
+		{
+			const uint64 Bits = ((uint64(Random.GetUnsignedInt()) << 21) ^ Random.GetUnsignedInt()) & ((1ull << 53) - 1);
+			const double Fraction = double(Bits) * (1.0 / 9007199254740992.0);
+			Samples.Add(FMath::Clamp(T(double(Min) + (double(Max) - double(Min)) * Fraction), Min, Max));
+		}
+		return Samples;
+	}
+
+	// Random finite bit patterns accepted by Filter, so every binade is sampled as often as any other, denormals included.
+	template<typename T, typename FilterType>
+	TArray<T> BitPatternSamples(FRandomStream& Random, FilterType Filter)
+	{
+		TArray<T> Samples;
+		Samples.Reserve(NumSamples);
+		while (Samples.Num() < NumSamples)
+		{
+			const uint64 Bits = (uint64(Random.GetUnsignedInt()) << 32) | Random.GetUnsignedInt();
+			typename TFloatBits<T>::Type ValueBits = typename TFloatBits<T>::Type(Bits);
+			T Value;
+			FMemory::Memcpy(&Value, &ValueBits, sizeof(T));
+			if (FMath::IsFinite(Value) && Filter(Value))
+			{
+				Samples.Add(Value);
+			}
+		}
+		return Samples;
+	}
+
+	template<typename T>
+	TArray<T> BitPatternSamples(FRandomStream& Random)
+	{
+		return BitPatternSamples<T>(Random, [](T) { return true; });
+	}
+
+	/**
+	 * Runs Kernel four lanes at a time over A (and B for two argument kernels) and compares every lane with Reference
+	 * evaluated in double precision and rounded to T. A lane passes when it is within MaxUlps of the reference, NaN
+	 * exactly when the reference is, the same infinity, or a zero of the same sign when the reference is zero.
+	 */
+	template<typename T, typename KernelType, typename ReferenceType>
+	void CheckKernel(FAutomationTestBase& Test, const TCHAR* Name, const TArray<T>& A, const TArray<T>& B, uint64 MaxUlps, KernelType Kernel, ReferenceType Reference)
+	{
+		const bool bBinary = B.Num() > 0;
+		int32 NumFailed = 0;
+		int32 WorstIndex = 0;
+		uint64 WorstUlps = 0;
+		T WorstResult = T(0);
+
+		for (int32 Index = 0; Index < A.Num(); Index += 4)
+		{
+			T LanesA[4];
+			T LanesB[4];
+			T Results[4];
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				const int32 SampleIndex = FMath::Min(Index + Lane, A.Num() - 1);
+				LanesA[Lane] = A[SampleIndex];
+				LanesB[Lane] = bBinary ? B[SampleIndex] : T(1);
+			}
+			VectorStore(Kernel(VectorLoad(LanesA), VectorLoad(LanesB)), Results);
+
+			for (int32 Lane = 0; Lane < 4 && Index + Lane < A.Num(); ++Lane)
+			{
+				const T Expected = T(Reference(double(LanesA[Lane]), double(LanesB[Lane])));
+				uint64 Ulps = UlpDistance(Results[Lane], Expected);
+				if (Expected == T(0) && GetBits(Results[Lane]) != GetBits(Expected))
+				{
+					Ulps = MAX_uint64;
+				}
+				if (Ulps > MaxUlps)
+				{
+					++NumFailed;
+					if (Ulps > WorstUlps || NumFailed == 1)
+					{
+						WorstIndex = Index + Lane;
+						WorstUlps = Ulps;
+						WorstResult = Results[Lane];
+					}
+				}
+			}
+		}
+
+		if (NumFailed > 0)
+		{
+			const T InputB = bBinary ? B[WorstIndex] : T(1);
+			const T Expected = T(Reference(double(A[WorstIndex]), double(InputB)));
+			const FString Input = bBinary
+				? FString::Printf(TEXT("(%.17g, %.17g)"), double(A[WorstIndex]), double(InputB))
+				: FString::Printf(TEXT("%.17g"), double(A[WorstIndex]));
+			Test.AddError(FString::Printf(TEXT("%s: %d of %d results are more than %llu ulp off, worst is %.17g for %s, expected %.17g"),
+				Name, NumFailed, A.Num(), (unsigned long long)MaxUlps, double(WorstResult), *Input, double(Expected)));
+		}
+	}
+
+	template<typename T, typename KernelType, typename ReferenceType>
+	void CheckKernel(FAutomationTestBase& Test, const TCHAR* Name, const TArray<T>& A, uint64 MaxUlps, KernelType Kernel, ReferenceType Reference)
+	{
+		CheckKernel(Test, Name, A, TArray<T>(), MaxUlps, Kernel, Reference);
+	}
+
+	const auto Exp = [](const auto& X, const auto&) { return VectorExp(X); };
+	const auto Exp2 = [](const auto& X, const auto&) { return VectorExp2(X); };
+	const auto Log = [](const auto& X, const auto&) { return VectorLog(X); };
+	const auto Log2 = [](const auto& X, const auto&) { return VectorLog2(X); };
+	const auto Tan = [](const auto& X, const auto&) { return VectorTan(X); };
+	const auto ASin = [](const auto& X, const auto&) { return VectorASin(X); };
+	const auto ACos = [](const auto& X, const auto&) { return VectorACos(X); };
+	const auto ATan = [](const auto& X, const auto&) { return VectorATan(X); };
+	const auto ATan2 = [](const auto& Y, const auto& X) { return VectorATan2(Y, X); };
+
+	const auto ReferenceExp = [](double X, double) { return std::exp(X); };
+	const auto ReferenceExp2 = [](double X, double) { return std::exp2(X); };
+	const auto ReferenceLog = [](double X, double) { return std::log(X); };
+	const auto ReferenceLog2 = [](double X, double) { return std::log2(X); };
+	const auto ReferenceTan = [](double X, double) { return std::tan(X); };
+	const auto ReferenceASin = [](double X, double) { return std::asin(X); };
+	const auto ReferenceACos = [](double X, double) { return std::acos(X); };
+	const auto ReferenceATan = [](double X, double) { return std::atan(X); };
+	const auto ReferenceATan2 = [](double Y, double X) { return std::atan2(Y, X); };
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVectorTranscendentalFloatTest, "System.Core.Math.Vector Transcendentals.Float", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+bool FVectorTranscendentalFloatTest::RunTest(const FString& Parameters)
+{
+	using namespace UE::Math::VectorTranscendentalTest;
+
+	const float Inf = std::numeric_limits<float>::infinity();
+	const float NaN = std::numeric_limits<float>::quiet_NaN();
+	FRandomStream Random(0x5EED);
+
+	// Exp and Log are sse_mathfun's exp_ps and log_ps on SSE. exp_ps clamps its input to +-88.376 and log_ps flushes
+	// denormal inputs to FLT_MIN and returns NaN for zero, and both return finite values for NaN and infinity. So they are
+	// only checked over normal results and the special values every implementation agrees on.
+	CheckKernel(*this, TEXT("Exp"), UniformSamples(Random, -87.33f, 88.37f), 1, Exp, ReferenceExp);
+	CheckKernel(*this, TEXT("Exp special values"), TArray<float>({ -Inf, 0.0f, -0.0f, 1.0f }), 1, Exp, ReferenceExp);
+	CheckKernel(*this, TEXT("Log"), BitPatternSamples<float>(Random, [](float X) { return X >= FLT_MIN; }), 1, Log, ReferenceLog);
+	CheckKernel(*this, TEXT("Log special values"), TArray<float>({ -Inf, -1.0f, -FLT_MIN, 1.0f }), 1, Log, ReferenceLog);
+
+	CheckKernel(*this, TEXT("Exp2"), UniformSamples(Random, -150.0f, 128.0f), 1, Exp2, ReferenceExp2);
+	CheckKernel(*this, TEXT("Exp2 full range"), BitPatternSamples<float>(Random), 1, Exp2, ReferenceExp2);
+	CheckKernel(*this, TEXT("Exp2 special values"), TArray<float>({ NaN, -Inf, Inf, 0.0f, -0.0f, 127.99f, 128.0f, -126.5f, -149.0f, -150.0f }), 1, Exp2, ReferenceExp2);
+
+	CheckKernel(*this, TEXT("Log2"), UniformSamples(Random, 0.0f, 4.0f), 1, Log2, ReferenceLog2);
+	CheckKernel(*this, TEXT("Log2 full range"), BitPatternSamples<float>(Random, [](float X) { return X >= 0.0f; }), 1, Log2, ReferenceLog2);
+	CheckKernel(*this, TEXT("Log2 special values"), TArray<float>({ NaN, -Inf, Inf, 0.0f, -0.0f, -1.0f, 1.0f, 1e-45f, FLT_MIN, FLT_MAX }), 1, Log2, ReferenceLog2);
+
+	// Arguments above 8192 fall back to the scalar FMath::Tan.
+	CheckKernel(*this, TEXT("Tan"), UniformSamples(Random, -8192.0f, 8192.0f), 3, Tan, ReferenceTan);
+	CheckKernel(*this, TEXT("Tan full range"), BitPatternSamples<float>(Random), 3, Tan, ReferenceTan);
+	CheckKernel(*this, TEXT("Tan special values"), TArray<float>({ NaN, -Inf, Inf, 0.0f, -0.0f, 1e-30f, 8192.0f, 8193.0f }), 3, Tan, ReferenceTan);
+
+	CheckKernel(*this, TEXT("ASin"), UniformSamples(Random, -1.0f, 1.0f), 3, ASin, ReferenceASin);
+	CheckKernel(*this, TEXT("ASin full range"), BitPatternSamples<float>(Random, [](float X) { return FMath::Abs(X) <= 1.0f; }), 3, ASin, ReferenceASin);
+	CheckKernel(*this, TEXT("ASin special values"), TArray<float>({ NaN, -Inf, Inf, 0.0f, -0.0f, 1.0f, -1.0f, 1.0000001f, -1.5f, 1e-30f }), 3, ASin, ReferenceASin);
+
+	CheckKernel(*this, TEXT("ACos"), UniformSamples(Random, -1.0f, 1.0f), 1, ACos, ReferenceACos);
+	CheckKernel(*this, TEXT("ACos full range"), BitPatternSamples<float>(Random, [](float X) { return FMath::Abs(X) <= 1.0f; }), 1, ACos, ReferenceACos);
+	CheckKernel(*this, TEXT("ACos special values"), TArray<float>({ NaN, -Inf, Inf, 0.0f, -0.0f, 1.0f, -1.0f, 1.0000001f, -1.5f, 1e-30f }), 1, ACos, ReferenceACos);
+
+	CheckKernel(*this, TEXT("ATan"), UniformSamples(Random, -16.0f, 16.0f), 3, ATan, ReferenceATan);
+	CheckKernel(*this, TEXT("ATan full range"), BitPatternSamples<float>(Random), 3, ATan, ReferenceATan);
+	CheckKernel(*this, TEXT("ATan special values"), TArray<float>({ NaN, -Inf, Inf, 0.0f, -0.0f, 1e30f, -1e30f, 1e-30f }), 3, ATan, ReferenceATan);
+
+	CheckKernel(*this, TEXT("ATan2"), UniformSamples(Random, -2.0f, 2.0f), UniformSamples(Random, -2.0f, 2.0f), 3, ATan2, ReferenceATan2);
+	CheckKernel(*this, TEXT("ATan2 full range"), BitPatternSamples<float>(Random), BitPatternSamples<float>(Random), 3, ATan2, ReferenceATan2);
+	CheckKernel(*this, TEXT("ATan2 special values"),
+		TArray<float>({ 0.0f, -0.0f, 0.0f, -0.0f, 1.0f, -1.0f, 0.0f, 0.0f, -0.0f, Inf, Inf, -Inf, -Inf, 1.0f, 1.0f, -1.0f, Inf, -Inf, NaN, 1.0f, 1e-30f, 1e30f }),
+		TArray<float>({ 0.0f, 0.0f, -0.0f, -0.0f, 0.0f, 0.0f, 1.0f, -1.0f, -1.0f, Inf, -Inf, Inf, -Inf, Inf, -Inf, -Inf, 1.0f, 1.0f, 1.0f, NaN, 1e30f, 1e-30f }),
+		3, ATan2, ReferenceATan2);
+
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVectorTranscendentalDoubleTest, "System.Core.Math.Vector Transcendentals.Double", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+bool FVectorTranscendentalDoubleTest::RunTest(const FString& Parameters)
+{
+	using namespace UE::Math::VectorTranscendentalTest;
+
+	const double Inf = std::numeric_limits<double>::infinity();
+	const double NaN = std::numeric_limits<double>::quiet_NaN();
+	const double MinDenormal = std::numeric_limits<double>::denorm_min();
+	FRandomStream Random(0x5EED);
+
+	CheckKernel(*this, TEXT("Exp"), UniformSamples(Random, -746.0, 710.0), 1, Exp, ReferenceExp);
+	CheckKernel(*this, TEXT("Exp full range"), BitPatternSamples<double>(Random), 1, Exp, ReferenceExp);
+	CheckKernel(*this, TEXT("Exp special values"), TArray<double>({ NaN, -Inf, Inf, 0.0, -0.0, 709.78, 709.79, -708.4, -745.13, -745.2 }), 1, Exp, ReferenceExp);
+
+	CheckKernel(*this, TEXT("Exp2"), UniformSamples(Random, -1075.0, 1024.0), 2, Exp2, ReferenceExp2);
+	CheckKernel(*this, TEXT("Exp2 full range"), BitPatternSamples<double>(Random), 2, Exp2, ReferenceExp2);
+	CheckKernel(*this, TEXT("Exp2 special values"), TArray<double>({ NaN, -Inf, Inf, 0.0, -0.0, 1023.99, 1024.0, -1022.5, -1074.0, -1075.0 }), 2, Exp2, ReferenceExp2);
+
+	CheckKernel(*this, TEXT("Log"), UniformSamples(Random, 0.0, 4.0), 1, Log, ReferenceLog);
+	CheckKernel(*this, TEXT("Log full range"), BitPatternSamples<double>(Random, [](double X) { return X >= 0.0; }), 1, Log, ReferenceLog);
+	CheckKernel(*this, TEXT("Log special values"), TArray<double>({ NaN, -Inf, Inf, 0.0, -0.0, -1.0, 1.0, MinDenormal, DBL_MIN, DBL_MAX }), 1, Log, ReferenceLog);
+
+	CheckKernel(*this, TEXT("Log2"), UniformSamples(Random, 0.0, 4.0), 2, Log2, ReferenceLog2);
+	CheckKernel(*this, TEXT("Log2 full range"), BitPatternSamples<double>(Random, [](double X) { return X >= 0.0; }), 2, Log2, ReferenceLog2);
+	CheckKernel(*this, TEXT("Log2 special values"), TArray<double>({ NaN, -Inf, Inf, 0.0, -0.0, -1.0, 1.0, MinDenormal, DBL_MIN, DBL_MAX }), 2, Log2, ReferenceLog2);
+
+	// Arguments above 2^26 fall back to the scalar FMath::Tan.
+	CheckKernel(*this, TEXT("Tan"), UniformSamples(Random, -67108864.0, 67108864.0), 2, Tan, ReferenceTan);
+	CheckKernel(*this, TEXT("Tan full range"), BitPatternSamples<double>(Random), 2, Tan, ReferenceTan);
+	CheckKernel(*this, TEXT("Tan special values"), TArray<double>({ NaN, -Inf, Inf, 0.0, -0.0, 1e-300, 67108864.0, 67108865.0, 1e300 }), 2, Tan, ReferenceTan);
+
+	CheckKernel(*this, TEXT("ASin"), UniformSamples(Random, -1.0, 1.0), 2, ASin, ReferenceASin);
+	CheckKernel(*this, TEXT("ASin full range"), BitPatternSamples<double>(Random, [](double X) { return FMath::Abs(X) <= 1.0; }), 2, ASin, ReferenceASin);
+	CheckKernel(*this, TEXT("ASin special values"), TArray<double>({ NaN, -Inf, Inf, 0.0, -0.0, 1.0, -1.0, 1.0000000000000002, -1.5, 1e-300 }), 2, ASin, ReferenceASin);
+
+	CheckKernel(*this, TEXT("ACos"), UniformSamples(Random, -1.0, 1.0), 1, ACos, ReferenceACos);
+	CheckKernel(*this, TEXT("ACos full range"), BitPatternSamples<double>(Random, [](double X) { return FMath::Abs(X) <= 1.0; }), 1, ACos, ReferenceACos);
+	CheckKernel(*this, TEXT("ACos special values"), TArray<double>({ NaN, -Inf, Inf, 0.0, -0.0, 1.0, -1.0, 1.0000000000000002, -1.5, 1e-300 }), 1, ACos, ReferenceACos);
+
+	CheckKernel(*this, TEXT("ATan"), UniformSamples(Random, -16.0, 16.0), 1, ATan, ReferenceATan);
+	CheckKernel(*this, TEXT("ATan full range"), BitPatternSamples<double>(Random), 1, ATan, ReferenceATan);
+	CheckKernel(*this, TEXT("ATan special values"), TArray<double>({ NaN, -Inf, Inf, 0.0, -0.0, 1e300, -1e300, 1e-300 }), 1, ATan, ReferenceATan);
+
+	CheckKernel(*this, TEXT("ATan2"), UniformSamples(Random, -2.0, 2.0), UniformSamples(Random, -2.0, 2.0), 2, ATan2, ReferenceATan2);
+	CheckKernel(*this, TEXT("ATan2 full range"), BitPatternSamples<double>(Random), BitPatternSamples<double>(Random), 2, ATan2, ReferenceATan2);
+	CheckKernel(*this, TEXT("ATan2 special values"),
+		TArray<double>({ 0.0, -0.0, 0.0, -0.0, 1.0, -1.0, 0.0, 0.0, -0.0, Inf, Inf, -Inf, -Inf, 1.0, 1.0, -1.0, Inf, -Inf, NaN, 1.0, 1e-300, 1e300 }),
+		TArray<double>({ 0.0, 0.0, -0.0, -0.0, 0.0, 0.0, 1.0, -1.0, -1.0, Inf, -Inf, Inf, -Inf, Inf, -Inf, -Inf, 1.0, 1.0, 1.0, NaN, 1e300, 1e-300 }),
+		2, ATan2, ReferenceATan2);
+
+	return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -1585,6 +1585,39 @@ FORCEINLINE void VectorDeinterleave(VectorRegister4Double& RESTRICT OutEvens, Ve
 	OutOdds = VectorShuffle(Lo, Hi, 1, 3, 1, 3);
 }
 
+/**
+ * Transposes the 4x4 matrix held in the given rows, so that afterwards Row0 holds the first component of each of the
+ * original rows, Row1 the second and so on. Turns four XYZW vectors into XXXX, YYYY, ZZZZ, WWWW and back.
+ *
+ * @param Row0	[X0, Y0, Z0, W0] in, [X0, X1, X2, X3] out
+ * @param Row1	[X1, Y1, Z1, W1] in, [Y0, Y1, Y2, Y3] out
+ * @param Row2	[X2, Y2, Z2, W2] in, [Z0, Z1, Z2, Z3] out
+ * @param Row3	[X3, Y3, Z3, W3] in, [W0, W1, W2, W3] out
+ */
+FORCEINLINE void VectorTranspose4x4(VectorRegister4Float& RESTRICT Row0, VectorRegister4Float& RESTRICT Row1, VectorRegister4Float& RESTRICT Row2, VectorRegister4Float& RESTRICT Row3)
+{
+	const float64x2_t XZ01 = vreinterpretq_f64_f32(vtrn1q_f32(Row0, Row1));
+	const float64x2_t YW01 = vreinterpretq_f64_f32(vtrn2q_f32(Row0, Row1));
+	const float64x2_t XZ23 = vreinterpretq_f64_f32(vtrn1q_f32(Row2, Row3));
+	const float64x2_t YW23 = vreinterpretq_f64_f32(vtrn2q_f32(Row2, Row3));
+	Row0 = vreinterpretq_f32_f64(vtrn1q_f64(XZ01, XZ23));
+	Row1 = vreinterpretq_f32_f64(vtrn1q_f64(YW01, YW23));
+	Row2 = vreinterpretq_f32_f64(vtrn2q_f64(XZ01, XZ23));
+	Row3 = vreinterpretq_f32_f64(vtrn2q_f64(YW01, YW23));
+}
+
+FORCEINLINE void VectorTranspose4x4(VectorRegister4Double& RESTRICT Row0, VectorRegister4Double& RESTRICT Row1, VectorRegister4Double& RESTRICT Row2, VectorRegister4Double& RESTRICT Row3)
+{
+	const VectorRegister4Double In0 = Row0;
+	const VectorRegister4Double In1 = Row1;
+	const VectorRegister4Double In2 = Row2;
+	const VectorRegister4Double In3 = Row3;
+	Row0 = VectorRegister4Double(vzip1q_f64(In0.XY, In1.XY), vzip1q_f64(In2.XY, In3.XY));
+	Row1 = VectorRegister4Double(vzip2q_f64(In0.XY, In1.XY), vzip2q_f64(In2.XY, In3.XY));
+	Row2 = VectorRegister4Double(vzip1q_f64(In0.ZW, In1.ZW), vzip1q_f64(In2.ZW, In3.ZW));
+	Row3 = VectorRegister4Double(vzip2q_f64(In0.ZW, In1.ZW), vzip2q_f64(In2.ZW, In3.ZW));
+}
+
 /**
  * Calculates the cross product of two vectors (XYZ components). W of the input should be 0, and will remain 0.
  *
@@ -1627,17 +1660,137 @@ FORCEINLINE VectorRegister4Float VectorPow( const VectorRegister4Float& Base, co
 	return MakeVectorRegister( powf(B.F[0], E.F[0]), powf(B.F[1], E.F[1]), powf(B.F[2], E.F[2]), powf(B.F[3], E.F[3]) );
 }
 
+// Zeroes the low word of each double, used for the exact Hi/Lo splits in VectorPowImpl.
+FORCEINLINE float64x2_t VectorTruncateLowBitsImpl(float64x2_t V)
+{
+	return vreinterpretq_f64_u64(vandq_u64(vreinterpretq_u64_f64(V), vdupq_n_u64(0xFFFFFFFF00000000ull)));
+}
+
+// 2^N for integral N in [-1022, 1023], built directly in the exponent field.
+FORCEINLINE float64x2_t VectorPow2Impl(float64x2_t N)
+{
+	return vreinterpretq_f64_s64(vshlq_n_s64(vaddq_s64(vcvtq_s64_f64(N), vdupq_n_s64(1023)), 52));
+}
+
+// fdlibm e_pow.c on one pair of doubles, within 1 ulp of libm pow. log2(|X|) and Y * log2(|X|) are kept as Hi + Lo pairs,
+// only the polynomial steps use fused multiply-add since the pair splits need separately rounded products.
+FORCEINLINE float64x2_t VectorPowImpl(float64x2_t X, float64x2_t Y)
+{
+	const float64x2_t One = vdupq_n_f64(1.0);
+	const float64x2_t Zero = vdupq_n_f64(0.0);
+	const float64x2_t Inf = vreinterpretq_f64_u64(vdupq_n_u64(0x7FF0000000000000ull));
+	const float64x2_t AbsX = vabsq_f64(X);
+
+	// |X| = 2^N * M, M in [1, 2). Subnormals are brought into the normal range first.
+	const uint64x2_t IsSubnormal = vcltq_f64(AbsX, vdupq_n_f64(2.2250738585072014e-308));
+	const uint64x2_t Bits = vreinterpretq_u64_f64(vbslq_f64(IsSubnormal, vmulq_f64(AbsX, vdupq_n_f64(9007199254740992.0 /* 2^53 */)), AbsX));
+	float64x2_t N = vcvtq_f64_s64(vsubq_s64(vreinterpretq_s64_u64(vshrq_n_u64(Bits, 52)), vdupq_n_s64(1023)));
+	N = vsubq_f64(N, vbslq_f64(IsSubnormal, vdupq_n_f64(53.0), Zero));
+	float64x2_t M = vreinterpretq_f64_u64(vorrq_u64(vandq_u64(Bits, vdupq_n_u64(0x000FFFFFFFFFFFFFull)), vdupq_n_u64(0x3FF0000000000000ull)));
+
+	// Reduce M around 1 or 1.5: M < sqrt(3/2) uses 1, M < sqrt(3) uses 1.5, otherwise M / 2 around 1.
+	const uint64x2_t IsHigh = vcgeq_f64(M, vdupq_n_f64(1.7320508075688772));
+	const uint64x2_t IsMid = vandq_u64(vcgtq_f64(M, vdupq_n_f64(1.2247448713915890)), vcltq_f64(M, vdupq_n_f64(1.7320508075688772)));
+	M = vbslq_f64(IsHigh, vmulq_f64(M, vdupq_n_f64(0.5)), M);
+	N = vaddq_f64(N, vbslq_f64(IsHigh, One, Zero));
+	const float64x2_t BP = vbslq_f64(IsMid, vdupq_n_f64(1.5), One);
+	const float64x2_t DPHi = vbslq_f64(IsMid, vdupq_n_f64(5.84962487220764160156e-01), Zero);
+	const float64x2_t DPLo = vbslq_f64(IsMid, vdupq_n_f64(1.35003920212974897128e-08), Zero);
+
+	// SS = SHi + SLo = (M - BP) / (M + BP)
+	const float64x2_t U0 = vsubq_f64(M, BP);
+	const float64x2_t V0 = vdivq_f64(One, vaddq_f64(M, BP));
+	const float64x2_t SS = vmulq_f64(U0, V0);
+	const float64x2_t SHi = VectorTruncateLowBitsImpl(SS);
+	const float64x2_t THi0 = VectorTruncateLowBitsImpl(vaddq_f64(M, BP));
+	const float64x2_t TLo0 = vsubq_f64(M, vsubq_f64(THi0, BP));
+	const float64x2_t SLo = vmulq_f64(V0, vsubq_f64(vsubq_f64(U0, vmulq_f64(SHi, THi0)), vmulq_f64(SHi, TLo0)));
+
+	// log(M / BP) = 2 * SS + 2/3 * SS^3 + ...
+	float64x2_t S2 = vmulq_f64(SS, SS);
+	float64x2_t R = vfmaq_f64(vdupq_n_f64(2.30660745775561754067e-01), S2, vdupq_n_f64(2.06975017800338417784e-01));
+	R = vfmaq_f64(vdupq_n_f64(2.72728123808534006489e-01), S2, R);
+	R = vfmaq_f64(vdupq_n_f64(3.33333329818377432918e-01), S2, R);
+	R = vfmaq_f64(vdupq_n_f64(4.28571428578550184252e-01), S2, R);
+	R = vfmaq_f64(vdupq_n_f64(5.99999999999994648725e-01), S2, R);
+	R = vmulq_f64(vmulq_f64(S2, S2), R);
+	R = vaddq_f64(R, vmulq_f64(SLo, vaddq_f64(SHi, SS)));
+	S2 = vmulq_f64(SHi, SHi);
+	const float64x2_t THi1 = VectorTruncateLowBitsImpl(vaddq_f64(vaddq_f64(vdupq_n_f64(3.0), S2), R));
+	const float64x2_t TLo1 = vsubq_f64(R, vsubq_f64(vsubq_f64(THi1, vdupq_n_f64(3.0)), S2));
+
+	// PHi + PLo = SS * (3 + SS^2 + R)
+	const float64x2_t U1 = vmulq_f64(SHi, THi1);
+	const float64x2_t V1 = vaddq_f64(vmulq_f64(SLo, THi1), vmulq_f64(TLo1, SS));
+	const float64x2_t PHi0 = VectorTruncateLowBitsImpl(vaddq_f64(U1, V1));
+	const float64x2_t PLo0 = vsubq_f64(V1, vsubq_f64(PHi0, U1));
+
+	// log2(|X|) = N + DPHi + ZHi + ZLo = THi + TLo, scaled by 2/(3 ln2) split into hi/lo parts.
+	const float64x2_t ZHi = vmulq_f64(vdupq_n_f64(9.61796700954437255859e-01), PHi0);
+	const float64x2_t ZLo = vaddq_f64(vaddq_f64(vmulq_f64(vdupq_n_f64(-7.02846165095275826516e-09), PHi0), vmulq_f64(PLo0, vdupq_n_f64(9.61796693925975554329e-01))), DPLo);
+	const float64x2_t THi = VectorTruncateLowBitsImpl(vaddq_f64(vaddq_f64(vaddq_f64(ZHi, ZLo), DPHi), N));
+	const float64x2_t TLo = vsubq_f64(ZLo, vsubq_f64(vsubq_f64(vsubq_f64(THi, N), DPHi), ZHi));
+
+	// PHi + PLo = Y * log2(|X|), with Y split so YHi * THi is exact.
+	const float64x2_t YHi = VectorTruncateLowBitsImpl(Y);
+	const float64x2_t PLo = vaddq_f64(vmulq_f64(vsubq_f64(Y, YHi), THi), vmulq_f64(Y, TLo));
+	const float64x2_t PHi = vmulq_f64(YHi, THi);
+	const float64x2_t Z = vaddq_f64(PLo, PHi);
+
+	// Decide overflow/underflow on the extended product, the rounded sum alone can sit exactly on the boundary.
+	const float64x2_t ZMinusPHi = vsubq_f64(Z, PHi);
+	const uint64x2_t IsOverflow = vorrq_u64(vcgtq_f64(Z, vdupq_n_f64(1024.0)),
+		vandq_u64(vceqq_f64(Z, vdupq_n_f64(1024.0)), vcgtq_f64(vaddq_f64(PLo, vdupq_n_f64(8.0085662595372944372e-17)), ZMinusPHi)));
+	const uint64x2_t IsUnderflow = vorrq_u64(vcltq_f64(Z, vdupq_n_f64(-1075.0)),
+		vandq_u64(vceqq_f64(Z, vdupq_n_f64(-1075.0)), vcleq_f64(PLo, ZMinusPHi)));
+
+	// 2^(PHi + PLo) = 2^K * exp((PHi - K + PLo) * ln2), K integral and |PHi - K| <= 1/2. Clamping keeps K inside the scaling range,
+	// the lanes it affects are replaced by the overflow/underflow results below.
+	const float64x2_t K = vrndnq_f64(vmaxq_f64(vdupq_n_f64(-1076.0), vminq_f64(vdupq_n_f64(1025.0), Z)));
+	const float64x2_t PHiReduced = vsubq_f64(PHi, K);
+	const float64x2_t T = VectorTruncateLowBitsImpl(vaddq_f64(PLo, PHiReduced));
+	const float64x2_t U2 = vmulq_f64(T, vdupq_n_f64(6.93147182464599609375e-01));
+	const float64x2_t V2 = vaddq_f64(vmulq_f64(vsubq_f64(PLo, vsubq_f64(T, PHiReduced)), vdupq_n_f64(6.93147180559945286227e-01)), vmulq_f64(T, vdupq_n_f64(-1.90465429995776804525e-09)));
+	const float64x2_t E = vaddq_f64(U2, V2);
+	const float64x2_t W = vsubq_f64(V2, vsubq_f64(E, U2));
+
+	const float64x2_t EE = vmulq_f64(E, E);
+	float64x2_t P = vfmaq_f64(vdupq_n_f64(-1.65339022054652515390e-06), EE, vdupq_n_f64(4.13813679705723846039e-08));
+	P = vfmaq_f64(vdupq_n_f64(6.61375632143793436117e-05), EE, P);
+	P = vfmaq_f64(vdupq_n_f64(-2.77777777770155933842e-03), EE, P);
+	P = vfmaq_f64(vdupq_n_f64(1.66666666666666019037e-01), EE, P);
+	const float64x2_t C = vfmsq_f64(E, EE, P);
+
+	// 1 - ((E * C / (C - 2) - (W + E * W)) - E), scaled by 2^K in two steps so every intermediate power of two stays normal.
+	const float64x2_t RC = vsubq_f64(vdivq_f64(vmulq_f64(E, C), vsubq_f64(C, vdupq_n_f64(2.0))), vaddq_f64(W, vmulq_f64(E, W)));
+	const float64x2_t K1 = vrndnq_f64(vmulq_f64(K, vdupq_n_f64(0.5)));
+	float64x2_t Result = vmulq_f64(vmulq_f64(vsubq_f64(One, vsubq_f64(RC, E)), VectorPow2Impl(K1)), VectorPow2Impl(vsubq_f64(K, K1)));
+	Result = vbslq_f64(IsOverflow, Inf, Result);
+	Result = vbslq_f64(IsUnderflow, Zero, Result);
+
+	// |X| or |Y| infinite or X zero: +inf when |X| > 1 and Y > 0 or |X| < 1 and Y < 0, +0 otherwise, 1 for |X| == 1.
+	const uint64x2_t IsExtreme = vorrq_u64(vorrq_u64(vceqq_f64(vabsq_f64(Y), Inf), vceqq_f64(AbsX, Inf)), vceqq_f64(AbsX, Zero));
+	const float64x2_t ExtremeResult = vbslq_f64(vceqq_f64(AbsX, One), One, vbslq_f64(veorq_u64(vcgtq_f64(AbsX, One), vcleq_f64(Y, Zero)), Inf, Zero));
+	Result = vbslq_f64(IsExtreme, ExtremeResult, Result);
+
+	// Negative X (including -0 and -inf) keeps its sign for odd integral Y, finite negative X with non-integral Y is NaN.
+	const uint64x2_t IsIntegral = vceqq_f64(vrndnq_f64(Y), Y);
+	const float64x2_t HalfY = vmulq_f64(Y, vdupq_n_f64(0.5));
+	const uint64x2_t IsOdd = vbicq_u64(IsIntegral, vceqq_f64(vrndnq_f64(HalfY), HalfY));
+	const uint64x2_t SignBit = vandq_u64(vandq_u64(vreinterpretq_u64_f64(X), vdupq_n_u64(0x8000000000000000ull)), IsOdd);
+	Result = vreinterpretq_f64_u64(veorq_u64(vreinterpretq_u64_f64(Result), SignBit));
+
+	const uint64x2_t IsNegativeFinite = vandq_u64(vcltq_f64(X, Zero), vcltq_f64(AbsX, Inf));
+	const uint64x2_t IsValid = vbicq_u64(vandq_u64(vceqq_f64(X, X), vceqq_f64(Y, Y)), vbicq_u64(IsNegativeFinite, IsIntegral));
+	Result = vbslq_f64(IsValid, Result, vreinterpretq_f64_u64(vdupq_n_u64(0x7FF8000000000000ull)));
+
+	// X^0 and 1^Y are 1, even when the other operand is NaN.
+	return vbslq_f64(vorrq_u64(vceqq_f64(Y, Zero), vceqq_f64(X, One)), One, Result);
+}
+
 FORCEINLINE VectorRegister4Double VectorPow(const VectorRegister4Double& Base, const VectorRegister4Double& Exponent)
 {
-	//@TODO: Optimize this
-	AlignedDouble4 Values(Base);
-	AlignedDouble4 Exponents(Exponent);
-
-	Values[0] = FMath::Pow(Values[0], Exponents[0]);
-	Values[1] = FMath::Pow(Values[1], Exponents[1]);
-	Values[2] = FMath::Pow(Values[2], Exponents[2]);
-	Values[3] = FMath::Pow(Values[3], Exponents[3]);
-	return Values.ToVectorRegister();
+	return VectorRegister4Double(VectorPowImpl(Base.XY, Exponent.XY), VectorPowImpl(Base.ZW, Exponent.ZW));
 }
 
 /**
@@ -1979,6 +2132,102 @@ FORCEINLINE void VectorMatrixMultiply(FMatrix44d* Result, const FMatrix44d* Matr
 	vst1q_f64_x4((double*)Result + 8, R);
 }
 
+// 2x2 block helpers for VectorMatrixInverseImpl. A 2x2 matrix is stored row major in one register as (m00, m01, m10, m11).
+
+// A * B
+template<typename RegisterType>
+FORCEINLINE RegisterType Matrix2x2MultiplyImpl(const RegisterType& A, const RegisterType& B)
+{
+	return VectorMultiplyAdd(A, VectorSwizzle(B, 0, 3, 0, 3), VectorMultiply(VectorSwizzle(A, 1, 0, 3, 2), VectorSwizzle(B, 2, 1, 2, 1)));
+}
+
+// adj(A) * B
+template<typename RegisterType>
+FORCEINLINE RegisterType Matrix2x2AdjMultiplyImpl(const RegisterType& A, const RegisterType& B)
+{
+	return VectorSubtract(VectorMultiply(VectorSwizzle(A, 3, 3, 0, 0), B), VectorMultiply(VectorSwizzle(A, 1, 1, 2, 2), VectorSwizzle(B, 2, 3, 0, 1)));
+}
+
+// A * adj(B)
+template<typename RegisterType>
+FORCEINLINE RegisterType Matrix2x2MultiplyAdjImpl(const RegisterType& A, const RegisterType& B)
+{
+	return VectorSubtract(VectorMultiply(A, VectorSwizzle(B, 3, 0, 3, 0)), VectorMultiply(VectorSwizzle(A, 1, 0, 3, 2), VectorSwizzle(B, 2, 1, 2, 1)));
+}
+
+/**
+ * Inverts a 4x4 matrix through its 2x2 blocks (M = [A B; C D]), shared by the float and double VectorMatrixInverse.
+ * Matches FMath::MatrixInverse: a zero or non-finite determinant stores identity and returns false.
+ */
+template<typename ScalarType, typename MatrixType>
+FORCEINLINE bool VectorMatrixInverseImpl(MatrixType* DstMatrix, const MatrixType* SrcMatrix)
+{
+	typedef ScalarType Scalar4x4[4][4];
+	const Scalar4x4& SrcRows = *((const Scalar4x4*)SrcMatrix);
+	Scalar4x4& DstRows = *((Scalar4x4*)DstMatrix);
+
+	typedef decltype(VectorLoad(SrcRows[0])) RegisterType;
+	const RegisterType Row0 = VectorLoad(SrcRows[0]);
+	const RegisterType Row1 = VectorLoad(SrcRows[1]);
+	const RegisterType Row2 = VectorLoad(SrcRows[2]);
+	const RegisterType Row3 = VectorLoad(SrcRows[3]);
+
+	const RegisterType A = VectorShuffle(Row0, Row1, 0, 1, 0, 1);
+	const RegisterType B = VectorShuffle(Row0, Row1, 2, 3, 2, 3);
+	const RegisterType C = VectorShuffle(Row2, Row3, 0, 1, 0, 1);
+	const RegisterType D = VectorShuffle(Row2, Row3, 2, 3, 2, 3);
+
+	// (|A|, |B|, |C|, |D|)
+	const RegisterType DetSub = VectorSubtract(
+		VectorMultiply(VectorShuffle(Row0, Row2, 0, 2, 0, 2), VectorShuffle(Row1, Row3, 1, 3, 1, 3)),
+		VectorMultiply(VectorShuffle(Row0, Row2, 1, 3, 1, 3), VectorShuffle(Row1, Row3, 0, 2, 0, 2)));
+	const RegisterType DetA = VectorReplicate(DetSub, 0);
+	const RegisterType DetB = VectorReplicate(DetSub, 1);
+	const RegisterType DetC = VectorReplicate(DetSub, 2);
+	const RegisterType DetD = VectorReplicate(DetSub, 3);
+
+	const RegisterType D_C = Matrix2x2AdjMultiplyImpl(D, C);
+	const RegisterType A_B = Matrix2x2AdjMultiplyImpl(A, B);
+
+	// Adjugates of the blocks of the inverse, inv(M) = 1/|M| * [X Y; Z W]
+	RegisterType X_ = VectorSubtract(VectorMultiply(DetD, A), Matrix2x2MultiplyImpl(B, D_C));
+	RegisterType W_ = VectorSubtract(VectorMultiply(DetA, D), Matrix2x2MultiplyImpl(C, A_B));
+	RegisterType Y_ = VectorSubtract(VectorMultiply(DetB, C), Matrix2x2MultiplyAdjImpl(D, A_B));
+	RegisterType Z_ = VectorSubtract(VectorMultiply(DetC, B), Matrix2x2MultiplyAdjImpl(A, D_C));
+
+	// |M| = |A||D| + |B||C| - tr(adj(A) B adj(D) C)
+	RegisterType Trace = VectorMultiply(A_B, VectorSwizzle(D_C, 0, 2, 1, 3));
+	Trace = VectorAdd(Trace, VectorSwizzle(Trace, 2, 3, 0, 1));
+	Trace = VectorAdd(Trace, VectorSwizzle(Trace, 1, 0, 3, 2));
+	const RegisterType DetM = VectorSubtract(VectorMultiplyAdd(DetB, DetC, VectorMultiply(DetA, DetD)), Trace);
+
+	// Same rejection as FMath::MatrixInverse
+	ScalarType Det;
+	VectorStoreFloat1(DetM, &Det);
+	if (Det == ScalarType(0) || !FMath::IsFinite(Det))
+	{
+		VectorStore(MakeVectorRegister(ScalarType(1), ScalarType(0), ScalarType(0), ScalarType(0)), DstRows[0]);
+		VectorStore(MakeVectorRegister(ScalarType(0), ScalarType(1), ScalarType(0), ScalarType(0)), DstRows[1]);
+		VectorStore(MakeVectorRegister(ScalarType(0), ScalarType(0), ScalarType(1), ScalarType(0)), DstRows[2]);
+		VectorStore(MakeVectorRegister(ScalarType(0), ScalarType(0), ScalarType(0), ScalarType(1)), DstRows[3]);
+		return false;
+	}
+
+	// The adjugate sign pattern is folded into the reciprocal: (1, -1, -1, 1) / |M|
+	const RegisterType RcpDetM = VectorDivide(MakeVectorRegister(ScalarType(1), ScalarType(-1), ScalarType(-1), ScalarType(1)), DetM);
+	X_ = VectorMultiply(X_, RcpDetM);
+	Y_ = VectorMultiply(Y_, RcpDetM);
+	Z_ = VectorMultiply(Z_, RcpDetM);
+	W_ = VectorMultiply(W_, RcpDetM);
+
+	// Undo the adjugate swizzle and reassemble the rows in one shuffle each.
+	VectorStore(VectorShuffle(X_, Y_, 3, 1, 3, 1), DstRows[0]);
+	VectorStore(VectorShuffle(X_, Y_, 2, 0, 2, 0), DstRows[1]);
+	VectorStore(VectorShuffle(Z_, W_, 3, 1, 3, 1), DstRows[2]);
+	VectorStore(VectorShuffle(Z_, W_, 2, 0, 2, 0), DstRows[3]);
+	return true;
+}
+
 /**
  * Calculate the inverse of an FMatrix44.  Src == Dst is allowed
  *
@@ -1989,11 +2238,11 @@ FORCEINLINE void VectorMatrixMultiply(FMatrix44d* Result, const FMatrix44d* Matr
  */
 FORCEINLINE bool VectorMatrixInverse(FMatrix44d* DstMatrix, const FMatrix44d* SrcMatrix)
 {
-	return FMath::MatrixInverse(DstMatrix,SrcMatrix);
+	return VectorMatrixInverseImpl<double>(DstMatrix, SrcMatrix);
 }
 FORCEINLINE bool VectorMatrixInverse(FMatrix44f* DstMatrix, const FMatrix44f* SrcMatrix)
 {
-	return FMath::MatrixInverse(DstMatrix,SrcMatrix);
+	return VectorMatrixInverseImpl<float>(DstMatrix, SrcMatrix);
 }
 
 /**
@@ -2056,6 +2305,151 @@ FORCEINLINE VectorRegister4Double VectorTransformVector(const VectorRegister4Dou
 	return Result;
 }
 
+/**
+ * Transforms an array of homogeneous vectors by one matrix, Dst[i] = Src[i] * MatrixM.
+ * Same result as calling VectorTransformVector per element, with the matrix rows loaded once. Dst == Src is allowed.
+ *
+ * @param Dst			Array of Count vectors receiving the result
+ * @param Src			Array of Count vectors to transform
+ * @param Count			Number of vectors
+ * @param MatrixM		FMatrix pointer to the Matrix to apply transform
+ */
+inline void VectorTransformVectorArray(VectorRegister4Float* Dst, const VectorRegister4Float* Src, int32 Count, const FMatrix44f* MatrixM)
+{
+	const float32x4x4_t M = vld1q_f32_x4((const float*)MatrixM);
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const VectorRegister4Float V = Src[Index];
+		VectorRegister4Float Result = vmulq_laneq_f32(M.val[0], V, 0);
+		Result = vfmaq_laneq_f32(Result, M.val[1], V, 1);
+		Result = vfmaq_laneq_f32(Result, M.val[2], V, 2);
+		Result = vfmaq_laneq_f32(Result, M.val[3], V, 3);
+		Dst[Index] = Result;
+	}
+}
+
+inline void VectorTransformVectorArray(VectorRegister4Double* Dst, const VectorRegister4Double* Src, int32 Count, const FMatrix44d* MatrixM)
+{
+	const float64x2x4_t M1 = vld1q_f64_x4((const double*)MatrixM);
+	const float64x2x4_t M2 = vld1q_f64_x4(((const double*)MatrixM) + 8);
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const VectorRegister4Double V = Src[Index];
+		VectorRegister4Double Result;
+		Result.XY = vmulq_laneq_f64(M1.val[0], V.XY, 0);
+		Result.XY = vfmaq_laneq_f64(Result.XY, M1.val[2], V.XY, 1);
+		Result.XY = vfmaq_laneq_f64(Result.XY, M2.val[0], V.ZW, 0);
+		Result.XY = vfmaq_laneq_f64(Result.XY, M2.val[2], V.ZW, 1);
+
+		Result.ZW = vmulq_laneq_f64(M1.val[1], V.XY, 0);
+		Result.ZW = vfmaq_laneq_f64(Result.ZW, M1.val[3], V.XY, 1);
+		Result.ZW = vfmaq_laneq_f64(Result.ZW, M2.val[1], V.ZW, 0);
+		Result.ZW = vfmaq_laneq_f64(Result.ZW, M2.val[3], V.ZW, 1);
+		Dst[Index] = Result;
+	}
+}
+
+template<typename ScalarType>
+FORCEINLINE void VectorTransformVectorSoAImpl(const ScalarType (&M)[4][4], ScalarType* OutX, ScalarType* OutY, ScalarType* OutZ, ScalarType* OutW, const ScalarType* InX, const ScalarType* InY, const ScalarType* InZ, ScalarType InW, int32 Count)
+{
+	typedef decltype(VectorSetFloat1(InW)) RegisterType;
+	RegisterType Rows[3][4];
+	RegisterType Offset[4];
+	for (int32 Column = 0; Column < 4; ++Column)
+	{
+		Rows[0][Column] = VectorSetFloat1(M[0][Column]);
+		Rows[1][Column] = VectorSetFloat1(M[1][Column]);
+		Rows[2][Column] = VectorSetFloat1(M[2][Column]);
+		Offset[Column] = VectorSetFloat1(InW * M[3][Column]);
+	}
+
+	int32 Index = 0;
+	for (; Index + 4 <= Count; Index += 4)
+	{
+		const RegisterType X = VectorLoad(InX + Index);
+		const RegisterType Y = VectorLoad(InY + Index);
+		const RegisterType Z = VectorLoad(InZ + Index);
+		VectorStore(VectorMultiplyAdd(Z, Rows[2][0], VectorMultiplyAdd(Y, Rows[1][0], VectorMultiplyAdd(X, Rows[0][0], Offset[0]))), OutX + Index);
+		VectorStore(VectorMultiplyAdd(Z, Rows[2][1], VectorMultiplyAdd(Y, Rows[1][1], VectorMultiplyAdd(X, Rows[0][1], Offset[1]))), OutY + Index);
+		VectorStore(VectorMultiplyAdd(Z, Rows[2][2], VectorMultiplyAdd(Y, Rows[1][2], VectorMultiplyAdd(X, Rows[0][2], Offset[2]))), OutZ + Index);
+		if (OutW)
+		{
+			VectorStore(VectorMultiplyAdd(Z, Rows[2][3], VectorMultiplyAdd(Y, Rows[1][3], VectorMultiplyAdd(X, Rows[0][3], Offset[3]))), OutW + Index);
+		}
+	}
+
+	for (; Index < Count; ++Index)
+	{
+		const ScalarType X = InX[Index];
+		const ScalarType Y = InY[Index];
+		const ScalarType Z = InZ[Index];
+		OutX[Index] = X * M[0][0] + Y * M[1][0] + Z * M[2][0] + InW * M[3][0];
+		OutY[Index] = X * M[0][1] + Y * M[1][1] + Z * M[2][1] + InW * M[3][1];
+		OutZ[Index] = X * M[0][2] + Y * M[1][2] + Z * M[2][2] + InW * M[3][2];
+		if (OutW)
+		{
+			OutW[Index] = X * M[0][3] + Y * M[1][3] + Z * M[2][3] + InW * M[3][3];
+		}
+	}
+}
+
+/**
+ * Transforms Count vectors stored as structure of arrays by one matrix, (OutX, OutY, OutZ, OutW)[i] = (InX, InY, InZ, InW)[i] * MatrixM.
+ * Pass InW = 1 to transform positions and InW = 0 for directions. OutW may be nullptr to skip it,
+ * and OutX/OutY/OutZ may alias the matching inputs.
+ *
+ * @param MatrixM		FMatrix pointer to the Matrix to apply transform
+ * @param OutX			Receives Count transformed X components
+ * @param OutY			Receives Count transformed Y components
+ * @param OutZ			Receives Count transformed Z components
+ * @param OutW			Receives Count transformed W components (or nullptr)
+ * @param InX			Count source X components
+ * @param InY			Count source Y components
+ * @param InZ			Count source Z components
+ * @param InW			W component shared by all source vectors
+ * @param Count			Number of vectors
+ */
+inline void VectorTransformVectorSoA(const FMatrix44f* MatrixM, float* OutX, float* OutY, float* OutZ, float* OutW, const float* InX, const float* InY, const float* InZ, float InW, int32 Count)
+{
+	typedef float Float4x4[4][4];
+	VectorTransformVectorSoAImpl(*((const Float4x4*)MatrixM), OutX, OutY, OutZ, OutW, InX, InY, InZ, InW, Count);
+}
+
+inline void VectorTransformVectorSoA(const FMatrix44d* MatrixM, double* OutX, double* OutY, double* OutZ, double* OutW, const double* InX, const double* InY, const double* InZ, double InW, int32 Count)
+{
+	typedef double Double4x4[4][4];
+	VectorTransformVectorSoAImpl(*((const Double4x4*)MatrixM), OutX, OutY, OutZ, OutW, InX, InY, InZ, InW, Count);
+}
+
+template<typename MatrixType, typename ScalarType>
+FORCEINLINE void VectorMatrixMultiplyArrayImpl(MatrixType* Result, const MatrixType* Matrix1, const MatrixType* Matrix2, int32 Count)
+{
+	// The matrix types are incomplete here, step through them as arrays of 16 scalars.
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		VectorMatrixMultiply((MatrixType*)((ScalarType*)Result + Index * 16), (const MatrixType*)((const ScalarType*)Matrix1 + Index * 16), (const MatrixType*)((const ScalarType*)Matrix2 + Index * 16));
+	}
+}
+
+/**
+ * Multiplies Count pairs of 4x4 matrices, Result[i] = Matrix1[i] * Matrix2[i].
+ * Result[i] may alias Matrix1[i] or Matrix2[i].
+ *
+ * @param Result	Array of Count matrices receiving the products
+ * @param Matrix1	Array of Count left hand side matrices
+ * @param Matrix2	Array of Count right hand side matrices
+ * @param Count		Number of matrix pairs
+ */
+inline void VectorMatrixMultiplyArray(FMatrix44f* Result, const FMatrix44f* Matrix1, const FMatrix44f* Matrix2, int32 Count)
+{
+	VectorMatrixMultiplyArrayImpl<FMatrix44f, float>(Result, Matrix1, Matrix2, Count);
+}
+
+inline void VectorMatrixMultiplyArray(FMatrix44d* Result, const FMatrix44d* Matrix1, const FMatrix44d* Matrix2, int32 Count)
+{
+	VectorMatrixMultiplyArrayImpl<FMatrix44d, double>(Result, Matrix1, Matrix2, Count);
+}
+
 /**
  * Returns the minimum values of two vectors (component-wise).
  *
@@ -2218,6 +2612,70 @@ FORCEINLINE void VectorStoreHalf4(VectorRegister4Float Vec, void* RESTRICT Ptr)
 	}
 }
 
+/**
+ * Loads 4 fp16 values from unaligned memory and converts them into 4 FLOATs.
+ *
+ * @param Ptr			Unaligned memory pointer to the 4 fp16's.
+ * @return				VectorRegister4Float with 4 FLOATs loaded from Ptr.
+ */
+FORCEINLINE VectorRegister4Float VectorLoadHalf4(const void* Ptr)
+{
+	return vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16((const uint16_t*)Ptr)));
+}
+
+/**
+ * Converts an array of floats to fp16 (round to nearest even), e.g. Count = 4 * NumPixels for FFloat16Color.
+ * Converts 8 values per iteration.
+ *
+ * @param Dst			Unaligned destination of Count fp16's, must not overlap Src.
+ * @param Src			Unaligned source of Count floats.
+ * @param Count			Number of values to convert.
+ */
+inline void VectorFloatToHalfArray(uint16* RESTRICT Dst, const float* RESTRICT Src, int32 Count)
+{
+	int32 Index = 0;
+	for (; Index + 8 <= Count; Index += 8)
+	{
+		const float16x8_t Half = vcvt_high_f16_f32(vcvt_f16_f32(vld1q_f32(Src + Index)), vld1q_f32(Src + Index + 4));
+		vst1q_u16((uint16_t*)(Dst + Index), vreinterpretq_u16_f16(Half));
+	}
+	for (; Index + 4 <= Count; Index += 4)
+	{
+		vst1_u16((uint16_t*)(Dst + Index), vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(Src + Index))));
+	}
+	for (; Index < Count; ++Index)
+	{
+		vst1_lane_u16((uint16_t*)(Dst + Index), vreinterpret_u16_f16(vcvt_f16_f32(vdupq_n_f32(Src[Index]))), 0);
+	}
+}
+
+/**
+ * Converts an array of fp16 values to floats, e.g. Count = 4 * NumPixels for FFloat16Color.
+ * Converts 8 values per iteration.
+ *
+ * @param Dst			Unaligned destination of Count floats, must not overlap Src.
+ * @param Src			Unaligned source of Count fp16's.
+ * @param Count			Number of values to convert.
+ */
+inline void VectorHalfToFloatArray(float* RESTRICT Dst, const uint16* RESTRICT Src, int32 Count)
+{
+	int32 Index = 0;
+	for (; Index + 8 <= Count; Index += 8)
+	{
+		const float16x8_t Half = vreinterpretq_f16_u16(vld1q_u16((const uint16_t*)(Src + Index)));
+		vst1q_f32(Dst + Index, vcvt_f32_f16(vget_low_f16(Half)));
+		vst1q_f32(Dst + Index + 4, vcvt_high_f32_f16(Half));
+	}
+	for (; Index + 4 <= Count; Index += 4)
+	{
+		vst1q_f32(Dst + Index, VectorLoadHalf4(Src + Index));
+	}
+	for (; Index < Count; ++Index)
+	{
+		Dst[Index] = vgetq_lane_f32(vcvt_f32_f16(vreinterpret_f16_u16(vdup_n_u16(Src[Index]))), 0);
+	}
+}
+
 /**
 * Loads packed RGB10A2(4 bytes) from unaligned memory and converts them into 4 FLOATs.
 * IMPORTANT: You need to call VectorResetFloatRegisters() before using scalar FLOATs after you've used this intrinsic!
@@ -2477,6 +2935,144 @@ inline bool VectorContainsNaNOrInfinite(const VectorRegister4Double& Vec)
 	return vgetq_lane_u32((uint32x4_t)vqtbx2q_u8(ZeroVec, *(uint8x16x2_t*)&InfTestRes, Table), 0) != 0;
 }
 
+/** What a buffer scan such as VectorScanNonFiniteArray found: how many values were flagged and where the first one is. */
+struct FVectorScanResult
+{
+	/** Number of flagged values */
+	int32 NumFound = 0;
+	/** Index of the first flagged value, -1 when nothing was flagged */
+	int32 FirstIndex = -1;
+};
+
+// Adds the flagged values of the block starting at Index to Result, bit N of Bits standing for element Index + N.
+FORCEINLINE void VectorAddScanHitsImpl(FVectorScanResult& Result, int32 Index, uint64 Bits)
+{
+	if (Result.FirstIndex < 0)
+	{
+		Result.FirstIndex = Index + int32(FMath::CountTrailingZeros64(Bits));
+	}
+	Result.NumFound += int32(FMath::CountBits(Bits));
+}
+
+FORCEINLINE VectorRegister4Float VectorLoadScanImpl(const float* Src)
+{
+	return vld1q_f32(Src);
+}
+
+FORCEINLINE VectorRegister4Float VectorLoadScanImpl(const uint16* Src)
+{
+	return VectorLoadHalf4(Src);
+}
+
+// All ones in the lanes outside [MinValue, MaxValue], NaNs fail both compares.
+FORCEINLINE uint32x4_t VectorOutOfRangeMaskImpl(const VectorRegister4Float& Value, const VectorRegister4Float& MinValue, const VectorRegister4Float& MaxValue)
+{
+	return vmvnq_u32(vandq_u32(vcgeq_f32(Value, MinValue), vcleq_f32(Value, MaxValue)));
+}
+
+// Clean blocks of 16 cost one horizontal max, lane bits are only gathered for blocks with hits.
+template<typename ScalarType>
+inline FVectorScanResult VectorScanOutOfRangeArrayImpl(const ScalarType* Src, int32 Count, float MinValue, float MaxValue)
+{
+	FVectorScanResult Result;
+	const VectorRegister4Float Min = vdupq_n_f32(MinValue);
+	const VectorRegister4Float Max = vdupq_n_f32(MaxValue);
+	const uint32x4_t LaneBits = vreinterpretq_u32_s32(MakeVectorRegisterIntConstant(1, 2, 4, 8));
+	int32 Index = 0;
+	for (; Index + 16 <= Count; Index += 16)
+	{
+		const uint32x4_t Mask0 = VectorOutOfRangeMaskImpl(VectorLoadScanImpl(Src + Index + 0), Min, Max);
+		const uint32x4_t Mask1 = VectorOutOfRangeMaskImpl(VectorLoadScanImpl(Src + Index + 4), Min, Max);
+		const uint32x4_t Mask2 = VectorOutOfRangeMaskImpl(VectorLoadScanImpl(Src + Index + 8), Min, Max);
+		const uint32x4_t Mask3 = VectorOutOfRangeMaskImpl(VectorLoadScanImpl(Src + Index + 12), Min, Max);
+		if (vmaxvq_u32(vorrq_u32(vorrq_u32(Mask0, Mask1), vorrq_u32(Mask2, Mask3))) != 0)
+		{
+			VectorAddScanHitsImpl(Result, Index, uint64(vaddvq_u32(vandq_u32(Mask0, LaneBits)))
+				| (uint64(vaddvq_u32(vandq_u32(Mask1, LaneBits))) << 4)
+				| (uint64(vaddvq_u32(vandq_u32(Mask2, LaneBits))) << 8)
+				| (uint64(vaddvq_u32(vandq_u32(Mask3, LaneBits))) << 12));
+		}
+	}
+	for (; Index < Count; Index += 4)
+	{
+		uint64 Bits;
+		if (Index + 4 <= Count)
+		{
+			Bits = vaddvq_u32(vandq_u32(VectorOutOfRangeMaskImpl(VectorLoadScanImpl(Src + Index), Min, Max), LaneBits));
+		}
+		else
+		{
+			ScalarType Tail[4] = {};
+			for (int32 Lane = 0; Index + Lane < Count; ++Lane)
+			{
+				Tail[Lane] = Src[Index + Lane];
+			}
+			Bits = vaddvq_u32(vandq_u32(VectorOutOfRangeMaskImpl(VectorLoadScanImpl(Tail), Min, Max), LaneBits)) & ((uint64(1) << (Count - Index)) - 1);
+		}
+		if (Bits)
+		{
+			VectorAddScanHitsImpl(Result, Index, Bits);
+		}
+	}
+	return Result;
+}
+
+// Largest finite float, used as the bounds that flag infinities along with NaNs.
+constexpr float VectorScanFiniteMax = 3.402823466e+38f;
+
+/**
+ * Scans a float buffer for NaNs and values outside [MinValue, MaxValue]. Infinities are flagged unless the range includes
+ * them.
+ *
+ * @param Src		Unaligned source of Count floats
+ * @param Count		Number of values to scan
+ * @param MinValue	Smallest accepted value
+ * @param MaxValue	Largest accepted value
+ * @return			Number of flagged values and the index of the first one
+ */
+inline FVectorScanResult VectorScanOutOfRangeArray(const float* Src, int32 Count, float MinValue, float MaxValue)
+{
+	return VectorScanOutOfRangeArrayImpl(Src, Count, MinValue, MaxValue);
+}
+
+/**
+ * Scans an fp16 buffer for NaNs and values outside [MinValue, MaxValue], see VectorScanOutOfRangeArray.
+ *
+ * @param Src		Unaligned source of Count fp16's
+ * @param Count		Number of values to scan
+ * @param MinValue	Smallest accepted value
+ * @param MaxValue	Largest accepted value
+ * @return			Number of flagged values and the index of the first one
+ */
+inline FVectorScanResult VectorScanOutOfRangeHalfArray(const uint16* Src, int32 Count, float MinValue, float MaxValue)
+{
+	return VectorScanOutOfRangeArrayImpl(Src, Count, MinValue, MaxValue);
+}
+
+/**
+ * Buffer version of VectorContainsNaNOrInfinite: counts the NaN and infinite values in a float buffer.
+ *
+ * @param Src		Unaligned source of Count floats
+ * @param Count		Number of values to scan
+ * @return			Number of NaN and infinite values and the index of the first one
+ */
+inline FVectorScanResult VectorScanNonFiniteArray(const float* Src, int32 Count)
+{
+	return VectorScanOutOfRangeArrayImpl(Src, Count, -VectorScanFiniteMax, VectorScanFiniteMax);
+}
+
+/**
+ * Counts the NaN and infinite values in an fp16 buffer.
+ *
+ * @param Src		Unaligned source of Count fp16's
+ * @param Count		Number of values to scan
+ * @return			Number of NaN and infinite values and the index of the first one
+ */
+inline FVectorScanResult VectorScanNonFiniteHalfArray(const uint16* Src, int32 Count)
+{
+	return VectorScanOutOfRangeArrayImpl(Src, Count, -VectorScanFiniteMax, VectorScanFiniteMax);
+}
+
 //TODO: Vectorize
 FORCEINLINE VectorRegister4Float VectorExp(const VectorRegister4Float& X)
 {
@@ -2755,10 +3351,188 @@ FORCEINLINE VectorRegister4Double VectorCos(const VectorRegister4Double& X)
 	return Doubles.ToVectorRegister();
 }
 
+// Unsigned 64 x 64 -> 128 bit multiply, returns the high word.
+FORCEINLINE uint64 VectorMultiplyHigh64Impl(uint64 A, uint64 B, uint64& OutLow)
+{
+	const uint64 LoLo = (A & 0xFFFFFFFFull) * (B & 0xFFFFFFFFull);
+	const uint64 HiLo = (A >> 32) * (B & 0xFFFFFFFFull);
+	const uint64 LoHi = (A & 0xFFFFFFFFull) * (B >> 32);
+	const uint64 Cross = (LoLo >> 32) + (HiLo & 0xFFFFFFFFull) + LoHi;
+	OutLow = (Cross << 32) | (LoLo & 0xFFFFFFFFull);
+	return (A >> 32) * (B >> 32) + (HiLo >> 32) + (Cross >> 32);
+}
+
+// Payne-Hanek reduction for a finite X > 2^26, same fixed point scheme as the SSE backend:
+// returns Z + OutTail = X - (4M + OutQuadrant) * pi/2 with |Z| <= pi/4.
+inline double VectorPayneHanekReduceImpl(double X, int32& OutQuadrant, double& OutTail)
+{
+	// Binary digits of 2/pi, the leading zero word is its integer part.
+	static constexpr uint64 TwoOverPi[] =
+	{
+		0x0000000000000000ull, 0xa2f9836e4e441529ull, 0xfc2757d1f534ddc0ull, 0xdb6295993c439041ull,
+		0xfe5163abdebbc561ull, 0xb7246e3a424dd2e0ull, 0x06492eea09d1921cull, 0xfe1deb1cb129a73eull,
+		0xe88235f52ebb4484ull, 0xe99c7026b45f7e41ull, 0x3991d639835339f4ull, 0x9c845f8bbdf9283bull,
+		0x1ff897ffde05980full, 0xef2f118b5a0a6d1full, 0x6d367ecf27cb09b7ull, 0x4f463f669e5fea2dull,
+		0x7527bac7ebe5f17bull, 0x3d0739f78a5292eaull, 0x6bfb5fb11f8d5d08ull, 0x56033046fc7b6babull,
+		0xf0cfbc209af4361dull,
+	};
+
+	// pi/2 * 2^126
+	static constexpr uint64 PiOver2Hi = 0x6487ed5110b4611aull;
+	static constexpr uint64 PiOver2Lo = 0x62633145c06e0e68ull;
+
+	const uint64 Bits = vgetq_lane_u64(vreinterpretq_u64_f64(vdupq_n_f64(X)), 0);
+	const int32 Exponent = int32((Bits >> 52) & 0x7FF) - 1075;
+	const uint64 Mantissa = (Bits & 0x000FFFFFFFFFFFFFull) | (1ull << 52);
+
+	// Window of 2/pi starting at weight 2^(2 - Exponent), the product's top three bits are the integer part mod 8.
+	const int32 Digit = (Exponent + 61) >> 6;
+	const int32 Shift = (Exponent + 61) & 63;
+	uint64 Window[3];
+	for (int32 Index = 0; Index < 3; ++Index)
+	{
+		Window[Index] = Shift ? (TwoOverPi[Digit + Index] << Shift) | (TwoOverPi[Digit + Index + 1] >> (64 - Shift)) : TwoOverPi[Digit + Index];
+	}
+
+	uint64 Ignored, Mid;
+	const uint64 Carry = VectorMultiplyHigh64Impl(Window[2], Mantissa, Ignored);
+	const uint64 MidHi = VectorMultiplyHigh64Impl(Window[1], Mantissa, Mid);
+	Mid += Carry;
+	const uint64 Top = Window[0] * Mantissa + MidHi + (Mid < Carry ? 1 : 0);
+
+	// Round to the nearest quadrant, a fraction >= 1/2 becomes the negative distance to the next one.
+	uint32 Quadrant = uint32(Top >> 61);
+	uint64 FracHi = (Top << 3) | (Mid >> 61);
+	uint64 FracLo = Mid << 3;
+	const bool bNegative = (FracHi >> 63) != 0;
+	if (bNegative)
+	{
+		++Quadrant;
+		FracLo = ~FracLo + 1;
+		FracHi = ~FracHi + (FracLo == 0 ? 1 : 0);
+	}
+	OutQuadrant = int32(Quadrant & 3);
+
+	int32 LeadingZeros = 0;
+	if (FracHi == 0)
+	{
+		FracHi = FracLo;
+		FracLo = 0;
+		LeadingZeros = 64;
+	}
+	if (FracHi == 0)
+	{
+		OutTail = 0.0;
+		return 0.0;
+	}
+	int32 Normalize = int32(FMath::CountLeadingZeros64(FracHi));
+	if (Normalize)
+	{
+		FracHi = (FracHi << Normalize) | (FracLo >> (64 - Normalize));
+		FracLo <<= Normalize;
+	}
+	LeadingZeros += Normalize;
+
+	// Z = Fraction * pi/2 on the top 128 bits of the product, then split into two exact 53 bit halves.
+	uint64 ZLo;
+	uint64 ZHi = VectorMultiplyHigh64Impl(FracHi, PiOver2Hi, ZLo);
+	uint64 CrossLo;
+	const uint64 Cross = VectorMultiplyHigh64Impl(FracHi, PiOver2Lo, CrossLo) + VectorMultiplyHigh64Impl(FracLo, PiOver2Hi, CrossLo);
+	ZLo += Cross;
+	ZHi += (ZLo < Cross ? 1 : 0);
+	Normalize = int32(FMath::CountLeadingZeros64(ZHi));
+	ZHi = (ZHi << Normalize) | (ZLo >> (64 - Normalize));
+	ZLo <<= Normalize;
+	LeadingZeros += Normalize;
+
+	const double Scale = vgetq_lane_f64(vreinterpretq_f64_u64(vdupq_n_u64(uint64(1023 - 104 - LeadingZeros) << 52)), 0);
+	const double Z = double(int64(ZHi >> 11)) * (Scale * 9007199254740992.0 /* 2^53 */);
+	const double Tail = double(int64(((ZHi & 0x7FF) << 42) | (ZLo >> 22))) * Scale;
+	OutTail = bNegative ? -Tail : Tail;
+	return bNegative ? -Z : Z;
+}
+
+// sin and cos of one pair of doubles from a single reduction X = K * pi/2 + Z + Y, fdlibm __kernel_sin / __kernel_cos on Z + Y.
+// Cody-Waite with a four-part pi/2 up to 2^26, Payne-Hanek per lane beyond.
+FORCEINLINE void VectorSinCosImpl(float64x2_t X, float64x2_t& OutSin, float64x2_t& OutCos)
+{
+	const float64x2_t AbsX = vabsq_f64(X);
+	const float64x2_t Limit = vdupq_n_f64(67108864.0);
+
+	// The first three parts of pi/2 carry 26 significant bits, two-sums keep the rounding errors of the middle steps.
+	float64x2_t K = vrndnq_f64(vmulq_f64(vminq_f64(AbsX, Limit), vdupq_n_f64(6.36619772367581382433e-01)));
+	const float64x2_t D = vfmsq_f64(AbsX, K, vdupq_n_f64(1.5707963407039642));
+	const float64x2_t P2 = vmulq_f64(K, vdupq_n_f64(1.3909067675399456e-08));
+	const float64x2_t H2 = vaddq_f64(D, P2);
+	const float64x2_t B2 = vsubq_f64(H2, D);
+	const float64x2_t E2 = vaddq_f64(vsubq_f64(D, vsubq_f64(H2, B2)), vsubq_f64(P2, B2));
+	const float64x2_t P3 = vmulq_f64(K, vdupq_n_f64(-6.123233932053594e-17));
+	const float64x2_t H3 = vaddq_f64(H2, P3);
+	const float64x2_t B3 = vsubq_f64(H3, H2);
+	const float64x2_t E3 = vaddq_f64(vsubq_f64(H2, vsubq_f64(H3, B3)), vsubq_f64(P3, B3));
+	const float64x2_t Tail = vfmsq_f64(vaddq_f64(E2, E3), K, vdupq_n_f64(6.36831716351095e-25));
+	float64x2_t Z = vaddq_f64(H3, Tail);
+	float64x2_t Y = vsubq_f64(Tail, vsubq_f64(Z, H3));
+
+	const uint64x2_t IsLarge = vandq_u64(vcgtq_f64(AbsX, Limit), vcltq_f64(AbsX, vreinterpretq_f64_u64(vdupq_n_u64(0x7FF0000000000000ull))));
+	if (vgetq_lane_u64(IsLarge, 0) | vgetq_lane_u64(IsLarge, 1))
+	{
+		int32 Quadrant;
+		double Tail0, Tail1;
+		if (vgetq_lane_u64(IsLarge, 0))
+		{
+			Z = vsetq_lane_f64(VectorPayneHanekReduceImpl(vgetq_lane_f64(AbsX, 0), Quadrant, Tail0), Z, 0);
+			Y = vsetq_lane_f64(Tail0, Y, 0);
+			K = vsetq_lane_f64(double(Quadrant), K, 0);
+		}
+		if (vgetq_lane_u64(IsLarge, 1))
+		{
+			Z = vsetq_lane_f64(VectorPayneHanekReduceImpl(vgetq_lane_f64(AbsX, 1), Quadrant, Tail1), Z, 1);
+			Y = vsetq_lane_f64(Tail1, Y, 1);
+			K = vsetq_lane_f64(double(Quadrant), K, 1);
+		}
+	}
+
+	// AbsX - AbsX is NaN exactly for Inf/NaN inputs.
+	Z = vaddq_f64(Z, vsubq_f64(AbsX, AbsX));
+
+	const float64x2_t ZZ = vmulq_f64(Z, Z);
+	const float64x2_t ZZZ = vmulq_f64(ZZ, Z);
+	const float64x2_t Half = vdupq_n_f64(0.5);
+
+	float64x2_t S = vfmaq_f64(vdupq_n_f64(-2.50507602534068634195e-08), ZZ, vdupq_n_f64(1.58969099521155010221e-10));
+	S = vfmaq_f64(vdupq_n_f64(2.75573137070700676789e-06), ZZ, S);
+	S = vfmaq_f64(vdupq_n_f64(-1.98412698298579493134e-04), ZZ, S);
+	S = vfmaq_f64(vdupq_n_f64(8.33333333332248946124e-03), ZZ, S);
+	S = vmulq_f64(ZZ, vfmsq_f64(vmulq_f64(Half, Y), ZZZ, S));
+	S = vsubq_f64(Z, vfmsq_f64(vsubq_f64(S, Y), ZZZ, vdupq_n_f64(-1.66666666666666324348e-01)));
+
+	float64x2_t C = vfmaq_f64(vdupq_n_f64(2.08757232129817482790e-09), ZZ, vdupq_n_f64(-1.13596475577881948265e-11));
+	C = vfmaq_f64(vdupq_n_f64(-2.75573143513906633035e-07), ZZ, C);
+	C = vfmaq_f64(vdupq_n_f64(2.48015872894767294178e-05), ZZ, C);
+	C = vfmaq_f64(vdupq_n_f64(-1.38888888888741095749e-03), ZZ, C);
+	C = vfmaq_f64(vdupq_n_f64(4.16666666666666019037e-02), ZZ, C);
+	C = vfmsq_f64(vmulq_f64(vmulq_f64(ZZ, ZZ), C), Z, Y);
+	const float64x2_t One = vdupq_n_f64(1.0);
+	const float64x2_t HalfZZ = vmulq_f64(ZZ, Half);
+	const float64x2_t W = vsubq_f64(One, HalfZZ);
+	C = vaddq_f64(W, vaddq_f64(vsubq_f64(vsubq_f64(One, W), HalfZZ), C));
+
+	// Quadrant K mod 4: odd quadrants swap sin and cos, quadrants 2 and 3 negate sin, quadrants 1 and 2 negate cos.
+	const int64x2_t Quadrant = vcvtq_s64_f64(K);
+	const uint64x2_t IsOdd = vtstq_s64(Quadrant, vdupq_n_s64(1));
+	const uint64x2_t NegateSin = vtstq_s64(Quadrant, vdupq_n_s64(2));
+	const uint64x2_t SignBit = vdupq_n_u64(0x8000000000000000ull);
+	const uint64x2_t SinSign = veorq_u64(vandq_u64(NegateSin, SignBit), vandq_u64(vreinterpretq_u64_f64(X), SignBit));
+	const uint64x2_t CosSign = vandq_u64(veorq_u64(IsOdd, NegateSin), SignBit);
+	OutSin = vreinterpretq_f64_u64(veorq_u64(vreinterpretq_u64_f64(vbslq_f64(IsOdd, C, S)), SinSign));
+	OutCos = vreinterpretq_f64_u64(veorq_u64(vreinterpretq_u64_f64(vbslq_f64(IsOdd, S, C)), CosSign));
+}
+
 FORCEINLINE void VectorSinCos(VectorRegister4Double* RESTRICT VSinAngles, VectorRegister4Double* RESTRICT VCosAngles, const VectorRegister4Double* RESTRICT VAngles)
 {
-	*VSinAngles = VectorSin(*VAngles);
-	*VCosAngles = VectorCos(*VAngles);
+	VectorSinCosImpl(VAngles->XY, VSinAngles->XY, VCosAngles->XY);
+	VectorSinCosImpl(VAngles->ZW, VSinAngles->ZW, VCosAngles->ZW);
 }
 
 /**
@@ -2823,6 +3597,1703 @@ FORCEINLINE void VectorStoreURGBA16N(const VectorRegister4Float& Vec, uint16* Ou
 	Out[3] = (uint16)F[3];
 }
 
+/**
+ * Array versions of the packed pixel loads and stores above, with the same signatures as the SSE ones.
+ * Each pixel goes through the per-pixel function, so the results are bit-identical to it. Floats are 4 per pixel.
+ *
+ * @param Dst			Unaligned destination, must not overlap Src.
+ * @param Src			Unaligned source.
+ * @param NumPixels		Number of pixels to convert.
+ */
+inline void VectorLoadByte4Array(float* RESTRICT Dst, const void* RESTRICT Src, int32 NumPixels)
+{
+	for (int32 Index = 0; Index < NumPixels; ++Index)
+	{
+		VectorStore(VectorLoadByte4((const uint8*)Src + Index * 4), Dst + Index * 4);
+	}
+}
+
+inline void VectorStoreByte4Array(void* RESTRICT Dst, const float* RESTRICT Src, int32 NumPixels)
+{
+	for (int32 Index = 0; Index < NumPixels; ++Index)
+	{
+		VectorStoreByte4(VectorLoad(Src + Index * 4), (uint8*)Dst + Index * 4);
+	}
+}
+
+inline void VectorLoadURGB10A2NArray(float* RESTRICT Dst, const void* RESTRICT Src, int32 NumPixels)
+{
+	for (int32 Index = 0; Index < NumPixels; ++Index)
+	{
+		VectorStore(VectorLoadURGB10A2N((uint32*)Src + Index), Dst + Index * 4);
+	}
+}
+
+inline void VectorStoreURGB10A2NArray(void* RESTRICT Dst, const float* RESTRICT Src, int32 NumPixels)
+{
+	for (int32 Index = 0; Index < NumPixels; ++Index)
+	{
+		VectorStoreURGB10A2N(VectorLoad(Src + Index * 4), (uint32*)Dst + Index);
+	}
+}
+
+inline void VectorLoadURGBA16NArray(float* RESTRICT Dst, const void* RESTRICT Src, int32 NumPixels)
+{
+	for (int32 Index = 0; Index < NumPixels; ++Index)
+	{
+		VectorStore(VectorLoadURGBA16N((const uint16*)Src + Index * 4), Dst + Index * 4);
+	}
+}
+
+inline void VectorLoadSRGBA16NArray(float* RESTRICT Dst, const void* RESTRICT Src, int32 NumPixels)
+{
+	for (int32 Index = 0; Index < NumPixels; ++Index)
+	{
+		VectorStore(VectorLoadSRGBA16N((const int16*)Src + Index * 4), Dst + Index * 4);
+	}
+}
+
+inline void VectorStoreURGBA16NArray(void* RESTRICT Dst, const float* RESTRICT Src, int32 NumPixels)
+{
+	for (int32 Index = 0; Index < NumPixels; ++Index)
+	{
+		VectorStoreURGBA16N(VectorLoad(Src + Index * 4), (uint16*)Dst + Index * 4);
+	}
+}
+
+// The fp16 variants run the float converters on blocks that stay in L1.
+constexpr int32 VectorPackedHalfBlockPixels = 64;
+
+template<typename LoadArrayType>
+FORCEINLINE void VectorLoadPackedHalfArrayImpl(uint16* RESTRICT Dst, const uint8* RESTRICT Src, int32 PixelSize, int32 NumPixels, LoadArrayType LoadArray)
+{
+	float Block[VectorPackedHalfBlockPixels * 4];
+	for (int32 Index = 0; Index < NumPixels; Index += VectorPackedHalfBlockPixels)
+	{
+		const int32 BlockPixels = FMath::Min(VectorPackedHalfBlockPixels, NumPixels - Index);
+		LoadArray(Block, Src + Index * PixelSize, BlockPixels);
+		VectorFloatToHalfArray(Dst + Index * 4, Block, BlockPixels * 4);
+	}
+}
+
+template<typename StoreArrayType>
+FORCEINLINE void VectorStorePackedHalfArrayImpl(uint8* RESTRICT Dst, const uint16* RESTRICT Src, int32 PixelSize, int32 NumPixels, StoreArrayType StoreArray)
+{
+	float Block[VectorPackedHalfBlockPixels * 4];
+	for (int32 Index = 0; Index < NumPixels; Index += VectorPackedHalfBlockPixels)
+	{
+		const int32 BlockPixels = FMath::Min(VectorPackedHalfBlockPixels, NumPixels - Index);
+		VectorHalfToFloatArray(Block, Src + Index * 4, BlockPixels * 4);
+		StoreArray(Dst + Index * PixelSize, Block, BlockPixels);
+	}
+}
+
+inline void VectorLoadByte4HalfArray(uint16* RESTRICT Dst, const void* RESTRICT Src, int32 NumPixels)
+{
+	VectorLoadPackedHalfArrayImpl(Dst, (const uint8*)Src, 4, NumPixels, &VectorLoadByte4Array);
+}
+
+inline void VectorStoreByte4HalfArray(void* RESTRICT Dst, const uint16* RESTRICT Src, int32 NumPixels)
+{
+	VectorStorePackedHalfArrayImpl((uint8*)Dst, Src, 4, NumPixels, &VectorStoreByte4Array);
+}
+
+inline void VectorLoadURGB10A2NHalfArray(uint16* RESTRICT Dst, const void* RESTRICT Src, int32 NumPixels)
+{
+	VectorLoadPackedHalfArrayImpl(Dst, (const uint8*)Src, 4, NumPixels, &VectorLoadURGB10A2NArray);
+}
+
+inline void VectorStoreURGB10A2NHalfArray(void* RESTRICT Dst, const uint16* RESTRICT Src, int32 NumPixels)
+{
+	VectorStorePackedHalfArrayImpl((uint8*)Dst, Src, 4, NumPixels, &VectorStoreURGB10A2NArray);
+}
+
+inline void VectorLoadURGBA16NHalfArray(uint16* RESTRICT Dst, const void* RESTRICT Src, int32 NumPixels)
+{
+	VectorLoadPackedHalfArrayImpl(Dst, (const uint8*)Src, 8, NumPixels, &VectorLoadURGBA16NArray);
+}
+
+inline void VectorLoadSRGBA16NHalfArray(uint16* RESTRICT Dst, const void* RESTRICT Src, int32 NumPixels)
+{
+	VectorLoadPackedHalfArrayImpl(Dst, (const uint8*)Src, 8, NumPixels, &VectorLoadSRGBA16NArray);
+}
+
+inline void VectorStoreURGBA16NHalfArray(void* RESTRICT Dst, const uint16* RESTRICT Src, int32 NumPixels)
+{
+	VectorStorePackedHalfArrayImpl((uint8*)Dst, Src, 8, NumPixels, &VectorStoreURGBA16NArray);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// bfloat16 arrays
+//
+// Same results as the SSE backend: narrowing flushes denormals to zero and rounds to nearest even, widening is exact.
+
+FORCEINLINE uint32x4_t VectorFlushDenormalsImpl(const uint32x4_t& Bits)
+{
+	const uint32x4_t IsDenormal = vceqq_u32(vandq_u32(Bits, vdupq_n_u32(0x7F800000)), vdupq_n_u32(0));
+	return vbicq_u32(Bits, vandq_u32(IsDenormal, vdupq_n_u32(0x7FFFFFFF)));
+}
+
+// NaNs are quieted and keep their top payload bits, like bfcvtn.
+FORCEINLINE uint16x4_t VectorFloatToBFloat16Impl(const float32x4_t& Vec)
+{
+	const uint32x4_t Bits = VectorFlushDenormalsImpl(vreinterpretq_u32_f32(Vec));
+	const uint32x4_t Odd = vandq_u32(vshrq_n_u32(Bits, 16), vdupq_n_u32(1));
+	const uint32x4_t Rounded = vaddq_u32(Bits, vaddq_u32(Odd, vdupq_n_u32(0x7FFF)));
+	const uint32x4_t IsNaN = vcgtq_u32(vandq_u32(Bits, vdupq_n_u32(0x7FFFFFFF)), vdupq_n_u32(0x7F800000));
+	return vshrn_n_u32(vbslq_u32(IsNaN, vorrq_u32(Bits, vdupq_n_u32(0x00400000)), Rounded), 16);
+}
+
+FORCEINLINE float32x4_t VectorBFloat16LoToFloatImpl(const uint16x8_t& Packed)
+{
+	return vreinterpretq_f32_u32(vshll_n_u16(vget_low_u16(Packed), 16));
+}
+
+FORCEINLINE float32x4_t VectorBFloat16HiToFloatImpl(const uint16x8_t& Packed)
+{
+	return vreinterpretq_f32_u32(vshll_high_n_u16(Packed, 16));
+}
+
+FORCEINLINE float VectorDotProductBFloat16Impl(const uint16* RESTRICT Row, const uint16* RESTRICT Vector, int32 NumColumns)
+{
+	float32x4_t Sum0 = vdupq_n_f32(0.0f);
+	float32x4_t Sum1 = vdupq_n_f32(0.0f);
+	int32 Column = 0;
+#if UE_PLATFORM_MATH_USE_NEON_BF16
+	// bfdot adds the products of each bfloat16 pair into one float lane.
+	for (; Column + 16 <= NumColumns; Column += 16)
+	{
+		Sum0 = vbfdotq_f32(Sum0, vld1q_bf16((const bfloat16_t*)(Row + Column)), vld1q_bf16((const bfloat16_t*)(Vector + Column)));
+		Sum1 = vbfdotq_f32(Sum1, vld1q_bf16((const bfloat16_t*)(Row + Column + 8)), vld1q_bf16((const bfloat16_t*)(Vector + Column + 8)));
+	}
+	if (Column + 8 <= NumColumns)
+	{
+		Sum0 = vbfdotq_f32(Sum0, vld1q_bf16((const bfloat16_t*)(Row + Column)), vld1q_bf16((const bfloat16_t*)(Vector + Column)));
+		Column += 8;
+	}
+#else
+	for (; Column + 8 <= NumColumns; Column += 8)
+	{
+		const uint16x8_t R = vld1q_u16((const uint16_t*)(Row + Column));
+		const uint16x8_t V = vld1q_u16((const uint16_t*)(Vector + Column));
+		Sum0 = vfmaq_f32(Sum0, VectorBFloat16LoToFloatImpl(R), VectorBFloat16LoToFloatImpl(V));
+		Sum1 = vfmaq_f32(Sum1, VectorBFloat16HiToFloatImpl(R), VectorBFloat16HiToFloatImpl(V));
+	}
+#endif
+	if (Column < NumColumns)
+	{
+		alignas(16) uint16 RowTail[8] = {};
+		alignas(16) uint16 VectorTail[8] = {};
+		for (int32 Tail = 0; Tail < NumColumns - Column; ++Tail)
+		{
+			RowTail[Tail] = Row[Column + Tail];
+			VectorTail[Tail] = Vector[Column + Tail];
+		}
+		const uint16x8_t R = vld1q_u16((const uint16_t*)RowTail);
+		const uint16x8_t V = vld1q_u16((const uint16_t*)VectorTail);
+		Sum0 = vfmaq_f32(Sum0, VectorBFloat16LoToFloatImpl(R), VectorBFloat16LoToFloatImpl(V));
+		Sum1 = vfmaq_f32(Sum1, VectorBFloat16HiToFloatImpl(R), VectorBFloat16HiToFloatImpl(V));
+	}
+	return vaddvq_f32(vaddq_f32(Sum0, Sum1));
+}
+
+/**
+ * Converts an array of floats to bfloat16 (the upper 16 bits of a float) with round-to-nearest-even.
+ * Denormals are flushed to signed zero and NaNs stay quiet NaNs. Converts 8 values per iteration.
+ *
+ * @param Dst			Unaligned destination of Count bfloat16's, must not overlap Src.
+ * @param Src			Unaligned source of Count floats.
+ * @param Count			Number of values to convert.
+ */
+inline void VectorFloatToBFloat16Array(uint16* RESTRICT Dst, const float* RESTRICT Src, int32 Count)
+{
+	int32 Index = 0;
+	for (; Index + 8 <= Count; Index += 8)
+	{
+#if UE_PLATFORM_MATH_USE_NEON_BF16
+		// bfcvtn honours FPCR.FZ, flushing first keeps the result independent of it.
+		const float32x4_t Lo = vreinterpretq_f32_u32(VectorFlushDenormalsImpl(vreinterpretq_u32_f32(vld1q_f32(Src + Index))));
+		const float32x4_t Hi = vreinterpretq_f32_u32(VectorFlushDenormalsImpl(vreinterpretq_u32_f32(vld1q_f32(Src + Index + 4))));
+		vst1q_u16((uint16_t*)(Dst + Index), vreinterpretq_u16_bf16(vcvtq_high_bf16_f32(vcvtq_low_bf16_f32(Lo), Hi)));
+#else
+		vst1q_u16((uint16_t*)(Dst + Index), vcombine_u16(VectorFloatToBFloat16Impl(vld1q_f32(Src + Index)), VectorFloatToBFloat16Impl(vld1q_f32(Src + Index + 4))));
+#endif
+	}
+	for (; Index + 4 <= Count; Index += 4)
+	{
+		vst1_u16((uint16_t*)(Dst + Index), VectorFloatToBFloat16Impl(vld1q_f32(Src + Index)));
+	}
+	for (; Index < Count; ++Index)
+	{
+		vst1_lane_u16((uint16_t*)(Dst + Index), VectorFloatToBFloat16Impl(vdupq_n_f32(Src[Index])), 0);
+	}
+}
+
+/**
+ * Converts an array of bfloat16 values to floats, exact. Converts 8 values per iteration.
+ *
+ * @param Dst			Unaligned destination of Count floats, must not overlap Src.
+ * @param Src			Unaligned source of Count bfloat16's.
+ * @param Count			Number of values to convert.
+ */
+inline void VectorBFloat16ToFloatArray(float* RESTRICT Dst, const uint16* RESTRICT Src, int32 Count)
+{
+	int32 Index = 0;
+	for (; Index + 8 <= Count; Index += 8)
+	{
+		const uint16x8_t Packed = vld1q_u16((const uint16_t*)(Src + Index));
+		vst1q_f32(Dst + Index, VectorBFloat16LoToFloatImpl(Packed));
+		vst1q_f32(Dst + Index + 4, VectorBFloat16HiToFloatImpl(Packed));
+	}
+	for (; Index < Count; ++Index)
+	{
+		Dst[Index] = vgetq_lane_f32(VectorBFloat16LoToFloatImpl(vdupq_n_u16(Src[Index])), 0);
+	}
+}
+
+/**
+ * Multiplies a row-major bfloat16 matrix by a bfloat16 vector: Result[Row] = sum of Matrix[Row][Column] * Vector[Column],
+ * accumulated in float. Uses bfdot when UE_PLATFORM_MATH_USE_NEON_BF16 is set, whose intermediate rounding differs from
+ * a plain multiply-add, so results may differ in the last bits from the other paths.
+ *
+ * @param Result		Destination of NumRows floats, must not overlap the inputs.
+ * @param Matrix		NumRows * NumColumns bfloat16's, row major without padding between rows.
+ * @param Vector		NumColumns bfloat16's.
+ * @param NumRows		Number of matrix rows.
+ * @param NumColumns	Number of matrix columns and vector elements.
+ */
+inline void VectorMatrixVectorMultiplyBFloat16(float* RESTRICT Result, const uint16* RESTRICT Matrix, const uint16* RESTRICT Vector, int32 NumRows, int32 NumColumns)
+{
+	for (int32 Row = 0; Row < NumRows; ++Row)
+	{
+		Result[Row] = VectorDotProductBFloat16Impl(Matrix + (SIZE_T)Row * NumColumns, Vector, NumColumns);
+	}
+}
+
+/**
+ * Dot product of two bfloat16 arrays, accumulated in float. Same precision as VectorMatrixVectorMultiplyBFloat16.
+ *
+ * @param A				Count bfloat16's.
+ * @param B				Count bfloat16's.
+ * @param Count			Number of elements.
+ * @return				Sum of A[i] * B[i].
+ */
+inline float VectorDotProductBFloat16(const uint16* A, const uint16* B, int32 Count)
+{
+	return VectorDotProductBFloat16Impl(A, B, Count);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Batched quaternion kernels
+//
+// Quaternions and vectors are stored as structure of arrays: every pointer array argument holds the X, Y, Z and W
+// component arrays (X, Y and Z for vectors). Same results as the SSE backend's 4-wide path.
+
+// Loads one SoA component of the 4 elements starting at Index, zero padded when fewer than 4 remain.
+template<typename ScalarType>
+FORCEINLINE decltype(VectorSetFloat1(ScalarType(0))) VectorLoadSoAImpl(const ScalarType* Src, int32 Index, int32 Count)
+{
+	if (Index + 4 <= Count)
+	{
+		return VectorLoad(Src + Index);
+	}
+	ScalarType Lanes[4] = {};
+	for (int32 Lane = 0; Index + Lane < Count; ++Lane)
+	{
+		Lanes[Lane] = Src[Index + Lane];
+	}
+	return VectorLoad(Lanes);
+}
+
+template<typename RegisterType, typename ScalarType>
+FORCEINLINE void VectorStoreSoAImpl(const RegisterType& Vec, ScalarType* Dst, int32 Index, int32 Count)
+{
+	if (Index + 4 <= Count)
+	{
+		VectorStore(Vec, Dst + Index);
+		return;
+	}
+	ScalarType Lanes[4];
+	VectorStore(Vec, Lanes);
+	for (int32 Lane = 0; Index + Lane < Count; ++Lane)
+	{
+		Dst[Index + Lane] = Lanes[Lane];
+	}
+}
+
+template<typename RegisterType, typename ScalarType>
+FORCEINLINE void VectorLoadQuaternionSoAImpl(RegisterType (&Out)[4], const ScalarType* const* Quat, int32 Index, int32 Count)
+{
+	Out[0] = VectorLoadSoAImpl(Quat[0], Index, Count);
+	Out[1] = VectorLoadSoAImpl(Quat[1], Index, Count);
+	Out[2] = VectorLoadSoAImpl(Quat[2], Index, Count);
+	Out[3] = VectorLoadSoAImpl(Quat[3], Index, Count);
+}
+
+template<typename RegisterType, typename ScalarType>
+FORCEINLINE void VectorStoreQuaternionSoAImpl(ScalarType* const* Quat, const RegisterType (&In)[4], int32 Index, int32 Count)
+{
+	VectorStoreSoAImpl(In[0], Quat[0], Index, Count);
+	VectorStoreSoAImpl(In[1], Quat[1], Index, Count);
+	VectorStoreSoAImpl(In[2], Quat[2], Index, Count);
+	VectorStoreSoAImpl(In[3], Quat[3], Index, Count);
+}
+
+// Each register holds one component of 4 quaternions.
+template<typename RegisterType>
+FORCEINLINE void VectorQuaternionMultiply4Impl(RegisterType (&Out)[4], const RegisterType (&A)[4], const RegisterType (&B)[4])
+{
+	Out[0] = VectorMultiplyAdd(A[3], B[0], VectorMultiplyAdd(A[0], B[3], VectorNegateMultiplyAdd(A[2], B[1], VectorMultiply(A[1], B[2]))));
+	Out[1] = VectorMultiplyAdd(A[3], B[1], VectorMultiplyAdd(A[1], B[3], VectorNegateMultiplyAdd(A[0], B[2], VectorMultiply(A[2], B[0]))));
+	Out[2] = VectorMultiplyAdd(A[3], B[2], VectorMultiplyAdd(A[2], B[3], VectorNegateMultiplyAdd(A[1], B[0], VectorMultiply(A[0], B[1]))));
+	Out[3] = VectorNegateMultiplyAdd(A[2], B[2], VectorNegateMultiplyAdd(A[1], B[1], VectorNegateMultiplyAdd(A[0], B[0], VectorMultiply(A[3], B[3]))));
+}
+
+template<typename RegisterType>
+FORCEINLINE RegisterType VectorQuaternionDot4Impl(const RegisterType (&A)[4], const RegisterType (&B)[4])
+{
+	return VectorMultiplyAdd(A[3], B[3], VectorMultiplyAdd(A[2], B[2], VectorMultiplyAdd(A[1], B[1], VectorMultiply(A[0], B[0]))));
+}
+
+template<typename ScalarType, typename RegisterType>
+FORCEINLINE void VectorQuaternionNormalize4Impl(RegisterType (&Q)[4])
+{
+	const RegisterType SquareSum = VectorQuaternionDot4Impl(Q, Q);
+	const RegisterType Valid = VectorCompareGE(SquareSum, VectorSetFloat1(ScalarType(1.e-8)));
+	const RegisterType Scale = VectorDivide(VectorSetFloat1(ScalarType(1)), VectorSqrt(SquareSum));
+	const RegisterType Zero = VectorSetFloat1(ScalarType(0));
+	Q[0] = VectorSelect(Valid, VectorMultiply(Q[0], Scale), Zero);
+	Q[1] = VectorSelect(Valid, VectorMultiply(Q[1], Scale), Zero);
+	Q[2] = VectorSelect(Valid, VectorMultiply(Q[2], Scale), Zero);
+	Q[3] = VectorSelect(Valid, VectorMultiply(Q[3], Scale), VectorSetFloat1(ScalarType(1)));
+}
+
+template<typename ScalarType, typename RegisterType>
+FORCEINLINE void VectorQuaternionBlend4Impl(RegisterType (&Out)[4], const RegisterType (&A)[4], const RegisterType (&B)[4], const RegisterType& WeightA, const RegisterType& WeightB)
+{
+	Out[0] = VectorMultiplyAdd(A[0], WeightA, VectorMultiply(B[0], WeightB));
+	Out[1] = VectorMultiplyAdd(A[1], WeightA, VectorMultiply(B[1], WeightB));
+	Out[2] = VectorMultiplyAdd(A[2], WeightA, VectorMultiply(B[2], WeightB));
+	Out[3] = VectorMultiplyAdd(A[3], WeightA, VectorMultiply(B[3], WeightB));
+	VectorQuaternionNormalize4Impl<ScalarType>(Out);
+}
+
+template<typename ScalarType>
+FORCEINLINE void VectorQuaternionMultiplySoAImpl(ScalarType* const* Result, const ScalarType* const* Quat1, const ScalarType* const* Quat2, int32 Count)
+{
+	typedef decltype(VectorSetFloat1(ScalarType(0))) RegisterType;
+	for (int32 Index = 0; Index < Count; Index += 4)
+	{
+		RegisterType A[4], B[4], Out[4];
+		VectorLoadQuaternionSoAImpl(A, Quat1, Index, Count);
+		VectorLoadQuaternionSoAImpl(B, Quat2, Index, Count);
+		VectorQuaternionMultiply4Impl(Out, A, B);
+		VectorStoreQuaternionSoAImpl(Result, Out, Index, Count);
+	}
+}
+
+template<typename ScalarType>
+FORCEINLINE void VectorQuaternionNormalizeSoAImpl(ScalarType* const* Result, const ScalarType* const* Quat, int32 Count)
+{
+	typedef decltype(VectorSetFloat1(ScalarType(0))) RegisterType;
+	for (int32 Index = 0; Index < Count; Index += 4)
+	{
+		RegisterType Q[4];
+		VectorLoadQuaternionSoAImpl(Q, Quat, Index, Count);
+		VectorQuaternionNormalize4Impl<ScalarType>(Q);
+		VectorStoreQuaternionSoAImpl(Result, Q, Index, Count);
+	}
+}
+
+template<typename ScalarType>
+FORCEINLINE void VectorQuaternionNLerpSoAImpl(ScalarType* const* Result, const ScalarType* const* Quat1, const ScalarType* const* Quat2, const ScalarType* Alpha, int32 Count)
+{
+	typedef decltype(VectorSetFloat1(ScalarType(0))) RegisterType;
+	const RegisterType One = VectorSetFloat1(ScalarType(1));
+	for (int32 Index = 0; Index < Count; Index += 4)
+	{
+		RegisterType A[4], B[4], Out[4];
+		VectorLoadQuaternionSoAImpl(A, Quat1, Index, Count);
+		VectorLoadQuaternionSoAImpl(B, Quat2, Index, Count);
+		const RegisterType Weight = VectorLoadSoAImpl(Alpha, Index, Count);
+
+		// FQuat::FastLerp, Quat1 is flipped onto Quat2's hemisphere to take the shortest path.
+		const RegisterType Bias = VectorSelect(VectorCompareGE(VectorQuaternionDot4Impl(A, B), VectorSetFloat1(ScalarType(0))), One, VectorSetFloat1(ScalarType(-1)));
+		VectorQuaternionBlend4Impl<ScalarType>(Out, A, B, VectorMultiply(Bias, VectorSubtract(One, Weight)), Weight);
+		VectorStoreQuaternionSoAImpl(Result, Out, Index, Count);
+	}
+}
+
+template<typename ScalarType>
+FORCEINLINE void VectorQuaternionSlerpSoAImpl(ScalarType* const* Result, const ScalarType* const* Quat1, const ScalarType* const* Quat2, const ScalarType* Alpha, int32 Count)
+{
+	typedef decltype(VectorSetFloat1(ScalarType(0))) RegisterType;
+	const RegisterType One = VectorSetFloat1(ScalarType(1));
+	for (int32 Index = 0; Index < Count; Index += 4)
+	{
+		RegisterType A[4], B[4], Out[4];
+		VectorLoadQuaternionSoAImpl(A, Quat1, Index, Count);
+		VectorLoadQuaternionSoAImpl(B, Quat2, Index, Count);
+		const RegisterType Weight = VectorLoadSoAImpl(Alpha, Index, Count);
+
+		// FQuat::Slerp. Nearly parallel quaternions (cos >= 0.9999) fall back to a linear blend, where 1 / sin(Omega)
+		// loses precision; those lanes may hold Inf/NaN weights before the select.
+		const RegisterType RawCosom = VectorQuaternionDot4Impl(A, B);
+		const RegisterType Cosom = VectorAbs(RawCosom);
+		const RegisterType Omega = VectorACos(Cosom);
+		const RegisterType InvSin = VectorDivide(One, VectorSin(Omega));
+		const RegisterType OneMinusAlpha = VectorSubtract(One, Weight);
+		const RegisterType IsLinear = VectorCompareGE(Cosom, VectorSetFloat1(ScalarType(0.9999f)));
+		const RegisterType Scale0 = VectorSelect(IsLinear, OneMinusAlpha, VectorMultiply(VectorSin(VectorMultiply(OneMinusAlpha, Omega)), InvSin));
+		RegisterType Scale1 = VectorSelect(IsLinear, Weight, VectorMultiply(VectorSin(VectorMultiply(Weight, Omega)), InvSin));
+		Scale1 = VectorSelect(VectorCompareGE(RawCosom, VectorSetFloat1(ScalarType(0))), Scale1, VectorNegate(Scale1));
+		VectorQuaternionBlend4Impl<ScalarType>(Out, A, B, Scale0, Scale1);
+		VectorStoreQuaternionSoAImpl(Result, Out, Index, Count);
+	}
+}
+
+template<typename ScalarType>
+FORCEINLINE void VectorQuaternionRotateVectorSoAImpl(ScalarType* const* Result, const ScalarType* const* Quat, const ScalarType* const* Vector, int32 Count)
+{
+	typedef decltype(VectorSetFloat1(ScalarType(0))) RegisterType;
+	const RegisterType Two = VectorSetFloat1(ScalarType(2));
+	for (int32 Index = 0; Index < Count; Index += 4)
+	{
+		RegisterType Q[4], V[3];
+		VectorLoadQuaternionSoAImpl(Q, Quat, Index, Count);
+		V[0] = VectorLoadSoAImpl(Vector[0], Index, Count);
+		V[1] = VectorLoadSoAImpl(Vector[1], Index, Count);
+		V[2] = VectorLoadSoAImpl(Vector[2], Index, Count);
+
+		// FQuat::RotateVector: T = 2 * (Q x V), Result = V + W * T + Q x T
+		const RegisterType TX = VectorMultiply(VectorNegateMultiplyAdd(Q[2], V[1], VectorMultiply(Q[1], V[2])), Two);
+		const RegisterType TY = VectorMultiply(VectorNegateMultiplyAdd(Q[0], V[2], VectorMultiply(Q[2], V[0])), Two);
+		const RegisterType TZ = VectorMultiply(VectorNegateMultiplyAdd(Q[1], V[0], VectorMultiply(Q[0], V[1])), Two);
+		VectorStoreSoAImpl(VectorAdd(VectorMultiplyAdd(Q[3], TX, V[0]), VectorNegateMultiplyAdd(Q[2], TY, VectorMultiply(Q[1], TZ))), Result[0], Index, Count);
+		VectorStoreSoAImpl(VectorAdd(VectorMultiplyAdd(Q[3], TY, V[1]), VectorNegateMultiplyAdd(Q[0], TZ, VectorMultiply(Q[2], TX))), Result[1], Index, Count);
+		VectorStoreSoAImpl(VectorAdd(VectorMultiplyAdd(Q[3], TZ, V[2]), VectorNegateMultiplyAdd(Q[1], TX, VectorMultiply(Q[0], TY))), Result[2], Index, Count);
+	}
+}
+
+/**
+ * Multiplies Count pairs of SoA quaternions, Result[i] = Quat1[i] * Quat2[i], same order convention as VectorQuaternionMultiply2.
+ * Result may alias Quat1 or Quat2.
+ *
+ * @param Result	X, Y, Z and W arrays receiving the Count products
+ * @param Quat1		X, Y, Z and W arrays of the left hand side quaternions
+ * @param Quat2		X, Y, Z and W arrays of the right hand side quaternions
+ * @param Count		Number of quaternion pairs
+ */
+inline void VectorQuaternionMultiplySoA(float* const* Result, const float* const* Quat1, const float* const* Quat2, int32 Count)
+{
+	VectorQuaternionMultiplySoAImpl(Result, Quat1, Quat2, Count);
+}
+
+inline void VectorQuaternionMultiplySoA(double* const* Result, const double* const* Quat1, const double* const* Quat2, int32 Count)
+{
+	VectorQuaternionMultiplySoAImpl(Result, Quat1, Quat2, Count);
+}
+
+/**
+ * Normalizes Count SoA quaternions like FQuat::Normalize: quaternions with a squared length below 1e-8 become the identity.
+ * Result may alias Quat.
+ *
+ * @param Result	X, Y, Z and W arrays receiving the Count normalized quaternions
+ * @param Quat		X, Y, Z and W arrays of the quaternions to normalize
+ * @param Count		Number of quaternions
+ */
+inline void VectorQuaternionNormalizeSoA(float* const* Result, const float* const* Quat, int32 Count)
+{
+	VectorQuaternionNormalizeSoAImpl(Result, Quat, Count);
+}
+
+inline void VectorQuaternionNormalizeSoA(double* const* Result, const double* const* Quat, int32 Count)
+{
+	VectorQuaternionNormalizeSoAImpl(Result, Quat, Count);
+}
+
+/**
+ * Normalized linear interpolation of Count pairs of SoA quaternions along the shortest path,
+ * Result[i] = normalize(FQuat::FastLerp(Quat1[i], Quat2[i], Alpha[i])). Result may alias Quat1 or Quat2.
+ *
+ * @param Result	X, Y, Z and W arrays receiving the Count blended quaternions
+ * @param Quat1		X, Y, Z and W arrays of the quaternions at Alpha = 0
+ * @param Quat2		X, Y, Z and W arrays of the quaternions at Alpha = 1
+ * @param Alpha		Count blend weights
+ * @param Count		Number of quaternion pairs
+ */
+inline void VectorQuaternionNLerpSoA(float* const* Result, const float* const* Quat1, const float* const* Quat2, const float* Alpha, int32 Count)
+{
+	VectorQuaternionNLerpSoAImpl(Result, Quat1, Quat2, Alpha, Count);
+}
+
+inline void VectorQuaternionNLerpSoA(double* const* Result, const double* const* Quat1, const double* const* Quat2, const double* Alpha, int32 Count)
+{
+	VectorQuaternionNLerpSoAImpl(Result, Quat1, Quat2, Alpha, Count);
+}
+
+/**
+ * Spherical interpolation of Count pairs of SoA quaternions along the shortest path, same result as FQuat::Slerp:
+ * nearly parallel pairs (cos >= 0.9999) fall back to a linear blend and the result is normalized.
+ * Result may alias Quat1 or Quat2.
+ *
+ * @param Result	X, Y, Z and W arrays receiving the Count blended quaternions
+ * @param Quat1		X, Y, Z and W arrays of the quaternions at Alpha = 0
+ * @param Quat2		X, Y, Z and W arrays of the quaternions at Alpha = 1
+ * @param Alpha		Count blend weights
+ * @param Count		Number of quaternion pairs
+ */
+inline void VectorQuaternionSlerpSoA(float* const* Result, const float* const* Quat1, const float* const* Quat2, const float* Alpha, int32 Count)
+{
+	VectorQuaternionSlerpSoAImpl(Result, Quat1, Quat2, Alpha, Count);
+}
+
+inline void VectorQuaternionSlerpSoA(double* const* Result, const double* const* Quat1, const double* const* Quat2, const double* Alpha, int32 Count)
+{
+	VectorQuaternionSlerpSoAImpl(Result, Quat1, Quat2, Alpha, Count);
+}
+
+/**
+ * Rotates Count SoA vectors by Count SoA unit quaternions, Result[i] = FQuat::RotateVector(Quat[i], Vector[i]).
+ * Result may alias Vector.
+ *
+ * @param Result	X, Y and Z arrays receiving the Count rotated vectors
+ * @param Quat		X, Y, Z and W arrays of the rotations
+ * @param Vector	X, Y and Z arrays of the vectors to rotate
+ * @param Count		Number of vectors
+ */
+inline void VectorQuaternionRotateVectorSoA(float* const* Result, const float* const* Quat, const float* const* Vector, int32 Count)
+{
+	VectorQuaternionRotateVectorSoAImpl(Result, Quat, Vector, Count);
+}
+
+inline void VectorQuaternionRotateVectorSoA(double* const* Result, const double* const* Quat, const double* const* Vector, int32 Count)
+{
+	VectorQuaternionRotateVectorSoAImpl(Result, Quat, Vector, Count);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+// AoS <-> SoA conversion
+//
+// ld4 / st4 deinterleave and interleave XYZW vectors directly, no separate transpose is needed.
+
+/**
+ * Splits Count XYZW vectors stored back to back into separate component arrays. Src must not overlap any of the
+ * destination arrays.
+ *
+ * @param Dst	X, Y, Z and W arrays receiving Count elements each. The W array may be nullptr to drop W.
+ * @param Src	Count vectors, 4 * Count scalars
+ * @param Count	Number of vectors
+ */
+inline void VectorAoSToSoA(float* const* Dst, const float* Src, int32 Count)
+{
+	int32 Index = 0;
+	for (; Index + 4 <= Count; Index += 4)
+	{
+		const float32x4x4_t Components = vld4q_f32(Src + Index * 4);
+		vst1q_f32(Dst[0] + Index, Components.val[0]);
+		vst1q_f32(Dst[1] + Index, Components.val[1]);
+		vst1q_f32(Dst[2] + Index, Components.val[2]);
+		if (Dst[3])
+		{
+			vst1q_f32(Dst[3] + Index, Components.val[3]);
+		}
+	}
+	for (; Index < Count; ++Index)
+	{
+		Dst[0][Index] = Src[Index * 4 + 0];
+		Dst[1][Index] = Src[Index * 4 + 1];
+		Dst[2][Index] = Src[Index * 4 + 2];
+		if (Dst[3])
+		{
+			Dst[3][Index] = Src[Index * 4 + 3];
+		}
+	}
+}
+
+inline void VectorAoSToSoA(double* const* Dst, const double* Src, int32 Count)
+{
+	int32 Index = 0;
+	for (; Index + 2 <= Count; Index += 2)
+	{
+		const float64x2x4_t Components = vld4q_f64(Src + Index * 4);
+		vst1q_f64(Dst[0] + Index, Components.val[0]);
+		vst1q_f64(Dst[1] + Index, Components.val[1]);
+		vst1q_f64(Dst[2] + Index, Components.val[2]);
+		if (Dst[3])
+		{
+			vst1q_f64(Dst[3] + Index, Components.val[3]);
+		}
+	}
+	if (Index < Count)
+	{
+		Dst[0][Index] = Src[Index * 4 + 0];
+		Dst[1][Index] = Src[Index * 4 + 1];
+		Dst[2][Index] = Src[Index * 4 + 2];
+		if (Dst[3])
+		{
+			Dst[3][Index] = Src[Index * 4 + 3];
+		}
+	}
+}
+
+/**
+ * Interleaves separate component arrays into Count XYZW vectors stored back to back, the inverse of VectorAoSToSoA.
+ * Dst must not overlap any of the source arrays.
+ *
+ * @param Dst	Receives Count vectors, 4 * Count scalars
+ * @param Src	X, Y, Z and W arrays of Count elements each. The W array may be nullptr, W is then written as zero.
+ * @param Count	Number of vectors
+ */
+inline void VectorSoAToAoS(float* Dst, const float* const* Src, int32 Count)
+{
+	int32 Index = 0;
+	for (; Index + 4 <= Count; Index += 4)
+	{
+		float32x4x4_t Components;
+		Components.val[0] = vld1q_f32(Src[0] + Index);
+		Components.val[1] = vld1q_f32(Src[1] + Index);
+		Components.val[2] = vld1q_f32(Src[2] + Index);
+		Components.val[3] = Src[3] ? vld1q_f32(Src[3] + Index) : vdupq_n_f32(0.0f);
+		vst4q_f32(Dst + Index * 4, Components);
+	}
+	for (; Index < Count; ++Index)
+	{
+		Dst[Index * 4 + 0] = Src[0][Index];
+		Dst[Index * 4 + 1] = Src[1][Index];
+		Dst[Index * 4 + 2] = Src[2][Index];
+		Dst[Index * 4 + 3] = Src[3] ? Src[3][Index] : 0.0f;
+	}
+}
+
+inline void VectorSoAToAoS(double* Dst, const double* const* Src, int32 Count)
+{
+	int32 Index = 0;
+	for (; Index + 2 <= Count; Index += 2)
+	{
+		float64x2x4_t Components;
+		Components.val[0] = vld1q_f64(Src[0] + Index);
+		Components.val[1] = vld1q_f64(Src[1] + Index);
+		Components.val[2] = vld1q_f64(Src[2] + Index);
+		Components.val[3] = Src[3] ? vld1q_f64(Src[3] + Index) : vdupq_n_f64(0.0);
+		vst4q_f64(Dst + Index * 4, Components);
+	}
+	if (Index < Count)
+	{
+		Dst[Index * 4 + 0] = Src[0][Index];
+		Dst[Index * 4 + 1] = Src[1][Index];
+		Dst[Index * 4 + 2] = Src[2][Index];
+		Dst[Index * 4 + 3] = Src[3] ? Src[3][Index] : 0.0;
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+// Point bounds
+//
+// Same API and results as the SSE backend. ld3 deinterleaves packed XYZ points straight into X, Y and Z registers; other
+// strides load one point per register, reading four scalars for all but the last point.
+
+template<typename ScalarType>
+FORCEINLINE void VectorAddBoundsPointImpl(ScalarType X, ScalarType Y, ScalarType Z, ScalarType* InOutMin, ScalarType* InOutMax)
+{
+	InOutMin[0] = FMath::Min(InOutMin[0], X);
+	InOutMin[1] = FMath::Min(InOutMin[1], Y);
+	InOutMin[2] = FMath::Min(InOutMin[2], Z);
+	InOutMax[0] = FMath::Max(InOutMax[0], X);
+	InOutMax[1] = FMath::Max(InOutMax[1], Y);
+	InOutMax[2] = FMath::Max(InOutMax[2], Z);
+}
+
+template<typename ScalarType>
+FORCEINLINE ScalarType VectorDistanceSquaredImpl(ScalarType X, ScalarType Y, ScalarType Z, const ScalarType* Center)
+{
+	return (X - Center[0]) * (X - Center[0]) + (Y - Center[1]) * (Y - Center[1]) + (Z - Center[2]) * (Z - Center[2]);
+}
+
+// Packed kernels, two ld3 blocks per iteration with their own accumulators. Return the index they stopped at.
+inline int32 VectorComputeBoundsPackedImpl(const float* Points, int32 Index, int32 Count, float* InOutMin, float* InOutMax)
+{
+	if (Index + 8 <= Count)
+	{
+		float32x4_t MinX0 = vdupq_n_f32(InOutMin[0]), MinY0 = vdupq_n_f32(InOutMin[1]), MinZ0 = vdupq_n_f32(InOutMin[2]);
+		float32x4_t MaxX0 = vdupq_n_f32(InOutMax[0]), MaxY0 = vdupq_n_f32(InOutMax[1]), MaxZ0 = vdupq_n_f32(InOutMax[2]);
+		float32x4_t MinX1 = MinX0, MinY1 = MinY0, MinZ1 = MinZ0;
+		float32x4_t MaxX1 = MaxX0, MaxY1 = MaxY0, MaxZ1 = MaxZ0;
+		for (; Index + 8 <= Count; Index += 8)
+		{
+			const float32x4x3_t Points0 = vld3q_f32(Points + SIZE_T(Index) * 3);
+			const float32x4x3_t Points1 = vld3q_f32(Points + SIZE_T(Index) * 3 + 12);
+			MinX0 = vminq_f32(MinX0, Points0.val[0]);
+			MinY0 = vminq_f32(MinY0, Points0.val[1]);
+			MinZ0 = vminq_f32(MinZ0, Points0.val[2]);
+			MaxX0 = vmaxq_f32(MaxX0, Points0.val[0]);
+			MaxY0 = vmaxq_f32(MaxY0, Points0.val[1]);
+			MaxZ0 = vmaxq_f32(MaxZ0, Points0.val[2]);
+			MinX1 = vminq_f32(MinX1, Points1.val[0]);
+			MinY1 = vminq_f32(MinY1, Points1.val[1]);
+			MinZ1 = vminq_f32(MinZ1, Points1.val[2]);
+			MaxX1 = vmaxq_f32(MaxX1, Points1.val[0]);
+			MaxY1 = vmaxq_f32(MaxY1, Points1.val[1]);
+			MaxZ1 = vmaxq_f32(MaxZ1, Points1.val[2]);
+		}
+		InOutMin[0] = vminvq_f32(vminq_f32(MinX0, MinX1));
+		InOutMin[1] = vminvq_f32(vminq_f32(MinY0, MinY1));
+		InOutMin[2] = vminvq_f32(vminq_f32(MinZ0, MinZ1));
+		InOutMax[0] = vmaxvq_f32(vmaxq_f32(MaxX0, MaxX1));
+		InOutMax[1] = vmaxvq_f32(vmaxq_f32(MaxY0, MaxY1));
+		InOutMax[2] = vmaxvq_f32(vmaxq_f32(MaxZ0, MaxZ1));
+	}
+	return Index;
+}
+
+inline int32 VectorComputeBoundsPackedImpl(const double* Points, int32 Index, int32 Count, double* InOutMin, double* InOutMax)
+{
+	if (Index + 4 <= Count)
+	{
+		float64x2_t MinX0 = vdupq_n_f64(InOutMin[0]), MinY0 = vdupq_n_f64(InOutMin[1]), MinZ0 = vdupq_n_f64(InOutMin[2]);
+		float64x2_t MaxX0 = vdupq_n_f64(InOutMax[0]), MaxY0 = vdupq_n_f64(InOutMax[1]), MaxZ0 = vdupq_n_f64(InOutMax[2]);
+		float64x2_t MinX1 = MinX0, MinY1 = MinY0, MinZ1 = MinZ0;
+		float64x2_t MaxX1 = MaxX0, MaxY1 = MaxY0, MaxZ1 = MaxZ0;
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			const float64x2x3_t Points0 = vld3q_f64(Points + SIZE_T(Index) * 3);
+			const float64x2x3_t Points1 = vld3q_f64(Points + SIZE_T(Index) * 3 + 6);
+			MinX0 = vminq_f64(MinX0, Points0.val[0]);
+			MinY0 = vminq_f64(MinY0, Points0.val[1]);
+			MinZ0 = vminq_f64(MinZ0, Points0.val[2]);
+			MaxX0 = vmaxq_f64(MaxX0, Points0.val[0]);
+			MaxY0 = vmaxq_f64(MaxY0, Points0.val[1]);
+			MaxZ0 = vmaxq_f64(MaxZ0, Points0.val[2]);
+			MinX1 = vminq_f64(MinX1, Points1.val[0]);
+			MinY1 = vminq_f64(MinY1, Points1.val[1]);
+			MinZ1 = vminq_f64(MinZ1, Points1.val[2]);
+			MaxX1 = vmaxq_f64(MaxX1, Points1.val[0]);
+			MaxY1 = vmaxq_f64(MaxY1, Points1.val[1]);
+			MaxZ1 = vmaxq_f64(MaxZ1, Points1.val[2]);
+		}
+		InOutMin[0] = vminvq_f64(vminq_f64(MinX0, MinX1));
+		InOutMin[1] = vminvq_f64(vminq_f64(MinY0, MinY1));
+		InOutMin[2] = vminvq_f64(vminq_f64(MinZ0, MinZ1));
+		InOutMax[0] = vmaxvq_f64(vmaxq_f64(MaxX0, MaxX1));
+		InOutMax[1] = vmaxvq_f64(vmaxq_f64(MaxY0, MaxY1));
+		InOutMax[2] = vmaxvq_f64(vmaxq_f64(MaxZ0, MaxZ1));
+	}
+	return Index;
+}
+
+inline int32 VectorComputeBoundingRadiusPackedImpl(const float* Points, int32 Index, int32 Count, const float* Center, float& InOutRadiusSquared)
+{
+	if (Index + 8 <= Count)
+	{
+		const float32x4_t CenterX = vdupq_n_f32(Center[0]);
+		const float32x4_t CenterY = vdupq_n_f32(Center[1]);
+		const float32x4_t CenterZ = vdupq_n_f32(Center[2]);
+		float32x4_t MaxDistance0 = vdupq_n_f32(InOutRadiusSquared);
+		float32x4_t MaxDistance1 = MaxDistance0;
+		for (; Index + 8 <= Count; Index += 8)
+		{
+			const float32x4x3_t Points0 = vld3q_f32(Points + SIZE_T(Index) * 3);
+			const float32x4x3_t Points1 = vld3q_f32(Points + SIZE_T(Index) * 3 + 12);
+			const float32x4_t DX0 = vsubq_f32(Points0.val[0], CenterX);
+			const float32x4_t DY0 = vsubq_f32(Points0.val[1], CenterY);
+			const float32x4_t DZ0 = vsubq_f32(Points0.val[2], CenterZ);
+			const float32x4_t DX1 = vsubq_f32(Points1.val[0], CenterX);
+			const float32x4_t DY1 = vsubq_f32(Points1.val[1], CenterY);
+			const float32x4_t DZ1 = vsubq_f32(Points1.val[2], CenterZ);
+			MaxDistance0 = vmaxq_f32(MaxDistance0, vfmaq_f32(vfmaq_f32(vmulq_f32(DX0, DX0), DY0, DY0), DZ0, DZ0));
+			MaxDistance1 = vmaxq_f32(MaxDistance1, vfmaq_f32(vfmaq_f32(vmulq_f32(DX1, DX1), DY1, DY1), DZ1, DZ1));
+		}
+		InOutRadiusSquared = vmaxvq_f32(vmaxq_f32(MaxDistance0, MaxDistance1));
+	}
+	return Index;
+}
+
+inline int32 VectorComputeBoundingRadiusPackedImpl(const double* Points, int32 Index, int32 Count, const double* Center, double& InOutRadiusSquared)
+{
+	if (Index + 4 <= Count)
+	{
+		const float64x2_t CenterX = vdupq_n_f64(Center[0]);
+		const float64x2_t CenterY = vdupq_n_f64(Center[1]);
+		const float64x2_t CenterZ = vdupq_n_f64(Center[2]);
+		float64x2_t MaxDistance0 = vdupq_n_f64(InOutRadiusSquared);
+		float64x2_t MaxDistance1 = MaxDistance0;
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			const float64x2x3_t Points0 = vld3q_f64(Points + SIZE_T(Index) * 3);
+			const float64x2x3_t Points1 = vld3q_f64(Points + SIZE_T(Index) * 3 + 6);
+			const float64x2_t DX0 = vsubq_f64(Points0.val[0], CenterX);
+			const float64x2_t DY0 = vsubq_f64(Points0.val[1], CenterY);
+			const float64x2_t DZ0 = vsubq_f64(Points0.val[2], CenterZ);
+			const float64x2_t DX1 = vsubq_f64(Points1.val[0], CenterX);
+			const float64x2_t DY1 = vsubq_f64(Points1.val[1], CenterY);
+			const float64x2_t DZ1 = vsubq_f64(Points1.val[2], CenterZ);
+			MaxDistance0 = vmaxq_f64(MaxDistance0, vfmaq_f64(vfmaq_f64(vmulq_f64(DX0, DX0), DY0, DY0), DZ0, DZ0));
+			MaxDistance1 = vmaxq_f64(MaxDistance1, vfmaq_f64(vfmaq_f64(vmulq_f64(DX1, DX1), DY1, DY1), DZ1, DZ1));
+		}
+		InOutRadiusSquared = vmaxvq_f64(vmaxq_f64(MaxDistance0, MaxDistance1));
+	}
+	return Index;
+}
+
+// One point per register, alternating between two sets of accumulators; W picks up whatever follows Z and is dropped.
+template<typename ScalarType>
+inline void VectorComputeBoundsStridedImpl(const ScalarType* Points, int32 Stride, int32 Index, int32 Count, ScalarType* InOutMin, ScalarType* InOutMax)
+{
+	typedef decltype(VectorLoad(Points)) RegisterType;
+	const uint8* Bytes = (const uint8*)Points;
+	if (Index + 1 < Count)
+	{
+		ScalarType MinLanes[4] = { InOutMin[0], InOutMin[1], InOutMin[2], InOutMin[2] };
+		ScalarType MaxLanes[4] = { InOutMax[0], InOutMax[1], InOutMax[2], InOutMax[2] };
+		RegisterType Min0 = VectorLoad(MinLanes);
+		RegisterType Max0 = VectorLoad(MaxLanes);
+		RegisterType Min1 = Min0;
+		RegisterType Max1 = Max0;
+		for (; Index + 2 < Count; Index += 2)
+		{
+			const RegisterType Point0 = VectorLoad((const ScalarType*)(Bytes + SIZE_T(Index) * Stride));
+			const RegisterType Point1 = VectorLoad((const ScalarType*)(Bytes + SIZE_T(Index + 1) * Stride));
+			Min0 = VectorMin(Min0, Point0);
+			Max0 = VectorMax(Max0, Point0);
+			Min1 = VectorMin(Min1, Point1);
+			Max1 = VectorMax(Max1, Point1);
+		}
+		if (Index + 1 < Count)
+		{
+			const RegisterType Point0 = VectorLoad((const ScalarType*)(Bytes + SIZE_T(Index) * Stride));
+			Min0 = VectorMin(Min0, Point0);
+			Max0 = VectorMax(Max0, Point0);
+			++Index;
+		}
+		VectorStore(VectorMin(Min0, Min1), MinLanes);
+		VectorStore(VectorMax(Max0, Max1), MaxLanes);
+		for (int32 Component = 0; Component < 3; ++Component)
+		{
+			InOutMin[Component] = MinLanes[Component];
+			InOutMax[Component] = MaxLanes[Component];
+		}
+	}
+	for (; Index < Count; ++Index)
+	{
+		const ScalarType* Point = (const ScalarType*)(Bytes + SIZE_T(Index) * Stride);
+		VectorAddBoundsPointImpl(Point[0], Point[1], Point[2], InOutMin, InOutMax);
+	}
+}
+
+// Four points per iteration transposed to X, Y and Z.
+template<typename ScalarType>
+inline void VectorComputeBoundingRadiusStridedImpl(const ScalarType* Points, int32 Stride, int32 Index, int32 Count, const ScalarType* Center, ScalarType& InOutRadiusSquared)
+{
+	typedef decltype(VectorLoad(Points)) RegisterType;
+	const uint8* Bytes = (const uint8*)Points;
+	if (Index + 4 < Count)
+	{
+		const RegisterType CenterX = VectorSetFloat1(Center[0]);
+		const RegisterType CenterY = VectorSetFloat1(Center[1]);
+		const RegisterType CenterZ = VectorSetFloat1(Center[2]);
+		RegisterType MaxDistance = VectorSetFloat1(InOutRadiusSquared);
+		for (; Index + 4 < Count; Index += 4)
+		{
+			const uint8* In = Bytes + SIZE_T(Index) * Stride;
+			RegisterType Row0 = VectorLoad((const ScalarType*)(In + 0 * SIZE_T(Stride)));
+			RegisterType Row1 = VectorLoad((const ScalarType*)(In + 1 * SIZE_T(Stride)));
+			RegisterType Row2 = VectorLoad((const ScalarType*)(In + 2 * SIZE_T(Stride)));
+			RegisterType Row3 = VectorLoad((const ScalarType*)(In + 3 * SIZE_T(Stride)));
+			VectorTranspose4x4(Row0, Row1, Row2, Row3);
+			const RegisterType DX = VectorSubtract(Row0, CenterX);
+			const RegisterType DY = VectorSubtract(Row1, CenterY);
+			const RegisterType DZ = VectorSubtract(Row2, CenterZ);
+			MaxDistance = VectorMax(MaxDistance, VectorMultiplyAdd(DZ, DZ, VectorMultiplyAdd(DY, DY, VectorMultiply(DX, DX))));
+		}
+
+		ScalarType Lanes[4];
+		VectorStore(MaxDistance, Lanes);
+		InOutRadiusSquared = FMath::Max(FMath::Max(Lanes[0], Lanes[1]), FMath::Max(Lanes[2], Lanes[3]));
+	}
+	for (; Index < Count; ++Index)
+	{
+		const ScalarType* Point = (const ScalarType*)(Bytes + SIZE_T(Index) * Stride);
+		InOutRadiusSquared = FMath::Max(InOutRadiusSquared, VectorDistanceSquaredImpl(Point[0], Point[1], Point[2], Center));
+	}
+}
+
+template<typename ScalarType>
+inline void VectorComputeBoundsImpl(ScalarType* OutMin, ScalarType* OutMax, const ScalarType* Points, int32 Stride, int32 Count)
+{
+	if (Count <= 0)
+	{
+		OutMin[0] = OutMin[1] = OutMin[2] = OutMax[0] = OutMax[1] = OutMax[2] = ScalarType(0);
+		return;
+	}
+	for (int32 Component = 0; Component < 3; ++Component)
+	{
+		OutMin[Component] = OutMax[Component] = Points[Component];
+	}
+
+	int32 Index = 1;
+	if (Stride == int32(3 * sizeof(ScalarType)))
+	{
+		Index = VectorComputeBoundsPackedImpl(Points, Index, Count, OutMin, OutMax);
+	}
+	VectorComputeBoundsStridedImpl(Points, Stride, Index, Count, OutMin, OutMax);
+}
+
+template<typename ScalarType>
+inline void VectorComputeBoundsSoAImpl(ScalarType* OutMin, ScalarType* OutMax, const ScalarType* const* Components, int32 Count)
+{
+	if (Count <= 0)
+	{
+		OutMin[0] = OutMin[1] = OutMin[2] = OutMax[0] = OutMax[1] = OutMax[2] = ScalarType(0);
+		return;
+	}
+
+	typedef decltype(VectorLoad(Components[0])) RegisterType;
+	RegisterType MinX = VectorSetFloat1(Components[0][0]), MinY = VectorSetFloat1(Components[1][0]), MinZ = VectorSetFloat1(Components[2][0]);
+	RegisterType MaxX = MinX, MaxY = MinY, MaxZ = MinZ;
+	int32 Index = 0;
+	for (; Index + 4 <= Count; Index += 4)
+	{
+		const RegisterType X = VectorLoad(Components[0] + Index);
+		const RegisterType Y = VectorLoad(Components[1] + Index);
+		const RegisterType Z = VectorLoad(Components[2] + Index);
+		MinX = VectorMin(MinX, X);
+		MaxX = VectorMax(MaxX, X);
+		MinY = VectorMin(MinY, Y);
+		MaxY = VectorMax(MaxY, Y);
+		MinZ = VectorMin(MinZ, Z);
+		MaxZ = VectorMax(MaxZ, Z);
+	}
+
+	ScalarType MinLanes[3][4];
+	ScalarType MaxLanes[3][4];
+	VectorStore(MinX, MinLanes[0]);
+	VectorStore(MinY, MinLanes[1]);
+	VectorStore(MinZ, MinLanes[2]);
+	VectorStore(MaxX, MaxLanes[0]);
+	VectorStore(MaxY, MaxLanes[1]);
+	VectorStore(MaxZ, MaxLanes[2]);
+	for (int32 Component = 0; Component < 3; ++Component)
+	{
+		OutMin[Component] = FMath::Min(FMath::Min(MinLanes[Component][0], MinLanes[Component][1]), FMath::Min(MinLanes[Component][2], MinLanes[Component][3]));
+		OutMax[Component] = FMath::Max(FMath::Max(MaxLanes[Component][0], MaxLanes[Component][1]), FMath::Max(MaxLanes[Component][2], MaxLanes[Component][3]));
+	}
+	for (; Index < Count; ++Index)
+	{
+		VectorAddBoundsPointImpl(Components[0][Index], Components[1][Index], Components[2][Index], OutMin, OutMax);
+	}
+}
+
+template<typename ScalarType>
+inline ScalarType VectorComputeBoundingRadiusImpl(const ScalarType* Center, const ScalarType* Points, int32 Stride, int32 Count)
+{
+	ScalarType RadiusSquared = ScalarType(0);
+	int32 Index = 0;
+	if (Stride == int32(3 * sizeof(ScalarType)))
+	{
+		Index = VectorComputeBoundingRadiusPackedImpl(Points, Index, Count, Center, RadiusSquared);
+	}
+	VectorComputeBoundingRadiusStridedImpl(Points, Stride, Index, Count, Center, RadiusSquared);
+	return FMath::Sqrt(RadiusSquared);
+}
+
+template<typename ScalarType>
+inline ScalarType VectorComputeBoundingRadiusSoAImpl(const ScalarType* Center, const ScalarType* const* Components, int32 Count)
+{
+	typedef decltype(VectorLoad(Components[0])) RegisterType;
+	const RegisterType CenterX = VectorSetFloat1(Center[0]);
+	const RegisterType CenterY = VectorSetFloat1(Center[1]);
+	const RegisterType CenterZ = VectorSetFloat1(Center[2]);
+	RegisterType MaxDistance = VectorSetFloat1(ScalarType(0));
+	int32 Index = 0;
+	for (; Index + 4 <= Count; Index += 4)
+	{
+		const RegisterType DX = VectorSubtract(VectorLoad(Components[0] + Index), CenterX);
+		const RegisterType DY = VectorSubtract(VectorLoad(Components[1] + Index), CenterY);
+		const RegisterType DZ = VectorSubtract(VectorLoad(Components[2] + Index), CenterZ);
+		MaxDistance = VectorMax(MaxDistance, VectorMultiplyAdd(DZ, DZ, VectorMultiplyAdd(DY, DY, VectorMultiply(DX, DX))));
+	}
+
+	ScalarType Lanes[4];
+	VectorStore(MaxDistance, Lanes);
+	ScalarType RadiusSquared = FMath::Max(FMath::Max(Lanes[0], Lanes[1]), FMath::Max(Lanes[2], Lanes[3]));
+	for (; Index < Count; ++Index)
+	{
+		RadiusSquared = FMath::Max(RadiusSquared, VectorDistanceSquaredImpl(Components[0][Index], Components[1][Index], Components[2][Index], Center));
+	}
+	return FMath::Sqrt(RadiusSquared);
+}
+
+/**
+ * Computes the axis aligned box around Count XYZ points. Points are read as four scalars except for the last one, so any
+ * padding after Z must be readable. NaNs give undefined bounds.
+ *
+ * @param OutMin	Receives the X, Y and Z minimum, zero when Count is zero
+ * @param OutMax	Receives the X, Y and Z maximum, zero when Count is zero
+ * @param Points	Unaligned first point
+ * @param Stride	Distance between points in bytes, at least 3 * sizeof(float)
+ * @param Count		Number of points
+ */
+inline void VectorComputeBounds(float* OutMin, float* OutMax, const float* Points, int32 Stride, int32 Count)
+{
+	VectorComputeBoundsImpl(OutMin, OutMax, Points, Stride, Count);
+}
+
+inline void VectorComputeBounds(double* OutMin, double* OutMax, const double* Points, int32 Stride, int32 Count)
+{
+	VectorComputeBoundsImpl(OutMin, OutMax, Points, Stride, Count);
+}
+
+/**
+ * Computes the axis aligned box around Count points stored as separate X, Y and Z arrays.
+ *
+ * @param OutMin		Receives the X, Y and Z minimum, zero when Count is zero
+ * @param OutMax		Receives the X, Y and Z maximum, zero when Count is zero
+ * @param Components	X, Y and Z arrays of Count elements each
+ * @param Count			Number of points
+ */
+inline void VectorComputeBoundsSoA(float* OutMin, float* OutMax, const float* const* Components, int32 Count)
+{
+	VectorComputeBoundsSoAImpl(OutMin, OutMax, Components, Count);
+}
+
+inline void VectorComputeBoundsSoA(double* OutMin, double* OutMax, const double* const* Components, int32 Count)
+{
+	VectorComputeBoundsSoAImpl(OutMin, OutMax, Components, Count);
+}
+
+/**
+ * Computes the radius of the smallest sphere around Center that contains Count XYZ points. Points are read as in
+ * VectorComputeBounds.
+ *
+ * @param Center	X, Y and Z of the sphere center, usually the center of the VectorComputeBounds box
+ * @param Points	Unaligned first point
+ * @param Stride	Distance between points in bytes, at least 3 * sizeof(float)
+ * @param Count		Number of points
+ * @return			Largest distance from Center to a point, zero when Count is zero
+ */
+inline float VectorComputeBoundingRadius(const float* Center, const float* Points, int32 Stride, int32 Count)
+{
+	return VectorComputeBoundingRadiusImpl(Center, Points, Stride, Count);
+}
+
+inline double VectorComputeBoundingRadius(const double* Center, const double* Points, int32 Stride, int32 Count)
+{
+	return VectorComputeBoundingRadiusImpl(Center, Points, Stride, Count);
+}
+
+/**
+ * Computes the radius of the smallest sphere around Center that contains Count points stored as separate X, Y and Z arrays.
+ *
+ * @param Center		X, Y and Z of the sphere center, usually the center of the VectorComputeBoundsSoA box
+ * @param Components	X, Y and Z arrays of Count elements each
+ * @param Count			Number of points
+ * @return				Largest distance from Center to a point, zero when Count is zero
+ */
+inline float VectorComputeBoundingRadiusSoA(const float* Center, const float* const* Components, int32 Count)
+{
+	return VectorComputeBoundingRadiusSoAImpl(Center, Components, Count);
+}
+
+inline double VectorComputeBoundingRadiusSoA(const double* Center, const double* const* Components, int32 Count)
+{
+	return VectorComputeBoundingRadiusSoAImpl(Center, Components, Count);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+// Frustum culling
+//
+// Same API and results as the SSE backend, see its VectorCullSpheresSoA. Two blocks of four objects go through each
+// plane so they share its broadcasts.
+
+// NegW holds -W.
+template<typename RegisterType>
+FORCEINLINE RegisterType VectorPlaneDistanceImpl(const RegisterType& NX, const RegisterType& NY, const RegisterType& NZ, const RegisterType& NegW, const RegisterType& X, const RegisterType& Y, const RegisterType& Z)
+{
+	return VectorMultiplyAdd(NZ, Z, VectorMultiplyAdd(NY, Y, VectorMultiplyAdd(NX, X, NegW)));
+}
+
+template<typename RegisterType>
+FORCEINLINE RegisterType VectorPlanePushOutImpl(const RegisterType& NX, const RegisterType& NY, const RegisterType& NZ, const RegisterType& ExtentX, const RegisterType& ExtentY, const RegisterType& ExtentZ)
+{
+	const RegisterType PushOut = VectorMultiply(VectorAbs(NX), ExtentX);
+	return VectorMultiplyAdd(VectorAbs(NZ), ExtentZ, VectorMultiplyAdd(VectorAbs(NY), ExtentY, PushOut));
+}
+
+// Finishes one word of 32 objects starting at Index, clearing the bits past Count.
+FORCEINLINE void VectorStoreCullWordImpl(uint32* OutVisible, uint32 Outside, int32 Index, int32 Count)
+{
+	const uint32 WordMask = Count - Index >= 32 ? ~0u : (1u << (Count - Index)) - 1;
+	OutVisible[Index / 32] = ~Outside & WordMask;
+}
+
+FORCEINLINE int32 VectorCountVisibleImpl(const uint32* Visible, int32 Count)
+{
+	int32 NumVisible = 0;
+	for (int32 Word = 0; Word < (Count + 31) / 32; ++Word)
+	{
+		NumVisible += int32(FMath::CountBits(Visible[Word]));
+	}
+	return NumVisible;
+}
+
+template<typename ScalarType>
+inline int32 VectorCullSpheresSoAImpl(uint32* OutVisible, const ScalarType* const* Spheres, const ScalarType* Planes, int32 NumPlanes, int32 Count)
+{
+	typedef decltype(VectorSetFloat1(ScalarType(0))) RegisterType;
+	for (int32 Index = 0; Index < Count; Index += 32)
+	{
+		uint32 Outside = 0;
+		for (int32 Block = Index; Block < Index + 32 && Block < Count; Block += 8)
+		{
+			const RegisterType X0 = VectorLoadSoAImpl(Spheres[0], Block, Count), X1 = VectorLoadSoAImpl(Spheres[0], Block + 4, Count);
+			const RegisterType Y0 = VectorLoadSoAImpl(Spheres[1], Block, Count), Y1 = VectorLoadSoAImpl(Spheres[1], Block + 4, Count);
+			const RegisterType Z0 = VectorLoadSoAImpl(Spheres[2], Block, Count), Z1 = VectorLoadSoAImpl(Spheres[2], Block + 4, Count);
+			const RegisterType Radius0 = VectorLoadSoAImpl(Spheres[3], Block, Count), Radius1 = VectorLoadSoAImpl(Spheres[3], Block + 4, Count);
+			RegisterType Mask0 = VectorSetFloat1(ScalarType(0));
+			RegisterType Mask1 = Mask0;
+			for (int32 Plane = 0; Plane < NumPlanes; ++Plane)
+			{
+				const RegisterType NX = VectorSetFloat1(Planes[4 * Plane + 0]);
+				const RegisterType NY = VectorSetFloat1(Planes[4 * Plane + 1]);
+				const RegisterType NZ = VectorSetFloat1(Planes[4 * Plane + 2]);
+				const RegisterType NegW = VectorSetFloat1(-Planes[4 * Plane + 3]);
+				Mask0 = VectorBitwiseOr(Mask0, VectorCompareGT(VectorPlaneDistanceImpl(NX, NY, NZ, NegW, X0, Y0, Z0), Radius0));
+				Mask1 = VectorBitwiseOr(Mask1, VectorCompareGT(VectorPlaneDistanceImpl(NX, NY, NZ, NegW, X1, Y1, Z1), Radius1));
+			}
+			Outside |= (VectorMaskBits(Mask0) | (VectorMaskBits(Mask1) << 4)) << (Block - Index);
+		}
+		VectorStoreCullWordImpl(OutVisible, Outside, Index, Count);
+	}
+	return VectorCountVisibleImpl(OutVisible, Count);
+}
+
+template<typename ScalarType>
+inline int32 VectorCullBoxesSoAImpl(uint32* OutVisible, const ScalarType* const* Boxes, const ScalarType* Planes, int32 NumPlanes, int32 Count)
+{
+	typedef decltype(VectorSetFloat1(ScalarType(0))) RegisterType;
+	for (int32 Index = 0; Index < Count; Index += 32)
+	{
+		uint32 Outside = 0;
+		for (int32 Block = Index; Block < Index + 32 && Block < Count; Block += 8)
+		{
+			const RegisterType X0 = VectorLoadSoAImpl(Boxes[0], Block, Count), X1 = VectorLoadSoAImpl(Boxes[0], Block + 4, Count);
+			const RegisterType Y0 = VectorLoadSoAImpl(Boxes[1], Block, Count), Y1 = VectorLoadSoAImpl(Boxes[1], Block + 4, Count);
+			const RegisterType Z0 = VectorLoadSoAImpl(Boxes[2], Block, Count), Z1 = VectorLoadSoAImpl(Boxes[2], Block + 4, Count);
+			const RegisterType ExtentX0 = VectorLoadSoAImpl(Boxes[3], Block, Count), ExtentX1 = VectorLoadSoAImpl(Boxes[3], Block + 4, Count);
+			const RegisterType ExtentY0 = VectorLoadSoAImpl(Boxes[4], Block, Count), ExtentY1 = VectorLoadSoAImpl(Boxes[4], Block + 4, Count);
+			const RegisterType ExtentZ0 = VectorLoadSoAImpl(Boxes[5], Block, Count), ExtentZ1 = VectorLoadSoAImpl(Boxes[5], Block + 4, Count);
+			RegisterType Mask0 = VectorSetFloat1(ScalarType(0));
+			RegisterType Mask1 = Mask0;
+			for (int32 Plane = 0; Plane < NumPlanes; ++Plane)
+			{
+				const RegisterType NX = VectorSetFloat1(Planes[4 * Plane + 0]);
+				const RegisterType NY = VectorSetFloat1(Planes[4 * Plane + 1]);
+				const RegisterType NZ = VectorSetFloat1(Planes[4 * Plane + 2]);
+				const RegisterType NegW = VectorSetFloat1(-Planes[4 * Plane + 3]);
+				Mask0 = VectorBitwiseOr(Mask0, VectorCompareGT(VectorPlaneDistanceImpl(NX, NY, NZ, NegW, X0, Y0, Z0), VectorPlanePushOutImpl(NX, NY, NZ, ExtentX0, ExtentY0, ExtentZ0)));
+				Mask1 = VectorBitwiseOr(Mask1, VectorCompareGT(VectorPlaneDistanceImpl(NX, NY, NZ, NegW, X1, Y1, Z1), VectorPlanePushOutImpl(NX, NY, NZ, ExtentX1, ExtentY1, ExtentZ1)));
+			}
+			Outside |= (VectorMaskBits(Mask0) | (VectorMaskBits(Mask1) << 4)) << (Block - Index);
+		}
+		VectorStoreCullWordImpl(OutVisible, Outside, Index, Count);
+	}
+	return VectorCountVisibleImpl(OutVisible, Count);
+}
+
+/**
+ * Culls Count bounding spheres against NumPlanes planes given as X, Y, Z, W (an FPlane array) with normals pointing out
+ * of the volume. A sphere is visible unless its center is more than Radius in front of a plane.
+ *
+ * @param OutVisible	Receives (Count + 31) / 32 words, bits past Count in the last word are zero
+ * @param Spheres		Center X, Y, Z and Radius arrays of Count elements each
+ * @param Planes		NumPlanes planes, X, Y, Z and W each
+ * @param NumPlanes		Number of planes, 6 for a view frustum with a far plane
+ * @param Count			Number of spheres
+ * @return				Number of visible spheres
+ */
+inline int32 VectorCullSpheresSoA(uint32* OutVisible, const float* const* Spheres, const float* Planes, int32 NumPlanes, int32 Count)
+{
+	return VectorCullSpheresSoAImpl(OutVisible, Spheres, Planes, NumPlanes, Count);
+}
+
+inline int32 VectorCullSpheresSoA(uint32* OutVisible, const double* const* Spheres, const double* Planes, int32 NumPlanes, int32 Count)
+{
+	return VectorCullSpheresSoAImpl(OutVisible, Spheres, Planes, NumPlanes, Count);
+}
+
+/**
+ * Culls Count axis aligned boxes against NumPlanes planes, see VectorCullSpheresSoA. A box is visible unless its center
+ * is in front of a plane by more than |N.X| * Extent.X + |N.Y| * Extent.Y + |N.Z| * Extent.Z.
+ *
+ * @param OutVisible	Receives (Count + 31) / 32 words, bits past Count in the last word are zero
+ * @param Boxes			Center X, Y, Z and Extent X, Y, Z arrays of Count elements each
+ * @param Planes		NumPlanes planes, X, Y, Z and W each
+ * @param NumPlanes		Number of planes
+ * @param Count			Number of boxes
+ * @return				Number of visible boxes
+ */
+inline int32 VectorCullBoxesSoA(uint32* OutVisible, const float* const* Boxes, const float* Planes, int32 NumPlanes, int32 Count)
+{
+	return VectorCullBoxesSoAImpl(OutVisible, Boxes, Planes, NumPlanes, Count);
+}
+
+inline int32 VectorCullBoxesSoA(uint32* OutVisible, const double* const* Boxes, const double* Planes, int32 NumPlanes, int32 Count)
+{
+	return VectorCullBoxesSoAImpl(OutVisible, Boxes, Planes, NumPlanes, Count);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+// Streaming copy and fill
+//
+// API parity with the SSE path. VectorStoreAlignedStreamed is an ordinary store here and Neon has no portable
+// non-temporal store intrinsic, so both routines forward to memcpy / memset, whose AArch64 implementations already
+// switch to non-allocating stores (DC ZVA, STNP) for large sizes. The threshold is kept so callers can tune it the same
+// way on every platform.
+
+/**
+ * Returns the size from which VectorMemcpyStreamed and VectorMemsetStreamed would stream, 4 MB by default. No effect on Neon.
+ */
+CORE_API SIZE_T VectorGetStreamingThreshold();
+
+/**
+ * Overrides the streaming threshold. Copies already running on other threads may still use the previous value.
+ *
+ * @param Threshold	Size in bytes from which stores are streamed, 0 to always stream
+ */
+CORE_API void VectorSetStreamingThreshold(SIZE_T Threshold);
+
+/**
+ * memcpy for large buffers that are read much later, see the SSE version.
+ *
+ * @param Dst	Destination, any alignment
+ * @param Src	Source, any alignment, must not overlap Dst
+ * @param Size	Number of bytes
+ */
+CORE_API void VectorMemcpyStreamed(void* RESTRICT Dst, const void* RESTRICT Src, SIZE_T Size);
+
+/**
+ * memset for large buffers that are read much later, see the SSE version.
+ *
+ * @param Dst	Destination, any alignment
+ * @param Value	Byte to fill with
+ * @param Size	Number of bytes
+ */
+CORE_API void VectorMemsetStreamed(void* Dst, uint8 Value, SIZE_T Size);
+
+//////////////////////////////////////////////////////////////////////////
+// 8-wide registers
+//
+// Neon tops out at 128 bits, so the 8-wide types are pairs of 4-wide registers. They exist for API parity with the
+// SSE backend, where VectorRegister8Float / VectorRegister8Double map onto single AVX / AVX-512 registers.
+
+// 8 floats
+struct alignas(16) VectorRegister8Float
+{
+	VectorRegister4Float Lo;
+	VectorRegister4Float Hi;
+
+	FORCEINLINE VectorRegister4Float GetLo() const { return Lo; }
+	FORCEINLINE VectorRegister4Float GetHi() const { return Hi; }
+
+	FORCEINLINE VectorRegister8Float() = default;
+	FORCEINLINE VectorRegister8Float(const VectorRegister4Float& InLo, const VectorRegister4Float& InHi) : Lo(InLo), Hi(InHi) {}
+};
+
+// 8 doubles
+struct alignas(16) VectorRegister8Double
+{
+	VectorRegister4Double Lo;
+	VectorRegister4Double Hi;
+
+	FORCEINLINE VectorRegister4Double GetLo() const { return Lo; }
+	FORCEINLINE VectorRegister4Double GetHi() const { return Hi; }
+
+	FORCEINLINE VectorRegister8Double() = default;
+	FORCEINLINE VectorRegister8Double(const VectorRegister4Double& InLo, const VectorRegister4Double& InHi) : Lo(InLo), Hi(InHi) {}
+};
+
+typedef VectorRegister8Float VectorRegister8f;
+typedef VectorRegister8Double VectorRegister8d;
+
+FORCEINLINE VectorRegister8Float VectorZero8Float()
+{
+	return VectorRegister8Float(VectorZeroFloat(), VectorZeroFloat());
+}
+
+FORCEINLINE VectorRegister8Double VectorZero8Double()
+{
+	return VectorRegister8Double(VectorZeroDouble(), VectorZeroDouble());
+}
+
+FORCEINLINE VectorRegister8Float VectorSet8Float1(float F)
+{
+	const VectorRegister4Float Value = VectorSetFloat1(F);
+	return VectorRegister8Float(Value, Value);
+}
+
+FORCEINLINE VectorRegister8Double VectorSet8Double1(double D)
+{
+	const VectorRegister4Double Value = VectorSetFloat1(D);
+	return VectorRegister8Double(Value, Value);
+}
+
+FORCEINLINE VectorRegister8Float VectorLoad8(const float* Ptr)
+{
+	return VectorRegister8Float(VectorLoad(Ptr), VectorLoad(Ptr + 4));
+}
+
+FORCEINLINE VectorRegister8Double VectorLoad8(const double* Ptr)
+{
+	return VectorRegister8Double(VectorLoad(Ptr), VectorLoad(Ptr + 4));
+}
+
+FORCEINLINE VectorRegister8Float VectorLoad8Aligned(const float* Ptr)
+{
+	return VectorRegister8Float(VectorLoadAligned(Ptr), VectorLoadAligned(Ptr + 4));
+}
+
+FORCEINLINE VectorRegister8Double VectorLoad8Aligned(const double* Ptr)
+{
+	return VectorRegister8Double(VectorLoadAligned(Ptr), VectorLoadAligned(Ptr + 4));
+}
+
+FORCEINLINE void VectorStore(const VectorRegister8Float& Vec, float* Ptr)
+{
+	VectorStore(Vec.Lo, Ptr);
+	VectorStore(Vec.Hi, Ptr + 4);
+}
+
+FORCEINLINE void VectorStore(const VectorRegister8Double& Vec, double* Ptr)
+{
+	VectorStore(Vec.Lo, Ptr);
+	VectorStore(Vec.Hi, Ptr + 4);
+}
+
+FORCEINLINE void VectorStoreAligned(const VectorRegister8Float& Vec, float* Ptr)
+{
+	VectorStoreAligned(Vec.Lo, Ptr);
+	VectorStoreAligned(Vec.Hi, Ptr + 4);
+}
+
+FORCEINLINE void VectorStoreAligned(const VectorRegister8Double& Vec, double* Ptr)
+{
+	VectorStoreAligned(Vec.Lo, Ptr);
+	VectorStoreAligned(Vec.Hi, Ptr + 4);
+}
+
+FORCEINLINE VectorRegister8Float VectorAdd(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+	return VectorRegister8Float(VectorAdd(Vec1.Lo, Vec2.Lo), VectorAdd(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Double VectorAdd(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+	return VectorRegister8Double(VectorAdd(Vec1.Lo, Vec2.Lo), VectorAdd(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Float VectorSubtract(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+	return VectorRegister8Float(VectorSubtract(Vec1.Lo, Vec2.Lo), VectorSubtract(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Double VectorSubtract(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+	return VectorRegister8Double(VectorSubtract(Vec1.Lo, Vec2.Lo), VectorSubtract(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Float VectorMultiply(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+	return VectorRegister8Float(VectorMultiply(Vec1.Lo, Vec2.Lo), VectorMultiply(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Double VectorMultiply(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+	return VectorRegister8Double(VectorMultiply(Vec1.Lo, Vec2.Lo), VectorMultiply(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Float VectorDivide(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+	return VectorRegister8Float(VectorDivide(Vec1.Lo, Vec2.Lo), VectorDivide(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Double VectorDivide(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+	return VectorRegister8Double(VectorDivide(Vec1.Lo, Vec2.Lo), VectorDivide(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Float VectorMultiplyAdd(const VectorRegister8Float& A, const VectorRegister8Float& B, const VectorRegister8Float& C)
+{
+	return VectorRegister8Float(VectorMultiplyAdd(A.Lo, B.Lo, C.Lo), VectorMultiplyAdd(A.Hi, B.Hi, C.Hi));
+}
+
+FORCEINLINE VectorRegister8Double VectorMultiplyAdd(const VectorRegister8Double& A, const VectorRegister8Double& B, const VectorRegister8Double& C)
+{
+	return VectorRegister8Double(VectorMultiplyAdd(A.Lo, B.Lo, C.Lo), VectorMultiplyAdd(A.Hi, B.Hi, C.Hi));
+}
+
+FORCEINLINE VectorRegister8Float VectorNegateMultiplyAdd(const VectorRegister8Float& A, const VectorRegister8Float& B, const VectorRegister8Float& C)
+{
+	return VectorRegister8Float(VectorNegateMultiplyAdd(A.Lo, B.Lo, C.Lo), VectorNegateMultiplyAdd(A.Hi, B.Hi, C.Hi));
+}
+
+FORCEINLINE VectorRegister8Double VectorNegateMultiplyAdd(const VectorRegister8Double& A, const VectorRegister8Double& B, const VectorRegister8Double& C)
+{
+	return VectorRegister8Double(VectorNegateMultiplyAdd(A.Lo, B.Lo, C.Lo), VectorNegateMultiplyAdd(A.Hi, B.Hi, C.Hi));
+}
+
+FORCEINLINE VectorRegister8Float VectorNegate(const VectorRegister8Float& Vec)
+{
+	return VectorRegister8Float(VectorNegate(Vec.Lo), VectorNegate(Vec.Hi));
+}
+
+FORCEINLINE VectorRegister8Double VectorNegate(const VectorRegister8Double& Vec)
+{
+	return VectorRegister8Double(VectorNegate(Vec.Lo), VectorNegate(Vec.Hi));
+}
+
+FORCEINLINE VectorRegister8Float VectorAbs(const VectorRegister8Float& Vec)
+{
+	return VectorRegister8Float(VectorAbs(Vec.Lo), VectorAbs(Vec.Hi));
+}
+
+FORCEINLINE VectorRegister8Double VectorAbs(const VectorRegister8Double& Vec)
+{
+	return VectorRegister8Double(VectorAbs(Vec.Lo), VectorAbs(Vec.Hi));
+}
+
+FORCEINLINE VectorRegister8Float VectorMin(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+	return VectorRegister8Float(VectorMin(Vec1.Lo, Vec2.Lo), VectorMin(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Double VectorMin(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+	return VectorRegister8Double(VectorMin(Vec1.Lo, Vec2.Lo), VectorMin(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Float VectorMax(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+	return VectorRegister8Float(VectorMax(Vec1.Lo, Vec2.Lo), VectorMax(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Double VectorMax(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+	return VectorRegister8Double(VectorMax(Vec1.Lo, Vec2.Lo), VectorMax(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Float VectorSqrt(const VectorRegister8Float& Vec)
+{
+	return VectorRegister8Float(VectorSqrt(Vec.Lo), VectorSqrt(Vec.Hi));
+}
+
+FORCEINLINE VectorRegister8Double VectorSqrt(const VectorRegister8Double& Vec)
+{
+	return VectorRegister8Double(VectorSqrt(Vec.Lo), VectorSqrt(Vec.Hi));
+}
+
+FORCEINLINE VectorRegister8Float VectorReciprocalSqrt(const VectorRegister8Float& Vec)
+{
+	return VectorRegister8Float(VectorReciprocalSqrt(Vec.Lo), VectorReciprocalSqrt(Vec.Hi));
+}
+
+FORCEINLINE VectorRegister8Double VectorReciprocalSqrt(const VectorRegister8Double& Vec)
+{
+	return VectorRegister8Double(VectorReciprocalSqrt(Vec.Lo), VectorReciprocalSqrt(Vec.Hi));
+}
+
+FORCEINLINE VectorRegister8Float VectorReciprocalSqrtEstimate(const VectorRegister8Float& Vec)
+{
+	return VectorRegister8Float(VectorReciprocalSqrtEstimate(Vec.Lo), VectorReciprocalSqrtEstimate(Vec.Hi));
+}
+
+FORCEINLINE VectorRegister8Double VectorReciprocalSqrtEstimate(const VectorRegister8Double& Vec)
+{
+	return VectorRegister8Double(VectorReciprocalSqrtEstimate(Vec.Lo), VectorReciprocalSqrtEstimate(Vec.Hi));
+}
+
+FORCEINLINE VectorRegister8Float VectorCompareEQ(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+	return VectorRegister8Float(VectorCompareEQ(Vec1.Lo, Vec2.Lo), VectorCompareEQ(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Double VectorCompareEQ(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+	return VectorRegister8Double(VectorCompareEQ(Vec1.Lo, Vec2.Lo), VectorCompareEQ(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Float VectorCompareNE(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+	return VectorRegister8Float(VectorCompareNE(Vec1.Lo, Vec2.Lo), VectorCompareNE(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Double VectorCompareNE(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+	return VectorRegister8Double(VectorCompareNE(Vec1.Lo, Vec2.Lo), VectorCompareNE(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Float VectorCompareGT(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+	return VectorRegister8Float(VectorCompareGT(Vec1.Lo, Vec2.Lo), VectorCompareGT(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Double VectorCompareGT(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+	return VectorRegister8Double(VectorCompareGT(Vec1.Lo, Vec2.Lo), VectorCompareGT(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Float VectorCompareGE(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+	return VectorRegister8Float(VectorCompareGE(Vec1.Lo, Vec2.Lo), VectorCompareGE(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Double VectorCompareGE(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+	return VectorRegister8Double(VectorCompareGE(Vec1.Lo, Vec2.Lo), VectorCompareGE(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Float VectorCompareLT(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+	return VectorRegister8Float(VectorCompareLT(Vec1.Lo, Vec2.Lo), VectorCompareLT(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Double VectorCompareLT(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+	return VectorRegister8Double(VectorCompareLT(Vec1.Lo, Vec2.Lo), VectorCompareLT(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Float VectorCompareLE(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+	return VectorRegister8Float(VectorCompareLE(Vec1.Lo, Vec2.Lo), VectorCompareLE(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Double VectorCompareLE(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+	return VectorRegister8Double(VectorCompareLE(Vec1.Lo, Vec2.Lo), VectorCompareLE(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Float VectorSelect(const VectorRegister8Float& Mask, const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+	return VectorRegister8Float(VectorSelect(Mask.Lo, Vec1.Lo, Vec2.Lo), VectorSelect(Mask.Hi, Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Double VectorSelect(const VectorRegister8Double& Mask, const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+	return VectorRegister8Double(VectorSelect(Mask.Lo, Vec1.Lo, Vec2.Lo), VectorSelect(Mask.Hi, Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Float VectorBitwiseAnd(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+	return VectorRegister8Float(VectorBitwiseAnd(Vec1.Lo, Vec2.Lo), VectorBitwiseAnd(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Double VectorBitwiseAnd(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+	return VectorRegister8Double(VectorBitwiseAnd(Vec1.Lo, Vec2.Lo), VectorBitwiseAnd(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Float VectorBitwiseOr(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+	return VectorRegister8Float(VectorBitwiseOr(Vec1.Lo, Vec2.Lo), VectorBitwiseOr(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Double VectorBitwiseOr(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+	return VectorRegister8Double(VectorBitwiseOr(Vec1.Lo, Vec2.Lo), VectorBitwiseOr(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Float VectorBitwiseXor(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+	return VectorRegister8Float(VectorBitwiseXor(Vec1.Lo, Vec2.Lo), VectorBitwiseXor(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE VectorRegister8Double VectorBitwiseXor(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+	return VectorRegister8Double(VectorBitwiseXor(Vec1.Lo, Vec2.Lo), VectorBitwiseXor(Vec1.Hi, Vec2.Hi));
+}
+
+FORCEINLINE uint32 VectorMaskBits(const VectorRegister8Float& VecMask)
+{
+	return (VectorMaskBits(VecMask.Hi) << 4) | VectorMaskBits(VecMask.Lo);
+}
+
+FORCEINLINE uint32 VectorMaskBits(const VectorRegister8Double& VecMask)
+{
+	return (VectorMaskBits(VecMask.Hi) << 4) | VectorMaskBits(VecMask.Lo);
+}
+
+// Same summation order as the SSE backend: ((V0 + V4) + (V2 + V6)) + ((V1 + V5) + (V3 + V7)).
+FORCEINLINE float VectorReduceAdd(const VectorRegister8Float& Vec)
+{
+	const float32x4_t Sum = VectorAdd(Vec.Lo, Vec.Hi);
+	return vpadds_f32(vadd_f32(vget_low_f32(Sum), vget_high_f32(Sum)));
+}
+
+FORCEINLINE double VectorReduceAdd(const VectorRegister8Double& Vec)
+{
+	const VectorRegister4Double Sum = VectorAdd(Vec.Lo, Vec.Hi);
+	return vpaddd_f64(vaddq_f64(Sum.XY, Sum.ZW));
+}
+
+FORCEINLINE float VectorReduceMin(const VectorRegister8Float& Vec)
+{
+	return vminvq_f32(VectorMin(Vec.Lo, Vec.Hi));
+}
+
+FORCEINLINE double VectorReduceMin(const VectorRegister8Double& Vec)
+{
+	const VectorRegister4Double Min = VectorMin(Vec.Lo, Vec.Hi);
+	return vminvq_f64(vminq_f64(Min.XY, Min.ZW));
+}
+
+FORCEINLINE float VectorReduceMax(const VectorRegister8Float& Vec)
+{
+	return vmaxvq_f32(VectorMax(Vec.Lo, Vec.Hi));
+}
+
+FORCEINLINE double VectorReduceMax(const VectorRegister8Double& Vec)
+{
+	const VectorRegister4Double Max = VectorMax(Vec.Lo, Vec.Hi);
+	return vmaxvq_f64(vmaxq_f64(Max.XY, Max.ZW));
+}
+
+/**
+ * Transposes the 8x8 matrix held in Rows, so that afterwards Rows[N] holds component N of each of the original rows.
+ *
+ * @param Rows	Rows of the matrix, replaced by its columns
+ */
+FORCEINLINE void VectorTranspose8x8(VectorRegister8Float (&Rows)[8])
+{
+	// Transpose the four 4x4 blocks, then swap the two off-diagonal ones.
+	VectorTranspose4x4(Rows[0].Lo, Rows[1].Lo, Rows[2].Lo, Rows[3].Lo);
+	VectorTranspose4x4(Rows[0].Hi, Rows[1].Hi, Rows[2].Hi, Rows[3].Hi);
+	VectorTranspose4x4(Rows[4].Lo, Rows[5].Lo, Rows[6].Lo, Rows[7].Lo);
+	VectorTranspose4x4(Rows[4].Hi, Rows[5].Hi, Rows[6].Hi, Rows[7].Hi);
+	for (int32 Row = 0; Row < 4; ++Row)
+	{
+		const VectorRegister4Float Block = Rows[Row].Hi;
+		Rows[Row].Hi = Rows[Row + 4].Lo;
+		Rows[Row + 4].Lo = Block;
+	}
+}
+
+FORCEINLINE void VectorTranspose8x8(VectorRegister8Double (&Rows)[8])
+{
+	VectorTranspose4x4(Rows[0].Lo, Rows[1].Lo, Rows[2].Lo, Rows[3].Lo);
+	VectorTranspose4x4(Rows[0].Hi, Rows[1].Hi, Rows[2].Hi, Rows[3].Hi);
+	VectorTranspose4x4(Rows[4].Lo, Rows[5].Lo, Rows[6].Lo, Rows[7].Lo);
+	VectorTranspose4x4(Rows[4].Hi, Rows[5].Hi, Rows[6].Hi, Rows[7].Hi);
+	for (int32 Row = 0; Row < 4; ++Row)
+	{
+		const VectorRegister4Double Block = Rows[Row].Hi;
+		Rows[Row].Hi = Rows[Row + 4].Lo;
+		Rows[Row + 4].Lo = Block;
+	}
+}
+
 //////////////////////////////////////////////////////////////////////////
 //Integer ops
 
@@ -232,6 +232,18 @@ struct VectorRegisterConstInit {};
 #define UE_PLATFORM_MATH_REQUIRES_AVX_CHECKS			PLATFORM_REQUIRES_AVX_CHECKS
 #endif
 
+// Bulk routines (array transforms, half conversion) pick their AVX2/AVX-512 kernels once at runtime through cpuid
+// when the build baseline is lower than what the running CPU may support.
+#ifndef UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+#define UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH			((UE_PLATFORM_MATH_REQUIRES_AVX_2_CHECKS && !UE_PLATFORM_MATH_USE_AVX_2) || (UE_PLATFORM_MATH_REQUIRES_AVX_512_CHECKS && !UE_PLATFORM_MATH_USE_AVX_512))
+#endif
+
+// The AVX and wider kernels of the bulk routines live in Private/Math/UnrealMathSSEBulk.cpp, either picked at runtime or
+// fixed by the build's minimum ISA. Plain SSE builds without runtime dispatch never leave the inline SSE loops.
+#ifndef UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+#define UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS		(UE_PLATFORM_MATH_USE_AVX || UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH)
+#endif
+
 #ifndef UE_PLATFORM_MATH_SUPPORTS_SVML
 	#if defined(PLATFORM_ALWAYS_HAS_SVML) && (PLATFORM_ALWAYS_HAS_SVML >= 1)
 		#define UE_PLATFORM_MATH_SUPPORTS_SVML			1
@@ -274,6 +286,8 @@ struct VectorRegisterConstInit {};
 #include <immintrin.h>
 #endif
 
+
+
 #define UE_SSE_FLOAT_ALIGNMENT	16
 
 #if UE_PLATFORM_MATH_USE_AVX
@@ -2011,12 +2025,21 @@ FORCEINLINE VectorRegister4Double VectorCompareLE(const VectorRegister4Double& V
 
 FORCEINLINE VectorRegister4Float VectorSelect(const VectorRegister4Float& Mask, const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2 )
 {
+#if UE_PLATFORM_MATH_USE_AVX_512_VL
+	// Single vpternlog, truth table 0xCA is Mask ? Vec1 : Vec2 per bit.
+	return _mm_castsi128_ps(_mm_ternarylogic_epi32(_mm_castps_si128(Mask), _mm_castps_si128(Vec1), _mm_castps_si128(Vec2), 0xCA));
+#else
 	return _mm_xor_ps(Vec2, _mm_and_ps(Mask, _mm_xor_ps(Vec1, Vec2)));
+#endif
 }
 
 FORCEINLINE VectorRegister2Double VectorSelect(const VectorRegister2Double& Mask, const VectorRegister2Double& Vec1, const VectorRegister2Double& Vec2)
 {
+#if UE_PLATFORM_MATH_USE_AVX_512_VL
+	return _mm_castsi128_pd(_mm_ternarylogic_epi64(_mm_castpd_si128(Mask), _mm_castpd_si128(Vec1), _mm_castpd_si128(Vec2), 0xCA));
+#else
 	return _mm_xor_pd(Vec2, _mm_and_pd(Mask, _mm_xor_pd(Vec1, Vec2)));
+#endif
 }
 
 FORCEINLINE VectorRegister4Double VectorSelect(const VectorRegister4Double& Mask, const VectorRegister4Double& Vec1, const VectorRegister4Double& Vec2)
@@ -2025,6 +2048,8 @@ FORCEINLINE VectorRegister4Double VectorSelect(const VectorRegister4Double& Mask
 #if !UE_PLATFORM_MATH_USE_AVX
 	Result.XY = VectorSelect(Mask.XY, Vec1.XY, Vec2.XY);
 	Result.ZW = VectorSelect(Mask.ZW, Vec1.ZW, Vec2.ZW);
+#elif UE_PLATFORM_MATH_USE_AVX_512_VL
+	Result = _mm256_castsi256_pd(_mm256_ternarylogic_epi64(_mm256_castpd_si256(Mask), _mm256_castpd_si256(Vec1), _mm256_castpd_si256(Vec2), 0xCA));
 #else
 	Result = _mm256_xor_pd(Vec2, _mm256_and_pd(Mask, _mm256_xor_pd(Vec1, Vec2)));
 #endif
@@ -2160,24 +2185,6 @@ FORCEINLINE VectorRegister4Float VectorPow( const VectorRegister4Float& Base, co
 */
 }
 
-FORCEINLINE VectorRegister4Double VectorPow(const VectorRegister4Double& Base, const VectorRegister4Double& Exponent)
-{
-#if UE_PLATFORM_MATH_USE_SVML_AVX
-	return _mm256_pow_pd(Base, Exponent);
-#elif UE_PLATFORM_MATH_USE_SVML
-	return VectorRegister4Double(_mm_pow_pd(Base.XY, Exponent.XY), _mm_pow_pd(Base.ZW, Exponent.ZW));
-#else
-	AlignedDouble4 Values(Base);
-	AlignedDouble4 Exponents(Exponent);
-
-	Values[0] = FMath::Pow(Values[0], Exponents[0]);
-	Values[1] = FMath::Pow(Values[1], Exponents[1]);
-	Values[2] = FMath::Pow(Values[2], Exponents[2]);
-	Values[3] = FMath::Pow(Values[3], Exponents[3]);
-	return Values.ToVectorRegister();
-#endif
-}
-
 /**
  * Return the square root of each component
  *
@@ -2442,6 +2449,106 @@ FORCEINLINE VectorRegister4Double VectorSet_W1(const VectorRegister4Double& Vec)
 CORE_API void VectorMatrixMultiply(FMatrix44f* Result, const FMatrix44f* Matrix1, const FMatrix44f* Matrix2);
 CORE_API void VectorMatrixMultiply(FMatrix44d* Result, const FMatrix44d* Matrix1, const FMatrix44d* Matrix2);
 
+namespace SSEVectorHelperFuncs
+{
+	// 2x2 block helpers for InternalVectorMatrixInverse. A 2x2 matrix is stored row major in one register as (m00, m01, m10, m11).
+
+	// A * B
+	template<typename RegisterType>
+	FORCEINLINE RegisterType InternalMatrix2x2Multiply(const RegisterType& A, const RegisterType& B)
+	{
+		return VectorMultiplyAdd(A, VectorSwizzle(B, 0, 3, 0, 3), VectorMultiply(VectorSwizzle(A, 1, 0, 3, 2), VectorSwizzle(B, 2, 1, 2, 1)));
+	}
+
+	// adj(A) * B
+	template<typename RegisterType>
+	FORCEINLINE RegisterType InternalMatrix2x2AdjMultiply(const RegisterType& A, const RegisterType& B)
+	{
+		return VectorSubtract(VectorMultiply(VectorSwizzle(A, 3, 3, 0, 0), B), VectorMultiply(VectorSwizzle(A, 1, 1, 2, 2), VectorSwizzle(B, 2, 3, 0, 1)));
+	}
+
+	// A * adj(B)
+	template<typename RegisterType>
+	FORCEINLINE RegisterType InternalMatrix2x2MultiplyAdj(const RegisterType& A, const RegisterType& B)
+	{
+		return VectorSubtract(VectorMultiply(A, VectorSwizzle(B, 3, 0, 3, 0)), VectorMultiply(VectorSwizzle(A, 1, 0, 3, 2), VectorSwizzle(B, 2, 1, 2, 1)));
+	}
+
+	/**
+	 * Inverts a 4x4 matrix through its 2x2 blocks (M = [A B; C D]), shared by the float and double VectorMatrixInverse.
+	 * Matches FMath::MatrixInverse: a zero or non-finite determinant stores identity and returns false.
+	 */
+	template<typename ScalarType, typename MatrixType>
+	FORCEINLINE bool InternalVectorMatrixInverse(MatrixType* DstMatrix, const MatrixType* SrcMatrix)
+	{
+		// Warning: FMatrix44d alignment may not match VectorRegister4Double, so load the rows unaligned.
+		typedef ScalarType Scalar4x4[4][4];
+		const Scalar4x4& SrcRows = *((const Scalar4x4*)SrcMatrix);
+		Scalar4x4& DstRows = *((Scalar4x4*)DstMatrix);
+
+		typedef decltype(VectorLoad(SrcRows[0])) RegisterType;
+		const RegisterType Row0 = VectorLoad(SrcRows[0]);
+		const RegisterType Row1 = VectorLoad(SrcRows[1]);
+		const RegisterType Row2 = VectorLoad(SrcRows[2]);
+		const RegisterType Row3 = VectorLoad(SrcRows[3]);
+
+		const RegisterType A = VectorShuffle(Row0, Row1, 0, 1, 0, 1);
+		const RegisterType B = VectorShuffle(Row0, Row1, 2, 3, 2, 3);
+		const RegisterType C = VectorShuffle(Row2, Row3, 0, 1, 0, 1);
+		const RegisterType D = VectorShuffle(Row2, Row3, 2, 3, 2, 3);
+
+		// (|A|, |B|, |C|, |D|)
+		const RegisterType DetSub = VectorSubtract(
+			VectorMultiply(VectorShuffle(Row0, Row2, 0, 2, 0, 2), VectorShuffle(Row1, Row3, 1, 3, 1, 3)),
+			VectorMultiply(VectorShuffle(Row0, Row2, 1, 3, 1, 3), VectorShuffle(Row1, Row3, 0, 2, 0, 2)));
+		const RegisterType DetA = VectorReplicate(DetSub, 0);
+		const RegisterType DetB = VectorReplicate(DetSub, 1);
+		const RegisterType DetC = VectorReplicate(DetSub, 2);
+		const RegisterType DetD = VectorReplicate(DetSub, 3);
+
+		const RegisterType D_C = InternalMatrix2x2AdjMultiply(D, C);
+		const RegisterType A_B = InternalMatrix2x2AdjMultiply(A, B);
+
+		// Adjugates of the blocks of the inverse, inv(M) = 1/|M| * [X Y; Z W]
+		RegisterType X_ = VectorSubtract(VectorMultiply(DetD, A), InternalMatrix2x2Multiply(B, D_C));
+		RegisterType W_ = VectorSubtract(VectorMultiply(DetA, D), InternalMatrix2x2Multiply(C, A_B));
+		RegisterType Y_ = VectorSubtract(VectorMultiply(DetB, C), InternalMatrix2x2MultiplyAdj(D, A_B));
+		RegisterType Z_ = VectorSubtract(VectorMultiply(DetC, B), InternalMatrix2x2MultiplyAdj(A, D_C));
+
+		// |M| = |A||D| + |B||C| - tr(adj(A) B adj(D) C)
+		RegisterType Trace = VectorMultiply(A_B, VectorSwizzle(D_C, 0, 2, 1, 3));
+		Trace = VectorAdd(Trace, VectorSwizzle(Trace, 2, 3, 0, 1));
+		Trace = VectorAdd(Trace, VectorSwizzle(Trace, 1, 0, 3, 2));
+		const RegisterType DetM = VectorSubtract(VectorMultiplyAdd(DetB, DetC, VectorMultiply(DetA, DetD)), Trace);
+
+		// Same rejection as FMath::MatrixInverse
+		ScalarType Det;
+		VectorStoreFloat1(DetM, &Det);
+		if (Det == ScalarType(0) || !FMath::IsFinite(Det))
+		{
+			VectorStore(MakeVectorRegister(ScalarType(1), ScalarType(0), ScalarType(0), ScalarType(0)), DstRows[0]);
+			VectorStore(MakeVectorRegister(ScalarType(0), ScalarType(1), ScalarType(0), ScalarType(0)), DstRows[1]);
+			VectorStore(MakeVectorRegister(ScalarType(0), ScalarType(0), ScalarType(1), ScalarType(0)), DstRows[2]);
+			VectorStore(MakeVectorRegister(ScalarType(0), ScalarType(0), ScalarType(0), ScalarType(1)), DstRows[3]);
+			return false;
+		}
+
+		// The adjugate sign pattern is folded into the reciprocal: (1, -1, -1, 1) / |M|
+		const RegisterType RcpDetM = VectorDivide(MakeVectorRegister(ScalarType(1), ScalarType(-1), ScalarType(-1), ScalarType(1)), DetM);
+		X_ = VectorMultiply(X_, RcpDetM);
+		Y_ = VectorMultiply(Y_, RcpDetM);
+		Z_ = VectorMultiply(Z_, RcpDetM);
+		W_ = VectorMultiply(W_, RcpDetM);
+
+		// Undo the adjugate swizzle and reassemble the rows in one shuffle each.
+		VectorStore(VectorShuffle(X_, Y_, 3, 1, 3, 1), DstRows[0]);
+		VectorStore(VectorShuffle(X_, Y_, 2, 0, 2, 0), DstRows[1]);
+		VectorStore(VectorShuffle(Z_, W_, 3, 1, 3, 1), DstRows[2]);
+		VectorStore(VectorShuffle(Z_, W_, 2, 0, 2, 0), DstRows[3]);
+		return true;
+	}
+} // namespace SSEVectorHelperFuncs
+
 /**
  * Calculate the inverse of an FMatrix44.  Src == Dst is allowed
  *
@@ -2452,11 +2559,11 @@ CORE_API void VectorMatrixMultiply(FMatrix44d* Result, const FMatrix44d* Matrix1
  */
 FORCEINLINE bool VectorMatrixInverse(FMatrix44d* DstMatrix, const FMatrix44d* SrcMatrix)
 {
-	return FMath::MatrixInverse(DstMatrix,SrcMatrix);
+	return SSEVectorHelperFuncs::InternalVectorMatrixInverse<double>(DstMatrix, SrcMatrix);
 }
 FORCEINLINE bool VectorMatrixInverse(FMatrix44f* DstMatrix, const FMatrix44f* SrcMatrix)
 {
-	return FMath::MatrixInverse(DstMatrix,SrcMatrix);
+	return SSEVectorHelperFuncs::InternalVectorMatrixInverse<float>(DstMatrix, SrcMatrix);
 }
 
 /**
@@ -2562,6 +2669,314 @@ FORCEINLINE VectorRegister4Double VectorTransformVector(const VectorRegister4Dou
 	return VTempX;
 }
 
+/** What a buffer scan such as VectorScanNonFiniteArray found: how many values were flagged and where the first one is. */
+struct FVectorScanResult
+{
+	/** Number of flagged values */
+	int32 NumFound = 0;
+	/** Index of the first flagged value, -1 when nothing was flagged */
+	int32 FirstIndex = -1;
+};
+
+namespace SSEVectorHelperFuncs
+{
+	// Adds the flagged values of the block starting at Index to Result, bit N of Bits standing for element Index + N.
+	FORCEINLINE void InternalAddScanHits(FVectorScanResult& Result, int32 Index, uint64 Bits)
+	{
+		if (Result.FirstIndex < 0)
+		{
+			Result.FirstIndex = Index + int32(FMath::CountTrailingZeros64(Bits));
+		}
+		Result.NumFound += int32(FMath::CountBits(Bits));
+	}
+
+	// Folds stored bounds accumulators into InOutMin/InOutMax. Lane N accumulated component (N / LanesPerComponent) % 3.
+	template<typename ScalarType>
+	FORCEINLINE void InternalFoldBoundsLanes(const ScalarType* MinLanes, const ScalarType* MaxLanes, int32 NumLanes, int32 LanesPerComponent, ScalarType* InOutMin, ScalarType* InOutMax)
+	{
+		for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+		{
+			const int32 Component = (Lane / LanesPerComponent) % 3;
+			InOutMin[Component] = FMath::Min(InOutMin[Component], MinLanes[Lane]);
+			InOutMax[Component] = FMath::Max(InOutMax[Component], MaxLanes[Lane]);
+		}
+	}
+
+	// Shared width-4 SoA transform body, also used for the remainder of the wider AVX loops. Returns the number of elements processed.
+	template<typename ScalarType>
+	FORCEINLINE int32 InternalVectorTransformVectorSoA4(const ScalarType (&M)[4][4], ScalarType* OutX, ScalarType* OutY, ScalarType* OutZ, ScalarType* OutW, const ScalarType* InX, const ScalarType* InY, const ScalarType* InZ, ScalarType InW, int32 Start, int32 Count)
+	{
+		typedef decltype(VectorSetFloat1(InW)) RegisterType;
+		RegisterType Rows[3][4];
+		RegisterType Offset[4];
+		for (int32 Column = 0; Column < 4; ++Column)
+		{
+			Rows[0][Column] = VectorSetFloat1(M[0][Column]);
+			Rows[1][Column] = VectorSetFloat1(M[1][Column]);
+			Rows[2][Column] = VectorSetFloat1(M[2][Column]);
+			Offset[Column] = VectorSetFloat1(InW * M[3][Column]);
+		}
+
+		int32 Index = Start;
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			const RegisterType X = VectorLoad(InX + Index);
+			const RegisterType Y = VectorLoad(InY + Index);
+			const RegisterType Z = VectorLoad(InZ + Index);
+			VectorStore(VectorMultiplyAdd(Z, Rows[2][0], VectorMultiplyAdd(Y, Rows[1][0], VectorMultiplyAdd(X, Rows[0][0], Offset[0]))), OutX + Index);
+			VectorStore(VectorMultiplyAdd(Z, Rows[2][1], VectorMultiplyAdd(Y, Rows[1][1], VectorMultiplyAdd(X, Rows[0][1], Offset[1]))), OutY + Index);
+			VectorStore(VectorMultiplyAdd(Z, Rows[2][2], VectorMultiplyAdd(Y, Rows[1][2], VectorMultiplyAdd(X, Rows[0][2], Offset[2]))), OutZ + Index);
+			if (OutW)
+			{
+				VectorStore(VectorMultiplyAdd(Z, Rows[2][3], VectorMultiplyAdd(Y, Rows[1][3], VectorMultiplyAdd(X, Rows[0][3], Offset[3]))), OutW + Index);
+			}
+		}
+		return Index;
+	}
+
+	template<typename ScalarType>
+	FORCEINLINE void InternalVectorTransformVectorSoAScalar(const ScalarType (&M)[4][4], ScalarType* OutX, ScalarType* OutY, ScalarType* OutZ, ScalarType* OutW, const ScalarType* InX, const ScalarType* InY, const ScalarType* InZ, ScalarType InW, int32 Start, int32 Count)
+	{
+		for (int32 Index = Start; Index < Count; ++Index)
+		{
+			const ScalarType X = InX[Index];
+			const ScalarType Y = InY[Index];
+			const ScalarType Z = InZ[Index];
+			OutX[Index] = X * M[0][0] + Y * M[1][0] + Z * M[2][0] + InW * M[3][0];
+			OutY[Index] = X * M[0][1] + Y * M[1][1] + Z * M[2][1] + InW * M[3][1];
+			OutZ[Index] = X * M[0][2] + Y * M[1][2] + Z * M[2][2] + InW * M[3][2];
+			if (OutW)
+			{
+				OutW[Index] = X * M[0][3] + Y * M[1][3] + Z * M[2][3] + InW * M[3][3];
+			}
+		}
+	}
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	// AVX, AVX2 and AVX-512 kernels of the bulk routines below, compiled out of line in Private/Math/UnrealMathSSEBulk.cpp.
+	// Each one continues at Index with the widest kernel the build, or with runtime dispatch the running CPU, supports and
+	// returns the index the caller's SSE loop continues from; Index itself when there is no wide kernel for the routine.
+	CORE_API int32 InternalVectorTransformVectorArrayWide(VectorRegister4Float* Dst, const VectorRegister4Float* Src, int32 Index, int32 Count, const float* MRows);
+	CORE_API int32 InternalVectorTransformVectorArrayWide(VectorRegister4Double* Dst, const VectorRegister4Double* Src, int32 Index, int32 Count, const double* MRows);
+	CORE_API int32 InternalVectorTransformVectorSoAWide(const float (&M)[4][4], float* OutX, float* OutY, float* OutZ, float* OutW, const float* InX, const float* InY, const float* InZ, float InW, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorTransformVectorSoAWide(const double (&M)[4][4], double* OutX, double* OutY, double* OutZ, double* OutW, const double* InX, const double* InY, const double* InZ, double InW, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorFloatToHalfArrayWide(uint16* RESTRICT Dst, const float* RESTRICT Src, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorHalfToFloatArrayWide(float* RESTRICT Dst, const uint16* RESTRICT Src, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorMatrixMultiplyArrayWide(float* Result, const float* Matrix1, const float* Matrix2, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorMatrixMultiplyArrayWide(double* Result, const double* Matrix1, const double* Matrix2, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorLoadByte4ArrayWide(float* RESTRICT Dst, const uint8* RESTRICT Src, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorStoreByte4ArrayWide(uint8* RESTRICT Dst, const float* RESTRICT Src, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorLoadURGB10A2NArrayWide(float* RESTRICT Dst, const uint32* RESTRICT Src, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorStoreURGB10A2NArrayWide(uint32* RESTRICT Dst, const float* RESTRICT Src, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorLoadURGBA16NArrayWide(float* RESTRICT Dst, const uint16* RESTRICT Src, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorLoadSRGBA16NArrayWide(float* RESTRICT Dst, const int16* RESTRICT Src, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorStoreURGBA16NArrayWide(uint16* RESTRICT Dst, const float* RESTRICT Src, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorQuaternionMultiplySoAWide(float* const* Result, const float* const* Quat1, const float* const* Quat2, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorQuaternionMultiplySoAWide(double* const* Result, const double* const* Quat1, const double* const* Quat2, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorQuaternionNormalizeSoAWide(float* const* Result, const float* const* Quat, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorQuaternionNormalizeSoAWide(double* const* Result, const double* const* Quat, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorQuaternionNLerpSoAWide(float* const* Result, const float* const* Quat1, const float* const* Quat2, const float* Alpha, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorQuaternionNLerpSoAWide(double* const* Result, const double* const* Quat1, const double* const* Quat2, const double* Alpha, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorQuaternionRotateVectorSoAWide(float* const* Result, const float* const* Quat, const float* const* Vector, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorQuaternionRotateVectorSoAWide(double* const* Result, const double* const* Quat, const double* const* Vector, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorFloatToBFloat16ArrayWide(uint16* RESTRICT Dst, const float* RESTRICT Src, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorBFloat16ToFloatArrayWide(float* RESTRICT Dst, const uint16* RESTRICT Src, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorMatrixVectorMultiplyBFloat16Wide(float* RESTRICT Result, const uint16* RESTRICT Matrix, const uint16* RESTRICT Vector, int32 NumColumns, int32 Row, int32 NumRows);
+	CORE_API int32 InternalVectorAoSToSoAWide(float* const* Dst, const float* Src, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorAoSToSoAWide(double* const* Dst, const double* Src, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorSoAToAoSWide(float* Dst, const float* const* Src, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorSoAToAoSWide(double* Dst, const double* const* Src, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorScanOutOfRangeArrayWide(const float* Src, int32 Index, int32 Count, float MinValue, float MaxValue, FVectorScanResult& Result);
+	CORE_API int32 InternalVectorScanOutOfRangeArrayWide(const uint16* Src, int32 Index, int32 Count, float MinValue, float MaxValue, FVectorScanResult& Result);
+	CORE_API int32 InternalVectorComputeBoundsPackedWide(const float* Points, int32 Index, int32 Count, float* InOutMin, float* InOutMax);
+	CORE_API int32 InternalVectorComputeBoundsPackedWide(const double* Points, int32 Index, int32 Count, double* InOutMin, double* InOutMax);
+	CORE_API int32 InternalVectorComputeBoundsStridedWide(const float* Points, int32 Stride, int32 Index, int32 Count, float* InOutMin, float* InOutMax);
+	CORE_API int32 InternalVectorComputeBoundsStridedWide(const double* Points, int32 Stride, int32 Index, int32 Count, double* InOutMin, double* InOutMax);
+	CORE_API int32 InternalVectorComputeBoundsSoAWide(const float* const* Components, int32 Index, int32 Count, float* InOutMin, float* InOutMax);
+	CORE_API int32 InternalVectorComputeBoundsSoAWide(const double* const* Components, int32 Index, int32 Count, double* InOutMin, double* InOutMax);
+	CORE_API int32 InternalVectorComputeBoundingRadiusStridedWide(const float* Points, int32 Stride, int32 Index, int32 Count, const float* Center, float& InOutRadiusSquared);
+	CORE_API int32 InternalVectorComputeBoundingRadiusStridedWide(const double* Points, int32 Stride, int32 Index, int32 Count, const double* Center, double& InOutRadiusSquared);
+	CORE_API int32 InternalVectorComputeBoundingRadiusSoAWide(const float* const* Components, int32 Index, int32 Count, const float* Center, float& InOutRadiusSquared);
+	CORE_API int32 InternalVectorComputeBoundingRadiusSoAWide(const double* const* Components, int32 Index, int32 Count, const double* Center, double& InOutRadiusSquared);
+	CORE_API int32 InternalVectorCullSpheresSoAWide(uint32* OutVisible, const float* const* Spheres, const float* Planes, int32 NumPlanes, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorCullSpheresSoAWide(uint32* OutVisible, const double* const* Spheres, const double* Planes, int32 NumPlanes, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorCullBoxesSoAWide(uint32* OutVisible, const float* const* Boxes, const float* Planes, int32 NumPlanes, int32 Index, int32 Count);
+	CORE_API int32 InternalVectorCullBoxesSoAWide(uint32* OutVisible, const double* const* Boxes, const double* Planes, int32 NumPlanes, int32 Index, int32 Count);
+#endif // UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+} // namespace SSEVectorHelperFuncs
+
+#if UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+/** Kernel sets the runtime dispatched bulk routines pick from. */
+enum class EVectorBulkLevel : uint8
+{
+	SSE,		// Caller's SSE code, plus the AVX-only kernels on AVX builds
+	AVX2,		// AVX2 + FMA3 + F16C
+	AVX512,		// AVX-512 F/VL/DQ/BW
+	AVX512BF16,	// AVX512 + AVX512_BF16
+};
+
+/** Widest kernel set the running CPU and OS support, probed with cpuid once per process. */
+CORE_API EVectorBulkLevel GetSupportedVectorBulkLevel();
+
+/** Kernel set the bulk routines currently use, the supported level unless SetVectorBulkLevel lowered it. */
+CORE_API EVectorBulkLevel GetVectorBulkLevel();
+
+/**
+ * Makes the bulk routines use the kernels of Level, clamped to GetSupportedVectorBulkLevel(). Meant for benchmarks and
+ * tests comparing the kernel sets: calls already running on other threads finish with the set they started with.
+ */
+CORE_API void SetVectorBulkLevel(EVectorBulkLevel Level);
+#endif // UE_PLATFORM_MATH_USE_RUNTIME_DISPATCH
+
+/**
+ * Transforms an array of homogeneous vectors by one matrix, Dst[i] = Src[i] * MatrixM.
+ * Same result as calling VectorTransformVector per element, but the matrix rows stay in registers and
+ * several vectors are processed per iteration on AVX and AVX-512. Dst == Src is allowed.
+ *
+ * @param Dst			Array of Count vectors receiving the result
+ * @param Src			Array of Count vectors to transform
+ * @param Count			Number of vectors
+ * @param MatrixM		FMatrix pointer to the Matrix to apply transform
+ */
+inline void VectorTransformVectorArray(VectorRegister4Float* Dst, const VectorRegister4Float* Src, int32 Count, const FMatrix44f* MatrixM)
+{
+	const float* MRows = (const float*)MatrixM;
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorTransformVectorArrayWide(Dst, Src, Index, Count, MRows);
+#endif
+
+	const VectorRegister4Float Row0 = VectorLoad(MRows + 0);
+	const VectorRegister4Float Row1 = VectorLoad(MRows + 4);
+	const VectorRegister4Float Row2 = VectorLoad(MRows + 8);
+	const VectorRegister4Float Row3 = VectorLoad(MRows + 12);
+	for (; Index < Count; ++Index)
+	{
+		const VectorRegister4Float V = Src[Index];
+		VectorRegister4Float Result = VectorMultiply(VectorReplicate(V, 0), Row0);
+		Result = VectorMultiplyAdd(VectorReplicate(V, 1), Row1, Result);
+		Result = VectorMultiplyAdd(VectorReplicate(V, 2), Row2, Result);
+		Result = VectorMultiplyAdd(VectorReplicate(V, 3), Row3, Result);
+		Dst[Index] = Result;
+	}
+}
+
+inline void VectorTransformVectorArray(VectorRegister4Double* Dst, const VectorRegister4Double* Src, int32 Count, const FMatrix44d* MatrixM)
+{
+	// Warning: FMatrix44d alignment may not match VectorRegister4Double, so you can't just cast to VectorRegister4Double*.
+	const double* MRows = (const double*)MatrixM;
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorTransformVectorArrayWide(Dst, Src, Index, Count, MRows);
+#endif
+
+	const VectorRegister4Double Row0 = VectorLoad(MRows + 0);
+	const VectorRegister4Double Row1 = VectorLoad(MRows + 4);
+	const VectorRegister4Double Row2 = VectorLoad(MRows + 8);
+	const VectorRegister4Double Row3 = VectorLoad(MRows + 12);
+	for (; Index < Count; ++Index)
+	{
+		const VectorRegister4Double V = Src[Index];
+		VectorRegister4Double Result = VectorMultiply(VectorReplicate(V, 0), Row0);
+		Result = VectorMultiplyAdd(VectorReplicate(V, 1), Row1, Result);
+		Result = VectorMultiplyAdd(VectorReplicate(V, 2), Row2, Result);
+		Result = VectorMultiplyAdd(VectorReplicate(V, 3), Row3, Result);
+		Dst[Index] = Result;
+	}
+}
+
+/**
+ * Transforms Count vectors stored as structure of arrays by one matrix, (OutX, OutY, OutZ, OutW)[i] = (InX, InY, InZ, InW)[i] * MatrixM.
+ * Pass InW = 1 to transform positions and InW = 0 for directions. OutW may be nullptr to skip it,
+ * and OutX/OutY/OutZ may alias the matching inputs. Uses 8 floats per iteration on AVX and 16 on AVX-512.
+ *
+ * @param MatrixM		FMatrix pointer to the Matrix to apply transform
+ * @param OutX			Receives Count transformed X components
+ * @param OutY			Receives Count transformed Y components
+ * @param OutZ			Receives Count transformed Z components
+ * @param OutW			Receives Count transformed W components (or nullptr)
+ * @param InX			Count source X components
+ * @param InY			Count source Y components
+ * @param InZ			Count source Z components
+ * @param InW			W component shared by all source vectors
+ * @param Count			Number of vectors
+ */
+inline void VectorTransformVectorSoA(const FMatrix44f* MatrixM, float* OutX, float* OutY, float* OutZ, float* OutW, const float* InX, const float* InY, const float* InZ, float InW, int32 Count)
+{
+	typedef float Float4x4[4][4];
+	const Float4x4& M = *((const Float4x4*)MatrixM);
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorTransformVectorSoAWide(M, OutX, OutY, OutZ, OutW, InX, InY, InZ, InW, Index, Count);
+#endif
+
+	Index = SSEVectorHelperFuncs::InternalVectorTransformVectorSoA4(M, OutX, OutY, OutZ, OutW, InX, InY, InZ, InW, Index, Count);
+	SSEVectorHelperFuncs::InternalVectorTransformVectorSoAScalar(M, OutX, OutY, OutZ, OutW, InX, InY, InZ, InW, Index, Count);
+}
+
+inline void VectorTransformVectorSoA(const FMatrix44d* MatrixM, double* OutX, double* OutY, double* OutZ, double* OutW, const double* InX, const double* InY, const double* InZ, double InW, int32 Count)
+{
+	typedef double Double4x4[4][4];
+	const Double4x4& M = *((const Double4x4*)MatrixM);
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorTransformVectorSoAWide(M, OutX, OutY, OutZ, OutW, InX, InY, InZ, InW, Index, Count);
+#endif
+
+	Index = SSEVectorHelperFuncs::InternalVectorTransformVectorSoA4(M, OutX, OutY, OutZ, OutW, InX, InY, InZ, InW, Index, Count);
+	SSEVectorHelperFuncs::InternalVectorTransformVectorSoAScalar(M, OutX, OutY, OutZ, OutW, InX, InY, InZ, InW, Index, Count);
+}
+
+/**
+ * Multiplies Count pairs of 4x4 matrices, Result[i] = Matrix1[i] * Matrix2[i].
+ * Same result as calling VectorMatrixMultiply per pair, but on AVX each row stays in one register
+ * (a single __m256d for doubles) and on AVX-512 two double rows or a whole float matrix do.
+ * Result[i] may alias Matrix1[i] or Matrix2[i].
+ *
+ * @param Result	Array of Count matrices receiving the products
+ * @param Matrix1	Array of Count left hand side matrices
+ * @param Matrix2	Array of Count right hand side matrices
+ * @param Count		Number of matrix pairs
+ */
+inline void VectorMatrixMultiplyArray(FMatrix44f* Result, const FMatrix44f* Matrix1, const FMatrix44f* Matrix2, int32 Count)
+{
+	// The matrix types are incomplete here, step through them as arrays of 16 floats.
+	float* ResultData = (float*)Result;
+	const float* Matrix1Data = (const float*)Matrix1;
+	const float* Matrix2Data = (const float*)Matrix2;
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorMatrixMultiplyArrayWide(ResultData, Matrix1Data, Matrix2Data, Index, Count);
+#endif
+
+	for (; Index < Count; ++Index)
+	{
+		VectorMatrixMultiply((FMatrix44f*)(ResultData + Index * 16), (const FMatrix44f*)(Matrix1Data + Index * 16), (const FMatrix44f*)(Matrix2Data + Index * 16));
+	}
+}
+
+inline void VectorMatrixMultiplyArray(FMatrix44d* Result, const FMatrix44d* Matrix1, const FMatrix44d* Matrix2, int32 Count)
+{
+	double* ResultData = (double*)Result;
+	const double* Matrix1Data = (const double*)Matrix1;
+	const double* Matrix2Data = (const double*)Matrix2;
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorMatrixMultiplyArrayWide(ResultData, Matrix1Data, Matrix2Data, Index, Count);
+#endif
+
+	for (; Index < Count; ++Index)
+	{
+		VectorMatrixMultiply((FMatrix44d*)(ResultData + Index * 16), (const FMatrix44d*)(Matrix1Data + Index * 16), (const FMatrix44d*)(Matrix2Data + Index * 16));
+	}
+}
+
 /**
  * Returns the minimum values of two vectors (component-wise).
  *
@@ -2665,6 +3080,50 @@ FORCEINLINE void VectorDeinterleave(VectorRegister4Double& RESTRICT OutEvens, Ve
 	OutOdds = VectorShuffle(Lo, Hi, 1, 3, 1, 3);
 }
 
+/**
+ * Transposes the 4x4 matrix held in the given rows, so that afterwards Row0 holds the first component of each of the
+ * original rows, Row1 the second and so on. Turns four XYZW vectors into XXXX, YYYY, ZZZZ, WWWW and back.
+ *
+ * @param Row0	[X0, Y0, Z0, W0] in, [X0, X1, X2, X3] out
+ * @param Row1	[X1, Y1, Z1, W1] in, [Y0, Y1, Y2, Y3] out
+ * @param Row2	[X2, Y2, Z2, W2] in, [Z0, Z1, Z2, Z3] out
+ * @param Row3	[X3, Y3, Z3, W3] in, [W0, W1, W2, W3] out
+ */
+FORCEINLINE void VectorTranspose4x4(VectorRegister4Float& RESTRICT Row0, VectorRegister4Float& RESTRICT Row1, VectorRegister4Float& RESTRICT Row2, VectorRegister4Float& RESTRICT Row3)
+{
+	const VectorRegister4Float XY01 = _mm_unpacklo_ps(Row0, Row1);
+	const VectorRegister4Float XY23 = _mm_unpacklo_ps(Row2, Row3);
+	const VectorRegister4Float ZW01 = _mm_unpackhi_ps(Row0, Row1);
+	const VectorRegister4Float ZW23 = _mm_unpackhi_ps(Row2, Row3);
+	Row0 = _mm_movelh_ps(XY01, XY23);
+	Row1 = _mm_movehl_ps(XY23, XY01);
+	Row2 = _mm_movelh_ps(ZW01, ZW23);
+	Row3 = _mm_movehl_ps(ZW23, ZW01);
+}
+
+FORCEINLINE void VectorTranspose4x4(VectorRegister4Double& RESTRICT Row0, VectorRegister4Double& RESTRICT Row1, VectorRegister4Double& RESTRICT Row2, VectorRegister4Double& RESTRICT Row3)
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	const __m256d XZ01 = _mm256_unpacklo_pd(Row0, Row1);
+	const __m256d YW01 = _mm256_unpackhi_pd(Row0, Row1);
+	const __m256d XZ23 = _mm256_unpacklo_pd(Row2, Row3);
+	const __m256d YW23 = _mm256_unpackhi_pd(Row2, Row3);
+	Row0 = _mm256_permute2f128_pd(XZ01, XZ23, 0x20);
+	Row1 = _mm256_permute2f128_pd(YW01, YW23, 0x20);
+	Row2 = _mm256_permute2f128_pd(XZ01, XZ23, 0x31);
+	Row3 = _mm256_permute2f128_pd(YW01, YW23, 0x31);
+#else
+	const VectorRegister4Double In0 = Row0;
+	const VectorRegister4Double In1 = Row1;
+	const VectorRegister4Double In2 = Row2;
+	const VectorRegister4Double In3 = Row3;
+	Row0 = VectorRegister4Double(_mm_unpacklo_pd(In0.XY, In1.XY), _mm_unpacklo_pd(In2.XY, In3.XY));
+	Row1 = VectorRegister4Double(_mm_unpackhi_pd(In0.XY, In1.XY), _mm_unpackhi_pd(In2.XY, In3.XY));
+	Row2 = VectorRegister4Double(_mm_unpacklo_pd(In0.ZW, In1.ZW), _mm_unpacklo_pd(In2.ZW, In3.ZW));
+	Row3 = VectorRegister4Double(_mm_unpackhi_pd(In0.ZW, In1.ZW), _mm_unpackhi_pd(In2.ZW, In3.ZW));
+#endif
+}
+
 
 /**
  * Returns an integer bit-mask (0x00 - 0x0f) based on the sign-bit for each component in a vector.
@@ -2863,82 +3322,642 @@ FORCEINLINE void VectorStoreURGBA16N(const VectorRegister4Float& Vec, void* Ptr)
 	Out[3] = static_cast<int16>(_mm_extract_epi16(TmpI, 6));
 }
 
+#if !UE_PLATFORM_MATH_USE_F16C
+namespace SSEVectorHelperFuncs
+{
+	// Widens 4 fp16 values (one per 32-bit lane, zero extended) to float. Bit-identical to F16C, including subnormals, Inf and NaN.
+	FORCEINLINE VectorRegister4Float InternalVectorHalfToFloat(const VectorRegister4Int& Half)
+	{
+		const VectorRegister4Int ExpMant = _mm_and_si128(Half, _mm_set1_epi32(0x7FFF));
+		const VectorRegister4Int Sign = _mm_slli_epi32(_mm_xor_si128(Half, ExpMant), 16);
+		// Rebias the exponent with a multiply by 2^112, which also normalizes half subnormals.
+		const VectorRegister4Float Scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(ExpMant, 13)), _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23)));
+		// Half Inf/NaN keep their mantissa but need the float exponent forced to all ones, NaNs are quieted like F16C does.
+		const VectorRegister4Int IsInfNaN = _mm_cmpgt_epi32(ExpMant, _mm_set1_epi32(0x7BFF));
+		const VectorRegister4Int IsNaN = _mm_cmpgt_epi32(ExpMant, _mm_set1_epi32(0x7C00));
+		const VectorRegister4Int InfNaNBits = _mm_or_si128(_mm_and_si128(IsInfNaN, _mm_set1_epi32(255 << 23)), _mm_and_si128(IsNaN, _mm_set1_epi32(0x00400000)));
+		return _mm_or_ps(Scaled, _mm_castsi128_ps(_mm_or_si128(Sign, InfNaNBits)));
+	}
+
+	// Narrows 4 floats to fp16 with round-to-nearest-even, one result per 32-bit lane (sign extended, ready for _mm_packs_epi32).
+	// Bit-identical to F16C: overflow goes to Inf and NaNs are quieted, keeping the top payload bits.
+	FORCEINLINE VectorRegister4Int InternalVectorFloatToHalf(const VectorRegister4Float& Vec)
+	{
+		const VectorRegister4Float JustSign = _mm_and_ps(Vec, _mm_castsi128_ps(_mm_set1_epi32(0x80000000)));
+		const VectorRegister4Float AbsF = _mm_xor_ps(Vec, JustSign);
+		const VectorRegister4Int AbsI = _mm_castps_si128(AbsF);
+
+		// Finite values below 65520 (which rounds to Inf) take the regular paths, everything else becomes Inf or quiet NaN.
+		const VectorRegister4Int IsRegular = _mm_cmpgt_epi32(_mm_set1_epi32((127 + 16) << 23), AbsI);
+		const VectorRegister4Int NaNPayload = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(AbsI, 13), _mm_set1_epi32(0x3FF)), _mm_set1_epi32(0x200));
+		const VectorRegister4Int NaNBits = _mm_and_si128(_mm_castps_si128(_mm_cmpunord_ps(AbsF, AbsF)), NaNPayload);
+		const VectorRegister4Int InfOrNaN = _mm_or_si128(NaNBits, _mm_set1_epi32(0x7C00));
+
+		// Subnormal result: adding a magic value lets the FPU do the rounding, the low bits are then the half.
+		const VectorRegister4Int SubnormalMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+		const VectorRegister4Int IsSubnormal = _mm_cmpgt_epi32(_mm_set1_epi32((127 - 14) << 23), AbsI);
+		const VectorRegister4Int Subnormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(AbsF, _mm_castsi128_ps(SubnormalMagic))), SubnormalMagic);
+
+		// Normal result: rebias the exponent and round the 13 dropped bits to nearest even.
+		const VectorRegister4Int MantissaOdd = _mm_srai_epi32(_mm_slli_epi32(AbsI, 31 - 13), 31);
+		const VectorRegister4Int Rounded = _mm_sub_epi32(_mm_add_epi32(AbsI, _mm_set1_epi32(0xFFF - ((127 - 15) << 23))), MantissaOdd);
+		const VectorRegister4Int Normal = _mm_srli_epi32(Rounded, 13);
+
+		const VectorRegister4Int Finite = _mm_or_si128(_mm_and_si128(IsSubnormal, Subnormal), _mm_andnot_si128(IsSubnormal, Normal));
+		const VectorRegister4Int Joined = _mm_or_si128(_mm_and_si128(IsRegular, Finite), _mm_andnot_si128(IsRegular, InfOrNaN));
+		return _mm_or_si128(Joined, _mm_srai_epi32(_mm_castps_si128(JustSign), 16));
+	}
+}
+#endif
+
 /**
- * Returns non-zero if any element in Vec1 is greater than the corresponding element in Vec2, otherwise 0.
+ * Loads 4 fp16 values from unaligned memory and converts them into 4 FLOATs.
  *
- * @param Vec1			1st source vector
- * @param Vec2			2nd source vector
- * @return				Non-zero integer if (Vec1.x > Vec2.x) || (Vec1.y > Vec2.y) || (Vec1.z > Vec2.z) || (Vec1.w > Vec2.w)
+ * @param Ptr			Unaligned memory pointer to the 4 fp16's.
+ * @return				VectorRegister4Float with 4 FLOATs loaded from Ptr.
  */
-FORCEINLINE int VectorAnyGreaterThan(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+FORCEINLINE VectorRegister4Float VectorLoadHalf4(const void* Ptr)
 {
-	return VectorMaskBits(VectorCompareGT(Vec1, Vec2));
+#if UE_PLATFORM_MATH_USE_F16C
+	return _mm_cvtph_ps(_mm_loadl_epi64((const __m128i*)Ptr));
+#else
+	return SSEVectorHelperFuncs::InternalVectorHalfToFloat(_mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i*)Ptr), _mm_setzero_si128()));
+#endif
 }
 
-FORCEINLINE int VectorAnyGreaterThan(const VectorRegister4Double& Vec1, const VectorRegister4Double& Vec2)
+/**
+ * Converts the 4 floats in the vector to 4 fp16 (round to nearest even) and stores based off bool to [un]aligned memory.
+ *
+ * @param Vec			Vector containing 4 floats
+ * @param Ptr			Memory pointer to store the 4 fp16's.
+ */
+template <bool bAligned>
+FORCEINLINE void VectorStoreHalf4(const VectorRegister4Float& Vec, void* RESTRICT Ptr)
 {
-	return VectorMaskBits(VectorCompareGT(Vec1, Vec2));
+	// movq has no alignment requirement, so both variants are the same store.
+#if UE_PLATFORM_MATH_USE_F16C
+	_mm_storel_epi64((__m128i*)Ptr, _mm_cvtps_ph(Vec, _MM_FROUND_TO_NEAREST_INT));
+#else
+	const VectorRegister4Int Half = SSEVectorHelperFuncs::InternalVectorFloatToHalf(Vec);
+	_mm_storel_epi64((__m128i*)Ptr, _mm_packs_epi32(Half, Half));
+#endif
 }
 
 /**
- * Resets the floating point registers so that they can be used again.
- * Some intrinsics use these for MMX purposes (e.g. VectorLoadByte4 and VectorStoreByte4).
+ * Converts an array of floats to fp16 (round to nearest even), e.g. Count = 4 * NumPixels for FFloat16Color.
+ * Converts 16 values per iteration with AVX-512, 8 with AVX+F16C or the SSE2 fallback.
+ *
+ * @param Dst			Unaligned destination of Count fp16's, must not overlap Src.
+ * @param Src			Unaligned source of Count floats.
+ * @param Count			Number of values to convert.
  */
-// This is no longer necessary now that we don't use MMX instructions
-#define VectorResetFloatRegisters()
-// TODO: LWC: remove?
+inline void VectorFloatToHalfArray(uint16* RESTRICT Dst, const float* RESTRICT Src, int32 Count)
+{
+	int32 Index = 0;
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorFloatToHalfArrayWide(Dst, Src, Index, Count);
+#endif
+#if !UE_PLATFORM_MATH_USE_F16C
+	for (; Index + 8 <= Count; Index += 8)
+	{
+		const VectorRegister4Int Lo = SSEVectorHelperFuncs::InternalVectorFloatToHalf(VectorLoad(Src + Index));
+		const VectorRegister4Int Hi = SSEVectorHelperFuncs::InternalVectorFloatToHalf(VectorLoad(Src + Index + 4));
+		_mm_storeu_si128((__m128i*)(Dst + Index), _mm_packs_epi32(Lo, Hi));
+	}
+#endif
+	for (; Index + 4 <= Count; Index += 4)
+	{
+		VectorStoreHalf4<false>(VectorLoad(Src + Index), Dst + Index);
+	}
+	if (Index < Count)
+	{
+		float InTail[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		uint16 OutTail[4];
+		for (int32 Tail = 0; Tail < Count - Index; ++Tail)
+		{
+			InTail[Tail] = Src[Index + Tail];
+		}
+		VectorStoreHalf4<false>(VectorLoad(InTail), OutTail);
+		for (int32 Tail = 0; Tail < Count - Index; ++Tail)
+		{
+			Dst[Index + Tail] = OutTail[Tail];
+		}
+	}
+}
 
 /**
- * Returns the control register.
+ * Converts an array of fp16 values to floats, e.g. Count = 4 * NumPixels for FFloat16Color.
+ * Converts 16 values per iteration with AVX-512, 8 with AVX+F16C or the SSE2 fallback.
  *
- * @return			The uint32 control register
+ * @param Dst			Unaligned destination of Count floats, must not overlap Src.
+ * @param Src			Unaligned source of Count fp16's.
+ * @param Count			Number of values to convert.
  */
-#define VectorGetControlRegister()		_mm_getcsr()
+inline void VectorHalfToFloatArray(float* RESTRICT Dst, const uint16* RESTRICT Src, int32 Count)
+{
+	int32 Index = 0;
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorHalfToFloatArrayWide(Dst, Src, Index, Count);
+#endif
+#if !UE_PLATFORM_MATH_USE_F16C
+	for (; Index + 8 <= Count; Index += 8)
+	{
+		const VectorRegister4Int Half = _mm_loadu_si128((const __m128i*)(Src + Index));
+		VectorStore(SSEVectorHelperFuncs::InternalVectorHalfToFloat(_mm_unpacklo_epi16(Half, _mm_setzero_si128())), Dst + Index);
+		VectorStore(SSEVectorHelperFuncs::InternalVectorHalfToFloat(_mm_unpackhi_epi16(Half, _mm_setzero_si128())), Dst + Index + 4);
+	}
+#endif
+	for (; Index + 4 <= Count; Index += 4)
+	{
+		VectorStore(VectorLoadHalf4(Src + Index), Dst + Index);
+	}
+	if (Index < Count)
+	{
+		uint16 InTail[4] = { 0, 0, 0, 0 };
+		float OutTail[4];
+		for (int32 Tail = 0; Tail < Count - Index; ++Tail)
+		{
+			InTail[Tail] = Src[Index + Tail];
+		}
+		VectorStore(VectorLoadHalf4(InTail), OutTail);
+		for (int32 Tail = 0; Tail < Count - Index; ++Tail)
+		{
+			Dst[Index + Tail] = OutTail[Tail];
+		}
+	}
+}
 
 /**
- * Sets the control register.
+ * Converts an array of 4-byte pixels to 4 floats each, the same values VectorLoadByte4 returns per pixel (not normalized).
+ * Converts 4 pixels per iteration with AVX2.
  *
- * @param ControlStatus		The uint32 control status value to set
+ * @param Dst			Unaligned destination of 4 * NumPixels floats, must not overlap Src.
+ * @param Src			Unaligned source of NumPixels 4-byte pixels.
+ * @param NumPixels		Number of pixels to convert.
  */
-#define	VectorSetControlRegister(ControlStatus) _mm_setcsr( ControlStatus )
+inline void VectorLoadByte4Array(float* RESTRICT Dst, const void* RESTRICT Src, int32 NumPixels)
+{
+	const uint8* Pixels = (const uint8*)Src;
+	int32 Index = 0;
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorLoadByte4ArrayWide(Dst, Pixels, Index, NumPixels);
+#endif
+	for (; Index < NumPixels; ++Index)
+	{
+		// VectorLoadByte4 is a macro that doesn't parenthesize its argument.
+		const uint8* Pixel = Pixels + Index * 4;
+		VectorStore(VectorLoadByte4(Pixel), Dst + Index * 4);
+	}
+}
 
 /**
- * Control status bit to round all floating point math results towards zero.
+ * Converts an array of 4 floats per pixel to 4-byte pixels, bit-identical to VectorStoreByte4 per pixel.
+ * Converts 8 pixels per iteration with AVX2.
+ *
+ * @param Dst			Unaligned destination of NumPixels 4-byte pixels, must not overlap Src.
+ * @param Src			Unaligned source of 4 * NumPixels floats.
+ * @param NumPixels		Number of pixels to convert.
  */
-#define VECTOR_ROUND_TOWARD_ZERO		_MM_ROUND_TOWARD_ZERO
+inline void VectorStoreByte4Array(void* RESTRICT Dst, const float* RESTRICT Src, int32 NumPixels)
+{
+	uint8* Pixels = (uint8*)Dst;
+	int32 Index = 0;
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorStoreByte4ArrayWide(Pixels, Src, Index, NumPixels);
+#endif
+	for (; Index < NumPixels; ++Index)
+	{
+		VectorStoreByte4(VectorLoad(Src + Index * 4), Pixels + Index * 4);
+	}
+}
 
 /**
-* Multiplies two quaternions; the order matters.
-*
-* Order matters when composing quaternions: C = VectorQuaternionMultiply2(A, B) will yield a quaternion C = A * B
-* that logically first applies B then A to any subsequent transformation (right first, then left).
-*
-* @param Quat1	Pointer to the first quaternion
-* @param Quat2	Pointer to the second quaternion
-* @return Quat1 * Quat2
-*/
-FORCEINLINE VectorRegister4Float VectorQuaternionMultiply2( const VectorRegister4Float& Quat1, const VectorRegister4Float& Quat2 )
+ * Converts an array of packed RGB10A2 pixels to 4 normalized floats each, bit-identical to VectorLoadURGB10A2N per pixel.
+ * Converts 4 pixels per iteration with AVX2.
+ *
+ * @param Dst			Unaligned destination of 4 * NumPixels floats, must not overlap Src.
+ * @param Src			Unaligned source of NumPixels RGB10A2 pixels (4 bytes each).
+ * @param NumPixels		Number of pixels to convert.
+ */
+inline void VectorLoadURGB10A2NArray(float* RESTRICT Dst, const void* RESTRICT Src, int32 NumPixels)
 {
-	VectorRegister4Float Result = VectorMultiply(VectorReplicate(Quat1, 3), Quat2);
-	Result = VectorMultiplyAdd( VectorMultiply(VectorReplicate(Quat1, 0), VectorSwizzle(Quat2, 3, 2, 1, 0)), GlobalVectorConstants::QMULTI_SIGN_MASK0, Result);
-	Result = VectorMultiplyAdd( VectorMultiply(VectorReplicate(Quat1, 1), VectorSwizzle(Quat2, 2, 3, 0, 1)), GlobalVectorConstants::QMULTI_SIGN_MASK1, Result);
-	Result = VectorMultiplyAdd( VectorMultiply(VectorReplicate(Quat1, 2), VectorSwizzle(Quat2, 1, 0, 3, 2)), GlobalVectorConstants::QMULTI_SIGN_MASK2, Result);
-
-	return Result;
+	const uint32* Pixels = (const uint32*)Src;
+	int32 Index = 0;
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorLoadURGB10A2NArrayWide(Dst, Pixels, Index, NumPixels);
+#endif
+	for (; Index < NumPixels; ++Index)
+	{
+		VectorStore(VectorLoadURGB10A2N((void*)(Pixels + Index)), Dst + Index * 4);
+	}
 }
 
-FORCEINLINE VectorRegister4Double VectorQuaternionMultiply2(const VectorRegister4Double& Quat1, const VectorRegister4Double& Quat2)
+/**
+ * Converts an array of 4 floats per pixel to packed RGB10A2, bit-identical to VectorStoreURGB10A2N per pixel.
+ * Converts 8 pixels per iteration with AVX2.
+ *
+ * @param Dst			Unaligned destination of NumPixels RGB10A2 pixels (4 bytes each), must not overlap Src.
+ * @param Src			Unaligned source of 4 * NumPixels floats.
+ * @param NumPixels		Number of pixels to convert.
+ */
+inline void VectorStoreURGB10A2NArray(void* RESTRICT Dst, const float* RESTRICT Src, int32 NumPixels)
 {
-	VectorRegister4Double Result = VectorMultiply(VectorReplicate(Quat1, 3), Quat2);
-	Result = VectorMultiplyAdd(VectorMultiply(VectorReplicate(Quat1, 0), VectorSwizzle(Quat2, 3, 2, 1, 0)), GlobalVectorConstants::DOUBLE_QMULTI_SIGN_MASK0, Result);
-	Result = VectorMultiplyAdd(VectorMultiply(VectorReplicate(Quat1, 1), VectorSwizzle(Quat2, 2, 3, 0, 1)), GlobalVectorConstants::DOUBLE_QMULTI_SIGN_MASK1, Result);
-	Result = VectorMultiplyAdd(VectorMultiply(VectorReplicate(Quat1, 2), VectorSwizzle(Quat2, 1, 0, 3, 2)), GlobalVectorConstants::DOUBLE_QMULTI_SIGN_MASK2, Result);
-
-	return Result;
+	uint32* Pixels = (uint32*)Dst;
+	int32 Index = 0;
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorStoreURGB10A2NArrayWide(Pixels, Src, Index, NumPixels);
+#endif
+	for (; Index < NumPixels; ++Index)
+	{
+		VectorStoreURGB10A2N(VectorLoad(Src + Index * 4), Pixels + Index);
+	}
 }
 
 /**
-* Multiplies two quaternions; the order matters.
+ * Converts an array of packed RGBA16 pixels to 4 floats each, the same values VectorLoadURGBA16N returns per pixel.
+ * Converts 8 pixels per iteration with AVX2.
+ *
+ * @param Dst			Unaligned destination of 4 * NumPixels floats, must not overlap Src.
+ * @param Src			Unaligned source of NumPixels RGBA16 pixels (8 bytes each).
+ * @param NumPixels		Number of pixels to convert.
+ */
+inline void VectorLoadURGBA16NArray(float* RESTRICT Dst, const void* RESTRICT Src, int32 NumPixels)
+{
+	const uint16* Pixels = (const uint16*)Src;
+	int32 Index = 0;
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorLoadURGBA16NArrayWide(Dst, Pixels, Index, NumPixels);
+#endif
+	for (; Index < NumPixels; ++Index)
+	{
+		const uint16* Pixel = Pixels + Index * 4;
+		VectorStore(VectorLoadURGBA16N(Pixel), Dst + Index * 4);
+	}
+}
+
+/**
+ * Converts an array of packed signed RGBA16 pixels to 4 floats each, the same values VectorLoadSRGBA16N returns per pixel.
+ * Converts 8 pixels per iteration with AVX2.
+ *
+ * @param Dst			Unaligned destination of 4 * NumPixels floats, must not overlap Src.
+ * @param Src			Unaligned source of NumPixels signed RGBA16 pixels (8 bytes each).
+ * @param NumPixels		Number of pixels to convert.
+ */
+inline void VectorLoadSRGBA16NArray(float* RESTRICT Dst, const void* RESTRICT Src, int32 NumPixels)
+{
+	const int16* Pixels = (const int16*)Src;
+	int32 Index = 0;
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorLoadSRGBA16NArrayWide(Dst, Pixels, Index, NumPixels);
+#endif
+	for (; Index < NumPixels; ++Index)
+	{
+		VectorStore(VectorLoadSRGBA16N(Pixels + Index * 4), Dst + Index * 4);
+	}
+}
+
+/**
+ * Converts an array of 4 floats per pixel to packed RGBA16, bit-identical to VectorStoreURGBA16N per pixel.
+ * Converts 4 pixels per iteration with AVX2.
+ *
+ * @param Dst			Unaligned destination of NumPixels RGBA16 pixels (8 bytes each), must not overlap Src.
+ * @param Src			Unaligned source of 4 * NumPixels floats.
+ * @param NumPixels		Number of pixels to convert.
+ */
+inline void VectorStoreURGBA16NArray(void* RESTRICT Dst, const float* RESTRICT Src, int32 NumPixels)
+{
+	uint16* Pixels = (uint16*)Dst;
+	int32 Index = 0;
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorStoreURGBA16NArrayWide(Pixels, Src, Index, NumPixels);
+#endif
+	for (; Index < NumPixels; ++Index)
+	{
+		VectorStoreURGBA16N(VectorLoad(Src + Index * 4), Pixels + Index * 4);
+	}
+}
+
+namespace SSEVectorHelperFuncs
+{
+	// The fp16 variants of the packed converters run the float ones on blocks small enough to stay in L1.
+	constexpr int32 PackedHalfBlockPixels = 64;
+
+	template<typename LoadArrayType>
+	FORCEINLINE void InternalVectorLoadPackedHalfArray(uint16* RESTRICT Dst, const uint8* RESTRICT Src, int32 PixelSize, int32 NumPixels, LoadArrayType LoadArray)
+	{
+		float Block[PackedHalfBlockPixels * 4];
+		for (int32 Index = 0; Index < NumPixels; Index += PackedHalfBlockPixels)
+		{
+			const int32 BlockPixels = FMath::Min(PackedHalfBlockPixels, NumPixels - Index);
+			LoadArray(Block, Src + Index * PixelSize, BlockPixels);
+			VectorFloatToHalfArray(Dst + Index * 4, Block, BlockPixels * 4);
+		}
+	}
+
+	template<typename StoreArrayType>
+	FORCEINLINE void InternalVectorStorePackedHalfArray(uint8* RESTRICT Dst, const uint16* RESTRICT Src, int32 PixelSize, int32 NumPixels, StoreArrayType StoreArray)
+	{
+		float Block[PackedHalfBlockPixels * 4];
+		for (int32 Index = 0; Index < NumPixels; Index += PackedHalfBlockPixels)
+		{
+			const int32 BlockPixels = FMath::Min(PackedHalfBlockPixels, NumPixels - Index);
+			VectorHalfToFloatArray(Block, Src + Index * 4, BlockPixels * 4);
+			StoreArray(Dst + Index * PixelSize, Block, BlockPixels);
+		}
+	}
+}
+
+/**
+ * fp16 variants of the packed pixel array converters above: the pixels are converted to or from 4 fp16's each,
+ * with the same results as the float variant followed by VectorFloatToHalfArray (or preceded by VectorHalfToFloatArray).
+ *
+ * @param Dst			Unaligned destination, must not overlap Src.
+ * @param Src			Unaligned source.
+ * @param NumPixels		Number of pixels to convert.
+ */
+inline void VectorLoadByte4HalfArray(uint16* RESTRICT Dst, const void* RESTRICT Src, int32 NumPixels)
+{
+	SSEVectorHelperFuncs::InternalVectorLoadPackedHalfArray(Dst, (const uint8*)Src, 4, NumPixels, &VectorLoadByte4Array);
+}
+
+inline void VectorStoreByte4HalfArray(void* RESTRICT Dst, const uint16* RESTRICT Src, int32 NumPixels)
+{
+	SSEVectorHelperFuncs::InternalVectorStorePackedHalfArray((uint8*)Dst, Src, 4, NumPixels, &VectorStoreByte4Array);
+}
+
+inline void VectorLoadURGB10A2NHalfArray(uint16* RESTRICT Dst, const void* RESTRICT Src, int32 NumPixels)
+{
+	SSEVectorHelperFuncs::InternalVectorLoadPackedHalfArray(Dst, (const uint8*)Src, 4, NumPixels, &VectorLoadURGB10A2NArray);
+}
+
+inline void VectorStoreURGB10A2NHalfArray(void* RESTRICT Dst, const uint16* RESTRICT Src, int32 NumPixels)
+{
+	SSEVectorHelperFuncs::InternalVectorStorePackedHalfArray((uint8*)Dst, Src, 4, NumPixels, &VectorStoreURGB10A2NArray);
+}
+
+inline void VectorLoadURGBA16NHalfArray(uint16* RESTRICT Dst, const void* RESTRICT Src, int32 NumPixels)
+{
+	SSEVectorHelperFuncs::InternalVectorLoadPackedHalfArray(Dst, (const uint8*)Src, 8, NumPixels, &VectorLoadURGBA16NArray);
+}
+
+inline void VectorLoadSRGBA16NHalfArray(uint16* RESTRICT Dst, const void* RESTRICT Src, int32 NumPixels)
+{
+	SSEVectorHelperFuncs::InternalVectorLoadPackedHalfArray(Dst, (const uint8*)Src, 8, NumPixels, &VectorLoadSRGBA16NArray);
+}
+
+inline void VectorStoreURGBA16NHalfArray(void* RESTRICT Dst, const uint16* RESTRICT Src, int32 NumPixels)
+{
+	SSEVectorHelperFuncs::InternalVectorStorePackedHalfArray((uint8*)Dst, Src, 8, NumPixels, &VectorStoreURGBA16NArray);
+}
+
+namespace SSEVectorHelperFuncs
+{
+	// Narrows 4 floats to bfloat16 with round-to-nearest-even, one result per 32-bit lane (sign extended, ready for _mm_packs_epi32).
+	// Denormals flush to signed zero and NaNs are quieted, the same bits vcvtneps2bf16 produces.
+	FORCEINLINE VectorRegister4Int InternalVectorFloatToBFloat16(const VectorRegister4Float& Vec)
+	{
+		const VectorRegister4Int AbsMask = _mm_set1_epi32(0x7FFFFFFF);
+		const VectorRegister4Int IsDenormal = _mm_cmpeq_epi32(_mm_and_si128(_mm_castps_si128(Vec), _mm_set1_epi32(0x7F800000)), _mm_setzero_si128());
+		const VectorRegister4Int Bits = _mm_andnot_si128(_mm_and_si128(IsDenormal, AbsMask), _mm_castps_si128(Vec));
+		const VectorRegister4Int Odd = _mm_and_si128(_mm_srli_epi32(Bits, 16), _mm_set1_epi32(1));
+		const VectorRegister4Int Rounded = _mm_add_epi32(Bits, _mm_add_epi32(Odd, _mm_set1_epi32(0x7FFF)));
+		const VectorRegister4Int IsNaN = _mm_cmpgt_epi32(_mm_and_si128(Bits, AbsMask), _mm_set1_epi32(0x7F800000));
+		const VectorRegister4Int Quiet = _mm_or_si128(Bits, _mm_set1_epi32(0x00400000));
+		return _mm_srai_epi32(_mm_or_si128(_mm_and_si128(IsNaN, Quiet), _mm_andnot_si128(IsNaN, Rounded)), 16);
+	}
+
+	// Widening is exact: the bfloat16 becomes the upper half of the float.
+	FORCEINLINE VectorRegister4Float InternalVectorBFloat16LoToFloat(const VectorRegister4Int& Packed)
+	{
+		return _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), Packed));
+	}
+
+	FORCEINLINE VectorRegister4Float InternalVectorBFloat16HiToFloat(const VectorRegister4Int& Packed)
+	{
+		return _mm_castsi128_ps(_mm_unpackhi_epi16(_mm_setzero_si128(), Packed));
+	}
+
+	FORCEINLINE float InternalVectorDotProductBFloat16(const uint16* RESTRICT Row, const uint16* RESTRICT Vector, int32 NumColumns)
+	{
+		VectorRegister4Float Sum0 = VectorZeroFloat();
+		VectorRegister4Float Sum1 = VectorZeroFloat();
+		int32 Column = 0;
+		for (; Column + 8 <= NumColumns; Column += 8)
+		{
+			const VectorRegister4Int R = _mm_loadu_si128((const __m128i*)(Row + Column));
+			const VectorRegister4Int V = _mm_loadu_si128((const __m128i*)(Vector + Column));
+			Sum0 = VectorMultiplyAdd(InternalVectorBFloat16LoToFloat(R), InternalVectorBFloat16LoToFloat(V), Sum0);
+			Sum1 = VectorMultiplyAdd(InternalVectorBFloat16HiToFloat(R), InternalVectorBFloat16HiToFloat(V), Sum1);
+		}
+		if (Column < NumColumns)
+		{
+			alignas(16) uint16 RowTail[8] = {};
+			alignas(16) uint16 VectorTail[8] = {};
+			for (int32 Tail = 0; Tail < NumColumns - Column; ++Tail)
+			{
+				RowTail[Tail] = Row[Column + Tail];
+				VectorTail[Tail] = Vector[Column + Tail];
+			}
+			const VectorRegister4Int R = _mm_load_si128((const __m128i*)RowTail);
+			const VectorRegister4Int V = _mm_load_si128((const __m128i*)VectorTail);
+			Sum0 = VectorMultiplyAdd(InternalVectorBFloat16LoToFloat(R), InternalVectorBFloat16LoToFloat(V), Sum0);
+			Sum1 = VectorMultiplyAdd(InternalVectorBFloat16HiToFloat(R), InternalVectorBFloat16HiToFloat(V), Sum1);
+		}
+		const VectorRegister4Float Sum = VectorAdd(Sum0, Sum1);
+		const VectorRegister4Float Sum2 = VectorAdd(Sum, _mm_movehl_ps(Sum, Sum));
+		return _mm_cvtss_f32(_mm_add_ss(Sum2, _mm_shuffle_ps(Sum2, Sum2, _MM_SHUFFLE(1, 1, 1, 1))));
+	}
+}
+
+/**
+ * Converts an array of floats to bfloat16 (the upper 16 bits of a float) with round-to-nearest-even.
+ * Denormals are flushed to signed zero and NaNs stay quiet NaNs, so every code path produces the same bits.
+ * Converts 32 values per iteration with AVX-512 BF16, 16 with AVX-512 or AVX2, 8 with SSE.
+ *
+ * @param Dst			Unaligned destination of Count bfloat16's, must not overlap Src.
+ * @param Src			Unaligned source of Count floats.
+ * @param Count			Number of values to convert.
+ */
+inline void VectorFloatToBFloat16Array(uint16* RESTRICT Dst, const float* RESTRICT Src, int32 Count)
+{
+	int32 Index = 0;
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorFloatToBFloat16ArrayWide(Dst, Src, Index, Count);
+#endif
+	for (; Index + 8 <= Count; Index += 8)
+	{
+		const VectorRegister4Int Lo = SSEVectorHelperFuncs::InternalVectorFloatToBFloat16(VectorLoad(Src + Index));
+		const VectorRegister4Int Hi = SSEVectorHelperFuncs::InternalVectorFloatToBFloat16(VectorLoad(Src + Index + 4));
+		_mm_storeu_si128((__m128i*)(Dst + Index), _mm_packs_epi32(Lo, Hi));
+	}
+	if (Index < Count)
+	{
+		float InTail[8] = {};
+		alignas(16) uint16 OutTail[8];
+		for (int32 Tail = 0; Tail < Count - Index; ++Tail)
+		{
+			InTail[Tail] = Src[Index + Tail];
+		}
+		const VectorRegister4Int Lo = SSEVectorHelperFuncs::InternalVectorFloatToBFloat16(VectorLoad(InTail));
+		const VectorRegister4Int Hi = SSEVectorHelperFuncs::InternalVectorFloatToBFloat16(VectorLoad(InTail + 4));
+		_mm_store_si128((__m128i*)OutTail, _mm_packs_epi32(Lo, Hi));
+		for (int32 Tail = 0; Tail < Count - Index; ++Tail)
+		{
+			Dst[Index + Tail] = OutTail[Tail];
+		}
+	}
+}
+
+/**
+ * Converts an array of bfloat16 values to floats, exact.
+ *
+ * @param Dst			Unaligned destination of Count floats, must not overlap Src.
+ * @param Src			Unaligned source of Count bfloat16's.
+ * @param Count			Number of values to convert.
+ */
+inline void VectorBFloat16ToFloatArray(float* RESTRICT Dst, const uint16* RESTRICT Src, int32 Count)
+{
+	int32 Index = 0;
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorBFloat16ToFloatArrayWide(Dst, Src, Index, Count);
+#endif
+	for (; Index + 8 <= Count; Index += 8)
+	{
+		const VectorRegister4Int Packed = _mm_loadu_si128((const __m128i*)(Src + Index));
+		VectorStore(SSEVectorHelperFuncs::InternalVectorBFloat16LoToFloat(Packed), Dst + Index);
+		VectorStore(SSEVectorHelperFuncs::InternalVectorBFloat16HiToFloat(Packed), Dst + Index + 4);
+	}
+	for (; Index < Count; ++Index)
+	{
+		Dst[Index] = _mm_cvtss_f32(SSEVectorHelperFuncs::InternalVectorBFloat16LoToFloat(_mm_cvtsi32_si128(Src[Index])));
+	}
+}
+
+/**
+ * Multiplies a row-major bfloat16 matrix by a bfloat16 vector: Result[Row] = sum of Matrix[Row][Column] * Vector[Column].
+ * Products are exact in float and accumulated in float. Storing weights as bfloat16 halves the memory traffic of float
+ * weights; activations can be narrowed once per call with VectorFloatToBFloat16Array.
+ * Uses vdpbf16ps on CPUs with AVX-512 BF16, which treats denormal inputs as zero. The summation order depends on the
+ * code path, so results may differ in the last bits between CPUs.
+ *
+ * @param Result		Destination of NumRows floats, must not overlap the inputs.
+ * @param Matrix		NumRows * NumColumns bfloat16's, row major without padding between rows.
+ * @param Vector		NumColumns bfloat16's.
+ * @param NumRows		Number of matrix rows.
+ * @param NumColumns	Number of matrix columns and vector elements.
+ */
+inline void VectorMatrixVectorMultiplyBFloat16(float* RESTRICT Result, const uint16* RESTRICT Matrix, const uint16* RESTRICT Vector, int32 NumRows, int32 NumColumns)
+{
+	int32 Row = 0;
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Row = SSEVectorHelperFuncs::InternalVectorMatrixVectorMultiplyBFloat16Wide(Result, Matrix, Vector, NumColumns, Row, NumRows);
+#endif
+	for (; Row < NumRows; ++Row)
+	{
+		Result[Row] = SSEVectorHelperFuncs::InternalVectorDotProductBFloat16(Matrix + (SIZE_T)Row * NumColumns, Vector, NumColumns);
+	}
+}
+
+/**
+ * Dot product of two bfloat16 arrays, accumulated in float. Same paths and precision as VectorMatrixVectorMultiplyBFloat16.
+ *
+ * @param A				Count bfloat16's.
+ * @param B				Count bfloat16's.
+ * @param Count			Number of elements.
+ * @return				Sum of A[i] * B[i].
+ */
+inline float VectorDotProductBFloat16(const uint16* A, const uint16* B, int32 Count)
+{
+	float Result;
+	VectorMatrixVectorMultiplyBFloat16(&Result, A, B, 1, Count);
+	return Result;
+}
+
+/**
+ * Returns non-zero if any element in Vec1 is greater than the corresponding element in Vec2, otherwise 0.
+ *
+ * @param Vec1			1st source vector
+ * @param Vec2			2nd source vector
+ * @return				Non-zero integer if (Vec1.x > Vec2.x) || (Vec1.y > Vec2.y) || (Vec1.z > Vec2.z) || (Vec1.w > Vec2.w)
+ */
+FORCEINLINE int VectorAnyGreaterThan(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512_VL
+	// Compare straight into a mask register, no vector mask + movmsk round trip.
+	return _mm_cmp_ps_mask(Vec1, Vec2, _CMP_GT_OQ);
+#else
+	return VectorMaskBits(VectorCompareGT(Vec1, Vec2));
+#endif
+}
+
+FORCEINLINE int VectorAnyGreaterThan(const VectorRegister4Double& Vec1, const VectorRegister4Double& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512_VL
+	return _mm256_cmp_pd_mask(Vec1, Vec2, _CMP_GT_OQ);
+#else
+	return VectorMaskBits(VectorCompareGT(Vec1, Vec2));
+#endif
+}
+
+/**
+ * Resets the floating point registers so that they can be used again.
+ * Some intrinsics use these for MMX purposes (e.g. VectorLoadByte4 and VectorStoreByte4).
+ */
+// This is no longer necessary now that we don't use MMX instructions
+#define VectorResetFloatRegisters()
+// TODO: LWC: remove?
+
+/**
+ * Returns the control register.
+ *
+ * @return			The uint32 control register
+ */
+#define VectorGetControlRegister()		_mm_getcsr()
+
+/**
+ * Sets the control register.
+ *
+ * @param ControlStatus		The uint32 control status value to set
+ */
+#define	VectorSetControlRegister(ControlStatus) _mm_setcsr( ControlStatus )
+
+/**
+ * Control status bit to round all floating point math results towards zero.
+ */
+#define VECTOR_ROUND_TOWARD_ZERO		_MM_ROUND_TOWARD_ZERO
+
+/**
+* Multiplies two quaternions; the order matters.
+*
+* Order matters when composing quaternions: C = VectorQuaternionMultiply2(A, B) will yield a quaternion C = A * B
+* that logically first applies B then A to any subsequent transformation (right first, then left).
+*
+* @param Quat1	Pointer to the first quaternion
+* @param Quat2	Pointer to the second quaternion
+* @return Quat1 * Quat2
+*/
+FORCEINLINE VectorRegister4Float VectorQuaternionMultiply2( const VectorRegister4Float& Quat1, const VectorRegister4Float& Quat2 )
+{
+	VectorRegister4Float Result = VectorMultiply(VectorReplicate(Quat1, 3), Quat2);
+	Result = VectorMultiplyAdd( VectorMultiply(VectorReplicate(Quat1, 0), VectorSwizzle(Quat2, 3, 2, 1, 0)), GlobalVectorConstants::QMULTI_SIGN_MASK0, Result);
+	Result = VectorMultiplyAdd( VectorMultiply(VectorReplicate(Quat1, 1), VectorSwizzle(Quat2, 2, 3, 0, 1)), GlobalVectorConstants::QMULTI_SIGN_MASK1, Result);
+	Result = VectorMultiplyAdd( VectorMultiply(VectorReplicate(Quat1, 2), VectorSwizzle(Quat2, 1, 0, 3, 2)), GlobalVectorConstants::QMULTI_SIGN_MASK2, Result);
+
+	return Result;
+}
+
+FORCEINLINE VectorRegister4Double VectorQuaternionMultiply2(const VectorRegister4Double& Quat1, const VectorRegister4Double& Quat2)
+{
+	VectorRegister4Double Result = VectorMultiply(VectorReplicate(Quat1, 3), Quat2);
+	Result = VectorMultiplyAdd(VectorMultiply(VectorReplicate(Quat1, 0), VectorSwizzle(Quat2, 3, 2, 1, 0)), GlobalVectorConstants::DOUBLE_QMULTI_SIGN_MASK0, Result);
+	Result = VectorMultiplyAdd(VectorMultiply(VectorReplicate(Quat1, 1), VectorSwizzle(Quat2, 2, 3, 0, 1)), GlobalVectorConstants::DOUBLE_QMULTI_SIGN_MASK1, Result);
+	Result = VectorMultiplyAdd(VectorMultiply(VectorReplicate(Quat1, 2), VectorSwizzle(Quat2, 1, 0, 3, 2)), GlobalVectorConstants::DOUBLE_QMULTI_SIGN_MASK2, Result);
+
+	return Result;
+}
+
+/**
+* Multiplies two quaternions; the order matters.
 *
 * When composing quaternions: VectorQuaternionMultiply(C, A, B) will yield a quaternion C = A * B
 * that logically first applies B then A to any subsequent transformation (right first, then left).
@@ -2960,6 +3979,10 @@ FORCEINLINE void VectorQuaternionMultiply(VectorRegister4Double* RESTRICT Result
 // Returns true if the vector contains a component that is either NAN or +/-infinite.
 FORCEINLINE bool VectorContainsNaNOrInfinite(const VectorRegister4Float& Vec)
 {
+#if UE_PLATFORM_MATH_USE_AVX_512_DQ && UE_PLATFORM_MATH_USE_AVX_512_VL
+	// vfpclass categories: 0x01 QNaN, 0x08 +Inf, 0x10 -Inf, 0x80 SNaN
+	return _mm_fpclass_ps_mask(Vec, 0x99) != 0;
+#else
 	// https://en.wikipedia.org/wiki/IEEE_754-1985
 	// Infinity is represented with all exponent bits set, with the correct sign bit.
 	// NaN is represented with all exponent bits set, plus at least one fraction/significand bit set.
@@ -2975,10 +3998,14 @@ FORCEINLINE bool VectorContainsNaNOrInfinite(const VectorRegister4Float& Vec)
 	// Compare to full exponent. If any are full exponent (not finite), the signs copied to the mask are non-zero, otherwise it's zero and finite.
 	bool IsFinite = VectorMaskBits(VectorCompareEQ(ExpTest, FloatInfinity)) == 0;
 	return !IsFinite;
+#endif
 }
 
 FORCEINLINE bool VectorContainsNaNOrInfinite(const VectorRegister4Double& Vec)
 {
+#if UE_PLATFORM_MATH_USE_AVX_512_DQ && UE_PLATFORM_MATH_USE_AVX_512_VL
+	return _mm256_fpclass_pd_mask(Vec, 0x99) != 0;
+#else
 	// https://en.wikipedia.org/wiki/IEEE_754-1985
 	// Infinity is represented with all exponent bits set, with the correct sign bit.
 	// NaN is represented with all exponent bits set, plus at least one fraction/significand bit set.
@@ -2994,6 +4021,136 @@ FORCEINLINE bool VectorContainsNaNOrInfinite(const VectorRegister4Double& Vec)
 	// Compare to full exponent. If any are full exponent (not finite), the signs copied to the mask are non-zero, otherwise it's zero and finite.
 	bool IsFinite = VectorMaskBits(VectorCompareEQ(ExpTest, DoubleInfinity)) == 0;
 	return !IsFinite;
+#endif
+}
+
+namespace SSEVectorHelperFuncs
+{
+	FORCEINLINE VectorRegister4Float InternalLoadScan4(const float* Src)
+	{
+		return VectorLoad(Src);
+	}
+
+	FORCEINLINE VectorRegister4Float InternalLoadScan4(const uint16* Src)
+	{
+		return VectorLoadHalf4(Src);
+	}
+
+	FORCEINLINE uint64 InternalOutOfRangeMaskBits4(const VectorRegister4Float& Value, const VectorRegister4Float& MinValue, const VectorRegister4Float& MaxValue)
+	{
+		return uint64(VectorMaskBits(_mm_or_ps(_mm_cmpnge_ps(Value, MinValue), _mm_cmpnle_ps(Value, MaxValue))));
+	}
+
+	template<typename ScalarType>
+	FORCEINLINE void InternalVectorScanOutOfRangeArray4(const ScalarType* Src, int32 Index, int32 Count, float MinValue, float MaxValue, FVectorScanResult& Result)
+	{
+		const VectorRegister4Float Min = VectorSetFloat1(MinValue);
+		const VectorRegister4Float Max = VectorSetFloat1(MaxValue);
+		for (; Index + 16 <= Count; Index += 16)
+		{
+			const uint64 Bits = InternalOutOfRangeMaskBits4(InternalLoadScan4(Src + Index + 0), Min, Max)
+				| (InternalOutOfRangeMaskBits4(InternalLoadScan4(Src + Index + 4), Min, Max) << 4)
+				| (InternalOutOfRangeMaskBits4(InternalLoadScan4(Src + Index + 8), Min, Max) << 8)
+				| (InternalOutOfRangeMaskBits4(InternalLoadScan4(Src + Index + 12), Min, Max) << 12);
+			if (Bits)
+			{
+				InternalAddScanHits(Result, Index, Bits);
+			}
+		}
+		for (; Index < Count; Index += 4)
+		{
+			uint64 Bits;
+			if (Index + 4 <= Count)
+			{
+				Bits = InternalOutOfRangeMaskBits4(InternalLoadScan4(Src + Index), Min, Max);
+			}
+			else
+			{
+				ScalarType Tail[4] = {};
+				for (int32 Lane = 0; Index + Lane < Count; ++Lane)
+				{
+					Tail[Lane] = Src[Index + Lane];
+				}
+				Bits = InternalOutOfRangeMaskBits4(InternalLoadScan4(Tail), Min, Max) & ((uint64(1) << (Count - Index)) - 1);
+			}
+			if (Bits)
+			{
+				InternalAddScanHits(Result, Index, Bits);
+			}
+		}
+	}
+
+	// Largest finite float, used as the bounds that flag infinities along with NaNs.
+	constexpr float InternalScanFiniteMax = 3.402823466e+38f;
+} // namespace SSEVectorHelperFuncs
+
+/**
+ * Scans a float buffer for NaNs and values outside [MinValue, MaxValue]. Infinities are flagged unless the range includes
+ * them. Checks 64 values per iteration with AVX-512, 32 with AVX and 16 otherwise.
+ *
+ * @param Src		Unaligned source of Count floats
+ * @param Count		Number of values to scan
+ * @param MinValue	Smallest accepted value
+ * @param MaxValue	Largest accepted value
+ * @return			Number of flagged values and the index of the first one
+ */
+inline FVectorScanResult VectorScanOutOfRangeArray(const float* Src, int32 Count, float MinValue, float MaxValue)
+{
+	FVectorScanResult Result;
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorScanOutOfRangeArrayWide(Src, Index, Count, MinValue, MaxValue, Result);
+#endif
+
+	SSEVectorHelperFuncs::InternalVectorScanOutOfRangeArray4(Src, Index, Count, MinValue, MaxValue, Result);
+	return Result;
+}
+
+/**
+ * Scans an fp16 buffer for NaNs and values outside [MinValue, MaxValue], see VectorScanOutOfRangeArray.
+ *
+ * @param Src		Unaligned source of Count fp16's
+ * @param Count		Number of values to scan
+ * @param MinValue	Smallest accepted value
+ * @param MaxValue	Largest accepted value
+ * @return			Number of flagged values and the index of the first one
+ */
+inline FVectorScanResult VectorScanOutOfRangeHalfArray(const uint16* Src, int32 Count, float MinValue, float MaxValue)
+{
+	FVectorScanResult Result;
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorScanOutOfRangeArrayWide(Src, Index, Count, MinValue, MaxValue, Result);
+#endif
+
+	SSEVectorHelperFuncs::InternalVectorScanOutOfRangeArray4(Src, Index, Count, MinValue, MaxValue, Result);
+	return Result;
+}
+
+/**
+ * Buffer version of VectorContainsNaNOrInfinite: counts the NaN and infinite values in a float buffer.
+ *
+ * @param Src		Unaligned source of Count floats
+ * @param Count		Number of values to scan
+ * @return			Number of NaN and infinite values and the index of the first one
+ */
+inline FVectorScanResult VectorScanNonFiniteArray(const float* Src, int32 Count)
+{
+	return VectorScanOutOfRangeArray(Src, Count, -SSEVectorHelperFuncs::InternalScanFiniteMax, SSEVectorHelperFuncs::InternalScanFiniteMax);
+}
+
+/**
+ * Counts the NaN and infinite values in an fp16 buffer.
+ *
+ * @param Src		Unaligned source of Count fp16's
+ * @param Count		Number of values to scan
+ * @return			Number of NaN and infinite values and the index of the first one
+ */
+inline FVectorScanResult VectorScanNonFiniteHalfArray(const uint16* Src, int32 Count)
+{
+	return VectorScanOutOfRangeHalfArray(Src, Count, -SSEVectorHelperFuncs::InternalScanFiniteMax, SSEVectorHelperFuncs::InternalScanFiniteMax);
 }
 
 FORCEINLINE VectorRegister4Float VectorTruncate(const VectorRegister4Float& Vec)
@@ -3181,9 +4338,979 @@ FORCEINLINE VectorRegister4Double VectorStep(const VectorRegister4Double& X)
 	return VectorSelect(Mask, GlobalVectorConstants::DoubleOne, GlobalVectorConstants::DoubleZero);
 }
 
-FORCEINLINE VectorRegister4Float VectorExp(const VectorRegister4Float& X)
-{
-#if UE_PLATFORM_MATH_USE_SVML
+/*=============================================================================
+ *	Double precision transcendental kernels, used when SVML is not available.
+ *
+ *	Ports of the fdlibm/Cephes reference algorithms evaluated on VectorRegister4Double.
+ *	Error bounds below are measured against glibc libm over the full double range:
+ *		Exp, Log			<= 1 ulp
+ *		Exp2, Log2			<= 2 ulp
+ *		Tan					<= 2 ulp for |X| <= 2^26, larger arguments fall back to scalar FMath::Tan
+ *		SinCos				<= 1 ulp, Payne-Hanek reduction for |X| > 2^26
+ *		ASin				<= 2 ulp
+ *		ACos, ATan			<= 1 ulp
+ *		ATan2				<= 2 ulp
+ *		Pow					<= 1 ulp
+ *============================================================================*/
+
+namespace SSEVectorHelperFuncs
+{
+	// Rounds each component to the nearest integral value, ties to even.
+	FORCEINLINE VectorRegister4Double InternalVectorRoundDouble(const VectorRegister4Double& V)
+	{
+#if UE_PLATFORM_MATH_USE_AVX
+		return _mm256_round_pd(V, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#elif UE_PLATFORM_MATH_USE_SSE4_1
+		return VectorRegister4Double(_mm_round_pd(V.XY, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC), _mm_round_pd(V.ZW, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+#else
+		// Round-trip through int32 using the default (round to nearest even) MXCSR mode. Callers only pass values well inside int32 range.
+		return VectorRegister4Double(_mm_cvtepi32_pd(_mm_cvtpd_epi32(V.XY)), _mm_cvtepi32_pd(_mm_cvtpd_epi32(V.ZW)));
+#endif
+	}
+
+	// Returns 2^N for integral N in [-1022, 1023], built directly in the exponent field.
+	FORCEINLINE VectorRegister4Double InternalVectorPow2Double(const VectorRegister4Double& N)
+	{
+		const VectorRegister4Int Bias = _mm_set1_epi32(1023);
+#if UE_PLATFORM_MATH_USE_AVX_2
+		const VectorRegister4Int Biased = _mm_add_epi32(_mm256_cvtpd_epi32(N), Bias);
+		return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_cvtepi32_epi64(Biased), 52));
+#else
+		// Biased exponents are positive so zero-extending to 64 bits is enough.
+		const VectorRegister4Int BiasedXY = _mm_unpacklo_epi32(_mm_add_epi32(_mm_cvtpd_epi32(N.GetXY()), Bias), _mm_setzero_si128());
+		const VectorRegister4Int BiasedZW = _mm_unpacklo_epi32(_mm_add_epi32(_mm_cvtpd_epi32(N.GetZW()), Bias), _mm_setzero_si128());
+		return VectorRegister4Double(_mm_castsi128_pd(_mm_slli_epi64(BiasedXY, 52)), _mm_castsi128_pd(_mm_slli_epi64(BiasedZW, 52)));
+#endif
+	}
+
+	// Computes V * 2^N for integral N in [-2044, 2046]. The scale is applied in two steps so every intermediate power of two stays normal.
+	FORCEINLINE VectorRegister4Double InternalVectorLdexpDouble(const VectorRegister4Double& V, const VectorRegister4Double& N)
+	{
+#if UE_PLATFORM_MATH_USE_AVX_512_VL
+		// vscalef rounds once and handles overflow/underflow itself.
+		return _mm256_scalef_pd(V, N);
+#else
+		const VectorRegister4Double N1 = InternalVectorRoundDouble(VectorMultiply(N, VectorSetFloat1(0.5)));
+		const VectorRegister4Double N2 = VectorSubtract(N, N1);
+		return VectorMultiply(VectorMultiply(V, InternalVectorPow2Double(N1)), InternalVectorPow2Double(N2));
+#endif
+	}
+
+	// Splits a positive, normal V into a mantissa in [1, 2) and its unbiased exponent (returned as an integral double).
+	FORCEINLINE VectorRegister4Double InternalVectorFrexpDouble(const VectorRegister4Double& V, VectorRegister4Double& OutExponent)
+	{
+#if UE_PLATFORM_MATH_USE_AVX_512_VL
+		OutExponent = _mm256_getexp_pd(V);
+		return _mm256_getmant_pd(V, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero);
+#else
+#if UE_PLATFORM_MATH_USE_AVX_2
+		const __m256i Biased = _mm256_srli_epi64(_mm256_castpd_si256(V), 52);
+		const __m128i Biased32 = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(Biased, _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7)));
+		OutExponent = _mm256_cvtepi32_pd(_mm_sub_epi32(Biased32, _mm_set1_epi32(1023)));
+#else
+		const __m128i BiasedXY = _mm_srli_epi64(_mm_castpd_si128(V.GetXY()), 52);
+		const __m128i BiasedZW = _mm_srli_epi64(_mm_castpd_si128(V.GetZW()), 52);
+		const __m128i Bias = _mm_set1_epi32(1023);
+		OutExponent = VectorRegister4Double(
+			_mm_cvtepi32_pd(_mm_sub_epi32(_mm_shuffle_epi32(BiasedXY, _MM_SHUFFLE(3, 1, 2, 0)), Bias)),
+			_mm_cvtepi32_pd(_mm_sub_epi32(_mm_shuffle_epi32(BiasedZW, _MM_SHUFFLE(3, 1, 2, 0)), Bias)));
+#endif
+		const VectorRegister4Double MantissaMask = MakeVectorRegisterDoubleMask(0x000FFFFFFFFFFFFFull, 0x000FFFFFFFFFFFFFull, 0x000FFFFFFFFFFFFFull, 0x000FFFFFFFFFFFFFull);
+		return VectorBitwiseOr(VectorBitwiseAnd(V, MantissaMask), VectorOneDouble());
+#endif
+	}
+
+	FORCEINLINE VectorRegister4Double InternalVectorInfinityDouble()
+	{
+		return MakeVectorRegisterDoubleMask(0x7FF0000000000000ull, 0x7FF0000000000000ull, 0x7FF0000000000000ull, 0x7FF0000000000000ull);
+	}
+
+	FORCEINLINE VectorRegister4Double InternalVectorNaNDouble()
+	{
+		return MakeVectorRegisterDoubleMask(0x7FF8000000000000ull, 0x7FF8000000000000ull, 0x7FF8000000000000ull, 0x7FF8000000000000ull);
+	}
+
+	FORCEINLINE VectorRegister4Double InternalVectorSignBitDouble()
+	{
+		return MakeVectorRegisterDoubleMask(0x8000000000000000ull, 0x8000000000000000ull, 0x8000000000000000ull, 0x8000000000000000ull);
+	}
+
+	// exp(Hi - Lo) for |Hi - Lo| <= ln(2)/2, fdlibm's rational form. Hi/Lo carry the extra precision of the range reduction.
+	FORCEINLINE VectorRegister4Double InternalVectorExpReducedDouble(const VectorRegister4Double& Hi, const VectorRegister4Double& Lo)
+	{
+		const VectorRegister4Double R = VectorSubtract(Hi, Lo);
+		const VectorRegister4Double T = VectorMultiply(R, R);
+
+		VectorRegister4Double P = VectorSetFloat1(4.13813679705723846039e-08);
+		P = VectorMultiplyAdd(T, P, VectorSetFloat1(-1.65339022054652515390e-06));
+		P = VectorMultiplyAdd(T, P, VectorSetFloat1(6.61375632143793436117e-05));
+		P = VectorMultiplyAdd(T, P, VectorSetFloat1(-2.77777777770155933842e-03));
+		P = VectorMultiplyAdd(T, P, VectorSetFloat1(1.66666666666666019037e-01));
+		const VectorRegister4Double C = VectorNegateMultiplyAdd(T, P, R);
+
+		// 1 - ((Lo - (R * C) / (2 - C)) - Hi)
+		const VectorRegister4Double RC = VectorDivide(VectorMultiply(R, C), VectorSubtract(VectorSetFloat1(2.0), C));
+		return VectorSubtract(VectorOneDouble(), VectorSubtract(VectorSubtract(Lo, RC), Hi));
+	}
+
+	FORCEINLINE VectorRegister4Double InternalVectorExpDouble(const VectorRegister4Double& X)
+	{
+		// Clamp so that K stays in the range InternalVectorLdexpDouble handles, results still overflow/underflow correctly.
+		// Operand order keeps NaN inputs (min/max return the second operand when either is NaN).
+		const VectorRegister4Double XClamped = VectorMax(VectorSetFloat1(-746.0), VectorMin(VectorSetFloat1(710.0), X));
+
+		// X = K * ln2 + R, |R| <= ln2/2
+		const VectorRegister4Double K = InternalVectorRoundDouble(VectorMultiply(XClamped, VectorSetFloat1(1.44269504088896338700e+00)));
+		const VectorRegister4Double Hi = VectorNegateMultiplyAdd(K, VectorSetFloat1(6.93147180369123816490e-01), XClamped);
+		const VectorRegister4Double Lo = VectorMultiply(K, VectorSetFloat1(1.90821492927058770002e-10));
+
+		return InternalVectorLdexpDouble(InternalVectorExpReducedDouble(Hi, Lo), K);
+	}
+
+	FORCEINLINE VectorRegister4Double InternalVectorExp2Double(const VectorRegister4Double& X)
+	{
+		const VectorRegister4Double XClamped = VectorMax(VectorSetFloat1(-1076.0), VectorMin(VectorSetFloat1(1025.0), X));
+
+		// X = K + F, |F| <= 1/2, 2^F = exp(F * ln2)
+		const VectorRegister4Double K = InternalVectorRoundDouble(XClamped);
+		const VectorRegister4Double R = VectorMultiply(VectorSubtract(XClamped, K), VectorSetFloat1(6.93147180559945286227e-01));
+
+		return InternalVectorLdexpDouble(InternalVectorExpReducedDouble(R, VectorZeroDouble()), K);
+	}
+
+	// Shared log reduction: X = 2^OutExponent * (1 + OutF), with 1 + OutF in [sqrt(2)/2, sqrt(2)). Returns log(1 + OutF) - OutF split as (OutHfsq, return value), see fdlibm e_log.c.
+	FORCEINLINE VectorRegister4Double InternalVectorLogReduceDouble(const VectorRegister4Double& X, VectorRegister4Double& OutExponent, VectorRegister4Double& OutF, VectorRegister4Double& OutHfsq)
+	{
+		VectorRegister4Double Exponent;
+#if UE_PLATFORM_MATH_USE_AVX_512_VL
+		// vgetexp/vgetmant normalize subnormals themselves.
+		VectorRegister4Double Mantissa = InternalVectorFrexpDouble(X, Exponent);
+#else
+		// Bring subnormals into the normal range, then compensate in the exponent.
+		const VectorRegister4Double IsSubnormal = VectorCompareLT(X, VectorSetFloat1(2.2250738585072014e-308));
+		const VectorRegister4Double XNormal = VectorSelect(IsSubnormal, VectorMultiply(X, VectorSetFloat1(18014398509481984.0 /* 2^54 */)), X);
+
+		VectorRegister4Double Mantissa = InternalVectorFrexpDouble(XNormal, Exponent);
+		Exponent = VectorSubtract(Exponent, VectorSelect(IsSubnormal, VectorSetFloat1(54.0), VectorZeroDouble()));
+#endif
+
+		const VectorRegister4Double IsLarge = VectorCompareGT(Mantissa, VectorSetFloat1(1.41421356237309504880));
+		Mantissa = VectorSelect(IsLarge, VectorMultiply(Mantissa, VectorSetFloat1(0.5)), Mantissa);
+		OutExponent = VectorAdd(Exponent, VectorSelect(IsLarge, VectorOneDouble(), VectorZeroDouble()));
+
+		const VectorRegister4Double F = VectorSubtract(Mantissa, VectorOneDouble());
+		const VectorRegister4Double S = VectorDivide(F, VectorAdd(VectorSetFloat1(2.0), F));
+		const VectorRegister4Double Z = VectorMultiply(S, S);
+		const VectorRegister4Double W = VectorMultiply(Z, Z);
+
+		VectorRegister4Double T1 = VectorSetFloat1(1.531383769920937332e-01);
+		T1 = VectorMultiplyAdd(W, T1, VectorSetFloat1(2.222219843214978396e-01));
+		T1 = VectorMultiplyAdd(W, T1, VectorSetFloat1(3.999999999940941908e-01));
+		T1 = VectorMultiply(W, T1);
+
+		VectorRegister4Double T2 = VectorSetFloat1(1.479819860511658591e-01);
+		T2 = VectorMultiplyAdd(W, T2, VectorSetFloat1(1.818357216161805012e-01));
+		T2 = VectorMultiplyAdd(W, T2, VectorSetFloat1(2.857142874366239149e-01));
+		T2 = VectorMultiplyAdd(W, T2, VectorSetFloat1(6.666666666666735130e-01));
+		T2 = VectorMultiply(Z, T2);
+
+		const VectorRegister4Double Hfsq = VectorMultiply(VectorSetFloat1(0.5), VectorMultiply(F, F));
+		OutF = F;
+		OutHfsq = Hfsq;
+		// S * (Hfsq + R)
+		return VectorMultiply(S, VectorAdd(Hfsq, VectorAdd(T1, T2)));
+	}
+
+	// Patches the results of log/log2 for zero, negative, infinite and NaN inputs.
+	FORCEINLINE VectorRegister4Double InternalVectorLogSpecialCasesDouble(const VectorRegister4Double& X, const VectorRegister4Double& Result)
+	{
+		const VectorRegister4Double Inf = InternalVectorInfinityDouble();
+		const VectorRegister4Double IsInvalid = VectorBitwiseOr(VectorCompareLT(X, VectorZeroDouble()), VectorCompareNE(X, X));
+		VectorRegister4Double Out = VectorSelect(VectorCompareEQ(X, Inf), Inf, Result);
+		Out = VectorSelect(VectorCompareEQ(X, VectorZeroDouble()), VectorNegate(Inf), Out);
+		return VectorSelect(IsInvalid, InternalVectorNaNDouble(), Out);
+	}
+
+	FORCEINLINE VectorRegister4Double InternalVectorLogDouble(const VectorRegister4Double& X)
+	{
+		VectorRegister4Double K, F, Hfsq;
+		const VectorRegister4Double SR = InternalVectorLogReduceDouble(X, K, F, Hfsq);
+
+		// K * ln2_hi - ((Hfsq - (S * (Hfsq + R) + K * ln2_lo)) - F)
+		const VectorRegister4Double Lo = VectorMultiplyAdd(K, VectorSetFloat1(1.90821492927058770002e-10), SR);
+		const VectorRegister4Double Result = VectorSubtract(VectorMultiply(K, VectorSetFloat1(6.93147180369123816490e-01)), VectorSubtract(VectorSubtract(Hfsq, Lo), F));
+		return InternalVectorLogSpecialCasesDouble(X, Result);
+	}
+
+	FORCEINLINE VectorRegister4Double InternalVectorLog2Double(const VectorRegister4Double& X)
+	{
+		VectorRegister4Double K, F, Hfsq;
+		const VectorRegister4Double SR = InternalVectorLogReduceDouble(X, K, F, Hfsq);
+
+		// log(1 + F) = F - (Hfsq - S * (Hfsq + R)), scaled by 1/ln2 split into hi/lo parts.
+		const VectorRegister4Double LogF = VectorSubtract(F, VectorSubtract(Hfsq, SR));
+		VectorRegister4Double Result = VectorMultiply(LogF, VectorSetFloat1(1.92596299112661746887e-08));
+		Result = VectorMultiplyAdd(LogF, VectorSetFloat1(1.44269502162933349609e+00), Result);
+		Result = VectorAdd(K, Result);
+		return InternalVectorLogSpecialCasesDouble(X, Result);
+	}
+
+	// Clears the low 32 bits, leaving at most 21 significant bits so products of two such values are exact.
+	FORCEINLINE VectorRegister4Double InternalVectorTruncateLowBitsDouble(const VectorRegister4Double& V)
+	{
+		return VectorBitwiseAnd(V, MakeVectorRegisterDoubleMask(0xFFFFFFFF00000000ull, 0xFFFFFFFF00000000ull, 0xFFFFFFFF00000000ull, 0xFFFFFFFF00000000ull));
+	}
+
+	// Port of fdlibm e_pow.c: log2(|X|) is carried as Hi + Lo with ~64 bits of precision so that Y * log2(|X|) stays accurate
+	// for results close to overflow. The Hi/Lo splits rely on exact products of truncated values, keep the separate multiplies and adds.
+	FORCEINLINE VectorRegister4Double InternalVectorPowDouble(const VectorRegister4Double& X, const VectorRegister4Double& Y)
+	{
+		const VectorRegister4Double One = VectorOneDouble();
+		const VectorRegister4Double Zero = VectorZeroDouble();
+		const VectorRegister4Double Inf = InternalVectorInfinityDouble();
+		const VectorRegister4Double AbsX = VectorAbs(X);
+
+		// |X| = 2^N * M, M in [1, 2).
+		VectorRegister4Double N;
+#if UE_PLATFORM_MATH_USE_AVX_512_VL
+		VectorRegister4Double M = InternalVectorFrexpDouble(AbsX, N);
+#else
+		const VectorRegister4Double IsSubnormal = VectorCompareLT(AbsX, VectorSetFloat1(2.2250738585072014e-308));
+		VectorRegister4Double M = InternalVectorFrexpDouble(VectorSelect(IsSubnormal, VectorMultiply(AbsX, VectorSetFloat1(9007199254740992.0 /* 2^53 */)), AbsX), N);
+		N = VectorSubtract(N, VectorSelect(IsSubnormal, VectorSetFloat1(53.0), Zero));
+#endif
+
+		// Reduce M around 1 or 1.5: M < sqrt(3/2) uses 1, M < sqrt(3) uses 1.5, otherwise M / 2 around 1.
+		const VectorRegister4Double IsHigh = VectorCompareGE(M, VectorSetFloat1(1.7320508075688772));
+		const VectorRegister4Double IsMid = VectorBitwiseAnd(VectorCompareGT(M, VectorSetFloat1(1.2247448713915890)), VectorCompareLT(M, VectorSetFloat1(1.7320508075688772)));
+		M = VectorSelect(IsHigh, VectorMultiply(M, VectorSetFloat1(0.5)), M);
+		N = VectorAdd(N, VectorSelect(IsHigh, One, Zero));
+		const VectorRegister4Double BP = VectorSelect(IsMid, VectorSetFloat1(1.5), One);
+		const VectorRegister4Double DPHi = VectorSelect(IsMid, VectorSetFloat1(5.84962487220764160156e-01), Zero);
+		const VectorRegister4Double DPLo = VectorSelect(IsMid, VectorSetFloat1(1.35003920212974897128e-08), Zero);
+
+		// SS = SHi + SLo = (M - BP) / (M + BP)
+		const VectorRegister4Double U0 = VectorSubtract(M, BP);
+		const VectorRegister4Double V0 = VectorDivide(One, VectorAdd(M, BP));
+		const VectorRegister4Double SS = VectorMultiply(U0, V0);
+		const VectorRegister4Double SHi = InternalVectorTruncateLowBitsDouble(SS);
+		const VectorRegister4Double THi0 = InternalVectorTruncateLowBitsDouble(VectorAdd(M, BP));
+		const VectorRegister4Double TLo0 = VectorSubtract(M, VectorSubtract(THi0, BP));
+		const VectorRegister4Double SLo = VectorMultiply(V0, VectorSubtract(VectorSubtract(U0, VectorMultiply(SHi, THi0)), VectorMultiply(SHi, TLo0)));
+
+		// log(M / BP) = 2 * SS + 2/3 * SS^3 + ...
+		VectorRegister4Double S2 = VectorMultiply(SS, SS);
+		VectorRegister4Double R = VectorSetFloat1(2.06975017800338417784e-01);
+		R = VectorMultiplyAdd(S2, R, VectorSetFloat1(2.30660745775561754067e-01));
+		R = VectorMultiplyAdd(S2, R, VectorSetFloat1(2.72728123808534006489e-01));
+		R = VectorMultiplyAdd(S2, R, VectorSetFloat1(3.33333329818377432918e-01));
+		R = VectorMultiplyAdd(S2, R, VectorSetFloat1(4.28571428578550184252e-01));
+		R = VectorMultiplyAdd(S2, R, VectorSetFloat1(5.99999999999994648725e-01));
+		R = VectorMultiply(VectorMultiply(S2, S2), R);
+		R = VectorAdd(R, VectorMultiply(SLo, VectorAdd(SHi, SS)));
+		S2 = VectorMultiply(SHi, SHi);
+		const VectorRegister4Double THi1 = InternalVectorTruncateLowBitsDouble(VectorAdd(VectorAdd(VectorSetFloat1(3.0), S2), R));
+		const VectorRegister4Double TLo1 = VectorSubtract(R, VectorSubtract(VectorSubtract(THi1, VectorSetFloat1(3.0)), S2));
+
+		// PHi + PLo = SS * (3 + SS^2 + R)
+		const VectorRegister4Double U1 = VectorMultiply(SHi, THi1);
+		const VectorRegister4Double V1 = VectorAdd(VectorMultiply(SLo, THi1), VectorMultiply(TLo1, SS));
+		const VectorRegister4Double PHi0 = InternalVectorTruncateLowBitsDouble(VectorAdd(U1, V1));
+		const VectorRegister4Double PLo0 = VectorSubtract(V1, VectorSubtract(PHi0, U1));
+
+		// log2(|X|) = N + DPHi + ZHi + ZLo = THi + TLo, scaled by 2/(3 ln2) split into hi/lo parts.
+		const VectorRegister4Double ZHi = VectorMultiply(VectorSetFloat1(9.61796700954437255859e-01), PHi0);
+		const VectorRegister4Double ZLo = VectorAdd(VectorAdd(VectorMultiply(VectorSetFloat1(-7.02846165095275826516e-09), PHi0), VectorMultiply(PLo0, VectorSetFloat1(9.61796693925975554329e-01))), DPLo);
+		const VectorRegister4Double THi = InternalVectorTruncateLowBitsDouble(VectorAdd(VectorAdd(VectorAdd(ZHi, ZLo), DPHi), N));
+		const VectorRegister4Double TLo = VectorSubtract(ZLo, VectorSubtract(VectorSubtract(VectorSubtract(THi, N), DPHi), ZHi));
+
+		// PHi + PLo = Y * log2(|X|), with Y split so YHi * THi is exact.
+		const VectorRegister4Double YHi = InternalVectorTruncateLowBitsDouble(Y);
+		const VectorRegister4Double PLo = VectorAdd(VectorMultiply(VectorSubtract(Y, YHi), THi), VectorMultiply(Y, TLo));
+		const VectorRegister4Double PHi = VectorMultiply(YHi, THi);
+		const VectorRegister4Double Z = VectorAdd(PLo, PHi);
+
+		// 2^(PHi + PLo) = 2^K * exp((PHi - K + PLo) * ln2), K integral and |PHi - K| <= 1/2. Clamping keeps K inside the Ldexp range,
+		// the lanes it affects are replaced by the overflow/underflow results below.
+		const VectorRegister4Double K = InternalVectorRoundDouble(VectorMax(VectorSetFloat1(-1076.0), VectorMin(VectorSetFloat1(1025.0), Z)));
+		const VectorRegister4Double PHiReduced = VectorSubtract(PHi, K);
+		const VectorRegister4Double T = InternalVectorTruncateLowBitsDouble(VectorAdd(PLo, PHiReduced));
+		const VectorRegister4Double U2 = VectorMultiply(T, VectorSetFloat1(6.93147182464599609375e-01));
+		const VectorRegister4Double V2 = VectorAdd(VectorMultiply(VectorSubtract(PLo, VectorSubtract(T, PHiReduced)), VectorSetFloat1(6.93147180559945286227e-01)), VectorMultiply(T, VectorSetFloat1(-1.90465429995776804525e-09)));
+		const VectorRegister4Double E = VectorAdd(U2, V2);
+		const VectorRegister4Double W = VectorSubtract(V2, VectorSubtract(E, U2));
+
+		const VectorRegister4Double EE = VectorMultiply(E, E);
+		VectorRegister4Double P = VectorSetFloat1(4.13813679705723846039e-08);
+		P = VectorMultiplyAdd(EE, P, VectorSetFloat1(-1.65339022054652515390e-06));
+		P = VectorMultiplyAdd(EE, P, VectorSetFloat1(6.61375632143793436117e-05));
+		P = VectorMultiplyAdd(EE, P, VectorSetFloat1(-2.77777777770155933842e-03));
+		P = VectorMultiplyAdd(EE, P, VectorSetFloat1(1.66666666666666019037e-01));
+		const VectorRegister4Double C = VectorNegateMultiplyAdd(EE, P, E);
+
+		// 1 - ((E * C / (C - 2) - (W + E * W)) - E)
+		const VectorRegister4Double RC = VectorSubtract(VectorDivide(VectorMultiply(E, C), VectorSubtract(C, VectorSetFloat1(2.0))), VectorAdd(W, VectorMultiply(E, W)));
+		VectorRegister4Double Result = InternalVectorLdexpDouble(VectorSubtract(One, VectorSubtract(RC, E)), K);
+
+		// Positive finite X with finite Y and a result well inside the normal range needs no fix-ups, which is the common case.
+		const VectorRegister4Double IsRegular = VectorBitwiseAnd(VectorBitwiseAnd(VectorCompareGT(X, Zero), VectorCompareLT(X, Inf)),
+			VectorBitwiseAnd(VectorCompareLT(VectorAbs(Y), Inf), VectorCompareLT(VectorAbs(Z), VectorSetFloat1(1020.0))));
+		if (VectorMaskBits(IsRegular) == 0xF)
+		{
+			return Result;
+		}
+
+		// Decide overflow/underflow on the extended product, the rounded sum alone can sit exactly on the boundary.
+		const VectorRegister4Double ZMinusPHi = VectorSubtract(Z, PHi);
+		const VectorRegister4Double IsOverflow = VectorBitwiseOr(VectorCompareGT(Z, VectorSetFloat1(1024.0)),
+			VectorBitwiseAnd(VectorCompareEQ(Z, VectorSetFloat1(1024.0)), VectorCompareGT(VectorAdd(PLo, VectorSetFloat1(8.0085662595372944372e-17)), ZMinusPHi)));
+		const VectorRegister4Double IsUnderflow = VectorBitwiseOr(VectorCompareLT(Z, VectorSetFloat1(-1075.0)),
+			VectorBitwiseAnd(VectorCompareEQ(Z, VectorSetFloat1(-1075.0)), VectorCompareLE(PLo, ZMinusPHi)));
+
+		Result = VectorSelect(IsOverflow, Inf, Result);
+		Result = VectorSelect(IsUnderflow, Zero, Result);
+
+		// |X| or |Y| infinite or X zero: +inf when |X| > 1 and Y > 0 or |X| < 1 and Y < 0, +0 otherwise, 1 for |X| == 1.
+		const VectorRegister4Double IsExtreme = VectorBitwiseOr(VectorBitwiseOr(VectorCompareEQ(VectorAbs(Y), Inf), VectorCompareEQ(AbsX, Inf)), VectorCompareEQ(AbsX, Zero));
+		const VectorRegister4Double ExtremeResult = VectorSelect(VectorCompareEQ(AbsX, One), One,
+			VectorSelect(VectorBitwiseXor(VectorCompareGT(AbsX, One), VectorCompareLE(Y, Zero)), Inf, Zero));
+		Result = VectorSelect(IsExtreme, ExtremeResult, Result);
+
+		// Negative X (including -0 and -inf) keeps its sign for odd integral Y, finite negative X with non-integral Y is NaN.
+		const VectorRegister4Double RoundY = InternalVectorRoundDouble(Y);
+		const VectorRegister4Double HalfY = VectorMultiply(Y, VectorSetFloat1(0.5));
+		const VectorRegister4Double IsOdd = VectorBitwiseAnd(VectorCompareEQ(RoundY, Y), VectorCompareNE(InternalVectorRoundDouble(HalfY), HalfY));
+		Result = VectorBitwiseXor(Result, VectorBitwiseAnd(VectorBitwiseAnd(X, InternalVectorSignBitDouble()), IsOdd));
+
+		const VectorRegister4Double IsNegativeFinite = VectorBitwiseAnd(VectorCompareLT(X, Zero), VectorCompareNE(AbsX, Inf));
+		const VectorRegister4Double IsNaN = VectorBitwiseOr(VectorBitwiseOr(VectorCompareNE(X, X), VectorCompareNE(Y, Y)), VectorBitwiseAnd(IsNegativeFinite, VectorCompareNE(RoundY, Y)));
+		Result = VectorSelect(IsNaN, InternalVectorNaNDouble(), Result);
+
+		// X^0 and 1^Y are 1, even when the other operand is NaN.
+		return VectorSelect(VectorBitwiseOr(VectorCompareEQ(Y, Zero), VectorCompareEQ(X, One)), One, Result);
+	}
+
+	FORCEINLINE VectorRegister4Double InternalVectorTanDouble(const VectorRegister4Double& X)
+	{
+		const VectorRegister4Double AbsX = VectorAbs(X);
+
+		// X = K * pi/2 + Z, |Z| <= pi/4, three-part Cody-Waite reduction (Cephes DP1..DP3 scaled by 2).
+		const VectorRegister4Double K = InternalVectorRoundDouble(VectorMultiply(AbsX, VectorSetFloat1(6.36619772367581382433e-01)));
+		VectorRegister4Double Z = VectorNegateMultiplyAdd(K, VectorSetFloat1(1.570796310901641845703125), AbsX);
+		Z = VectorNegateMultiplyAdd(K, VectorSetFloat1(1.58932547122958567343e-08), Z);
+		Z = VectorNegateMultiplyAdd(K, VectorSetFloat1(6.12323399573676588614e-17), Z);
+		const VectorRegister4Double ZZ = VectorMultiply(Z, Z);
+
+		VectorRegister4Double P = VectorSetFloat1(-1.30936939181383777646e+04);
+		P = VectorMultiplyAdd(ZZ, P, VectorSetFloat1(1.15351664838587416140e+06));
+		P = VectorMultiplyAdd(ZZ, P, VectorSetFloat1(-1.79565251976484877988e+07));
+
+		VectorRegister4Double Q = VectorAdd(ZZ, VectorSetFloat1(1.36812963470692954678e+04));
+		Q = VectorMultiplyAdd(ZZ, Q, VectorSetFloat1(-1.32089234440210967447e+06));
+		Q = VectorMultiplyAdd(ZZ, Q, VectorSetFloat1(2.50083801823357915839e+07));
+		Q = VectorMultiplyAdd(ZZ, Q, VectorSetFloat1(-5.38695755929454629881e+07));
+
+		VectorRegister4Double Result = VectorMultiplyAdd(Z, VectorDivide(VectorMultiply(ZZ, P), Q), Z);
+
+		// Odd quadrants: tan(Z + pi/2) = -1/tan(Z)
+		const VectorRegister4Double HalfK = VectorMultiply(K, VectorSetFloat1(0.5));
+		const VectorRegister4Double IsOdd = VectorCompareNE(HalfK, VectorFloor(HalfK));
+		Result = VectorSelect(IsOdd, VectorDivide(GlobalVectorConstants::DoubleMinusOne, Result), Result);
+
+		// tan is odd, restore the sign of X
+		return VectorBitwiseXor(Result, VectorBitwiseAnd(X, InternalVectorSignBitDouble()));
+	}
+
+	// Unsigned 64 x 64 -> 128 bit multiply from 32 bit halves, returns the high word.
+	FORCEINLINE uint64 InternalMultiplyHigh64(uint64 A, uint64 B, uint64& OutLow)
+	{
+		const uint64 LoLo = (A & 0xFFFFFFFFull) * (B & 0xFFFFFFFFull);
+		const uint64 HiLo = (A >> 32) * (B & 0xFFFFFFFFull);
+		const uint64 LoHi = (A & 0xFFFFFFFFull) * (B >> 32);
+		const uint64 Cross = (LoLo >> 32) + (HiLo & 0xFFFFFFFFull) + LoHi;
+		OutLow = (Cross << 32) | (LoLo & 0xFFFFFFFFull);
+		return (A >> 32) * (B >> 32) + (HiLo >> 32) + (Cross >> 32);
+	}
+
+	// Payne-Hanek reduction for a finite X > 2^26: returns Z + OutTail = X - (4M + OutQuadrant) * pi/2 with |Z| <= pi/4.
+	// X * 2/pi and the final multiply by pi/2 are done in fixed point, so no precision is lost for any argument size.
+	inline double InternalPayneHanekReduceDouble(double X, int32& OutQuadrant, double& OutTail)
+	{
+		// Binary digits of 2/pi, the leading zero word is its integer part.
+		static constexpr uint64 TwoOverPi[] =
+		{
+			0x0000000000000000ull, 0xa2f9836e4e441529ull, 0xfc2757d1f534ddc0ull, 0xdb6295993c439041ull,
+			0xfe5163abdebbc561ull, 0xb7246e3a424dd2e0ull, 0x06492eea09d1921cull, 0xfe1deb1cb129a73eull,
+			0xe88235f52ebb4484ull, 0xe99c7026b45f7e41ull, 0x3991d639835339f4ull, 0x9c845f8bbdf9283bull,
+			0x1ff897ffde05980full, 0xef2f118b5a0a6d1full, 0x6d367ecf27cb09b7ull, 0x4f463f669e5fea2dull,
+			0x7527bac7ebe5f17bull, 0x3d0739f78a5292eaull, 0x6bfb5fb11f8d5d08ull, 0x56033046fc7b6babull,
+			0xf0cfbc209af4361dull,
+		};
+
+		// pi/2 * 2^126
+		static constexpr uint64 PiOver2Hi = 0x6487ed5110b4611aull;
+		static constexpr uint64 PiOver2Lo = 0x62633145c06e0e68ull;
+
+		// X = Mantissa * 2^Exponent with a 53 bit integer mantissa.
+		const uint64 Bits = (uint64)_mm_cvtsi128_si64(_mm_castpd_si128(_mm_set_sd(X)));
+		const int32 Exponent = int32((Bits >> 52) & 0x7FF) - 1075;
+		const uint64 Mantissa = (Bits & 0x000FFFFFFFFFFFFFull) | (1ull << 52);
+
+		// Start the window at weight 2^(2 - Exponent): earlier digits only add multiples of 8 to X * 2/pi, and the
+		// top three bits of the product are its integer part mod 8.
+		const int32 Digit = (Exponent + 61) >> 6;
+		const int32 Shift = (Exponent + 61) & 63;
+		uint64 Window[3];
+		for (int32 Index = 0; Index < 3; ++Index)
+		{
+			Window[Index] = Shift ? (TwoOverPi[Digit + Index] << Shift) | (TwoOverPi[Digit + Index + 1] >> (64 - Shift)) : TwoOverPi[Digit + Index];
+		}
+
+		uint64 Ignored, Mid;
+		const uint64 Carry = InternalMultiplyHigh64(Window[2], Mantissa, Ignored);
+		const uint64 MidHi = InternalMultiplyHigh64(Window[1], Mantissa, Mid);
+		Mid += Carry;
+		const uint64 Top = Window[0] * Mantissa + MidHi + (Mid < Carry ? 1 : 0);
+
+		// Round to the nearest quadrant, a fraction >= 1/2 becomes the negative distance to the next one.
+		uint32 Quadrant = uint32(Top >> 61);
+		uint64 FracHi = (Top << 3) | (Mid >> 61);
+		uint64 FracLo = Mid << 3;
+		const bool bNegative = (FracHi >> 63) != 0;
+		if (bNegative)
+		{
+			++Quadrant;
+			FracLo = ~FracLo + 1;
+			FracHi = ~FracHi + (FracLo == 0 ? 1 : 0);
+		}
+		OutQuadrant = int32(Quadrant & 3);
+
+		// Normalize the 128 bit fraction, Fraction = (FracHi:FracLo) * 2^(-128 - LeadingZeros).
+		int32 LeadingZeros = 0;
+		if (FracHi == 0)
+		{
+			FracHi = FracLo;
+			FracLo = 0;
+			LeadingZeros = 64;
+		}
+		if (FracHi == 0)
+		{
+			OutTail = 0.0;
+			return 0.0;
+		}
+		int32 Normalize = int32(FMath::CountLeadingZeros64(FracHi));
+		if (Normalize)
+		{
+			FracHi = (FracHi << Normalize) | (FracLo >> (64 - Normalize));
+			FracLo <<= Normalize;
+		}
+		LeadingZeros += Normalize;
+
+		// Z = Fraction * pi/2, keeping the top 128 bits of the product: (ZHi:ZLo) * 2^(-126 - LeadingZeros).
+		uint64 ZLo;
+		uint64 ZHi = InternalMultiplyHigh64(FracHi, PiOver2Hi, ZLo);
+		uint64 CrossLo;
+		const uint64 Cross = InternalMultiplyHigh64(FracHi, PiOver2Lo, CrossLo) + InternalMultiplyHigh64(FracLo, PiOver2Hi, CrossLo);
+		ZLo += Cross;
+		ZHi += (ZLo < Cross ? 1 : 0);
+		Normalize = int32(FMath::CountLeadingZeros64(ZHi));
+		ZHi = (ZHi << Normalize) | (ZLo >> (64 - Normalize));
+		ZLo <<= Normalize;
+		LeadingZeros += Normalize;
+
+		// Split into two 53 bit halves, both exact in a double. The tail's weight 2^(-104 - LeadingZeros) is built in the exponent field.
+		const uint64 ScaleBits = uint64(1023 - 104 - LeadingZeros) << 52;
+		const double Scale = _mm_cvtsd_f64(_mm_castsi128_pd(_mm_cvtsi64_si128(int64(ScaleBits))));
+		const double Z = double(int64(ZHi >> 11)) * (Scale * 9007199254740992.0 /* 2^53 */);
+		const double Tail = double(int64(((ZHi & 0x7FF) << 42) | (ZLo >> 22))) * Scale;
+		OutTail = bNegative ? -Tail : Tail;
+		return bNegative ? -Z : Z;
+	}
+
+	// Sine and cosine from one reduction X = K * pi/2 + Z + Y, |Z| <= pi/4, with fdlibm __kernel_sin / __kernel_cos
+	// evaluated on the Z + Y pair.
+	FORCEINLINE void InternalVectorSinCosDouble(const VectorRegister4Double& X, VectorRegister4Double& OutSin, VectorRegister4Double& OutCos)
+	{
+		const VectorRegister4Double AbsX = VectorAbs(X);
+
+		// Four-part Cody-Waite reduction. The first three parts of pi/2 carry 26 significant bits, so K * Part is exact
+		// for K < 2^27 with or without FMA. AbsX - K * Part1 is exact, the next two subtractions keep their rounding
+		// errors (two-sum) and the last part only touches the tail.
+		VectorRegister4Double K = InternalVectorRoundDouble(VectorMultiply(VectorMin(AbsX, VectorSetFloat1(67108864.0)), VectorSetFloat1(6.36619772367581382433e-01)));
+		const VectorRegister4Double D = VectorNegateMultiplyAdd(K, VectorSetFloat1(1.5707963407039642), AbsX);
+		const VectorRegister4Double P2 = VectorMultiply(K, VectorSetFloat1(1.3909067675399456e-08));
+		const VectorRegister4Double H2 = VectorAdd(D, P2);
+		const VectorRegister4Double B2 = VectorSubtract(H2, D);
+		const VectorRegister4Double E2 = VectorAdd(VectorSubtract(D, VectorSubtract(H2, B2)), VectorSubtract(P2, B2));
+		const VectorRegister4Double P3 = VectorMultiply(K, VectorSetFloat1(-6.123233932053594e-17));
+		const VectorRegister4Double H3 = VectorAdd(H2, P3);
+		const VectorRegister4Double B3 = VectorSubtract(H3, H2);
+		const VectorRegister4Double E3 = VectorAdd(VectorSubtract(H2, VectorSubtract(H3, B3)), VectorSubtract(P3, B3));
+		const VectorRegister4Double Tail = VectorNegateMultiplyAdd(K, VectorSetFloat1(6.36831716351095e-25), VectorAdd(E2, E3));
+		VectorRegister4Double Z = VectorAdd(H3, Tail);
+		VectorRegister4Double Y = VectorSubtract(Tail, VectorSubtract(Z, H3));
+
+		// Past 2^26 the Cody-Waite constants run out of bits, those lanes are reduced one at a time with Payne-Hanek.
+		const VectorRegister4Double IsLarge = VectorBitwiseAnd(VectorCompareGT(AbsX, VectorSetFloat1(67108864.0)), VectorCompareLT(AbsX, InternalVectorInfinityDouble()));
+		const int LargeMask = VectorMaskBits(IsLarge);
+		if (LargeMask != 0)
+		{
+			AlignedDouble4 AbsXLanes(AbsX);
+			AlignedDouble4 KLanes(K);
+			AlignedDouble4 ZLanes(Z);
+			AlignedDouble4 YLanes(Y);
+			for (int32 Index = 0; Index < 4; ++Index)
+			{
+				if (LargeMask & (1 << Index))
+				{
+					int32 Quadrant;
+					ZLanes[Index] = InternalPayneHanekReduceDouble(AbsXLanes[Index], Quadrant, YLanes[Index]);
+					KLanes[Index] = double(Quadrant);
+				}
+			}
+			K = KLanes.ToVectorRegister();
+			Z = ZLanes.ToVectorRegister();
+			Y = YLanes.ToVectorRegister();
+		}
+
+		// AbsX - AbsX is NaN exactly for Inf/NaN inputs, which the polynomials then carry into both results.
+		Z = VectorAdd(Z, VectorSubtract(AbsX, AbsX));
+
+		const VectorRegister4Double ZZ = VectorMultiply(Z, Z);
+		const VectorRegister4Double ZZZ = VectorMultiply(ZZ, Z);
+		const VectorRegister4Double Half = VectorSetFloat1(0.5);
+
+		// sin(Z + Y) = Z - ((ZZ * (Y/2 - ZZZ * R) - Y) - ZZZ * S1)
+		VectorRegister4Double S = VectorSetFloat1(1.58969099521155010221e-10);
+		S = VectorMultiplyAdd(ZZ, S, VectorSetFloat1(-2.50507602534068634195e-08));
+		S = VectorMultiplyAdd(ZZ, S, VectorSetFloat1(2.75573137070700676789e-06));
+		S = VectorMultiplyAdd(ZZ, S, VectorSetFloat1(-1.98412698298579493134e-04));
+		S = VectorMultiplyAdd(ZZ, S, VectorSetFloat1(8.33333333332248946124e-03));
+		S = VectorMultiply(ZZ, VectorNegateMultiplyAdd(ZZZ, S, VectorMultiply(Half, Y)));
+		S = VectorSubtract(Z, VectorNegateMultiplyAdd(ZZZ, VectorSetFloat1(-1.66666666666666324348e-01), VectorSubtract(S, Y)));
+
+		// cos(Z + Y) = W + (((1 - W) - ZZ/2) + (ZZ * R - Z * Y)) with W = 1 - ZZ/2, recovering the rounding error of W.
+		VectorRegister4Double C = VectorSetFloat1(-1.13596475577881948265e-11);
+		C = VectorMultiplyAdd(ZZ, C, VectorSetFloat1(2.08757232129817482790e-09));
+		C = VectorMultiplyAdd(ZZ, C, VectorSetFloat1(-2.75573143513906633035e-07));
+		C = VectorMultiplyAdd(ZZ, C, VectorSetFloat1(2.48015872894767294178e-05));
+		C = VectorMultiplyAdd(ZZ, C, VectorSetFloat1(-1.38888888888741095749e-03));
+		C = VectorMultiplyAdd(ZZ, C, VectorSetFloat1(4.16666666666666019037e-02));
+		C = VectorNegateMultiplyAdd(Z, Y, VectorMultiply(VectorMultiply(ZZ, ZZ), C));
+		const VectorRegister4Double One = VectorOneDouble();
+		const VectorRegister4Double HalfZZ = VectorMultiply(ZZ, Half);
+		const VectorRegister4Double W = VectorSubtract(One, HalfZZ);
+		C = VectorAdd(W, VectorAdd(VectorSubtract(VectorSubtract(One, W), HalfZZ), C));
+
+		// Quadrant K mod 4: odd quadrants swap sin and cos, quadrants 2 and 3 negate sin, quadrants 1 and 2 negate cos.
+		const VectorRegister4Double SignBit = InternalVectorSignBitDouble();
+		const VectorRegister4Double HalfK = VectorMultiply(K, VectorSetFloat1(0.5));
+		const VectorRegister4Double QuarterK = VectorMultiply(K, VectorSetFloat1(0.25));
+		const VectorRegister4Double IsOdd = VectorCompareNE(HalfK, VectorFloor(HalfK));
+		const VectorRegister4Double NegateSin = VectorCompareGE(VectorSubtract(QuarterK, VectorFloor(QuarterK)), VectorSetFloat1(0.5));
+		const VectorRegister4Double NegateCos = VectorBitwiseXor(IsOdd, NegateSin);
+
+		// sin is odd, so the sign of X folds into the sine's sign flip.
+		const VectorRegister4Double SinSign = VectorBitwiseXor(VectorBitwiseAnd(NegateSin, SignBit), VectorBitwiseAnd(X, SignBit));
+		OutSin = VectorBitwiseXor(VectorSelect(IsOdd, C, S), SinSign);
+		OutCos = VectorBitwiseXor(VectorSelect(IsOdd, S, C), VectorBitwiseAnd(NegateCos, SignBit));
+	}
+
+	// asin/acos rational approximation R(T) = P(T)/Q(T), see fdlibm e_asin.c
+	FORCEINLINE VectorRegister4Double InternalVectorASinRationalDouble(const VectorRegister4Double& T)
+	{
+		VectorRegister4Double P = VectorSetFloat1(3.47933107596021167570e-05);
+		P = VectorMultiplyAdd(T, P, VectorSetFloat1(7.91534994289814532176e-04));
+		P = VectorMultiplyAdd(T, P, VectorSetFloat1(-4.00555345006794114027e-02));
+		P = VectorMultiplyAdd(T, P, VectorSetFloat1(2.01212532134862925881e-01));
+		P = VectorMultiplyAdd(T, P, VectorSetFloat1(-3.25565818622400915405e-01));
+		P = VectorMultiplyAdd(T, P, VectorSetFloat1(1.66666666666666657415e-01));
+		P = VectorMultiply(T, P);
+
+		VectorRegister4Double Q = VectorSetFloat1(7.70381505559019352791e-02);
+		Q = VectorMultiplyAdd(T, Q, VectorSetFloat1(-6.88283971605453293030e-01));
+		Q = VectorMultiplyAdd(T, Q, VectorSetFloat1(2.02094576023350569471e+00));
+		Q = VectorMultiplyAdd(T, Q, VectorSetFloat1(-2.40339491173441421878e+00));
+		Q = VectorMultiplyAdd(T, Q, VectorOneDouble());
+
+		return VectorDivide(P, Q);
+	}
+
+	FORCEINLINE VectorRegister4Double InternalVectorASinDouble(const VectorRegister4Double& X)
+	{
+		const VectorRegister4Double AbsX = VectorAbs(X);
+		const VectorRegister4Double IsLarge = VectorCompareGE(AbsX, VectorSetFloat1(0.5));
+
+		// |X| < 0.5: asin(X) = X + X * R(X^2)
+		// |X| >= 0.5: asin(|X|) = pi/2 - 2 * (S + S * R(T)), T = (1 - |X|) / 2, S = sqrt(T)
+		const VectorRegister4Double T = VectorSelect(IsLarge, VectorMultiply(VectorSubtract(VectorOneDouble(), AbsX), VectorSetFloat1(0.5)), VectorMultiply(AbsX, AbsX));
+		const VectorRegister4Double R = InternalVectorASinRationalDouble(T);
+		const VectorRegister4Double S = VectorSqrt(T);
+
+		const VectorRegister4Double Small = VectorMultiplyAdd(AbsX, R, AbsX);
+		const VectorRegister4Double Twice = VectorMultiply(VectorSetFloat1(2.0), VectorMultiplyAdd(S, R, S));
+		const VectorRegister4Double Large = VectorSubtract(VectorSetFloat1(1.57079632679489655800e+00), VectorSubtract(Twice, VectorSetFloat1(6.12323399573676603587e-17)));
+
+		const VectorRegister4Double Result = VectorSelect(IsLarge, Large, Small);
+		// |X| > 1 yields NaN through the sqrt of a negative T. Restore the sign of X.
+		return VectorBitwiseOr(Result, VectorBitwiseAnd(X, InternalVectorSignBitDouble()));
+	}
+
+	FORCEINLINE VectorRegister4Double InternalVectorACosDouble(const VectorRegister4Double& X)
+	{
+		const VectorRegister4Double AbsX = VectorAbs(X);
+		const VectorRegister4Double IsLarge = VectorCompareGE(AbsX, VectorSetFloat1(0.5));
+		const VectorRegister4Double IsNegative = VectorCompareLT(X, VectorZeroDouble());
+
+		// |X| < 0.5: acos(X) = pi/2 - (X + X * R(X^2))
+		// X >= 0.5: acos(X) = 2 * (S + S * R(T)), T = (1 - X) / 2
+		// X <= -0.5: acos(X) = pi - 2 * (S + S * R(T)), T = (1 + X) / 2
+		const VectorRegister4Double T = VectorSelect(IsLarge, VectorMultiply(VectorSubtract(VectorOneDouble(), AbsX), VectorSetFloat1(0.5)), VectorMultiply(X, X));
+		const VectorRegister4Double R = InternalVectorASinRationalDouble(T);
+		const VectorRegister4Double S = VectorSqrt(T);
+
+		const VectorRegister4Double PiByTwoHi = VectorSetFloat1(1.57079632679489655800e+00);
+		const VectorRegister4Double PiByTwoLo = VectorSetFloat1(6.12323399573676603587e-17);
+
+		const VectorRegister4Double Small = VectorSubtract(PiByTwoHi, VectorSubtract(VectorMultiplyAdd(X, R, X), PiByTwoLo));
+		const VectorRegister4Double Twice = VectorMultiply(VectorSetFloat1(2.0), VectorMultiplyAdd(S, R, S));
+		const VectorRegister4Double LargeNegative = VectorSubtract(VectorSetFloat1(3.14159265358979311600e+00), VectorSubtract(Twice, VectorSetFloat1(1.22464679914735320717e-16)));
+
+		const VectorRegister4Double Large = VectorSelect(IsNegative, LargeNegative, Twice);
+		return VectorSelect(IsLarge, Large, Small);
+	}
+
+	// atan for X >= 0 (or NaN), fdlibm s_atan.c with its four breakpoints resolved through selects.
+	FORCEINLINE VectorRegister4Double InternalVectorATanPositiveDouble(const VectorRegister4Double& AbsX)
+	{
+		const VectorRegister4Double One = VectorOneDouble();
+		const VectorRegister4Double Range0 = VectorCompareGE(AbsX, VectorSetFloat1(0.4375));	// 7/16
+		const VectorRegister4Double Range1 = VectorCompareGE(AbsX, VectorSetFloat1(0.6875));	// 11/16
+		const VectorRegister4Double Range2 = VectorCompareGE(AbsX, VectorSetFloat1(1.1875));	// 19/16
+		const VectorRegister4Double Range3 = VectorCompareGE(AbsX, VectorSetFloat1(2.4375));	// 39/16
+
+		// Reduced argument Num/Den per range:
+		//   [0, 7/16):      X / 1
+		//   [7/16, 11/16):  (2X - 1) / (2 + X)
+		//   [11/16, 19/16): (X - 1) / (X + 1)
+		//   [19/16, 39/16): (X - 1.5) / (1 + 1.5X)
+		//   [39/16, inf]:   -1 / X
+		VectorRegister4Double Num = AbsX;
+		VectorRegister4Double Den = One;
+		Num = VectorSelect(Range0, VectorSubtract(VectorAdd(AbsX, AbsX), One), Num);
+		Den = VectorSelect(Range0, VectorAdd(VectorSetFloat1(2.0), AbsX), Den);
+		Num = VectorSelect(Range1, VectorSubtract(AbsX, One), Num);
+		Den = VectorSelect(Range1, VectorAdd(AbsX, One), Den);
+		Num = VectorSelect(Range2, VectorSubtract(AbsX, VectorSetFloat1(1.5)), Num);
+		Den = VectorSelect(Range2, VectorMultiplyAdd(AbsX, VectorSetFloat1(1.5), One), Den);
+		Num = VectorSelect(Range3, GlobalVectorConstants::DoubleMinusOne, Num);
+		Den = VectorSelect(Range3, AbsX, Den);
+		const VectorRegister4Double Y = VectorDivide(Num, Den);
+
+		// atan(breakpoint) split into hi/lo parts
+		VectorRegister4Double AtanHi = VectorZeroDouble();
+		VectorRegister4Double AtanLo = VectorZeroDouble();
+		AtanHi = VectorSelect(Range0, VectorSetFloat1(4.63647609000806093515e-01), AtanHi);
+		AtanLo = VectorSelect(Range0, VectorSetFloat1(2.26987774529616870924e-17), AtanLo);
+		AtanHi = VectorSelect(Range1, VectorSetFloat1(7.85398163397448278999e-01), AtanHi);
+		AtanLo = VectorSelect(Range1, VectorSetFloat1(3.06161699786838301793e-17), AtanLo);
+		AtanHi = VectorSelect(Range2, VectorSetFloat1(9.82793723247329054082e-01), AtanHi);
+		AtanLo = VectorSelect(Range2, VectorSetFloat1(1.39033110312309984516e-17), AtanLo);
+		AtanHi = VectorSelect(Range3, VectorSetFloat1(1.57079632679489655800e+00), AtanHi);
+		AtanLo = VectorSelect(Range3, VectorSetFloat1(6.12323399573676603587e-17), AtanLo);
+
+		const VectorRegister4Double Z = VectorMultiply(Y, Y);
+		const VectorRegister4Double W = VectorMultiply(Z, Z);
+
+		VectorRegister4Double S1 = VectorSetFloat1(1.62858201153657823623e-02);
+		S1 = VectorMultiplyAdd(W, S1, VectorSetFloat1(4.97687799461593236017e-02));
+		S1 = VectorMultiplyAdd(W, S1, VectorSetFloat1(6.66107313738753120669e-02));
+		S1 = VectorMultiplyAdd(W, S1, VectorSetFloat1(9.09088713343650656196e-02));
+		S1 = VectorMultiplyAdd(W, S1, VectorSetFloat1(1.42857142725034663711e-01));
+		S1 = VectorMultiplyAdd(W, S1, VectorSetFloat1(3.33333333333329318027e-01));
+		S1 = VectorMultiply(Z, S1);
+
+		VectorRegister4Double S2 = VectorSetFloat1(-3.65315727442169155270e-02);
+		S2 = VectorMultiplyAdd(W, S2, VectorSetFloat1(-5.83357013379057348645e-02));
+		S2 = VectorMultiplyAdd(W, S2, VectorSetFloat1(-7.69187620504482999495e-02));
+		S2 = VectorMultiplyAdd(W, S2, VectorSetFloat1(-1.11111104054623557880e-01));
+		S2 = VectorMultiplyAdd(W, S2, VectorSetFloat1(-1.99999999998764832476e-01));
+		S2 = VectorMultiply(W, S2);
+
+		// AtanHi - ((Y * (S1 + S2) - AtanLo) - Y), which reduces to Y - Y * (S1 + S2) in the first range.
+		const VectorRegister4Double YS = VectorMultiply(Y, VectorAdd(S1, S2));
+		return VectorSubtract(AtanHi, VectorSubtract(VectorSubtract(YS, AtanLo), Y));
+	}
+
+	FORCEINLINE VectorRegister4Double InternalVectorATanDouble(const VectorRegister4Double& X)
+	{
+		const VectorRegister4Double Result = InternalVectorATanPositiveDouble(VectorAbs(X));
+		return VectorBitwiseOr(Result, VectorBitwiseAnd(X, InternalVectorSignBitDouble()));
+	}
+
+	FORCEINLINE VectorRegister4Double InternalVectorATan2Double(const VectorRegister4Double& Y, const VectorRegister4Double& X)
+	{
+		const VectorRegister4Double SignBit = InternalVectorSignBitDouble();
+		const VectorRegister4Double AbsX = VectorAbs(X);
+		const VectorRegister4Double AbsY = VectorAbs(Y);
+		const VectorRegister4Double Inf = InternalVectorInfinityDouble();
+
+		// Evaluate atan on the [0, 1] ratio and fix up the octant afterwards.
+		const VectorRegister4Double MinXY = VectorMin(AbsX, AbsY);
+		const VectorRegister4Double MaxXY = VectorMax(AbsX, AbsY);
+		VectorRegister4Double Ratio = VectorDivide(MinXY, MaxXY);
+		Ratio = VectorSelect(VectorCompareEQ(MaxXY, VectorZeroDouble()), VectorZeroDouble(), Ratio);
+		Ratio = VectorSelect(VectorCompareEQ(MinXY, Inf), VectorOneDouble(), Ratio);
+
+		VectorRegister4Double Result = InternalVectorATanPositiveDouble(Ratio);
+
+		// |Y| > |X|: pi/2 - Result
+		const VectorRegister4Double PiByTwoMinus = VectorAdd(VectorSubtract(VectorSetFloat1(1.57079632679489655800e+00), Result), VectorSetFloat1(6.12323399573676603587e-17));
+		Result = VectorSelect(VectorCompareGT(AbsY, AbsX), PiByTwoMinus, Result);
+
+		// X negative (including -0): pi - Result
+		// Compare +/-1 carrying the sign of X, so -0 is treated as negative.
+		const VectorRegister4Double XIsNegative = VectorCompareLT(VectorBitwiseOr(VectorBitwiseAnd(X, SignBit), VectorOneDouble()), VectorZeroDouble());
+		const VectorRegister4Double PiMinus = VectorAdd(VectorSubtract(VectorSetFloat1(3.14159265358979311600e+00), Result), VectorSetFloat1(1.22464679914735320717e-16));
+		Result = VectorSelect(XIsNegative, PiMinus, Result);
+
+		// Sign follows Y, NaNs propagate.
+		Result = VectorBitwiseOr(Result, VectorBitwiseAnd(Y, SignBit));
+		const VectorRegister4Double IsNaN = VectorBitwiseOr(VectorCompareNE(X, X), VectorCompareNE(Y, Y));
+		return VectorSelect(IsNaN, VectorAdd(X, Y), Result);
+	}
+
+	/*=============================================================================
+	 *	Single precision kernels (Cephes single precision polynomials), complementing SSE::exp_ps/log_ps.
+	 *	Error bounds, measured against the correctly rounded result over every float input (ATan2 over random pairs):
+	 *		Exp2, Log2, ACos			<= 1 ulp
+	 *		ASin, ATan, ATan2, Tan		<= 3 ulp, Tan for |X| <= 8192 (larger arguments fall back to scalar FMath::Tan)
+	 *============================================================================*/
+
+	FORCEINLINE VectorRegister4Float InternalVectorSignBitFloat()
+	{
+		return MakeVectorRegisterFloatMask(0x80000000u, 0x80000000u, 0x80000000u, 0x80000000u);
+	}
+
+	FORCEINLINE VectorRegister4Float InternalVectorInfinityFloat()
+	{
+		return MakeVectorRegisterFloatMask(0x7F800000u, 0x7F800000u, 0x7F800000u, 0x7F800000u);
+	}
+
+	FORCEINLINE VectorRegister4Float InternalVectorNaNFloat()
+	{
+		return MakeVectorRegisterFloatMask(0x7FC00000u, 0x7FC00000u, 0x7FC00000u, 0x7FC00000u);
+	}
+
+	// Returns 2^N for integral N in [-126, 127], built directly in the exponent field.
+	FORCEINLINE VectorRegister4Float InternalVectorPow2Float(const VectorRegister4Int& N)
+	{
+		return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(N, _mm_set1_epi32(127)), 23));
+	}
+
+	FORCEINLINE VectorRegister4Float InternalVectorExp2Float(const VectorRegister4Float& X)
+	{
+		// Operand order keeps NaN inputs, see InternalVectorExpDouble.
+		const VectorRegister4Float XClamped = VectorMax(VectorSetFloat1(-151.0f), VectorMin(VectorSetFloat1(129.0f), X));
+
+		// X = K + F, |F| <= 1/2
+		const VectorRegister4Int K = _mm_cvtps_epi32(XClamped);
+		const VectorRegister4Float F = VectorSubtract(XClamped, _mm_cvtepi32_ps(K));
+
+		VectorRegister4Float P = VectorSetFloat1(1.535336188319500e-4f);
+		P = VectorMultiplyAdd(F, P, VectorSetFloat1(1.339887440266574e-3f));
+		P = VectorMultiplyAdd(F, P, VectorSetFloat1(9.618437357674640e-3f));
+		P = VectorMultiplyAdd(F, P, VectorSetFloat1(5.550332471162809e-2f));
+		P = VectorMultiplyAdd(F, P, VectorSetFloat1(2.402264791363012e-1f));
+		P = VectorMultiplyAdd(F, P, VectorSetFloat1(6.931472028550421e-1f));
+		const VectorRegister4Float Y = VectorMultiplyAdd(F, P, GlobalVectorConstants::FloatOne);
+
+#if UE_PLATFORM_MATH_USE_AVX_512_VL
+		return _mm_scalef_ps(Y, _mm_cvtepi32_ps(K));
+#else
+		// Scale in two steps so the intermediate powers of two stay normal.
+		const VectorRegister4Int K1 = _mm_srai_epi32(K, 1);
+		const VectorRegister4Int K2 = _mm_sub_epi32(K, K1);
+		return VectorMultiply(VectorMultiply(Y, InternalVectorPow2Float(K1)), InternalVectorPow2Float(K2));
+#endif
+	}
+
+	FORCEINLINE VectorRegister4Float InternalVectorLog2Float(const VectorRegister4Float& X)
+	{
+		// Bring subnormals into the normal range, then compensate in the exponent.
+		const VectorRegister4Float IsSubnormal = VectorCompareLT(X, VectorSetFloat1(1.17549435e-38f));
+		const VectorRegister4Float XNormal = VectorSelect(IsSubnormal, VectorMultiply(X, VectorSetFloat1(33554432.0f /* 2^25 */)), X);
+
+		// X = 2^E * M, M in [sqrt(2)/2, sqrt(2))
+		const VectorRegister4Int Bits = _mm_castps_si128(XNormal);
+		VectorRegister4Int E = _mm_sub_epi32(_mm_srli_epi32(Bits, 23), _mm_set1_epi32(127));
+		VectorRegister4Float M = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(Bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F800000)));
+		const VectorRegister4Float IsLarge = VectorCompareGT(M, VectorSetFloat1(1.41421356f));
+		M = VectorSelect(IsLarge, VectorMultiply(M, VectorSetFloat1(0.5f)), M);
+		E = _mm_sub_epi32(E, _mm_castps_si128(IsLarge));	// mask is -1 where set
+		const VectorRegister4Float Exponent = VectorSubtract(_mm_cvtepi32_ps(E), VectorSelect(IsSubnormal, VectorSetFloat1(25.0f), GlobalVectorConstants::FloatZero));
+
+		const VectorRegister4Float F = VectorSubtract(M, GlobalVectorConstants::FloatOne);
+		const VectorRegister4Float Z = VectorMultiply(F, F);
+
+		VectorRegister4Float P = VectorSetFloat1(7.0376836292e-2f);
+		P = VectorMultiplyAdd(F, P, VectorSetFloat1(-1.1514610310e-1f));
+		P = VectorMultiplyAdd(F, P, VectorSetFloat1(1.1676998740e-1f));
+		P = VectorMultiplyAdd(F, P, VectorSetFloat1(-1.2420140846e-1f));
+		P = VectorMultiplyAdd(F, P, VectorSetFloat1(1.4249322787e-1f));
+		P = VectorMultiplyAdd(F, P, VectorSetFloat1(-1.6668057665e-1f));
+		P = VectorMultiplyAdd(F, P, VectorSetFloat1(2.0000714765e-1f));
+		P = VectorMultiplyAdd(F, P, VectorSetFloat1(-2.4999993993e-1f));
+		P = VectorMultiplyAdd(F, P, VectorSetFloat1(3.3333331174e-1f));
+
+		// Y = log(1 + F) - F, then log2 = E + F + Y + (F + Y) * (log2(e) - 1)
+		VectorRegister4Float Y = VectorMultiply(VectorMultiply(F, Z), P);
+		Y = VectorNegateMultiplyAdd(VectorSetFloat1(0.5f), Z, Y);
+		const VectorRegister4Float Log2eMinusOne = VectorSetFloat1(0.44269504088896340736f);
+		VectorRegister4Float Result = VectorMultiply(Y, Log2eMinusOne);
+		Result = VectorMultiplyAdd(F, Log2eMinusOne, Result);
+		Result = VectorAdd(Result, Y);
+		Result = VectorAdd(Result, F);
+		Result = VectorAdd(Result, Exponent);
+
+		// Zero, negative, infinite and NaN inputs
+		const VectorRegister4Float Inf = InternalVectorInfinityFloat();
+		const VectorRegister4Float IsInvalid = VectorBitwiseOr(VectorCompareLT(X, GlobalVectorConstants::FloatZero), VectorCompareNE(X, X));
+		Result = VectorSelect(VectorCompareEQ(X, Inf), Inf, Result);
+		Result = VectorSelect(VectorCompareEQ(X, GlobalVectorConstants::FloatZero), VectorNegate(Inf), Result);
+		return VectorSelect(IsInvalid, InternalVectorNaNFloat(), Result);
+	}
+
+	FORCEINLINE VectorRegister4Float InternalVectorTanFloat(const VectorRegister4Float& X)
+	{
+		const VectorRegister4Float AbsX = VectorAbs(X);
+
+		// X = J * pi/4 + Z with J even, |Z| <= pi/4. The reduction is done in double: near the poles Z is tiny and
+		// a float Cody-Waite reduction loses most of its bits before the -1/tan(Z) step amplifies the error.
+		VectorRegister4Int J = _mm_cvttps_epi32(VectorMultiply(AbsX, VectorSetFloat1(1.27323954473516f)));
+		J = _mm_and_si128(_mm_add_epi32(J, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+		const VectorRegister2Double PiByFourHi = _mm_set1_pd(0.785398006439208984375);		// 24 bits, J * PiByFourHi is exact
+		const VectorRegister2Double PiByFourLo = _mm_set1_pd(1.5695823932524066e-07);
+		const VectorRegister2Double JLo = _mm_cvtepi32_pd(J);
+		const VectorRegister2Double JHi = _mm_cvtepi32_pd(_mm_shuffle_epi32(J, _MM_SHUFFLE(1, 0, 3, 2)));
+		const VectorRegister2Double ZLo = _mm_sub_pd(_mm_sub_pd(_mm_cvtps_pd(AbsX), _mm_mul_pd(JLo, PiByFourHi)), _mm_mul_pd(JLo, PiByFourLo));
+		const VectorRegister2Double ZHi = _mm_sub_pd(_mm_sub_pd(_mm_cvtps_pd(_mm_movehl_ps(AbsX, AbsX)), _mm_mul_pd(JHi, PiByFourHi)), _mm_mul_pd(JHi, PiByFourLo));
+		const VectorRegister4Float Z = _mm_movelh_ps(_mm_cvtpd_ps(ZLo), _mm_cvtpd_ps(ZHi));
+		const VectorRegister4Float ZZ = VectorMultiply(Z, Z);
+
+		VectorRegister4Float P = VectorSetFloat1(9.38540185543e-3f);
+		P = VectorMultiplyAdd(ZZ, P, VectorSetFloat1(3.11992232697e-3f));
+		P = VectorMultiplyAdd(ZZ, P, VectorSetFloat1(2.44301354525e-2f));
+		P = VectorMultiplyAdd(ZZ, P, VectorSetFloat1(5.34112807005e-2f));
+		P = VectorMultiplyAdd(ZZ, P, VectorSetFloat1(1.33387994085e-1f));
+		P = VectorMultiplyAdd(ZZ, P, VectorSetFloat1(3.33331568548e-1f));
+		VectorRegister4Float Result = VectorMultiplyAdd(VectorMultiply(ZZ, Z), P, Z);
+
+		// J/2 odd: tan(Z + pi/2) = -1/tan(Z)
+		const VectorRegister4Float IsOdd = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(J, _mm_set1_epi32(2)), _mm_set1_epi32(2)));
+		Result = VectorSelect(IsOdd, VectorDivide(GlobalVectorConstants::FloatMinusOne, Result), Result);
+
+		return VectorBitwiseXor(Result, VectorBitwiseAnd(X, InternalVectorSignBitFloat()));
+	}
+
+	// asin(S) for S in [0, 0.5] given T = S^2, Cephes asinf polynomial.
+	FORCEINLINE VectorRegister4Float InternalVectorASinPolyFloat(const VectorRegister4Float& S, const VectorRegister4Float& T)
+	{
+		VectorRegister4Float P = VectorSetFloat1(4.2163199048e-2f);
+		P = VectorMultiplyAdd(T, P, VectorSetFloat1(2.4181311049e-2f));
+		P = VectorMultiplyAdd(T, P, VectorSetFloat1(4.5470025998e-2f));
+		P = VectorMultiplyAdd(T, P, VectorSetFloat1(7.4953002686e-2f));
+		P = VectorMultiplyAdd(T, P, VectorSetFloat1(1.6666752422e-1f));
+		return VectorMultiplyAdd(VectorMultiply(T, S), P, S);
+	}
+
+	FORCEINLINE VectorRegister4Float InternalVectorASinFloat(const VectorRegister4Float& X)
+	{
+		const VectorRegister4Float AbsX = VectorAbs(X);
+		const VectorRegister4Float IsLarge = VectorCompareGT(AbsX, VectorSetFloat1(0.5f));
+
+		// |X| > 0.5: asin(|X|) = pi/2 - 2 * asin(sqrt((1 - |X|) / 2))
+		const VectorRegister4Float T = VectorSelect(IsLarge, VectorMultiply(VectorSubtract(GlobalVectorConstants::FloatOne, AbsX), VectorSetFloat1(0.5f)), VectorMultiply(AbsX, AbsX));
+		const VectorRegister4Float S = VectorSelect(IsLarge, VectorSqrt(T), AbsX);
+		const VectorRegister4Float R = InternalVectorASinPolyFloat(S, T);
+
+		const VectorRegister4Float Result = VectorSelect(IsLarge, VectorSubtract(GlobalVectorConstants::PiByTwo, VectorAdd(R, R)), R);
+		return VectorBitwiseOr(Result, VectorBitwiseAnd(X, InternalVectorSignBitFloat()));
+	}
+
+	FORCEINLINE VectorRegister4Float InternalVectorACosFloat(const VectorRegister4Float& X)
+	{
+		const VectorRegister4Float AbsX = VectorAbs(X);
+		const VectorRegister4Float IsLarge = VectorCompareGT(AbsX, VectorSetFloat1(0.5f));
+
+		// |X| <= 0.5: acos(X) = pi/2 - asin(X)
+		// X > 0.5: acos(X) = 2 * asin(sqrt((1 - X) / 2))
+		// X < -0.5: acos(X) = pi - 2 * asin(sqrt((1 + X) / 2))
+		const VectorRegister4Float T = VectorSelect(IsLarge, VectorMultiply(VectorSubtract(GlobalVectorConstants::FloatOne, AbsX), VectorSetFloat1(0.5f)), VectorMultiply(X, X));
+		const VectorRegister4Float S = VectorSelect(IsLarge, VectorSqrt(T), X);
+		const VectorRegister4Float R = InternalVectorASinPolyFloat(S, T);
+
+		const VectorRegister4Float Twice = VectorAdd(R, R);
+		const VectorRegister4Float Large = VectorSelect(VectorCompareLT(X, GlobalVectorConstants::FloatZero), VectorSubtract(GlobalVectorConstants::Pi, Twice), Twice);
+		return VectorSelect(IsLarge, Large, VectorSubtract(GlobalVectorConstants::PiByTwo, R));
+	}
+
+	// atan for X >= 0 (or NaN), Cephes atanf with its two breakpoints resolved through selects.
+	FORCEINLINE VectorRegister4Float InternalVectorATanPositiveFloat(const VectorRegister4Float& AbsX)
+	{
+		const VectorRegister4Float One = GlobalVectorConstants::FloatOne;
+		const VectorRegister4Float IsMid = VectorCompareGT(AbsX, VectorSetFloat1(0.4142135623730950f));	// tan(pi/8)
+		const VectorRegister4Float IsHigh = VectorCompareGT(AbsX, VectorSetFloat1(2.414213562373095f));		// tan(3pi/8)
+
+		// (X - 1) / (X + 1) above tan(pi/8), -1 / X above tan(3pi/8)
+		const VectorRegister4Float Num = VectorSelect(IsHigh, GlobalVectorConstants::FloatMinusOne, VectorSelect(IsMid, VectorSubtract(AbsX, One), AbsX));
+		const VectorRegister4Float Den = VectorSelect(IsHigh, AbsX, VectorSelect(IsMid, VectorAdd(AbsX, One), One));
+		const VectorRegister4Float Y = VectorDivide(Num, Den);
+		const VectorRegister4Float Base = VectorSelect(IsHigh, GlobalVectorConstants::PiByTwo, VectorSelect(IsMid, VectorSetFloat1(0.78539816339744830962f), GlobalVectorConstants::FloatZero));
+
+		const VectorRegister4Float Z = VectorMultiply(Y, Y);
+		VectorRegister4Float P = VectorSetFloat1(8.05374449538e-2f);
+		P = VectorMultiplyAdd(Z, P, VectorSetFloat1(-1.38776856032e-1f));
+		P = VectorMultiplyAdd(Z, P, VectorSetFloat1(1.99777106478e-1f));
+		P = VectorMultiplyAdd(Z, P, VectorSetFloat1(-3.33329491539e-1f));
+		return VectorAdd(Base, VectorMultiplyAdd(VectorMultiply(Z, Y), P, Y));
+	}
+
+	FORCEINLINE VectorRegister4Float InternalVectorATanFloat(const VectorRegister4Float& X)
+	{
+		const VectorRegister4Float Result = InternalVectorATanPositiveFloat(VectorAbs(X));
+		return VectorBitwiseOr(Result, VectorBitwiseAnd(X, InternalVectorSignBitFloat()));
+	}
+
+	FORCEINLINE VectorRegister4Float InternalVectorATan2Float(const VectorRegister4Float& Y, const VectorRegister4Float& X)
+	{
+		const VectorRegister4Float SignBit = InternalVectorSignBitFloat();
+		const VectorRegister4Float AbsX = VectorAbs(X);
+		const VectorRegister4Float AbsY = VectorAbs(Y);
+
+		// Evaluate atan on the [0, 1] ratio and fix up the octant afterwards, see InternalVectorATan2Double.
+		const VectorRegister4Float MinXY = VectorMin(AbsX, AbsY);
+		const VectorRegister4Float MaxXY = VectorMax(AbsX, AbsY);
+		VectorRegister4Float Ratio = VectorDivide(MinXY, MaxXY);
+		Ratio = VectorSelect(VectorCompareEQ(MaxXY, GlobalVectorConstants::FloatZero), GlobalVectorConstants::FloatZero, Ratio);
+		Ratio = VectorSelect(VectorCompareEQ(MinXY, InternalVectorInfinityFloat()), GlobalVectorConstants::FloatOne, Ratio);
+
+		VectorRegister4Float Result = InternalVectorATanPositiveFloat(Ratio);
+		Result = VectorSelect(VectorCompareGT(AbsY, AbsX), VectorSubtract(GlobalVectorConstants::PiByTwo, Result), Result);
+
+		const VectorRegister4Float XIsNegative = VectorCompareLT(VectorBitwiseOr(VectorBitwiseAnd(X, SignBit), GlobalVectorConstants::FloatOne), GlobalVectorConstants::FloatZero);
+		Result = VectorSelect(XIsNegative, VectorSubtract(GlobalVectorConstants::Pi, Result), Result);
+
+		Result = VectorBitwiseOr(Result, VectorBitwiseAnd(Y, SignBit));
+		const VectorRegister4Float IsNaN = VectorBitwiseOr(VectorCompareNE(X, X), VectorCompareNE(Y, Y));
+		return VectorSelect(IsNaN, VectorAdd(X, Y), Result);
+	}
+
+} // namespace SSEVectorHelperFuncs
+
+FORCEINLINE VectorRegister4Float VectorExp(const VectorRegister4Float& X)
+{
+#if UE_PLATFORM_MATH_USE_SVML
 	return _mm_exp_ps(X);
 #else
 	return SSE::exp_ps(X);
@@ -3197,12 +5324,7 @@ FORCEINLINE VectorRegister4Double VectorExp(const VectorRegister4Double& X)
 #elif UE_PLATFORM_MATH_USE_SVML
 	return VectorRegister4Double(_mm_exp_pd(X.XY), _mm_exp_pd(X.ZW));
 #else
-	AlignedDouble4 Doubles(X);
-	Doubles[0] = FMath::Exp(Doubles[0]);
-	Doubles[1] = FMath::Exp(Doubles[1]);
-	Doubles[2] = FMath::Exp(Doubles[2]);
-	Doubles[3] = FMath::Exp(Doubles[3]);
-	return Doubles.ToVectorRegister();
+	return SSEVectorHelperFuncs::InternalVectorExpDouble(X);
 #endif
 }
 
@@ -3211,12 +5333,7 @@ FORCEINLINE VectorRegister4Float VectorExp2(const VectorRegister4Float& X)
 #if UE_PLATFORM_MATH_USE_SVML
 	return _mm_exp2_ps(X);
 #else
-	AlignedFloat4 Floats(X);
-	Floats[0] = FMath::Exp2(Floats[0]);
-	Floats[1] = FMath::Exp2(Floats[1]);
-	Floats[2] = FMath::Exp2(Floats[2]);
-	Floats[3] = FMath::Exp2(Floats[3]);
-	return Floats.ToVectorRegister();
+	return SSEVectorHelperFuncs::InternalVectorExp2Float(X);
 #endif
 }
 
@@ -3227,12 +5344,7 @@ FORCEINLINE VectorRegister4Double VectorExp2(const VectorRegister4Double& X)
 #elif UE_PLATFORM_MATH_USE_SVML
 	return VectorRegister4Double(_mm_exp2_pd(X.XY), _mm_exp2_pd(X.ZW));
 #else
-	AlignedDouble4 Doubles(X);
-	Doubles[0] = FMath::Exp2(Doubles[0]);
-	Doubles[1] = FMath::Exp2(Doubles[1]);
-	Doubles[2] = FMath::Exp2(Doubles[2]);
-	Doubles[3] = FMath::Exp2(Doubles[3]);
-	return Doubles.ToVectorRegister();
+	return SSEVectorHelperFuncs::InternalVectorExp2Double(X);
 #endif
 }
 
@@ -3252,12 +5364,7 @@ FORCEINLINE VectorRegister4Double VectorLog(const VectorRegister4Double& X)
 #elif UE_PLATFORM_MATH_USE_SVML
 	return VectorRegister4Double(_mm_log_pd(X.XY), _mm_log_pd(X.ZW));
 #else
-	AlignedDouble4 Doubles(X);
-	Doubles[0] = FMath::Loge(Doubles[0]);
-	Doubles[1] = FMath::Loge(Doubles[1]);
-	Doubles[2] = FMath::Loge(Doubles[2]);
-	Doubles[3] = FMath::Loge(Doubles[3]);
-	return Doubles.ToVectorRegister();
+	return SSEVectorHelperFuncs::InternalVectorLogDouble(X);
 #endif
 }
 
@@ -3266,12 +5373,7 @@ FORCEINLINE VectorRegister4Float VectorLog2(const VectorRegister4Float& X)
 #if UE_PLATFORM_MATH_USE_SVML
 	return _mm_log2_ps(X);
 #else
-	AlignedFloat4 Floats(X);
-	Floats[0] = FMath::Log2(Floats[0]);
-	Floats[1] = FMath::Log2(Floats[1]);
-	Floats[2] = FMath::Log2(Floats[2]);
-	Floats[3] = FMath::Log2(Floats[3]);
-	return Floats.ToVectorRegister();
+	return SSEVectorHelperFuncs::InternalVectorLog2Float(X);
 #endif
 }
 
@@ -3282,12 +5384,28 @@ FORCEINLINE VectorRegister4Double VectorLog2(const VectorRegister4Double& X)
 #elif UE_PLATFORM_MATH_USE_SVML
 	return VectorRegister4Double(_mm_log2_pd(X.XY), _mm_log2_pd(X.ZW));
 #else
-	AlignedDouble4 Doubles(X);
-	Doubles[0] = FMath::Log2(Doubles[0]);
-	Doubles[1] = FMath::Log2(Doubles[1]);
-	Doubles[2] = FMath::Log2(Doubles[2]);
-	Doubles[3] = FMath::Log2(Doubles[3]);
-	return Doubles.ToVectorRegister();
+	return SSEVectorHelperFuncs::InternalVectorLog2Double(X);
+#endif
+}
+
+FORCEINLINE VectorRegister4Double VectorPow(const VectorRegister4Double& Base, const VectorRegister4Double& Exponent)
+{
+#if UE_PLATFORM_MATH_USE_SVML_AVX
+	return _mm256_pow_pd(Base, Exponent);
+#elif UE_PLATFORM_MATH_USE_SVML
+	return VectorRegister4Double(_mm_pow_pd(Base.XY, Exponent.XY), _mm_pow_pd(Base.ZW, Exponent.ZW));
+#elif UE_PLATFORM_MATH_USE_AVX
+	return SSEVectorHelperFuncs::InternalVectorPowDouble(Base, Exponent);
+#else
+	// Two lanes per instruction leave the kernel latency bound, the C library pow is faster here.
+	AlignedDouble4 Values(Base);
+	AlignedDouble4 Exponents(Exponent);
+
+	Values[0] = FMath::Pow(Values[0], Exponents[0]);
+	Values[1] = FMath::Pow(Values[1], Exponents[1]);
+	Values[2] = FMath::Pow(Values[2], Exponents[2]);
+	Values[3] = FMath::Pow(Values[3], Exponents[3]);
+	return Values.ToVectorRegister();
 #endif
 }
 
@@ -3428,8 +5546,7 @@ FORCEINLINE void VectorSinCos(VectorRegister4Double* RESTRICT VSinAngles, Vector
 	VSinAngles->XY = _mm_sincos_pd(&(VCosAngles->XY), VAngles->XY);
 	VSinAngles->ZW = _mm_sincos_pd(&(VCosAngles->ZW), VAngles->ZW);
 #else
-	*VSinAngles = VectorSin(*VAngles);
-	*VCosAngles = VectorCos(*VAngles);
+	SSEVectorHelperFuncs::InternalVectorSinCosDouble(*VAngles, *VSinAngles, *VCosAngles);
 #endif
 }
 
@@ -3439,7 +5556,12 @@ FORCEINLINE VectorRegister4Float VectorTan(const VectorRegister4Float& X)
 #if UE_PLATFORM_MATH_USE_SVML
 	return _mm_tan_ps(X);
 #else
-	//return SSE::tan_ps(X);
+	// The two-part pi/4 split is exact for |X| <= 8192, hand larger lanes (and Inf/NaN) to the scalar path.
+	const VectorRegister4Float InRange = VectorCompareLE(VectorAbs(X), VectorSetFloat1(8192.0f));
+	if (VectorMaskBits(InRange) == 0xF)
+	{
+		return SSEVectorHelperFuncs::InternalVectorTanFloat(X);
+	}
 	AlignedFloat4 Floats(X);
 	Floats[0] = FMath::Tan(Floats[0]);
 	Floats[1] = FMath::Tan(Floats[1]);
@@ -3456,6 +5578,12 @@ FORCEINLINE VectorRegister4Double VectorTan(const VectorRegister4Double& X)
 #elif UE_PLATFORM_MATH_USE_SVML
 	return VectorRegister4Double(_mm_tan_pd(X.XY), _mm_tan_pd(X.ZW));
 #else
+	// The three-part reduction loses accuracy past 2^26, hand those (and Inf/NaN) to the scalar path.
+	const VectorRegister4Double InRange = VectorCompareLE(VectorAbs(X), VectorSetFloat1(67108864.0));
+	if (VectorMaskBits(InRange) == 0xF)
+	{
+		return SSEVectorHelperFuncs::InternalVectorTanDouble(X);
+	}
 	AlignedDouble4 Doubles(X);
 	Doubles[0] = FMath::Tan(Doubles[0]);
 	Doubles[1] = FMath::Tan(Doubles[1]);
@@ -3470,12 +5598,7 @@ FORCEINLINE VectorRegister4Float VectorASin(const VectorRegister4Float& X)
 #if UE_PLATFORM_MATH_USE_SVML
 	return _mm_asin_ps(X);
 #else
-	AlignedFloat4 Floats(X);
-	Floats[0] = FMath::Asin(Floats[0]);
-	Floats[1] = FMath::Asin(Floats[1]);
-	Floats[2] = FMath::Asin(Floats[2]);
-	Floats[3] = FMath::Asin(Floats[3]);
-	return Floats.ToVectorRegister();
+	return SSEVectorHelperFuncs::InternalVectorASinFloat(X);
 #endif
 }
 
@@ -3486,12 +5609,7 @@ FORCEINLINE VectorRegister4Double VectorASin(const VectorRegister4Double& X)
 #elif UE_PLATFORM_MATH_USE_SVML
 	return VectorRegister4Double(_mm_asin_pd(X.XY), _mm_asin_pd(X.ZW));
 #else
-	AlignedDouble4 Doubles(X);
-	Doubles[0] = FMath::Asin(Doubles[0]);
-	Doubles[1] = FMath::Asin(Doubles[1]);
-	Doubles[2] = FMath::Asin(Doubles[2]);
-	Doubles[3] = FMath::Asin(Doubles[3]);
-	return Doubles.ToVectorRegister();
+	return SSEVectorHelperFuncs::InternalVectorASinDouble(X);
 #endif
 }
 
@@ -3500,12 +5618,7 @@ FORCEINLINE VectorRegister4Float VectorACos(const VectorRegister4Float& X)
 #if UE_PLATFORM_MATH_USE_SVML
 	return _mm_acos_ps(X);
 #else
-	AlignedFloat4 Floats(X);
-	Floats[0] = FMath::Acos(Floats[0]);
-	Floats[1] = FMath::Acos(Floats[1]);
-	Floats[2] = FMath::Acos(Floats[2]);
-	Floats[3] = FMath::Acos(Floats[3]);
-	return Floats.ToVectorRegister();
+	return SSEVectorHelperFuncs::InternalVectorACosFloat(X);
 #endif
 }
 
@@ -3516,12 +5629,7 @@ FORCEINLINE VectorRegister4Double VectorACos(const VectorRegister4Double& X)
 #elif UE_PLATFORM_MATH_USE_SVML
 	return VectorRegister4Double(_mm_acos_pd(X.XY), _mm_acos_pd(X.ZW));
 #else
-	AlignedDouble4 Doubles(X);
-	Doubles[0] = FMath::Acos(Doubles[0]);
-	Doubles[1] = FMath::Acos(Doubles[1]);
-	Doubles[2] = FMath::Acos(Doubles[2]);
-	Doubles[3] = FMath::Acos(Doubles[3]);
-	return Doubles.ToVectorRegister();
+	return SSEVectorHelperFuncs::InternalVectorACosDouble(X);
 #endif
 }
 
@@ -3530,13 +5638,7 @@ FORCEINLINE VectorRegister4Float VectorATan(const VectorRegister4Float& X)
 #if UE_PLATFORM_MATH_USE_SVML
 	return _mm_atan_ps(X);
 #else
-	//return SSE::atan_ps(X);
-	AlignedFloat4 Floats(X);
-	Floats[0] = FMath::Atan(Floats[0]);
-	Floats[1] = FMath::Atan(Floats[1]);
-	Floats[2] = FMath::Atan(Floats[2]);
-	Floats[3] = FMath::Atan(Floats[3]);
-	return Floats.ToVectorRegister();
+	return SSEVectorHelperFuncs::InternalVectorATanFloat(X);
 #endif
 }
 
@@ -3547,12 +5649,7 @@ FORCEINLINE VectorRegister4Double VectorATan(const VectorRegister4Double& X)
 #elif UE_PLATFORM_MATH_USE_SVML
 	return VectorRegister4Double(_mm_atan_pd(X.XY), _mm_atan_pd(X.ZW));
 #else
-	AlignedDouble4 Doubles(X);
-	Doubles[0] = FMath::Atan(Doubles[0]);
-	Doubles[1] = FMath::Atan(Doubles[1]);
-	Doubles[2] = FMath::Atan(Doubles[2]);
-	Doubles[3] = FMath::Atan(Doubles[3]);
-	return Doubles.ToVectorRegister();
+	return SSEVectorHelperFuncs::InternalVectorATanDouble(X);
 #endif
 }
 
@@ -3561,14 +5658,7 @@ FORCEINLINE VectorRegister4Float VectorATan2(const VectorRegister4Float& Y, cons
 #if UE_PLATFORM_MATH_USE_SVML
 	return _mm_atan2_ps(Y, X);
 #else
-	//return SSE::atan2_ps(Y, X);
-	AlignedFloat4 FloatsY(Y);
-	AlignedFloat4 FloatsX(X);
-	FloatsY[0] = FMath::Atan2(FloatsY[0], FloatsX[0]);
-	FloatsY[1] = FMath::Atan2(FloatsY[1], FloatsX[1]);
-	FloatsY[2] = FMath::Atan2(FloatsY[2], FloatsX[2]);
-	FloatsY[3] = FMath::Atan2(FloatsY[3], FloatsX[3]);
-	return FloatsY.ToVectorRegister();
+	return SSEVectorHelperFuncs::InternalVectorATan2Float(Y, X);
 #endif
 }
 
@@ -3579,44 +5669,2167 @@ FORCEINLINE VectorRegister4Double VectorATan2(const VectorRegister4Double& Y, co
 #elif UE_PLATFORM_MATH_USE_SVML
 	return VectorRegister4Double(_mm_atan2_pd(Y.XY, X.XY), _mm_atan2_pd(Y.ZW, X.ZW));
 #else
-	AlignedDouble4 DoublesY(Y);
-	AlignedDouble4 DoublesX(X);
-	DoublesY[0] = FMath::Atan2(DoublesY[0], DoublesX[0]);
-	DoublesY[1] = FMath::Atan2(DoublesY[1], DoublesX[1]);
-	DoublesY[2] = FMath::Atan2(DoublesY[2], DoublesX[2]);
-	DoublesY[3] = FMath::Atan2(DoublesY[3], DoublesX[3]);
-	return DoublesY.ToVectorRegister();
+	return SSEVectorHelperFuncs::InternalVectorATan2Double(Y, X);
 #endif
 }
 
 
 //////////////////////////////////////////////////////////////////////////
-//Integer ops
+// Batched quaternion kernels
+//
+// Quaternions and vectors are stored as structure of arrays: every pointer array argument holds the X, Y, Z and W
+// component arrays (X, Y and Z for vectors). AVX and AVX-512 builds run all but slerp at full register width.
 
-//Bitwise
-/** = a & b */
-#define VectorIntAnd(A, B)		_mm_and_si128(A, B)
-/** = a | b */
-#define VectorIntOr(A, B)		_mm_or_si128(A, B)
-/** = a ^ b */
-#define VectorIntXor(A, B)		_mm_xor_si128(A, B)
-/** = (~a) & b */
-#define VectorIntAndNot(A, B)	_mm_andnot_si128(A, B)
-/** = ~a */
-#define VectorIntNot(A)	_mm_xor_si128(A, GlobalVectorConstants::IntAllMask)
+namespace SSEVectorHelperFuncs
+{
+	// Loads one SoA component of the 4 elements starting at Index, zero padded when fewer than 4 remain.
+	template<typename ScalarType>
+	FORCEINLINE decltype(VectorSetFloat1(ScalarType(0))) InternalVectorLoadSoA4(const ScalarType* Src, int32 Index, int32 Count)
+	{
+		if (Index + 4 <= Count)
+		{
+			return VectorLoad(Src + Index);
+		}
+		ScalarType Lanes[4] = {};
+		for (int32 Lane = 0; Index + Lane < Count; ++Lane)
+		{
+			Lanes[Lane] = Src[Index + Lane];
+		}
+		return VectorLoad(Lanes);
+	}
 
-//Comparison
-#define VectorIntCompareEQ(A, B)	_mm_cmpeq_epi32(A,B)
-#define VectorIntCompareNEQ(A, B)	VectorIntNot(_mm_cmpeq_epi32(A,B))
-#define VectorIntCompareGT(A, B)	_mm_cmpgt_epi32(A,B)
-#define VectorIntCompareLT(A, B)	_mm_cmplt_epi32(A,B)
-#define VectorIntCompareGE(A, B)	VectorIntNot(VectorIntCompareLT(A,B))
-#define VectorIntCompareLE(A, B)	VectorIntNot(VectorIntCompareGT(A,B))
+	template<typename RegisterType, typename ScalarType>
+	FORCEINLINE void InternalVectorStoreSoA4(const RegisterType& Vec, ScalarType* Dst, int32 Index, int32 Count)
+	{
+		if (Index + 4 <= Count)
+		{
+			VectorStore(Vec, Dst + Index);
+			return;
+		}
+		ScalarType Lanes[4];
+		VectorStore(Vec, Lanes);
+		for (int32 Lane = 0; Index + Lane < Count; ++Lane)
+		{
+			Dst[Index + Lane] = Lanes[Lane];
+		}
+	}
 
+	template<typename RegisterType, typename ScalarType>
+	FORCEINLINE void InternalVectorLoadQuaternionSoA4(RegisterType (&Out)[4], const ScalarType* const* Quat, int32 Index, int32 Count)
+	{
+		Out[0] = InternalVectorLoadSoA4(Quat[0], Index, Count);
+		Out[1] = InternalVectorLoadSoA4(Quat[1], Index, Count);
+		Out[2] = InternalVectorLoadSoA4(Quat[2], Index, Count);
+		Out[3] = InternalVectorLoadSoA4(Quat[3], Index, Count);
+	}
 
-FORCEINLINE VectorRegister4Int VectorIntSelect(const VectorRegister4Int& Mask, const VectorRegister4Int& Vec1, const VectorRegister4Int& Vec2)
-{
-	return _mm_xor_si128(Vec2, _mm_and_si128(Mask, _mm_xor_si128(Vec1, Vec2)));
+	template<typename RegisterType, typename ScalarType>
+	FORCEINLINE void InternalVectorStoreQuaternionSoA4(ScalarType* const* Quat, const RegisterType (&In)[4], int32 Index, int32 Count)
+	{
+		InternalVectorStoreSoA4(In[0], Quat[0], Index, Count);
+		InternalVectorStoreSoA4(In[1], Quat[1], Index, Count);
+		InternalVectorStoreSoA4(In[2], Quat[2], Index, Count);
+		InternalVectorStoreSoA4(In[3], Quat[3], Index, Count);
+	}
+
+	// Same math as the AVX kernels on 4 lanes, each register holds one component of 4 quaternions.
+	template<typename RegisterType>
+	FORCEINLINE void InternalQuaternionMultiply4(RegisterType (&Out)[4], const RegisterType (&A)[4], const RegisterType (&B)[4])
+	{
+		Out[0] = VectorMultiplyAdd(A[3], B[0], VectorMultiplyAdd(A[0], B[3], VectorNegateMultiplyAdd(A[2], B[1], VectorMultiply(A[1], B[2]))));
+		Out[1] = VectorMultiplyAdd(A[3], B[1], VectorMultiplyAdd(A[1], B[3], VectorNegateMultiplyAdd(A[0], B[2], VectorMultiply(A[2], B[0]))));
+		Out[2] = VectorMultiplyAdd(A[3], B[2], VectorMultiplyAdd(A[2], B[3], VectorNegateMultiplyAdd(A[1], B[0], VectorMultiply(A[0], B[1]))));
+		Out[3] = VectorNegateMultiplyAdd(A[2], B[2], VectorNegateMultiplyAdd(A[1], B[1], VectorNegateMultiplyAdd(A[0], B[0], VectorMultiply(A[3], B[3]))));
+	}
+
+	template<typename RegisterType>
+	FORCEINLINE RegisterType InternalQuaternionDot4(const RegisterType (&A)[4], const RegisterType (&B)[4])
+	{
+		return VectorMultiplyAdd(A[3], B[3], VectorMultiplyAdd(A[2], B[2], VectorMultiplyAdd(A[1], B[1], VectorMultiply(A[0], B[0]))));
+	}
+
+	template<typename ScalarType, typename RegisterType>
+	FORCEINLINE void InternalQuaternionNormalize4(RegisterType (&Q)[4])
+	{
+		const RegisterType SquareSum = InternalQuaternionDot4(Q, Q);
+		const RegisterType Valid = VectorCompareGE(SquareSum, VectorSetFloat1(ScalarType(1.e-8)));
+		const RegisterType Scale = VectorDivide(VectorSetFloat1(ScalarType(1)), VectorSqrt(SquareSum));
+		const RegisterType Zero = VectorSetFloat1(ScalarType(0));
+		Q[0] = VectorSelect(Valid, VectorMultiply(Q[0], Scale), Zero);
+		Q[1] = VectorSelect(Valid, VectorMultiply(Q[1], Scale), Zero);
+		Q[2] = VectorSelect(Valid, VectorMultiply(Q[2], Scale), Zero);
+		Q[3] = VectorSelect(Valid, VectorMultiply(Q[3], Scale), VectorSetFloat1(ScalarType(1)));
+	}
+
+	template<typename ScalarType, typename RegisterType>
+	FORCEINLINE void InternalQuaternionBlend4(RegisterType (&Out)[4], const RegisterType (&A)[4], const RegisterType (&B)[4], const RegisterType& WeightA, const RegisterType& WeightB)
+	{
+		Out[0] = VectorMultiplyAdd(A[0], WeightA, VectorMultiply(B[0], WeightB));
+		Out[1] = VectorMultiplyAdd(A[1], WeightA, VectorMultiply(B[1], WeightB));
+		Out[2] = VectorMultiplyAdd(A[2], WeightA, VectorMultiply(B[2], WeightB));
+		Out[3] = VectorMultiplyAdd(A[3], WeightA, VectorMultiply(B[3], WeightB));
+		InternalQuaternionNormalize4<ScalarType>(Out);
+	}
+
+	template<typename ScalarType>
+	FORCEINLINE void InternalVectorQuaternionMultiplySoA4(ScalarType* const* Result, const ScalarType* const* Quat1, const ScalarType* const* Quat2, int32 Index, int32 Count)
+	{
+		typedef decltype(VectorSetFloat1(ScalarType(0))) RegisterType;
+		for (; Index < Count; Index += 4)
+		{
+			RegisterType A[4], B[4], Out[4];
+			InternalVectorLoadQuaternionSoA4(A, Quat1, Index, Count);
+			InternalVectorLoadQuaternionSoA4(B, Quat2, Index, Count);
+			InternalQuaternionMultiply4(Out, A, B);
+			InternalVectorStoreQuaternionSoA4(Result, Out, Index, Count);
+		}
+	}
+
+	template<typename ScalarType>
+	FORCEINLINE void InternalVectorQuaternionNormalizeSoA4(ScalarType* const* Result, const ScalarType* const* Quat, int32 Index, int32 Count)
+	{
+		typedef decltype(VectorSetFloat1(ScalarType(0))) RegisterType;
+		for (; Index < Count; Index += 4)
+		{
+			RegisterType Q[4];
+			InternalVectorLoadQuaternionSoA4(Q, Quat, Index, Count);
+			InternalQuaternionNormalize4<ScalarType>(Q);
+			InternalVectorStoreQuaternionSoA4(Result, Q, Index, Count);
+		}
+	}
+
+	template<typename ScalarType>
+	FORCEINLINE void InternalVectorQuaternionNLerpSoA4(ScalarType* const* Result, const ScalarType* const* Quat1, const ScalarType* const* Quat2, const ScalarType* Alpha, int32 Index, int32 Count)
+	{
+		typedef decltype(VectorSetFloat1(ScalarType(0))) RegisterType;
+		const RegisterType One = VectorSetFloat1(ScalarType(1));
+		for (; Index < Count; Index += 4)
+		{
+			RegisterType A[4], B[4], Out[4];
+			InternalVectorLoadQuaternionSoA4(A, Quat1, Index, Count);
+			InternalVectorLoadQuaternionSoA4(B, Quat2, Index, Count);
+			const RegisterType Weight = InternalVectorLoadSoA4(Alpha, Index, Count);
+
+			// FQuat::FastLerp, Quat1 is flipped onto Quat2's hemisphere to take the shortest path.
+			const RegisterType Bias = VectorSelect(VectorCompareGE(InternalQuaternionDot4(A, B), VectorSetFloat1(ScalarType(0))), One, VectorSetFloat1(ScalarType(-1)));
+			InternalQuaternionBlend4<ScalarType>(Out, A, B, VectorMultiply(Bias, VectorSubtract(One, Weight)), Weight);
+			InternalVectorStoreQuaternionSoA4(Result, Out, Index, Count);
+		}
+	}
+
+	template<typename ScalarType>
+	FORCEINLINE void InternalVectorQuaternionSlerpSoA4(ScalarType* const* Result, const ScalarType* const* Quat1, const ScalarType* const* Quat2, const ScalarType* Alpha, int32 Index, int32 Count)
+	{
+		typedef decltype(VectorSetFloat1(ScalarType(0))) RegisterType;
+		const RegisterType One = VectorSetFloat1(ScalarType(1));
+		for (; Index < Count; Index += 4)
+		{
+			RegisterType A[4], B[4], Out[4];
+			InternalVectorLoadQuaternionSoA4(A, Quat1, Index, Count);
+			InternalVectorLoadQuaternionSoA4(B, Quat2, Index, Count);
+			const RegisterType Weight = InternalVectorLoadSoA4(Alpha, Index, Count);
+
+			// FQuat::Slerp. Nearly parallel quaternions (cos >= 0.9999) fall back to a linear blend, where 1 / sin(Omega)
+			// loses precision; those lanes may hold Inf/NaN weights before the select.
+			const RegisterType RawCosom = InternalQuaternionDot4(A, B);
+			const RegisterType Cosom = VectorAbs(RawCosom);
+			const RegisterType Omega = VectorACos(Cosom);
+			const RegisterType InvSin = VectorDivide(One, VectorSin(Omega));
+			const RegisterType OneMinusAlpha = VectorSubtract(One, Weight);
+			const RegisterType IsLinear = VectorCompareGE(Cosom, VectorSetFloat1(ScalarType(0.9999f)));
+			const RegisterType Scale0 = VectorSelect(IsLinear, OneMinusAlpha, VectorMultiply(VectorSin(VectorMultiply(OneMinusAlpha, Omega)), InvSin));
+			RegisterType Scale1 = VectorSelect(IsLinear, Weight, VectorMultiply(VectorSin(VectorMultiply(Weight, Omega)), InvSin));
+			Scale1 = VectorSelect(VectorCompareGE(RawCosom, VectorSetFloat1(ScalarType(0))), Scale1, VectorNegate(Scale1));
+			InternalQuaternionBlend4<ScalarType>(Out, A, B, Scale0, Scale1);
+			InternalVectorStoreQuaternionSoA4(Result, Out, Index, Count);
+		}
+	}
+
+	template<typename ScalarType>
+	FORCEINLINE void InternalVectorQuaternionRotateVectorSoA4(ScalarType* const* Result, const ScalarType* const* Quat, const ScalarType* const* Vector, int32 Index, int32 Count)
+	{
+		typedef decltype(VectorSetFloat1(ScalarType(0))) RegisterType;
+		const RegisterType Two = VectorSetFloat1(ScalarType(2));
+		for (; Index < Count; Index += 4)
+		{
+			RegisterType Q[4], V[3];
+			InternalVectorLoadQuaternionSoA4(Q, Quat, Index, Count);
+			V[0] = InternalVectorLoadSoA4(Vector[0], Index, Count);
+			V[1] = InternalVectorLoadSoA4(Vector[1], Index, Count);
+			V[2] = InternalVectorLoadSoA4(Vector[2], Index, Count);
+
+			// FQuat::RotateVector: T = 2 * (Q x V), Result = V + W * T + Q x T
+			const RegisterType TX = VectorMultiply(VectorNegateMultiplyAdd(Q[2], V[1], VectorMultiply(Q[1], V[2])), Two);
+			const RegisterType TY = VectorMultiply(VectorNegateMultiplyAdd(Q[0], V[2], VectorMultiply(Q[2], V[0])), Two);
+			const RegisterType TZ = VectorMultiply(VectorNegateMultiplyAdd(Q[1], V[0], VectorMultiply(Q[0], V[1])), Two);
+			InternalVectorStoreSoA4(VectorAdd(VectorMultiplyAdd(Q[3], TX, V[0]), VectorNegateMultiplyAdd(Q[2], TY, VectorMultiply(Q[1], TZ))), Result[0], Index, Count);
+			InternalVectorStoreSoA4(VectorAdd(VectorMultiplyAdd(Q[3], TY, V[1]), VectorNegateMultiplyAdd(Q[0], TZ, VectorMultiply(Q[2], TX))), Result[1], Index, Count);
+			InternalVectorStoreSoA4(VectorAdd(VectorMultiplyAdd(Q[3], TZ, V[2]), VectorNegateMultiplyAdd(Q[1], TX, VectorMultiply(Q[0], TY))), Result[2], Index, Count);
+		}
+	}
+} // namespace SSEVectorHelperFuncs
+
+/**
+ * Multiplies Count pairs of SoA quaternions, Result[i] = Quat1[i] * Quat2[i], same order convention as VectorQuaternionMultiply2.
+ * Result may alias Quat1 or Quat2.
+ *
+ * @param Result	X, Y, Z and W arrays receiving the Count products
+ * @param Quat1		X, Y, Z and W arrays of the left hand side quaternions
+ * @param Quat2		X, Y, Z and W arrays of the right hand side quaternions
+ * @param Count		Number of quaternion pairs
+ */
+inline void VectorQuaternionMultiplySoA(float* const* Result, const float* const* Quat1, const float* const* Quat2, int32 Count)
+{
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorQuaternionMultiplySoAWide(Result, Quat1, Quat2, Index, Count);
+#endif
+
+	SSEVectorHelperFuncs::InternalVectorQuaternionMultiplySoA4(Result, Quat1, Quat2, Index, Count);
+}
+
+inline void VectorQuaternionMultiplySoA(double* const* Result, const double* const* Quat1, const double* const* Quat2, int32 Count)
+{
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorQuaternionMultiplySoAWide(Result, Quat1, Quat2, Index, Count);
+#endif
+
+	SSEVectorHelperFuncs::InternalVectorQuaternionMultiplySoA4(Result, Quat1, Quat2, Index, Count);
+}
+
+/**
+ * Normalizes Count SoA quaternions like FQuat::Normalize: quaternions with a squared length below 1e-8 become the identity.
+ * Result may alias Quat.
+ *
+ * @param Result	X, Y, Z and W arrays receiving the Count normalized quaternions
+ * @param Quat		X, Y, Z and W arrays of the quaternions to normalize
+ * @param Count		Number of quaternions
+ */
+inline void VectorQuaternionNormalizeSoA(float* const* Result, const float* const* Quat, int32 Count)
+{
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorQuaternionNormalizeSoAWide(Result, Quat, Index, Count);
+#endif
+
+	SSEVectorHelperFuncs::InternalVectorQuaternionNormalizeSoA4(Result, Quat, Index, Count);
+}
+
+inline void VectorQuaternionNormalizeSoA(double* const* Result, const double* const* Quat, int32 Count)
+{
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorQuaternionNormalizeSoAWide(Result, Quat, Index, Count);
+#endif
+
+	SSEVectorHelperFuncs::InternalVectorQuaternionNormalizeSoA4(Result, Quat, Index, Count);
+}
+
+/**
+ * Normalized linear interpolation of Count pairs of SoA quaternions along the shortest path,
+ * Result[i] = normalize(FQuat::FastLerp(Quat1[i], Quat2[i], Alpha[i])). Result may alias Quat1 or Quat2.
+ *
+ * @param Result	X, Y, Z and W arrays receiving the Count blended quaternions
+ * @param Quat1		X, Y, Z and W arrays of the quaternions at Alpha = 0
+ * @param Quat2		X, Y, Z and W arrays of the quaternions at Alpha = 1
+ * @param Alpha		Count blend weights
+ * @param Count		Number of quaternion pairs
+ */
+inline void VectorQuaternionNLerpSoA(float* const* Result, const float* const* Quat1, const float* const* Quat2, const float* Alpha, int32 Count)
+{
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorQuaternionNLerpSoAWide(Result, Quat1, Quat2, Alpha, Index, Count);
+#endif
+
+	SSEVectorHelperFuncs::InternalVectorQuaternionNLerpSoA4(Result, Quat1, Quat2, Alpha, Index, Count);
+}
+
+inline void VectorQuaternionNLerpSoA(double* const* Result, const double* const* Quat1, const double* const* Quat2, const double* Alpha, int32 Count)
+{
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorQuaternionNLerpSoAWide(Result, Quat1, Quat2, Alpha, Index, Count);
+#endif
+
+	SSEVectorHelperFuncs::InternalVectorQuaternionNLerpSoA4(Result, Quat1, Quat2, Alpha, Index, Count);
+}
+
+/**
+ * Spherical interpolation of Count pairs of SoA quaternions along the shortest path, same result as FQuat::Slerp:
+ * nearly parallel pairs (cos >= 0.9999) fall back to a linear blend and the result is normalized.
+ * Result may alias Quat1 or Quat2. Runs 4 quaternions at a time on every ISA, the cost is dominated by VectorACos / VectorSin.
+ *
+ * @param Result	X, Y, Z and W arrays receiving the Count blended quaternions
+ * @param Quat1		X, Y, Z and W arrays of the quaternions at Alpha = 0
+ * @param Quat2		X, Y, Z and W arrays of the quaternions at Alpha = 1
+ * @param Alpha		Count blend weights
+ * @param Count		Number of quaternion pairs
+ */
+inline void VectorQuaternionSlerpSoA(float* const* Result, const float* const* Quat1, const float* const* Quat2, const float* Alpha, int32 Count)
+{
+	SSEVectorHelperFuncs::InternalVectorQuaternionSlerpSoA4(Result, Quat1, Quat2, Alpha, 0, Count);
+}
+
+inline void VectorQuaternionSlerpSoA(double* const* Result, const double* const* Quat1, const double* const* Quat2, const double* Alpha, int32 Count)
+{
+	SSEVectorHelperFuncs::InternalVectorQuaternionSlerpSoA4(Result, Quat1, Quat2, Alpha, 0, Count);
+}
+
+/**
+ * Rotates Count SoA vectors by Count SoA unit quaternions, Result[i] = FQuat::RotateVector(Quat[i], Vector[i]).
+ * Result may alias Vector.
+ *
+ * @param Result	X, Y and Z arrays receiving the Count rotated vectors
+ * @param Quat		X, Y, Z and W arrays of the rotations
+ * @param Vector	X, Y and Z arrays of the vectors to rotate
+ * @param Count		Number of vectors
+ */
+inline void VectorQuaternionRotateVectorSoA(float* const* Result, const float* const* Quat, const float* const* Vector, int32 Count)
+{
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorQuaternionRotateVectorSoAWide(Result, Quat, Vector, Index, Count);
+#endif
+
+	SSEVectorHelperFuncs::InternalVectorQuaternionRotateVectorSoA4(Result, Quat, Vector, Index, Count);
+}
+
+inline void VectorQuaternionRotateVectorSoA(double* const* Result, const double* const* Quat, const double* const* Vector, int32 Count)
+{
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorQuaternionRotateVectorSoAWide(Result, Quat, Vector, Index, Count);
+#endif
+
+	SSEVectorHelperFuncs::InternalVectorQuaternionRotateVectorSoA4(Result, Quat, Vector, Index, Count);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+// AoS <-> SoA conversion
+//
+// Converts between interleaved XYZW vectors and separate X, Y, Z and W component arrays, the layout the batched
+// quaternion kernels above and VectorTransformVectorSoA work on.
+
+namespace SSEVectorHelperFuncs
+{
+	template<typename ScalarType>
+	FORCEINLINE void InternalVectorAoSToSoA4(ScalarType* const* Dst, const ScalarType* Src, int32 Index, int32 Count)
+	{
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			const ScalarType* In = Src + Index * 4;
+			auto Row0 = VectorLoad(In + 0);
+			auto Row1 = VectorLoad(In + 4);
+			auto Row2 = VectorLoad(In + 8);
+			auto Row3 = VectorLoad(In + 12);
+			VectorTranspose4x4(Row0, Row1, Row2, Row3);
+			VectorStore(Row0, Dst[0] + Index);
+			VectorStore(Row1, Dst[1] + Index);
+			VectorStore(Row2, Dst[2] + Index);
+			if (Dst[3])
+			{
+				VectorStore(Row3, Dst[3] + Index);
+			}
+		}
+		for (; Index < Count; ++Index)
+		{
+			Dst[0][Index] = Src[Index * 4 + 0];
+			Dst[1][Index] = Src[Index * 4 + 1];
+			Dst[2][Index] = Src[Index * 4 + 2];
+			if (Dst[3])
+			{
+				Dst[3][Index] = Src[Index * 4 + 3];
+			}
+		}
+	}
+
+	template<typename ScalarType>
+	FORCEINLINE void InternalVectorSoAToAoS4(ScalarType* Dst, const ScalarType* const* Src, int32 Index, int32 Count)
+	{
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			auto Row0 = VectorLoad(Src[0] + Index);
+			auto Row1 = VectorLoad(Src[1] + Index);
+			auto Row2 = VectorLoad(Src[2] + Index);
+			auto Row3 = Src[3] ? VectorLoad(Src[3] + Index) : VectorSetFloat1(ScalarType(0));
+			VectorTranspose4x4(Row0, Row1, Row2, Row3);
+			ScalarType* Out = Dst + Index * 4;
+			VectorStore(Row0, Out + 0);
+			VectorStore(Row1, Out + 4);
+			VectorStore(Row2, Out + 8);
+			VectorStore(Row3, Out + 12);
+		}
+		for (; Index < Count; ++Index)
+		{
+			Dst[Index * 4 + 0] = Src[0][Index];
+			Dst[Index * 4 + 1] = Src[1][Index];
+			Dst[Index * 4 + 2] = Src[2][Index];
+			Dst[Index * 4 + 3] = Src[3] ? Src[3][Index] : ScalarType(0);
+		}
+	}
+} // namespace SSEVectorHelperFuncs
+
+/**
+ * Splits Count XYZW vectors stored back to back into separate component arrays. Src must not overlap any of the
+ * destination arrays.
+ *
+ * @param Dst	X, Y, Z and W arrays receiving Count elements each. The W array may be nullptr to drop W.
+ * @param Src	Count vectors, 4 * Count scalars
+ * @param Count	Number of vectors
+ */
+inline void VectorAoSToSoA(float* const* Dst, const float* Src, int32 Count)
+{
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorAoSToSoAWide(Dst, Src, Index, Count);
+#endif
+
+	SSEVectorHelperFuncs::InternalVectorAoSToSoA4(Dst, Src, Index, Count);
+}
+
+inline void VectorAoSToSoA(double* const* Dst, const double* Src, int32 Count)
+{
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorAoSToSoAWide(Dst, Src, Index, Count);
+#endif
+
+	SSEVectorHelperFuncs::InternalVectorAoSToSoA4(Dst, Src, Index, Count);
+}
+
+/**
+ * Interleaves separate component arrays into Count XYZW vectors stored back to back, the inverse of VectorAoSToSoA.
+ * Dst must not overlap any of the source arrays.
+ *
+ * @param Dst	Receives Count vectors, 4 * Count scalars
+ * @param Src	X, Y, Z and W arrays of Count elements each. The W array may be nullptr, W is then written as zero.
+ * @param Count	Number of vectors
+ */
+inline void VectorSoAToAoS(float* Dst, const float* const* Src, int32 Count)
+{
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorSoAToAoSWide(Dst, Src, Index, Count);
+#endif
+
+	SSEVectorHelperFuncs::InternalVectorSoAToAoS4(Dst, Src, Index, Count);
+}
+
+inline void VectorSoAToAoS(double* Dst, const double* const* Src, int32 Count)
+{
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorSoAToAoSWide(Dst, Src, Index, Count);
+#endif
+
+	SSEVectorHelperFuncs::InternalVectorSoAToAoS4(Dst, Src, Index, Count);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+// Point bounds
+//
+// Reduces point arrays to an axis aligned box and a bounding sphere, e.g. to refit the bounds of deformed meshes. Points
+// are either XYZ triples Stride bytes apart (an FVector3f array has a stride of sizeof(FVector3f)) or separate X, Y and Z
+// arrays. FBoxSphereBounds(Points, NumPoints) is VectorComputeBounds, then VectorComputeBoundingRadius around the box center.
+
+namespace SSEVectorHelperFuncs
+{
+	template<typename ScalarType>
+	FORCEINLINE void InternalAddBoundsPoint(ScalarType X, ScalarType Y, ScalarType Z, ScalarType* InOutMin, ScalarType* InOutMax)
+	{
+		InOutMin[0] = FMath::Min(InOutMin[0], X);
+		InOutMin[1] = FMath::Min(InOutMin[1], Y);
+		InOutMin[2] = FMath::Min(InOutMin[2], Z);
+		InOutMax[0] = FMath::Max(InOutMax[0], X);
+		InOutMax[1] = FMath::Max(InOutMax[1], Y);
+		InOutMax[2] = FMath::Max(InOutMax[2], Z);
+	}
+
+	template<typename ScalarType>
+	FORCEINLINE ScalarType InternalDistanceSquared(ScalarType X, ScalarType Y, ScalarType Z, const ScalarType* Center)
+	{
+		return (X - Center[0]) * (X - Center[0]) + (Y - Center[1]) * (Y - Center[1]) + (Z - Center[2]) * (Z - Center[2]);
+	}
+
+	// Same rotating component order as the wide packed kernels, four points per block of three registers.
+	template<typename ScalarType>
+	FORCEINLINE void InternalVectorComputeBoundsPacked4(const ScalarType* Points, int32 Index, int32 Count, ScalarType* InOutMin, ScalarType* InOutMax)
+	{
+		typedef decltype(VectorLoad(Points)) RegisterType;
+		if (Index + 4 <= Count)
+		{
+			ScalarType MinLanes[12];
+			ScalarType MaxLanes[12];
+			for (int32 Lane = 0; Lane < 12; ++Lane)
+			{
+				MinLanes[Lane] = InOutMin[Lane % 3];
+				MaxLanes[Lane] = InOutMax[Lane % 3];
+			}
+
+			RegisterType Min0 = VectorLoad(MinLanes + 0), Min1 = VectorLoad(MinLanes + 4), Min2 = VectorLoad(MinLanes + 8);
+			RegisterType Max0 = VectorLoad(MaxLanes + 0), Max1 = VectorLoad(MaxLanes + 4), Max2 = VectorLoad(MaxLanes + 8);
+			for (; Index + 4 <= Count; Index += 4)
+			{
+				const ScalarType* In = Points + SIZE_T(Index) * 3;
+				const RegisterType Value0 = VectorLoad(In + 0);
+				const RegisterType Value1 = VectorLoad(In + 4);
+				const RegisterType Value2 = VectorLoad(In + 8);
+				Min0 = VectorMin(Min0, Value0);
+				Max0 = VectorMax(Max0, Value0);
+				Min1 = VectorMin(Min1, Value1);
+				Max1 = VectorMax(Max1, Value1);
+				Min2 = VectorMin(Min2, Value2);
+				Max2 = VectorMax(Max2, Value2);
+			}
+			VectorStore(Min0, MinLanes + 0);
+			VectorStore(Min1, MinLanes + 4);
+			VectorStore(Min2, MinLanes + 8);
+			VectorStore(Max0, MaxLanes + 0);
+			VectorStore(Max1, MaxLanes + 4);
+			VectorStore(Max2, MaxLanes + 8);
+			InternalFoldBoundsLanes(MinLanes, MaxLanes, 12, 1, InOutMin, InOutMax);
+		}
+		for (; Index < Count; ++Index)
+		{
+			const ScalarType* Point = Points + SIZE_T(Index) * 3;
+			InternalAddBoundsPoint(Point[0], Point[1], Point[2], InOutMin, InOutMax);
+		}
+	}
+
+	// One point per register, alternating between two sets of accumulators; W picks up whatever follows Z and is dropped.
+	// Points are read as four scalars, so the last one is left to the scalar loop to stay inside the buffer.
+	template<typename ScalarType>
+	FORCEINLINE void InternalVectorComputeBoundsStrided4(const ScalarType* Points, int32 Stride, int32 Index, int32 Count, ScalarType* InOutMin, ScalarType* InOutMax)
+	{
+		typedef decltype(VectorLoad(Points)) RegisterType;
+		const uint8* Bytes = (const uint8*)Points;
+		if (Index + 1 < Count)
+		{
+			ScalarType MinLanes[4] = { InOutMin[0], InOutMin[1], InOutMin[2], InOutMin[2] };
+			ScalarType MaxLanes[4] = { InOutMax[0], InOutMax[1], InOutMax[2], InOutMax[2] };
+			RegisterType Min0 = VectorLoad(MinLanes);
+			RegisterType Max0 = VectorLoad(MaxLanes);
+			RegisterType Min1 = Min0;
+			RegisterType Max1 = Max0;
+			for (; Index + 2 < Count; Index += 2)
+			{
+				const RegisterType Point0 = VectorLoad((const ScalarType*)(Bytes + SIZE_T(Index) * Stride));
+				const RegisterType Point1 = VectorLoad((const ScalarType*)(Bytes + SIZE_T(Index + 1) * Stride));
+				Min0 = VectorMin(Min0, Point0);
+				Max0 = VectorMax(Max0, Point0);
+				Min1 = VectorMin(Min1, Point1);
+				Max1 = VectorMax(Max1, Point1);
+			}
+			if (Index + 1 < Count)
+			{
+				const RegisterType Point0 = VectorLoad((const ScalarType*)(Bytes + SIZE_T(Index) * Stride));
+				Min0 = VectorMin(Min0, Point0);
+				Max0 = VectorMax(Max0, Point0);
+				++Index;
+			}
+			VectorStore(VectorMin(Min0, Min1), MinLanes);
+			VectorStore(VectorMax(Max0, Max1), MaxLanes);
+			InternalFoldBoundsLanes(MinLanes, MaxLanes, 3, 1, InOutMin, InOutMax);
+		}
+		for (; Index < Count; ++Index)
+		{
+			const ScalarType* Point = (const ScalarType*)(Bytes + SIZE_T(Index) * Stride);
+			InternalAddBoundsPoint(Point[0], Point[1], Point[2], InOutMin, InOutMax);
+		}
+	}
+
+	template<typename ScalarType>
+	FORCEINLINE void InternalVectorComputeBounds4(const ScalarType* Points, int32 Stride, int32 Index, int32 Count, ScalarType* InOutMin, ScalarType* InOutMax)
+	{
+		if (Stride == int32(3 * sizeof(ScalarType)))
+		{
+			InternalVectorComputeBoundsPacked4(Points, Index, Count, InOutMin, InOutMax);
+		}
+		else
+		{
+			InternalVectorComputeBoundsStrided4(Points, Stride, Index, Count, InOutMin, InOutMax);
+		}
+	}
+
+	template<typename ScalarType>
+	FORCEINLINE void InternalVectorComputeBoundsSoA4(const ScalarType* const* Components, int32 Index, int32 Count, ScalarType* InOutMin, ScalarType* InOutMax)
+	{
+		typedef decltype(VectorLoad(Components[0])) RegisterType;
+		if (Index + 4 <= Count)
+		{
+			RegisterType MinX = VectorSetFloat1(InOutMin[0]), MinY = VectorSetFloat1(InOutMin[1]), MinZ = VectorSetFloat1(InOutMin[2]);
+			RegisterType MaxX = VectorSetFloat1(InOutMax[0]), MaxY = VectorSetFloat1(InOutMax[1]), MaxZ = VectorSetFloat1(InOutMax[2]);
+			for (; Index + 4 <= Count; Index += 4)
+			{
+				const RegisterType X = VectorLoad(Components[0] + Index);
+				const RegisterType Y = VectorLoad(Components[1] + Index);
+				const RegisterType Z = VectorLoad(Components[2] + Index);
+				MinX = VectorMin(MinX, X);
+				MaxX = VectorMax(MaxX, X);
+				MinY = VectorMin(MinY, Y);
+				MaxY = VectorMax(MaxY, Y);
+				MinZ = VectorMin(MinZ, Z);
+				MaxZ = VectorMax(MaxZ, Z);
+			}
+
+			ScalarType MinLanes[12];
+			ScalarType MaxLanes[12];
+			VectorStore(MinX, MinLanes + 0);
+			VectorStore(MinY, MinLanes + 4);
+			VectorStore(MinZ, MinLanes + 8);
+			VectorStore(MaxX, MaxLanes + 0);
+			VectorStore(MaxY, MaxLanes + 4);
+			VectorStore(MaxZ, MaxLanes + 8);
+			InternalFoldBoundsLanes(MinLanes, MaxLanes, 12, 4, InOutMin, InOutMax);
+		}
+		for (; Index < Count; ++Index)
+		{
+			InternalAddBoundsPoint(Components[0][Index], Components[1][Index], Components[2][Index], InOutMin, InOutMax);
+		}
+	}
+
+	// Four points per iteration transposed to X, Y and Z. As above the last point is left to the scalar loop.
+	template<typename ScalarType>
+	FORCEINLINE void InternalVectorComputeBoundingRadiusStrided4(const ScalarType* Points, int32 Stride, int32 Index, int32 Count, const ScalarType* Center, ScalarType& InOutRadiusSquared)
+	{
+		typedef decltype(VectorLoad(Points)) RegisterType;
+		const uint8* Bytes = (const uint8*)Points;
+		if (Index + 4 < Count)
+		{
+			const RegisterType CenterX = VectorSetFloat1(Center[0]);
+			const RegisterType CenterY = VectorSetFloat1(Center[1]);
+			const RegisterType CenterZ = VectorSetFloat1(Center[2]);
+			RegisterType MaxDistance = VectorSetFloat1(InOutRadiusSquared);
+			for (; Index + 4 < Count; Index += 4)
+			{
+				const uint8* In = Bytes + SIZE_T(Index) * Stride;
+				RegisterType Row0 = VectorLoad((const ScalarType*)(In + 0 * SIZE_T(Stride)));
+				RegisterType Row1 = VectorLoad((const ScalarType*)(In + 1 * SIZE_T(Stride)));
+				RegisterType Row2 = VectorLoad((const ScalarType*)(In + 2 * SIZE_T(Stride)));
+				RegisterType Row3 = VectorLoad((const ScalarType*)(In + 3 * SIZE_T(Stride)));
+				VectorTranspose4x4(Row0, Row1, Row2, Row3);
+				const RegisterType DX = VectorSubtract(Row0, CenterX);
+				const RegisterType DY = VectorSubtract(Row1, CenterY);
+				const RegisterType DZ = VectorSubtract(Row2, CenterZ);
+				MaxDistance = VectorMax(MaxDistance, VectorMultiplyAdd(DZ, DZ, VectorMultiplyAdd(DY, DY, VectorMultiply(DX, DX))));
+			}
+
+			ScalarType Lanes[4];
+			VectorStore(MaxDistance, Lanes);
+			InOutRadiusSquared = FMath::Max(FMath::Max(Lanes[0], Lanes[1]), FMath::Max(Lanes[2], Lanes[3]));
+		}
+		for (; Index < Count; ++Index)
+		{
+			const ScalarType* Point = (const ScalarType*)(Bytes + SIZE_T(Index) * Stride);
+			InOutRadiusSquared = FMath::Max(InOutRadiusSquared, InternalDistanceSquared(Point[0], Point[1], Point[2], Center));
+		}
+	}
+
+	template<typename ScalarType>
+	FORCEINLINE void InternalVectorComputeBoundingRadiusSoA4(const ScalarType* const* Components, int32 Index, int32 Count, const ScalarType* Center, ScalarType& InOutRadiusSquared)
+	{
+		typedef decltype(VectorLoad(Components[0])) RegisterType;
+		if (Index + 4 <= Count)
+		{
+			const RegisterType CenterX = VectorSetFloat1(Center[0]);
+			const RegisterType CenterY = VectorSetFloat1(Center[1]);
+			const RegisterType CenterZ = VectorSetFloat1(Center[2]);
+			RegisterType MaxDistance = VectorSetFloat1(InOutRadiusSquared);
+			for (; Index + 4 <= Count; Index += 4)
+			{
+				const RegisterType DX = VectorSubtract(VectorLoad(Components[0] + Index), CenterX);
+				const RegisterType DY = VectorSubtract(VectorLoad(Components[1] + Index), CenterY);
+				const RegisterType DZ = VectorSubtract(VectorLoad(Components[2] + Index), CenterZ);
+				MaxDistance = VectorMax(MaxDistance, VectorMultiplyAdd(DZ, DZ, VectorMultiplyAdd(DY, DY, VectorMultiply(DX, DX))));
+			}
+
+			ScalarType Lanes[4];
+			VectorStore(MaxDistance, Lanes);
+			InOutRadiusSquared = FMath::Max(FMath::Max(Lanes[0], Lanes[1]), FMath::Max(Lanes[2], Lanes[3]));
+		}
+		for (; Index < Count; ++Index)
+		{
+			InOutRadiusSquared = FMath::Max(InOutRadiusSquared, InternalDistanceSquared(Components[0][Index], Components[1][Index], Components[2][Index], Center));
+		}
+	}
+} // namespace SSEVectorHelperFuncs
+
+/**
+ * Computes the axis aligned box around Count XYZ points. Packed points (Stride of three scalars) are read straight
+ * through, up to 32 per iteration with AVX-512; other strides go through four- or eight-point transposes. Points are read
+ * as four scalars except for the last one, so any padding after Z must be readable. NaNs give undefined bounds.
+ *
+ * @param OutMin	Receives the X, Y and Z minimum, zero when Count is zero
+ * @param OutMax	Receives the X, Y and Z maximum, zero when Count is zero
+ * @param Points	Unaligned first point
+ * @param Stride	Distance between points in bytes, at least 3 * sizeof(float)
+ * @param Count		Number of points
+ */
+inline void VectorComputeBounds(float* OutMin, float* OutMax, const float* Points, int32 Stride, int32 Count)
+{
+	if (Count <= 0)
+	{
+		OutMin[0] = OutMin[1] = OutMin[2] = OutMax[0] = OutMax[1] = OutMax[2] = 0.0f;
+		return;
+	}
+	for (int32 Component = 0; Component < 3; ++Component)
+	{
+		OutMin[Component] = OutMax[Component] = Points[Component];
+	}
+
+	int32 Index = 1;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	const bool bPacked = Stride == int32(3 * sizeof(float));
+	Index = bPacked ? SSEVectorHelperFuncs::InternalVectorComputeBoundsPackedWide(Points, Index, Count, OutMin, OutMax) : SSEVectorHelperFuncs::InternalVectorComputeBoundsStridedWide(Points, Stride, Index, Count, OutMin, OutMax);
+#endif
+
+	SSEVectorHelperFuncs::InternalVectorComputeBounds4(Points, Stride, Index, Count, OutMin, OutMax);
+}
+
+inline void VectorComputeBounds(double* OutMin, double* OutMax, const double* Points, int32 Stride, int32 Count)
+{
+	if (Count <= 0)
+	{
+		OutMin[0] = OutMin[1] = OutMin[2] = OutMax[0] = OutMax[1] = OutMax[2] = 0.0;
+		return;
+	}
+	for (int32 Component = 0; Component < 3; ++Component)
+	{
+		OutMin[Component] = OutMax[Component] = Points[Component];
+	}
+
+	int32 Index = 1;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	const bool bPacked = Stride == int32(3 * sizeof(double));
+	Index = bPacked ? SSEVectorHelperFuncs::InternalVectorComputeBoundsPackedWide(Points, Index, Count, OutMin, OutMax) : SSEVectorHelperFuncs::InternalVectorComputeBoundsStridedWide(Points, Stride, Index, Count, OutMin, OutMax);
+#endif
+
+	SSEVectorHelperFuncs::InternalVectorComputeBounds4(Points, Stride, Index, Count, OutMin, OutMax);
+}
+
+/**
+ * Computes the axis aligned box around Count points stored as separate X, Y and Z arrays.
+ *
+ * @param OutMin		Receives the X, Y and Z minimum, zero when Count is zero
+ * @param OutMax		Receives the X, Y and Z maximum, zero when Count is zero
+ * @param Components	X, Y and Z arrays of Count elements each
+ * @param Count			Number of points
+ */
+inline void VectorComputeBoundsSoA(float* OutMin, float* OutMax, const float* const* Components, int32 Count)
+{
+	if (Count <= 0)
+	{
+		OutMin[0] = OutMin[1] = OutMin[2] = OutMax[0] = OutMax[1] = OutMax[2] = 0.0f;
+		return;
+	}
+	for (int32 Component = 0; Component < 3; ++Component)
+	{
+		OutMin[Component] = OutMax[Component] = Components[Component][0];
+	}
+
+	int32 Index = 1;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorComputeBoundsSoAWide(Components, Index, Count, OutMin, OutMax);
+#endif
+
+	SSEVectorHelperFuncs::InternalVectorComputeBoundsSoA4(Components, Index, Count, OutMin, OutMax);
+}
+
+inline void VectorComputeBoundsSoA(double* OutMin, double* OutMax, const double* const* Components, int32 Count)
+{
+	if (Count <= 0)
+	{
+		OutMin[0] = OutMin[1] = OutMin[2] = OutMax[0] = OutMax[1] = OutMax[2] = 0.0;
+		return;
+	}
+	for (int32 Component = 0; Component < 3; ++Component)
+	{
+		OutMin[Component] = OutMax[Component] = Components[Component][0];
+	}
+
+	int32 Index = 1;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorComputeBoundsSoAWide(Components, Index, Count, OutMin, OutMax);
+#endif
+
+	SSEVectorHelperFuncs::InternalVectorComputeBoundsSoA4(Components, Index, Count, OutMin, OutMax);
+}
+
+/**
+ * Computes the radius of the smallest sphere around Center that contains Count XYZ points. Points are read as in
+ * VectorComputeBounds.
+ *
+ * @param Center	X, Y and Z of the sphere center, usually the center of the VectorComputeBounds box
+ * @param Points	Unaligned first point
+ * @param Stride	Distance between points in bytes, at least 3 * sizeof(float)
+ * @param Count		Number of points
+ * @return			Largest distance from Center to a point, zero when Count is zero
+ */
+inline float VectorComputeBoundingRadius(const float* Center, const float* Points, int32 Stride, int32 Count)
+{
+	float RadiusSquared = 0.0f;
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorComputeBoundingRadiusStridedWide(Points, Stride, Index, Count, Center, RadiusSquared);
+#endif
+
+	SSEVectorHelperFuncs::InternalVectorComputeBoundingRadiusStrided4(Points, Stride, Index, Count, Center, RadiusSquared);
+	return FMath::Sqrt(RadiusSquared);
+}
+
+inline double VectorComputeBoundingRadius(const double* Center, const double* Points, int32 Stride, int32 Count)
+{
+	double RadiusSquared = 0.0;
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorComputeBoundingRadiusStridedWide(Points, Stride, Index, Count, Center, RadiusSquared);
+#endif
+
+	SSEVectorHelperFuncs::InternalVectorComputeBoundingRadiusStrided4(Points, Stride, Index, Count, Center, RadiusSquared);
+	return FMath::Sqrt(RadiusSquared);
+}
+
+/**
+ * Computes the radius of the smallest sphere around Center that contains Count points stored as separate X, Y and Z arrays.
+ *
+ * @param Center		X, Y and Z of the sphere center, usually the center of the VectorComputeBoundsSoA box
+ * @param Components	X, Y and Z arrays of Count elements each
+ * @param Count			Number of points
+ * @return				Largest distance from Center to a point, zero when Count is zero
+ */
+inline float VectorComputeBoundingRadiusSoA(const float* Center, const float* const* Components, int32 Count)
+{
+	float RadiusSquared = 0.0f;
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorComputeBoundingRadiusSoAWide(Components, Index, Count, Center, RadiusSquared);
+#endif
+
+	SSEVectorHelperFuncs::InternalVectorComputeBoundingRadiusSoA4(Components, Index, Count, Center, RadiusSquared);
+	return FMath::Sqrt(RadiusSquared);
+}
+
+inline double VectorComputeBoundingRadiusSoA(const double* Center, const double* const* Components, int32 Count)
+{
+	double RadiusSquared = 0.0;
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorComputeBoundingRadiusSoAWide(Components, Index, Count, Center, RadiusSquared);
+#endif
+
+	SSEVectorHelperFuncs::InternalVectorComputeBoundingRadiusSoA4(Components, Index, Count, Center, RadiusSquared);
+	return FMath::Sqrt(RadiusSquared);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+// Frustum culling
+//
+// Tests SoA bounding spheres or boxes against a convex volume, the way FConvexVolume::IntersectSphere and IntersectBox
+// do: planes are X, Y, Z, W scalars as in FPlane (the double overloads take an FConvexVolume's Planes array as is), with
+// normals pointing out of the volume, and an object is culled when it is entirely in front of any plane. The result is a
+// visibility bitmask, bit I % 32 of word I / 32 for object I, so crowds and instances are culled a register at a time.
+
+namespace SSEVectorHelperFuncs
+{
+	// NegW holds -W.
+	template<typename RegisterType>
+	FORCEINLINE RegisterType InternalPlaneDistance4(const RegisterType& NX, const RegisterType& NY, const RegisterType& NZ, const RegisterType& NegW, const RegisterType& X, const RegisterType& Y, const RegisterType& Z)
+	{
+		return VectorMultiplyAdd(NZ, Z, VectorMultiplyAdd(NY, Y, VectorMultiplyAdd(NX, X, NegW)));
+	}
+
+	template<typename RegisterType>
+	FORCEINLINE RegisterType InternalPlanePushOut4(const RegisterType& NX, const RegisterType& NY, const RegisterType& NZ, const RegisterType& ExtentX, const RegisterType& ExtentY, const RegisterType& ExtentZ)
+	{
+		const RegisterType PushOut = VectorMultiply(VectorAbs(NX), ExtentX);
+		return VectorMultiplyAdd(VectorAbs(NZ), ExtentZ, VectorMultiplyAdd(VectorAbs(NY), ExtentY, PushOut));
+	}
+
+	// Bits of the word starting at Index that belong to objects, all of them except in the last word.
+	FORCEINLINE uint32 InternalCullWordMask(int32 Index, int32 Count)
+	{
+		return Count - Index >= 32 ? ~0u : (1u << (Count - Index)) - 1;
+	}
+
+	// Index is a multiple of 32. Lanes past Count are zero padded and their bits cleared.
+	template<typename ScalarType>
+	FORCEINLINE void InternalVectorCullSpheresSoA4(uint32* OutVisible, const ScalarType* const* Spheres, const ScalarType* Planes, int32 NumPlanes, int32 Index, int32 Count)
+	{
+		typedef decltype(VectorSetFloat1(ScalarType(0))) RegisterType;
+		for (; Index < Count; Index += 32)
+		{
+			uint32 Outside = 0;
+			for (int32 Block = Index; Block < Index + 32 && Block < Count; Block += 4)
+			{
+				const RegisterType X = InternalVectorLoadSoA4(Spheres[0], Block, Count);
+				const RegisterType Y = InternalVectorLoadSoA4(Spheres[1], Block, Count);
+				const RegisterType Z = InternalVectorLoadSoA4(Spheres[2], Block, Count);
+				const RegisterType Radius = InternalVectorLoadSoA4(Spheres[3], Block, Count);
+				RegisterType Mask = VectorSetFloat1(ScalarType(0));
+				for (int32 Plane = 0; Plane < NumPlanes; ++Plane)
+				{
+					const RegisterType NX = VectorSetFloat1(Planes[4 * Plane + 0]);
+					const RegisterType NY = VectorSetFloat1(Planes[4 * Plane + 1]);
+					const RegisterType NZ = VectorSetFloat1(Planes[4 * Plane + 2]);
+					const RegisterType NegW = VectorSetFloat1(-Planes[4 * Plane + 3]);
+					Mask = VectorBitwiseOr(Mask, VectorCompareGT(InternalPlaneDistance4(NX, NY, NZ, NegW, X, Y, Z), Radius));
+				}
+				Outside |= uint32(VectorMaskBits(Mask)) << (Block - Index);
+			}
+			OutVisible[Index / 32] = ~Outside & InternalCullWordMask(Index, Count);
+		}
+	}
+
+	template<typename ScalarType>
+	FORCEINLINE void InternalVectorCullBoxesSoA4(uint32* OutVisible, const ScalarType* const* Boxes, const ScalarType* Planes, int32 NumPlanes, int32 Index, int32 Count)
+	{
+		typedef decltype(VectorSetFloat1(ScalarType(0))) RegisterType;
+		for (; Index < Count; Index += 32)
+		{
+			uint32 Outside = 0;
+			for (int32 Block = Index; Block < Index + 32 && Block < Count; Block += 4)
+			{
+				const RegisterType X = InternalVectorLoadSoA4(Boxes[0], Block, Count);
+				const RegisterType Y = InternalVectorLoadSoA4(Boxes[1], Block, Count);
+				const RegisterType Z = InternalVectorLoadSoA4(Boxes[2], Block, Count);
+				const RegisterType ExtentX = InternalVectorLoadSoA4(Boxes[3], Block, Count);
+				const RegisterType ExtentY = InternalVectorLoadSoA4(Boxes[4], Block, Count);
+				const RegisterType ExtentZ = InternalVectorLoadSoA4(Boxes[5], Block, Count);
+				RegisterType Mask = VectorSetFloat1(ScalarType(0));
+				for (int32 Plane = 0; Plane < NumPlanes; ++Plane)
+				{
+					const RegisterType NX = VectorSetFloat1(Planes[4 * Plane + 0]);
+					const RegisterType NY = VectorSetFloat1(Planes[4 * Plane + 1]);
+					const RegisterType NZ = VectorSetFloat1(Planes[4 * Plane + 2]);
+					const RegisterType NegW = VectorSetFloat1(-Planes[4 * Plane + 3]);
+					Mask = VectorBitwiseOr(Mask, VectorCompareGT(InternalPlaneDistance4(NX, NY, NZ, NegW, X, Y, Z), InternalPlanePushOut4(NX, NY, NZ, ExtentX, ExtentY, ExtentZ)));
+				}
+				Outside |= uint32(VectorMaskBits(Mask)) << (Block - Index);
+			}
+			OutVisible[Index / 32] = ~Outside & InternalCullWordMask(Index, Count);
+		}
+	}
+
+	FORCEINLINE int32 InternalCountVisible(const uint32* Visible, int32 Count)
+	{
+		int32 NumVisible = 0;
+		for (int32 Word = 0; Word < (Count + 31) / 32; ++Word)
+		{
+			NumVisible += int32(FMath::CountBits(Visible[Word]));
+		}
+		return NumVisible;
+	}
+} // namespace SSEVectorHelperFuncs
+
+/**
+ * Culls Count bounding spheres against NumPlanes planes, 8 spheres per register with AVX and 16 with AVX-512. A sphere
+ * is visible unless its center is more than Radius in front of a plane. Multiply-adds are fused where the CPU allows, so
+ * spheres within rounding error of a plane may land either way depending on the CPU.
+ *
+ * @param OutVisible	Receives (Count + 31) / 32 words, bits past Count in the last word are zero
+ * @param Spheres		Center X, Y, Z and Radius arrays of Count elements each
+ * @param Planes		NumPlanes planes, X, Y, Z and W each
+ * @param NumPlanes		Number of planes, 6 for a view frustum with a far plane
+ * @param Count			Number of spheres
+ * @return				Number of visible spheres
+ */
+inline int32 VectorCullSpheresSoA(uint32* OutVisible, const float* const* Spheres, const float* Planes, int32 NumPlanes, int32 Count)
+{
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorCullSpheresSoAWide(OutVisible, Spheres, Planes, NumPlanes, Index, Count);
+#endif
+
+	SSEVectorHelperFuncs::InternalVectorCullSpheresSoA4(OutVisible, Spheres, Planes, NumPlanes, Index, Count);
+	return SSEVectorHelperFuncs::InternalCountVisible(OutVisible, Count);
+}
+
+inline int32 VectorCullSpheresSoA(uint32* OutVisible, const double* const* Spheres, const double* Planes, int32 NumPlanes, int32 Count)
+{
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorCullSpheresSoAWide(OutVisible, Spheres, Planes, NumPlanes, Index, Count);
+#endif
+
+	SSEVectorHelperFuncs::InternalVectorCullSpheresSoA4(OutVisible, Spheres, Planes, NumPlanes, Index, Count);
+	return SSEVectorHelperFuncs::InternalCountVisible(OutVisible, Count);
+}
+
+/**
+ * Culls Count axis aligned boxes against NumPlanes planes, see VectorCullSpheresSoA. A box is visible unless its center
+ * is in front of a plane by more than the box's projected half size, |N.X| * Extent.X + |N.Y| * Extent.Y + |N.Z| * Extent.Z.
+ *
+ * @param OutVisible	Receives (Count + 31) / 32 words, bits past Count in the last word are zero
+ * @param Boxes			Center X, Y, Z and Extent X, Y, Z arrays of Count elements each
+ * @param Planes		NumPlanes planes, X, Y, Z and W each
+ * @param NumPlanes		Number of planes
+ * @param Count			Number of boxes
+ * @return				Number of visible boxes
+ */
+inline int32 VectorCullBoxesSoA(uint32* OutVisible, const float* const* Boxes, const float* Planes, int32 NumPlanes, int32 Count)
+{
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorCullBoxesSoAWide(OutVisible, Boxes, Planes, NumPlanes, Index, Count);
+#endif
+
+	SSEVectorHelperFuncs::InternalVectorCullBoxesSoA4(OutVisible, Boxes, Planes, NumPlanes, Index, Count);
+	return SSEVectorHelperFuncs::InternalCountVisible(OutVisible, Count);
+}
+
+inline int32 VectorCullBoxesSoA(uint32* OutVisible, const double* const* Boxes, const double* Planes, int32 NumPlanes, int32 Count)
+{
+	int32 Index = 0;
+
+#if UE_PLATFORM_MATH_USE_WIDE_BULK_KERNELS
+	Index = SSEVectorHelperFuncs::InternalVectorCullBoxesSoAWide(OutVisible, Boxes, Planes, NumPlanes, Index, Count);
+#endif
+
+	SSEVectorHelperFuncs::InternalVectorCullBoxesSoA4(OutVisible, Boxes, Planes, NumPlanes, Index, Count);
+	return SSEVectorHelperFuncs::InternalCountVisible(OutVisible, Count);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+// Streaming copy and fill
+//
+// Bulk memcpy / memset that switch to non-temporal stores above a size threshold, for buffers that are written once and
+// read much later (frame buffers, accumulation planes). Streamed lines bypass the caches instead of evicting the working
+// set from the LLC. Smaller sizes go through memcpy / memset, which beat streaming stores when the destination is read
+// soon after.
+
+/**
+ * Returns the size from which VectorMemcpyStreamed and VectorMemsetStreamed use non-temporal stores. Defaults to half the
+ * last level cache as reported by cpuid, probed once per process.
+ */
+CORE_API SIZE_T VectorGetStreamingThreshold();
+
+/**
+ * Overrides the streaming threshold, e.g. from a console variable at startup. Copies already running on other threads
+ * may still use the previous value.
+ *
+ * @param Threshold	Size in bytes from which stores are streamed, 0 to always stream
+ */
+CORE_API void VectorSetStreamingThreshold(SIZE_T Threshold);
+
+/**
+ * memcpy that streams the destination past the caches from VectorGetStreamingThreshold() bytes on. The partial cache
+ * lines at both ends are copied normally; the streamed stores are followed by an sfence, so they are ordered before any
+ * later store, e.g. a flag telling another thread the buffer is ready.
+ *
+ * @param Dst	Destination, any alignment
+ * @param Src	Source, any alignment, must not overlap Dst
+ * @param Size	Number of bytes
+ */
+CORE_API void VectorMemcpyStreamed(void* RESTRICT Dst, const void* RESTRICT Src, SIZE_T Size);
+
+/**
+ * memset that streams the destination past the caches from VectorGetStreamingThreshold() bytes on, see VectorMemcpyStreamed.
+ *
+ * @param Dst	Destination, any alignment
+ * @param Value	Byte to fill with
+ * @param Size	Number of bytes
+ */
+CORE_API void VectorMemsetStreamed(void* Dst, uint8 Value, SIZE_T Size);
+
+//////////////////////////////////////////////////////////////////////////
+// 8-wide registers
+//
+// VectorRegister8Float is a single __m256 on AVX builds and VectorRegister8Double a single __m512d on AVX-512 builds.
+// Narrower builds pair two of the 4-wide registers, so SoA code written against these types runs everywhere and
+// picks up the full register width where the target has it.
+
+// 8 floats
+struct alignas(32) VectorRegister8Float
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	__m256 Value;
+
+	FORCEINLINE VectorRegister4Float GetLo() const { return _mm256_castps256_ps128(Value); }
+	FORCEINLINE VectorRegister4Float GetHi() const { return _mm256_extractf128_ps(Value, 1); }
+#else
+	VectorRegister4Float Lo;
+	VectorRegister4Float Hi;
+
+	FORCEINLINE VectorRegister4Float GetLo() const { return Lo; }
+	FORCEINLINE VectorRegister4Float GetHi() const { return Hi; }
+#endif
+
+	FORCEINLINE VectorRegister8Float() = default;
+
+	FORCEINLINE VectorRegister8Float(const VectorRegister4Float& InLo, const VectorRegister4Float& InHi)
+	{
+#if UE_PLATFORM_MATH_USE_AVX
+		Value = _mm256_setr_m128(InLo, InHi);
+#else
+		Lo = InLo;
+		Hi = InHi;
+#endif
+	}
+
+#if UE_PLATFORM_MATH_USE_AVX
+	// Convenience for things like 'Result = _mm256_add_ps(...)'
+	FORCEINLINE VectorRegister8Float(const __m256& Register)
+		: Value(Register)
+	{}
+
+	// Convenience for passing VectorRegister8Float to _mm256_* functions without needing '.Value'
+	FORCEINLINE operator __m256() const
+	{
+		return Value;
+	}
+#endif
+};
+
+// 8 doubles
+struct alignas(UE_PLATFORM_MATH_USE_AVX_512 ? 64 : UE_SSE_DOUBLE_ALIGNMENT) VectorRegister8Double
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	__m512d Value;
+
+	FORCEINLINE VectorRegister4Double GetLo() const { return _mm512_castpd512_pd256(Value); }
+	FORCEINLINE VectorRegister4Double GetHi() const { return _mm512_extractf64x4_pd(Value, 1); }
+#else
+	VectorRegister4Double Lo;
+	VectorRegister4Double Hi;
+
+	FORCEINLINE VectorRegister4Double GetLo() const { return Lo; }
+	FORCEINLINE VectorRegister4Double GetHi() const { return Hi; }
+#endif
+
+	FORCEINLINE VectorRegister8Double() = default;
+
+	FORCEINLINE VectorRegister8Double(const VectorRegister4Double& InLo, const VectorRegister4Double& InHi)
+	{
+#if UE_PLATFORM_MATH_USE_AVX_512
+		Value = _mm512_insertf64x4(_mm512_castpd256_pd512(InLo), InHi, 1);
+#else
+		Lo = InLo;
+		Hi = InHi;
+#endif
+	}
+
+#if UE_PLATFORM_MATH_USE_AVX_512
+	// Convenience for things like 'Result = _mm512_add_pd(...)'
+	FORCEINLINE VectorRegister8Double(const __m512d& Register)
+		: Value(Register)
+	{}
+
+	// Convenience for passing VectorRegister8Double to _mm512_* functions without needing '.Value'
+	FORCEINLINE operator __m512d() const
+	{
+		return Value;
+	}
+#endif
+};
+
+typedef VectorRegister8Float VectorRegister8f;
+typedef VectorRegister8Double VectorRegister8d;
+
+namespace SSEVectorHelperFuncs
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	// AVX-512 compares produce a mask register, widen it back to the all-ones lane masks the rest of the API expects.
+	FORCEINLINE __m512d InternalMaskToVector8Double(__mmask8 Mask)
+	{
+		return _mm512_castsi512_pd(_mm512_maskz_mov_epi64(Mask, _mm512_set1_epi64(-1)));
+	}
+#endif
+
+	// The 8-wide reductions fold the high half onto the low half first and finish here, so every
+	// backend adds in the same order: ((V0 + V4) + (V2 + V6)) + ((V1 + V5) + (V3 + V7)).
+	FORCEINLINE float InternalVectorReduceAdd(const VectorRegister4Float& Vec)
+	{
+		const VectorRegister4Float Sum = _mm_add_ps(Vec, _mm_movehl_ps(Vec, Vec));
+		return _mm_cvtss_f32(_mm_add_ss(Sum, _mm_shuffle_ps(Sum, Sum, _MM_SHUFFLE(1, 1, 1, 1))));
+	}
+
+	FORCEINLINE float InternalVectorReduceMin(const VectorRegister4Float& Vec)
+	{
+		const VectorRegister4Float Min = _mm_min_ps(Vec, _mm_movehl_ps(Vec, Vec));
+		return _mm_cvtss_f32(_mm_min_ss(Min, _mm_shuffle_ps(Min, Min, _MM_SHUFFLE(1, 1, 1, 1))));
+	}
+
+	FORCEINLINE float InternalVectorReduceMax(const VectorRegister4Float& Vec)
+	{
+		const VectorRegister4Float Max = _mm_max_ps(Vec, _mm_movehl_ps(Vec, Vec));
+		return _mm_cvtss_f32(_mm_max_ss(Max, _mm_shuffle_ps(Max, Max, _MM_SHUFFLE(1, 1, 1, 1))));
+	}
+
+	FORCEINLINE double InternalVectorReduceAdd(const VectorRegister4Double& Vec)
+	{
+		const VectorRegister2Double Sum = _mm_add_pd(Vec.GetXY(), Vec.GetZW());
+		return _mm_cvtsd_f64(_mm_add_sd(Sum, _mm_unpackhi_pd(Sum, Sum)));
+	}
+
+	FORCEINLINE double InternalVectorReduceMin(const VectorRegister4Double& Vec)
+	{
+		const VectorRegister2Double Min = _mm_min_pd(Vec.GetXY(), Vec.GetZW());
+		return _mm_cvtsd_f64(_mm_min_sd(Min, _mm_unpackhi_pd(Min, Min)));
+	}
+
+	FORCEINLINE double InternalVectorReduceMax(const VectorRegister4Double& Vec)
+	{
+		const VectorRegister2Double Max = _mm_max_pd(Vec.GetXY(), Vec.GetZW());
+		return _mm_cvtsd_f64(_mm_max_sd(Max, _mm_unpackhi_pd(Max, Max)));
+	}
+} // namespace SSEVectorHelperFuncs
+
+/**
+ * Returns a vector with all 8 components zero.
+ *
+ * @return		VectorRegister8Float(0, 0, 0, 0, 0, 0, 0, 0)
+ */
+FORCEINLINE VectorRegister8Float VectorZero8Float()
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	return _mm256_setzero_ps();
+#else
+	return VectorRegister8Float(VectorZeroFloat(), VectorZeroFloat());
+#endif
+}
+
+FORCEINLINE VectorRegister8Double VectorZero8Double()
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	return _mm512_setzero_pd();
+#else
+	return VectorRegister8Double(VectorZeroDouble(), VectorZeroDouble());
+#endif
+}
+
+/**
+ * Propagates the passed in value to all 8 components of a vector.
+ *
+ * @param F		Value to replicate
+ * @return		VectorRegister8Float(F, F, F, F, F, F, F, F)
+ */
+FORCEINLINE VectorRegister8Float VectorSet8Float1(float F)
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	return _mm256_set1_ps(F);
+#else
+	const VectorRegister4Float Value = VectorSetFloat1(F);
+	return VectorRegister8Float(Value, Value);
+#endif
+}
+
+FORCEINLINE VectorRegister8Double VectorSet8Double1(double D)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	return _mm512_set1_pd(D);
+#else
+	const VectorRegister4Double Value = VectorSetFloat1(D);
+	return VectorRegister8Double(Value, Value);
+#endif
+}
+
+/**
+ * Loads 8 components from unaligned memory.
+ *
+ * @param Ptr	Unaligned memory pointer to the 8 components
+ * @return		VectorRegister8Float(Ptr[0], Ptr[1], ..., Ptr[7])
+ */
+FORCEINLINE VectorRegister8Float VectorLoad8(const float* Ptr)
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	return _mm256_loadu_ps(Ptr);
+#else
+	return VectorRegister8Float(VectorLoad(Ptr), VectorLoad(Ptr + 4));
+#endif
+}
+
+FORCEINLINE VectorRegister8Double VectorLoad8(const double* Ptr)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	return _mm512_loadu_pd(Ptr);
+#else
+	return VectorRegister8Double(VectorLoad(Ptr), VectorLoad(Ptr + 4));
+#endif
+}
+
+/**
+ * Loads 8 components from aligned memory.
+ *
+ * @param Ptr	Memory pointer to the 8 components, aligned to alignof(VectorRegister8Float) / alignof(VectorRegister8Double)
+ * @return		VectorRegister8Float(Ptr[0], Ptr[1], ..., Ptr[7])
+ */
+FORCEINLINE VectorRegister8Float VectorLoad8Aligned(const float* Ptr)
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	return _mm256_load_ps(Ptr);
+#else
+	return VectorRegister8Float(VectorLoadAligned(Ptr), VectorLoadAligned(Ptr + 4));
+#endif
+}
+
+FORCEINLINE VectorRegister8Double VectorLoad8Aligned(const double* Ptr)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	return _mm512_load_pd(Ptr);
+#else
+	return VectorRegister8Double(VectorLoadAligned(Ptr), VectorLoadAligned(Ptr + 4));
+#endif
+}
+
+/**
+ * Stores all 8 components of a vector to unaligned memory.
+ *
+ * @param Vec	Vector to store
+ * @param Ptr	Unaligned memory pointer
+ */
+FORCEINLINE void VectorStore(const VectorRegister8Float& Vec, float* Ptr)
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	_mm256_storeu_ps(Ptr, Vec);
+#else
+	VectorStore(Vec.Lo, Ptr);
+	VectorStore(Vec.Hi, Ptr + 4);
+#endif
+}
+
+FORCEINLINE void VectorStore(const VectorRegister8Double& Vec, double* Ptr)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	_mm512_storeu_pd(Ptr, Vec);
+#else
+	VectorStore(Vec.Lo, Ptr);
+	VectorStore(Vec.Hi, Ptr + 4);
+#endif
+}
+
+/**
+ * Stores all 8 components of a vector to aligned memory.
+ *
+ * @param Vec	Vector to store
+ * @param Ptr	Memory pointer, aligned to alignof(VectorRegister8Float) / alignof(VectorRegister8Double)
+ */
+FORCEINLINE void VectorStoreAligned(const VectorRegister8Float& Vec, float* Ptr)
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	_mm256_store_ps(Ptr, Vec);
+#else
+	VectorStoreAligned(Vec.Lo, Ptr);
+	VectorStoreAligned(Vec.Hi, Ptr + 4);
+#endif
+}
+
+FORCEINLINE void VectorStoreAligned(const VectorRegister8Double& Vec, double* Ptr)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	_mm512_store_pd(Ptr, Vec);
+#else
+	VectorStoreAligned(Vec.Lo, Ptr);
+	VectorStoreAligned(Vec.Hi, Ptr + 4);
+#endif
+}
+
+/**
+ * Adds two vectors (component-wise) and returns the result.
+ *
+ * @param Vec1	1st vector
+ * @param Vec2	2nd vector
+ * @return		VectorRegister8Float( Vec1[i] + Vec2[i] )
+ */
+FORCEINLINE VectorRegister8Float VectorAdd(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	return _mm256_add_ps(Vec1, Vec2);
+#else
+	return VectorRegister8Float(VectorAdd(Vec1.Lo, Vec2.Lo), VectorAdd(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+FORCEINLINE VectorRegister8Double VectorAdd(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	return _mm512_add_pd(Vec1, Vec2);
+#else
+	return VectorRegister8Double(VectorAdd(Vec1.Lo, Vec2.Lo), VectorAdd(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+/**
+ * Subtracts a vector from another (component-wise) and returns the result.
+ *
+ * @param Vec1	1st vector
+ * @param Vec2	2nd vector
+ * @return		VectorRegister8Float( Vec1[i] - Vec2[i] )
+ */
+FORCEINLINE VectorRegister8Float VectorSubtract(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	return _mm256_sub_ps(Vec1, Vec2);
+#else
+	return VectorRegister8Float(VectorSubtract(Vec1.Lo, Vec2.Lo), VectorSubtract(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+FORCEINLINE VectorRegister8Double VectorSubtract(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	return _mm512_sub_pd(Vec1, Vec2);
+#else
+	return VectorRegister8Double(VectorSubtract(Vec1.Lo, Vec2.Lo), VectorSubtract(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+/**
+ * Multiplies two vectors (component-wise) and returns the result.
+ *
+ * @param Vec1	1st vector
+ * @param Vec2	2nd vector
+ * @return		VectorRegister8Float( Vec1[i] * Vec2[i] )
+ */
+FORCEINLINE VectorRegister8Float VectorMultiply(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	return _mm256_mul_ps(Vec1, Vec2);
+#else
+	return VectorRegister8Float(VectorMultiply(Vec1.Lo, Vec2.Lo), VectorMultiply(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+FORCEINLINE VectorRegister8Double VectorMultiply(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	return _mm512_mul_pd(Vec1, Vec2);
+#else
+	return VectorRegister8Double(VectorMultiply(Vec1.Lo, Vec2.Lo), VectorMultiply(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+/**
+ * Divides two vectors (component-wise) and returns the result.
+ *
+ * @param Vec1	1st vector
+ * @param Vec2	2nd vector
+ * @return		VectorRegister8Float( Vec1[i] / Vec2[i] )
+ */
+FORCEINLINE VectorRegister8Float VectorDivide(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	return _mm256_div_ps(Vec1, Vec2);
+#else
+	return VectorRegister8Float(VectorDivide(Vec1.Lo, Vec2.Lo), VectorDivide(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+FORCEINLINE VectorRegister8Double VectorDivide(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	return _mm512_div_pd(Vec1, Vec2);
+#else
+	return VectorRegister8Double(VectorDivide(Vec1.Lo, Vec2.Lo), VectorDivide(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+/**
+ * Multiplies two vectors (component-wise), adds in the third vector and returns the result. (A*B + C)
+ *
+ * @param A		1st vector
+ * @param B		2nd vector
+ * @param C		3rd vector
+ * @return		VectorRegister8Float( A[i]*B[i] + C[i] )
+ */
+FORCEINLINE VectorRegister8Float VectorMultiplyAdd(const VectorRegister8Float& A, const VectorRegister8Float& B, const VectorRegister8Float& C)
+{
+#if UE_PLATFORM_MATH_USE_FMA3 && UE_PLATFORM_MATH_USE_AVX
+	return _mm256_fmadd_ps(A, B, C);
+#elif UE_PLATFORM_MATH_USE_AVX
+	return _mm256_add_ps(_mm256_mul_ps(A, B), C);
+#else
+	return VectorRegister8Float(VectorMultiplyAdd(A.Lo, B.Lo, C.Lo), VectorMultiplyAdd(A.Hi, B.Hi, C.Hi));
+#endif
+}
+
+FORCEINLINE VectorRegister8Double VectorMultiplyAdd(const VectorRegister8Double& A, const VectorRegister8Double& B, const VectorRegister8Double& C)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	return _mm512_fmadd_pd(A, B, C);
+#else
+	return VectorRegister8Double(VectorMultiplyAdd(A.Lo, B.Lo, C.Lo), VectorMultiplyAdd(A.Hi, B.Hi, C.Hi));
+#endif
+}
+
+/**
+ * Multiplies two vectors (component-wise), negates the results and adds it to the third vector i.e. (C - A*B)
+ *
+ * @param A		1st vector
+ * @param B		2nd vector
+ * @param C		3rd vector
+ * @return		VectorRegister8Float( C[i] - A[i]*B[i] )
+ */
+FORCEINLINE VectorRegister8Float VectorNegateMultiplyAdd(const VectorRegister8Float& A, const VectorRegister8Float& B, const VectorRegister8Float& C)
+{
+#if UE_PLATFORM_MATH_USE_FMA3 && UE_PLATFORM_MATH_USE_AVX
+	return _mm256_fnmadd_ps(A, B, C);
+#elif UE_PLATFORM_MATH_USE_AVX
+	return _mm256_sub_ps(C, _mm256_mul_ps(A, B));
+#else
+	return VectorRegister8Float(VectorNegateMultiplyAdd(A.Lo, B.Lo, C.Lo), VectorNegateMultiplyAdd(A.Hi, B.Hi, C.Hi));
+#endif
+}
+
+FORCEINLINE VectorRegister8Double VectorNegateMultiplyAdd(const VectorRegister8Double& A, const VectorRegister8Double& B, const VectorRegister8Double& C)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	return _mm512_fnmadd_pd(A, B, C);
+#else
+	return VectorRegister8Double(VectorNegateMultiplyAdd(A.Lo, B.Lo, C.Lo), VectorNegateMultiplyAdd(A.Hi, B.Hi, C.Hi));
+#endif
+}
+
+/**
+ * Returns the negated value (component-wise).
+ *
+ * @param Vec	Source vector
+ * @return		VectorRegister8Float( -Vec[i] )
+ */
+FORCEINLINE VectorRegister8Float VectorNegate(const VectorRegister8Float& Vec)
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	return _mm256_sub_ps(_mm256_setzero_ps(), Vec);
+#else
+	return VectorRegister8Float(VectorNegate(Vec.Lo), VectorNegate(Vec.Hi));
+#endif
+}
+
+FORCEINLINE VectorRegister8Double VectorNegate(const VectorRegister8Double& Vec)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	return _mm512_sub_pd(_mm512_setzero_pd(), Vec);
+#else
+	return VectorRegister8Double(VectorNegate(Vec.Lo), VectorNegate(Vec.Hi));
+#endif
+}
+
+/**
+ * Returns the absolute value (component-wise).
+ *
+ * @param Vec	Source vector
+ * @return		VectorRegister8Float( abs(Vec[i]) )
+ */
+FORCEINLINE VectorRegister8Float VectorAbs(const VectorRegister8Float& Vec)
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	return _mm256_and_ps(Vec, _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF)));
+#else
+	return VectorRegister8Float(VectorAbs(Vec.Lo), VectorAbs(Vec.Hi));
+#endif
+}
+
+FORCEINLINE VectorRegister8Double VectorAbs(const VectorRegister8Double& Vec)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	return _mm512_castsi512_pd(_mm512_and_si512(_mm512_castpd_si512(Vec), _mm512_set1_epi64(~(uint64(1) << 63))));
+#else
+	return VectorRegister8Double(VectorAbs(Vec.Lo), VectorAbs(Vec.Hi));
+#endif
+}
+
+/**
+ * Returns the minimum values of two vectors (component-wise).
+ *
+ * @param Vec1	1st vector
+ * @param Vec2	2nd vector
+ * @return		VectorRegister8Float( min(Vec1[i], Vec2[i]) )
+ */
+FORCEINLINE VectorRegister8Float VectorMin(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	return _mm256_min_ps(Vec1, Vec2);
+#else
+	return VectorRegister8Float(VectorMin(Vec1.Lo, Vec2.Lo), VectorMin(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+FORCEINLINE VectorRegister8Double VectorMin(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	return _mm512_min_pd(Vec1, Vec2);
+#else
+	return VectorRegister8Double(VectorMin(Vec1.Lo, Vec2.Lo), VectorMin(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+/**
+ * Returns the maximum values of two vectors (component-wise).
+ *
+ * @param Vec1	1st vector
+ * @param Vec2	2nd vector
+ * @return		VectorRegister8Float( max(Vec1[i], Vec2[i]) )
+ */
+FORCEINLINE VectorRegister8Float VectorMax(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	return _mm256_max_ps(Vec1, Vec2);
+#else
+	return VectorRegister8Float(VectorMax(Vec1.Lo, Vec2.Lo), VectorMax(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+FORCEINLINE VectorRegister8Double VectorMax(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	return _mm512_max_pd(Vec1, Vec2);
+#else
+	return VectorRegister8Double(VectorMax(Vec1.Lo, Vec2.Lo), VectorMax(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+/**
+ * Return the square root of each component
+ *
+ * @param Vec	Vector
+ * @return		VectorRegister8Float( sqrt(Vec[i]) )
+ */
+FORCEINLINE VectorRegister8Float VectorSqrt(const VectorRegister8Float& Vec)
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	return _mm256_sqrt_ps(Vec);
+#else
+	return VectorRegister8Float(VectorSqrt(Vec.Lo), VectorSqrt(Vec.Hi));
+#endif
+}
+
+FORCEINLINE VectorRegister8Double VectorSqrt(const VectorRegister8Double& Vec)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	return _mm512_sqrt_pd(Vec);
+#else
+	return VectorRegister8Double(VectorSqrt(Vec.Lo), VectorSqrt(Vec.Hi));
+#endif
+}
+
+/**
+ * Return the reciprocal of the square root of each component
+ *
+ * @param Vec	Vector
+ * @return		VectorRegister8Float( 1/sqrt(Vec[i]) )
+ */
+FORCEINLINE VectorRegister8Float VectorReciprocalSqrt(const VectorRegister8Float& Vec)
+{
+	// Same full precision divide as the 4-wide version, the hardware estimate differs between vendors.
+	return VectorDivide(VectorSet8Float1(1.0f), VectorSqrt(Vec));
+}
+
+FORCEINLINE VectorRegister8Double VectorReciprocalSqrt(const VectorRegister8Double& Vec)
+{
+	return VectorDivide(VectorSet8Double1(1.0), VectorSqrt(Vec));
+}
+
+/**
+ * Returns an estimate of 1/sqrt(c) for each component of the vector
+ *
+ * @param Vec	Vector
+ * @return		VectorRegister8Float( 1/sqrt(Vec[i]) )
+ */
+FORCEINLINE VectorRegister8Float VectorReciprocalSqrtEstimate(const VectorRegister8Float& Vec)
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	// Warning: Discrepancies between Intel and AMD hardware estimates make this diverge between platforms.
+	return _mm256_rsqrt_ps(Vec);
+#else
+	return VectorRegister8Float(VectorReciprocalSqrtEstimate(Vec.Lo), VectorReciprocalSqrtEstimate(Vec.Hi));
+#endif
+}
+
+FORCEINLINE VectorRegister8Double VectorReciprocalSqrtEstimate(const VectorRegister8Double& Vec)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	return VectorReciprocalSqrt(Vec);
+#else
+	return VectorRegister8Double(VectorReciprocalSqrtEstimate(Vec.Lo), VectorReciprocalSqrtEstimate(Vec.Hi));
+#endif
+}
+
+/**
+ * Creates an eight-part mask based on component-wise == compares of the input vectors
+ *
+ * @param Vec1	1st vector
+ * @param Vec2	2nd vector
+ * @return		VectorRegister8Float( Vec1[i] == Vec2[i] ? 0xFFFFFFFF : 0 )
+ */
+FORCEINLINE VectorRegister8Float VectorCompareEQ(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	return _mm256_cmp_ps(Vec1, Vec2, _CMP_EQ_OQ);
+#else
+	return VectorRegister8Float(VectorCompareEQ(Vec1.Lo, Vec2.Lo), VectorCompareEQ(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+FORCEINLINE VectorRegister8Double VectorCompareEQ(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	return SSEVectorHelperFuncs::InternalMaskToVector8Double(_mm512_cmp_pd_mask(Vec1, Vec2, _CMP_EQ_OQ));
+#else
+	return VectorRegister8Double(VectorCompareEQ(Vec1.Lo, Vec2.Lo), VectorCompareEQ(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+/**
+ * Creates an eight-part mask based on component-wise != compares of the input vectors, true when either input is NaN
+ *
+ * @param Vec1	1st vector
+ * @param Vec2	2nd vector
+ * @return		VectorRegister8Float( Vec1[i] != Vec2[i] ? 0xFFFFFFFF : 0 )
+ */
+FORCEINLINE VectorRegister8Float VectorCompareNE(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	return _mm256_cmp_ps(Vec1, Vec2, _CMP_NEQ_UQ);
+#else
+	return VectorRegister8Float(VectorCompareNE(Vec1.Lo, Vec2.Lo), VectorCompareNE(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+FORCEINLINE VectorRegister8Double VectorCompareNE(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	return SSEVectorHelperFuncs::InternalMaskToVector8Double(_mm512_cmp_pd_mask(Vec1, Vec2, _CMP_NEQ_UQ));
+#else
+	return VectorRegister8Double(VectorCompareNE(Vec1.Lo, Vec2.Lo), VectorCompareNE(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+/**
+ * Creates an eight-part mask based on component-wise > compares of the input vectors
+ *
+ * @param Vec1	1st vector
+ * @param Vec2	2nd vector
+ * @return		VectorRegister8Float( Vec1[i] > Vec2[i] ? 0xFFFFFFFF : 0 )
+ */
+FORCEINLINE VectorRegister8Float VectorCompareGT(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	return _mm256_cmp_ps(Vec1, Vec2, _CMP_GT_OQ);
+#else
+	return VectorRegister8Float(VectorCompareGT(Vec1.Lo, Vec2.Lo), VectorCompareGT(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+FORCEINLINE VectorRegister8Double VectorCompareGT(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	return SSEVectorHelperFuncs::InternalMaskToVector8Double(_mm512_cmp_pd_mask(Vec1, Vec2, _CMP_GT_OQ));
+#else
+	return VectorRegister8Double(VectorCompareGT(Vec1.Lo, Vec2.Lo), VectorCompareGT(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+/**
+ * Creates an eight-part mask based on component-wise >= compares of the input vectors
+ *
+ * @param Vec1	1st vector
+ * @param Vec2	2nd vector
+ * @return		VectorRegister8Float( Vec1[i] >= Vec2[i] ? 0xFFFFFFFF : 0 )
+ */
+FORCEINLINE VectorRegister8Float VectorCompareGE(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	return _mm256_cmp_ps(Vec1, Vec2, _CMP_GE_OQ);
+#else
+	return VectorRegister8Float(VectorCompareGE(Vec1.Lo, Vec2.Lo), VectorCompareGE(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+FORCEINLINE VectorRegister8Double VectorCompareGE(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	return SSEVectorHelperFuncs::InternalMaskToVector8Double(_mm512_cmp_pd_mask(Vec1, Vec2, _CMP_GE_OQ));
+#else
+	return VectorRegister8Double(VectorCompareGE(Vec1.Lo, Vec2.Lo), VectorCompareGE(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+/**
+ * Creates an eight-part mask based on component-wise < compares of the input vectors
+ *
+ * @param Vec1	1st vector
+ * @param Vec2	2nd vector
+ * @return		VectorRegister8Float( Vec1[i] < Vec2[i] ? 0xFFFFFFFF : 0 )
+ */
+FORCEINLINE VectorRegister8Float VectorCompareLT(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	return _mm256_cmp_ps(Vec1, Vec2, _CMP_LT_OQ);
+#else
+	return VectorRegister8Float(VectorCompareLT(Vec1.Lo, Vec2.Lo), VectorCompareLT(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+FORCEINLINE VectorRegister8Double VectorCompareLT(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	return SSEVectorHelperFuncs::InternalMaskToVector8Double(_mm512_cmp_pd_mask(Vec1, Vec2, _CMP_LT_OQ));
+#else
+	return VectorRegister8Double(VectorCompareLT(Vec1.Lo, Vec2.Lo), VectorCompareLT(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+/**
+ * Creates an eight-part mask based on component-wise <= compares of the input vectors
+ *
+ * @param Vec1	1st vector
+ * @param Vec2	2nd vector
+ * @return		VectorRegister8Float( Vec1[i] <= Vec2[i] ? 0xFFFFFFFF : 0 )
+ */
+FORCEINLINE VectorRegister8Float VectorCompareLE(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	return _mm256_cmp_ps(Vec1, Vec2, _CMP_LE_OQ);
+#else
+	return VectorRegister8Float(VectorCompareLE(Vec1.Lo, Vec2.Lo), VectorCompareLE(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+FORCEINLINE VectorRegister8Double VectorCompareLE(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	return SSEVectorHelperFuncs::InternalMaskToVector8Double(_mm512_cmp_pd_mask(Vec1, Vec2, _CMP_LE_OQ));
+#else
+	return VectorRegister8Double(VectorCompareLE(Vec1.Lo, Vec2.Lo), VectorCompareLE(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+/**
+ * Does a bitwise vector selection based on a mask (e.g., created from VectorCompareXX)
+ *
+ * @param Mask  Mask (when 1: use the corresponding bit from Vec1 otherwise from Vec2)
+ * @param Vec1	1st vector
+ * @param Vec2	2nd vector
+ * @return		VectorRegister8Float( for each bit i: Mask[i] ? Vec1[i] : Vec2[i] )
+ */
+FORCEINLINE VectorRegister8Float VectorSelect(const VectorRegister8Float& Mask, const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512_VL
+	return _mm256_castsi256_ps(_mm256_ternarylogic_epi32(_mm256_castps_si256(Mask), _mm256_castps_si256(Vec1), _mm256_castps_si256(Vec2), 0xCA));
+#elif UE_PLATFORM_MATH_USE_AVX
+	return _mm256_xor_ps(Vec2, _mm256_and_ps(Mask, _mm256_xor_ps(Vec1, Vec2)));
+#else
+	return VectorRegister8Float(VectorSelect(Mask.Lo, Vec1.Lo, Vec2.Lo), VectorSelect(Mask.Hi, Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+FORCEINLINE VectorRegister8Double VectorSelect(const VectorRegister8Double& Mask, const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	return _mm512_castsi512_pd(_mm512_ternarylogic_epi64(_mm512_castpd_si512(Mask), _mm512_castpd_si512(Vec1), _mm512_castpd_si512(Vec2), 0xCA));
+#else
+	return VectorRegister8Double(VectorSelect(Mask.Lo, Vec1.Lo, Vec2.Lo), VectorSelect(Mask.Hi, Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+/**
+ * Combines two vectors using bitwise AND (treating each vector as a 256 or 512 bit field)
+ *
+ * @param Vec1	1st vector
+ * @param Vec2	2nd vector
+ * @return		VectorRegister8Float( for each bit i: Vec1[i] & Vec2[i] )
+ */
+FORCEINLINE VectorRegister8Float VectorBitwiseAnd(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	return _mm256_and_ps(Vec1, Vec2);
+#else
+	return VectorRegister8Float(VectorBitwiseAnd(Vec1.Lo, Vec2.Lo), VectorBitwiseAnd(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+FORCEINLINE VectorRegister8Double VectorBitwiseAnd(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	return _mm512_castsi512_pd(_mm512_and_si512(_mm512_castpd_si512(Vec1), _mm512_castpd_si512(Vec2)));
+#else
+	return VectorRegister8Double(VectorBitwiseAnd(Vec1.Lo, Vec2.Lo), VectorBitwiseAnd(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+/**
+ * Combines two vectors using bitwise OR (treating each vector as a 256 or 512 bit field)
+ *
+ * @param Vec1	1st vector
+ * @param Vec2	2nd vector
+ * @return		VectorRegister8Float( for each bit i: Vec1[i] | Vec2[i] )
+ */
+FORCEINLINE VectorRegister8Float VectorBitwiseOr(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	return _mm256_or_ps(Vec1, Vec2);
+#else
+	return VectorRegister8Float(VectorBitwiseOr(Vec1.Lo, Vec2.Lo), VectorBitwiseOr(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+FORCEINLINE VectorRegister8Double VectorBitwiseOr(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	return _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(Vec1), _mm512_castpd_si512(Vec2)));
+#else
+	return VectorRegister8Double(VectorBitwiseOr(Vec1.Lo, Vec2.Lo), VectorBitwiseOr(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+/**
+ * Combines two vectors using bitwise XOR (treating each vector as a 256 or 512 bit field)
+ *
+ * @param Vec1	1st vector
+ * @param Vec2	2nd vector
+ * @return		VectorRegister8Float( for each bit i: Vec1[i] ^ Vec2[i] )
+ */
+FORCEINLINE VectorRegister8Float VectorBitwiseXor(const VectorRegister8Float& Vec1, const VectorRegister8Float& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	return _mm256_xor_ps(Vec1, Vec2);
+#else
+	return VectorRegister8Float(VectorBitwiseXor(Vec1.Lo, Vec2.Lo), VectorBitwiseXor(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+FORCEINLINE VectorRegister8Double VectorBitwiseXor(const VectorRegister8Double& Vec1, const VectorRegister8Double& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	return _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(Vec1), _mm512_castpd_si512(Vec2)));
+#else
+	return VectorRegister8Double(VectorBitwiseXor(Vec1.Lo, Vec2.Lo), VectorBitwiseXor(Vec1.Hi, Vec2.Hi));
+#endif
+}
+
+/**
+ * Returns an integer bit-mask (0x00 - 0xff) based on the sign-bit for each component in a vector.
+ *
+ * @param VecMask	Vector
+ * @return			Bit i = sign(VecMask[i])
+ */
+FORCEINLINE int VectorMaskBits(const VectorRegister8Float& VecMask)
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	return _mm256_movemask_ps(VecMask);
+#else
+	return (VectorMaskBits(VecMask.Hi) << 4) | VectorMaskBits(VecMask.Lo);
+#endif
+}
+
+FORCEINLINE int VectorMaskBits(const VectorRegister8Double& VecMask)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	// A signed compare against zero picks up the sign bits without needing AVX-512DQ.
+	return _mm512_cmplt_epi64_mask(_mm512_castpd_si512(VecMask), _mm512_setzero_si512());
+#else
+	return (VectorMaskBits(VecMask.Hi) << 4) | VectorMaskBits(VecMask.Lo);
+#endif
+}
+
+/**
+ * Returns the sum of all 8 components. The summation order is fixed, ((V0 + V4) + (V2 + V6)) + ((V1 + V5) + (V3 + V7)),
+ * so the result does not depend on which instruction set the build targets.
+ *
+ * @param Vec	Vector to reduce
+ * @return		Vec[0] + Vec[1] + ... + Vec[7]
+ */
+FORCEINLINE float VectorReduceAdd(const VectorRegister8Float& Vec)
+{
+	return SSEVectorHelperFuncs::InternalVectorReduceAdd(VectorAdd(Vec.GetLo(), Vec.GetHi()));
+}
+
+FORCEINLINE double VectorReduceAdd(const VectorRegister8Double& Vec)
+{
+	return SSEVectorHelperFuncs::InternalVectorReduceAdd(VectorAdd(Vec.GetLo(), Vec.GetHi()));
+}
+
+/**
+ * Returns the smallest of all 8 components.
+ *
+ * @param Vec	Vector to reduce
+ * @return		min(Vec[0], Vec[1], ..., Vec[7])
+ */
+FORCEINLINE float VectorReduceMin(const VectorRegister8Float& Vec)
+{
+	return SSEVectorHelperFuncs::InternalVectorReduceMin(VectorMin(Vec.GetLo(), Vec.GetHi()));
+}
+
+FORCEINLINE double VectorReduceMin(const VectorRegister8Double& Vec)
+{
+	return SSEVectorHelperFuncs::InternalVectorReduceMin(VectorMin(Vec.GetLo(), Vec.GetHi()));
+}
+
+/**
+ * Returns the largest of all 8 components.
+ *
+ * @param Vec	Vector to reduce
+ * @return		max(Vec[0], Vec[1], ..., Vec[7])
+ */
+FORCEINLINE float VectorReduceMax(const VectorRegister8Float& Vec)
+{
+	return SSEVectorHelperFuncs::InternalVectorReduceMax(VectorMax(Vec.GetLo(), Vec.GetHi()));
+}
+
+FORCEINLINE double VectorReduceMax(const VectorRegister8Double& Vec)
+{
+	return SSEVectorHelperFuncs::InternalVectorReduceMax(VectorMax(Vec.GetLo(), Vec.GetHi()));
+}
+
+/**
+ * Transposes the 8x8 matrix held in Rows, so that afterwards Rows[N] holds component N of each of the original rows.
+ *
+ * @param Rows	Rows of the matrix, replaced by its columns
+ */
+FORCEINLINE void VectorTranspose8x8(VectorRegister8Float (&Rows)[8])
+{
+#if UE_PLATFORM_MATH_USE_AVX
+	// 4x4 transposes within each 128-bit lane, then one lane swap per output row.
+	const __m256 T0 = _mm256_unpacklo_ps(Rows[0].Value, Rows[1].Value);
+	const __m256 T1 = _mm256_unpackhi_ps(Rows[0].Value, Rows[1].Value);
+	const __m256 T2 = _mm256_unpacklo_ps(Rows[2].Value, Rows[3].Value);
+	const __m256 T3 = _mm256_unpackhi_ps(Rows[2].Value, Rows[3].Value);
+	const __m256 T4 = _mm256_unpacklo_ps(Rows[4].Value, Rows[5].Value);
+	const __m256 T5 = _mm256_unpackhi_ps(Rows[4].Value, Rows[5].Value);
+	const __m256 T6 = _mm256_unpacklo_ps(Rows[6].Value, Rows[7].Value);
+	const __m256 T7 = _mm256_unpackhi_ps(Rows[6].Value, Rows[7].Value);
+	const __m256 S0 = _mm256_shuffle_ps(T0, T2, _MM_SHUFFLE(1, 0, 1, 0));
+	const __m256 S1 = _mm256_shuffle_ps(T0, T2, _MM_SHUFFLE(3, 2, 3, 2));
+	const __m256 S2 = _mm256_shuffle_ps(T1, T3, _MM_SHUFFLE(1, 0, 1, 0));
+	const __m256 S3 = _mm256_shuffle_ps(T1, T3, _MM_SHUFFLE(3, 2, 3, 2));
+	const __m256 S4 = _mm256_shuffle_ps(T4, T6, _MM_SHUFFLE(1, 0, 1, 0));
+	const __m256 S5 = _mm256_shuffle_ps(T4, T6, _MM_SHUFFLE(3, 2, 3, 2));
+	const __m256 S6 = _mm256_shuffle_ps(T5, T7, _MM_SHUFFLE(1, 0, 1, 0));
+	const __m256 S7 = _mm256_shuffle_ps(T5, T7, _MM_SHUFFLE(3, 2, 3, 2));
+	Rows[0].Value = _mm256_permute2f128_ps(S0, S4, 0x20);
+	Rows[1].Value = _mm256_permute2f128_ps(S1, S5, 0x20);
+	Rows[2].Value = _mm256_permute2f128_ps(S2, S6, 0x20);
+	Rows[3].Value = _mm256_permute2f128_ps(S3, S7, 0x20);
+	Rows[4].Value = _mm256_permute2f128_ps(S0, S4, 0x31);
+	Rows[5].Value = _mm256_permute2f128_ps(S1, S5, 0x31);
+	Rows[6].Value = _mm256_permute2f128_ps(S2, S6, 0x31);
+	Rows[7].Value = _mm256_permute2f128_ps(S3, S7, 0x31);
+#else
+	// Transpose the four 4x4 blocks, then swap the two off-diagonal ones.
+	VectorTranspose4x4(Rows[0].Lo, Rows[1].Lo, Rows[2].Lo, Rows[3].Lo);
+	VectorTranspose4x4(Rows[0].Hi, Rows[1].Hi, Rows[2].Hi, Rows[3].Hi);
+	VectorTranspose4x4(Rows[4].Lo, Rows[5].Lo, Rows[6].Lo, Rows[7].Lo);
+	VectorTranspose4x4(Rows[4].Hi, Rows[5].Hi, Rows[6].Hi, Rows[7].Hi);
+	for (int32 Row = 0; Row < 4; ++Row)
+	{
+		const VectorRegister4Float Block = Rows[Row].Hi;
+		Rows[Row].Hi = Rows[Row + 4].Lo;
+		Rows[Row + 4].Lo = Block;
+	}
+#endif
+}
+
+FORCEINLINE void VectorTranspose8x8(VectorRegister8Double (&Rows)[8])
+{
+#if UE_PLATFORM_MATH_USE_AVX_512
+	// T0 pairs element 2N of rows 0 and 1 in 128-bit lane N, T1 element 2N + 1. Two rounds of lane shuffles then
+	// collect lane N of T0, T2, T4 and T6 into row 2N and of T1, T3, T5 and T7 into row 2N + 1.
+	const __m512d T0 = _mm512_unpacklo_pd(Rows[0].Value, Rows[1].Value);
+	const __m512d T1 = _mm512_unpackhi_pd(Rows[0].Value, Rows[1].Value);
+	const __m512d T2 = _mm512_unpacklo_pd(Rows[2].Value, Rows[3].Value);
+	const __m512d T3 = _mm512_unpackhi_pd(Rows[2].Value, Rows[3].Value);
+	const __m512d T4 = _mm512_unpacklo_pd(Rows[4].Value, Rows[5].Value);
+	const __m512d T5 = _mm512_unpackhi_pd(Rows[4].Value, Rows[5].Value);
+	const __m512d T6 = _mm512_unpacklo_pd(Rows[6].Value, Rows[7].Value);
+	const __m512d T7 = _mm512_unpackhi_pd(Rows[6].Value, Rows[7].Value);
+	const __m512d S0 = _mm512_shuffle_f64x2(T0, T2, _MM_SHUFFLE(1, 0, 1, 0));
+	const __m512d S1 = _mm512_shuffle_f64x2(T1, T3, _MM_SHUFFLE(1, 0, 1, 0));
+	const __m512d S2 = _mm512_shuffle_f64x2(T0, T2, _MM_SHUFFLE(3, 2, 3, 2));
+	const __m512d S3 = _mm512_shuffle_f64x2(T1, T3, _MM_SHUFFLE(3, 2, 3, 2));
+	const __m512d S4 = _mm512_shuffle_f64x2(T4, T6, _MM_SHUFFLE(1, 0, 1, 0));
+	const __m512d S5 = _mm512_shuffle_f64x2(T5, T7, _MM_SHUFFLE(1, 0, 1, 0));
+	const __m512d S6 = _mm512_shuffle_f64x2(T4, T6, _MM_SHUFFLE(3, 2, 3, 2));
+	const __m512d S7 = _mm512_shuffle_f64x2(T5, T7, _MM_SHUFFLE(3, 2, 3, 2));
+	Rows[0].Value = _mm512_shuffle_f64x2(S0, S4, _MM_SHUFFLE(2, 0, 2, 0));
+	Rows[1].Value = _mm512_shuffle_f64x2(S1, S5, _MM_SHUFFLE(2, 0, 2, 0));
+	Rows[2].Value = _mm512_shuffle_f64x2(S0, S4, _MM_SHUFFLE(3, 1, 3, 1));
+	Rows[3].Value = _mm512_shuffle_f64x2(S1, S5, _MM_SHUFFLE(3, 1, 3, 1));
+	Rows[4].Value = _mm512_shuffle_f64x2(S2, S6, _MM_SHUFFLE(2, 0, 2, 0));
+	Rows[5].Value = _mm512_shuffle_f64x2(S3, S7, _MM_SHUFFLE(2, 0, 2, 0));
+	Rows[6].Value = _mm512_shuffle_f64x2(S2, S6, _MM_SHUFFLE(3, 1, 3, 1));
+	Rows[7].Value = _mm512_shuffle_f64x2(S3, S7, _MM_SHUFFLE(3, 1, 3, 1));
+#else
+	VectorTranspose4x4(Rows[0].Lo, Rows[1].Lo, Rows[2].Lo, Rows[3].Lo);
+	VectorTranspose4x4(Rows[0].Hi, Rows[1].Hi, Rows[2].Hi, Rows[3].Hi);
+	VectorTranspose4x4(Rows[4].Lo, Rows[5].Lo, Rows[6].Lo, Rows[7].Lo);
+	VectorTranspose4x4(Rows[4].Hi, Rows[5].Hi, Rows[6].Hi, Rows[7].Hi);
+	for (int32 Row = 0; Row < 4; ++Row)
+	{
+		const VectorRegister4Double Block = Rows[Row].Hi;
+		Rows[Row].Hi = Rows[Row + 4].Lo;
+		Rows[Row + 4].Lo = Block;
+	}
+#endif
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//Integer ops
+
+//Bitwise
+/** = a & b */
+#define VectorIntAnd(A, B)		_mm_and_si128(A, B)
+/** = a | b */
+#define VectorIntOr(A, B)		_mm_or_si128(A, B)
+/** = a ^ b */
+#define VectorIntXor(A, B)		_mm_xor_si128(A, B)
+/** = (~a) & b */
+#define VectorIntAndNot(A, B)	_mm_andnot_si128(A, B)
+/** = ~a */
+FORCEINLINE VectorRegister4Int VectorIntNot(const VectorRegister4Int& A)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512_VL
+	// vpternlog with truth table 0x55 (~A) avoids loading the all-ones constant.
+	return _mm_ternarylogic_epi32(A, A, A, 0x55);
+#else
+	return _mm_xor_si128(A, GlobalVectorConstants::IntAllMask);
+#endif
+}
+
+//Comparison
+#define VectorIntCompareEQ(A, B)	_mm_cmpeq_epi32(A,B)
+#define VectorIntCompareNEQ(A, B)	VectorIntNot(_mm_cmpeq_epi32(A,B))
+#define VectorIntCompareGT(A, B)	_mm_cmpgt_epi32(A,B)
+#define VectorIntCompareLT(A, B)	_mm_cmplt_epi32(A,B)
+#define VectorIntCompareGE(A, B)	VectorIntNot(VectorIntCompareLT(A,B))
+#define VectorIntCompareLE(A, B)	VectorIntNot(VectorIntCompareGT(A,B))
+
+
+FORCEINLINE VectorRegister4Int VectorIntSelect(const VectorRegister4Int& Mask, const VectorRegister4Int& Vec1, const VectorRegister4Int& Vec2)
+{
+#if UE_PLATFORM_MATH_USE_AVX_512_VL
+	return _mm_ternarylogic_epi32(Mask, Vec1, Vec2, 0xCA);
+#else
+	return _mm_xor_si128(Vec2, _mm_and_si128(Mask, _mm_xor_si128(Vec1, Vec2)));
+#endif
 }
 
 //Arithmetic